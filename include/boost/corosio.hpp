@@ -10,16 +10,26 @@
 #ifndef BOOST_COROSIO_HPP
 #define BOOST_COROSIO_HPP
 
+#include <boost/corosio/aligned_allocator.hpp>
 #include <boost/corosio/backend.hpp>
 #include <boost/corosio/cancel.hpp>
 #include <boost/corosio/connect.hpp>
+#include <boost/corosio/copy_file.hpp>
+#include <boost/corosio/dns_resolver.hpp>
 #include <boost/corosio/endpoint.hpp>
 #include <boost/corosio/file_base.hpp>
+#include <boost/corosio/filesystem.hpp>
+#include <boost/corosio/group_commit_file.hpp>
 #include <boost/corosio/host_name.hpp>
 #include <boost/corosio/io_context.hpp>
 #include <boost/corosio/ipv4_address.hpp>
 #include <boost/corosio/ipv6_address.hpp>
+#include <boost/corosio/mapped_file.hpp>
+#include <boost/corosio/multicast_receiver.hpp>
 #include <boost/corosio/random_access_file.hpp>
+#include <boost/corosio/read_ahead_file.hpp>
+#include <boost/corosio/relay.hpp>
+#include <boost/corosio/resolve_many.hpp>
 #include <boost/corosio/resolver.hpp>
 #include <boost/corosio/resolver_results.hpp>
 #include <boost/corosio/signal_set.hpp>
@@ -30,19 +40,29 @@
 #include <boost/corosio/tcp_socket.hpp>
 #include <boost/corosio/timer.hpp>
 #include <boost/corosio/udp_socket.hpp>
+#include <boost/corosio/udp_socket_group.hpp>
 
 #include <boost/corosio/local_connect_pair.hpp>
 #include <boost/corosio/local_endpoint.hpp>
 #include <boost/corosio/local_stream.hpp>
 #include <boost/corosio/local_stream_socket.hpp>
 #include <boost/corosio/local_stream_acceptor.hpp>
+#include <boost/corosio/shm_channel.hpp>
 
-// local_datagram.hpp and local_datagram_socket.hpp are POSIX-only;
-// Windows does not support AF_UNIX datagram sockets (SOCK_DGRAM).
+// The local datagram and seqpacket headers are POSIX-only; Windows
+// does not support AF_UNIX SOCK_DGRAM or SOCK_SEQPACKET sockets.
 #include <boost/corosio/detail/platform.hpp>
 #if BOOST_COROSIO_POSIX
 #include <boost/corosio/local_datagram.hpp>
 #include <boost/corosio/local_datagram_socket.hpp>
+#include <boost/corosio/local_seqpacket.hpp>
+#include <boost/corosio/local_seqpacket_socket.hpp>
+#include <boost/corosio/local_seqpacket_acceptor.hpp>
+#endif
+
+// Child processes are observed through pidfds, which only Linux has.
+#if BOOST_COROSIO_HAS_EPOLL
+#include <boost/corosio/process.hpp>
 #endif
 
 #include <boost/corosio/tls_context.hpp>
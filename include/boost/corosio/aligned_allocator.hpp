@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_ALIGNED_ALLOCATOR_HPP
+#define BOOST_COROSIO_ALIGNED_ALLOCATOR_HPP
+
+#include <boost/corosio/detail/config.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace boost::corosio {
+
+/** An allocator returning storage aligned for direct file I/O.
+
+    Files opened with @ref file_base::direct transfer data straight
+    between the device and the caller's memory, which must start on
+    a logical block boundary. The default alignment of 4096 bytes
+    satisfies every device with logical blocks up to 4 KiB.
+
+    Transfer lengths must be block multiples as well, so size
+    containers in whole blocks.
+
+    @tparam T The element type.
+    @tparam Alignment The byte alignment, a power of two no smaller
+        than `alignof(T)`.
+
+    @par Example
+    @code
+    std::vector<char, aligned_allocator<char>> buf(64 * 1024);
+
+    random_access_file f(ioc);
+    f.open("table.db", file_base::read_only | file_base::direct);
+    auto [ec, n] = co_await f.read_some_at(
+        0, capy::mutable_buffer(buf.data(), buf.size()));
+    @endcode
+*/
+template<class T, std::size_t Alignment = 4096>
+class aligned_allocator
+{
+    static_assert(
+        (Alignment & (Alignment - 1)) == 0,
+        "Alignment must be a power of two");
+    static_assert(
+        Alignment >= alignof(T), "Alignment must be at least alignof(T)");
+
+public:
+    /// The element type.
+    using value_type = T;
+
+    /// Allocators of the same alignment are interchangeable.
+    using is_always_equal = std::true_type;
+
+    /// Rebind to another element type with the same alignment.
+    template<class U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    /// The byte alignment of every allocation.
+    static constexpr std::size_t alignment = Alignment;
+
+    /// Construct an allocator.
+    constexpr aligned_allocator() noexcept = default;
+
+    /// Construct from an allocator for another element type.
+    template<class U>
+    constexpr aligned_allocator(
+        aligned_allocator<U, Alignment> const&) noexcept
+    {
+    }
+
+    /** Allocate storage for @p n objects.
+
+        @throws std::bad_array_new_length if the size overflows.
+        @throws std::bad_alloc on allocation failure.
+    */
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if (n > (std::numeric_limits<std::size_t>::max)() / sizeof(T))
+            throw std::bad_array_new_length();
+        return static_cast<T*>(::operator new(
+            n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    /// Release storage obtained from @ref allocate.
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        ::operator delete(p, n * sizeof(T), std::align_val_t(Alignment));
+    }
+
+    template<class U>
+    friend constexpr bool operator==(
+        aligned_allocator const&,
+        aligned_allocator<U, Alignment> const&) noexcept
+    {
+        return true;
+    }
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_COPY_FILE_HPP
+#define BOOST_COROSIO_COPY_FILE_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/random_access_file.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace boost::corosio {
+
+/// A byte range to copy from one file to another.
+struct copy_range
+{
+    /// Offset of the first byte in the source file.
+    std::uint64_t src_offset = 0;
+
+    /// Offset the first byte is written to in the destination file.
+    std::uint64_t dst_offset = 0;
+
+    /// Number of bytes to copy.
+    std::uint64_t length = 0;
+};
+
+/** Copy byte ranges between two files.
+
+    Copies each range in order, splitting it into chunks of at
+    most @p chunk_size bytes. On Linux each chunk is one
+    `copy_file_range` call on the thread pool, so the data never
+    passes through user memory and filesystems that support it
+    share extents instead of copying them (reflinks on Btrfs and
+    XFS, server-side copy on NFS). Where the kernel cannot copy
+    between the two files, and on other platforms, chunks go
+    through a buffer of @p chunk_size bytes using
+    `read_some_at` and `write_some_at`.
+
+    Cancellation is checked between chunks, so @p chunk_size
+    bounds how long a stop request waits.
+
+    @param src The file to read. Must be open for reading.
+    @param dst The file to write. Must be open for writing.
+    @param ranges The ranges to copy. Must remain valid until the
+        operation completes.
+    @param chunk_size The largest amount copied in one step.
+
+    @return An awaitable completing with
+        `io_result<std::uint64_t>`, the total bytes copied. The
+        copy stops at the first error. A range that extends past
+        the end of the source completes with `capy::error::eof`.
+
+    @throws std::logic_error if either file is not open.
+    @throws std::invalid_argument if @p chunk_size is zero.
+
+    @par Example
+    @code
+    // Compaction: gather live records into a new segment
+    std::vector<copy_range> live = collect_live_records();
+    auto [ec, n] = co_await copy_file(old_seg, new_seg, live);
+    @endcode
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<std::uint64_t>>
+copy_file(
+    random_access_file& src,
+    random_access_file& dst,
+    std::span<copy_range const> ranges,
+    std::size_t chunk_size = 1024 * 1024);
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_COPY_FILE_HPP
@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_DATAGRAM_INFO_HPP
+#define BOOST_COROSIO_DATAGRAM_INFO_HPP
+
+#include <boost/corosio/endpoint.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace boost::corosio {
+
+/** Per-datagram ancillary data.
+
+    Filled by `udp_socket::recv_msg` from the control messages the
+    kernel attaches to a datagram, and read by `udp_socket::send_msg`
+    to choose the source address and traffic class of an outgoing
+    datagram.
+
+    Each group of fields is guarded by a `has_` flag. On receive a
+    group is only present when the matching socket option is enabled:
+
+    @li Local address and interface: `receive_packet_info_v4` or
+        `receive_packet_info_v6` (`IP_PKTINFO`, `IPV6_RECVPKTINFO`).
+    @li Timestamp: `receive_timestamp` (`SO_TIMESTAMPNS`).
+    @li Traffic class: `receive_tos_v4` or `receive_tclass_v6`
+        (`IP_RECVTOS`, `IPV6_RECVTCLASS`).
+    @li Drop counter: `receive_drop_count` (`SO_RXQ_OVFL`, Linux).
+
+    The struct is a plain value; nothing is allocated per datagram.
+
+    @par Example
+    @code
+    datagram_info info;
+    endpoint peer;
+    auto [ec, n] = co_await sock.recv_msg(buf, peer, info);
+
+    // Reply from the address the request was sent to.
+    auto [ec2, m] = co_await sock.send_msg(reply, peer, info);
+    @endcode
+*/
+struct datagram_info
+{
+    /** Local address the datagram was sent to.
+
+        On send, the source address to use. The port is ignored
+        (zero on receive).
+    */
+    endpoint local_address;
+
+    /** Index of the interface the datagram arrived on.
+
+        On send, the outgoing interface, or zero to let the
+        routing table decide.
+    */
+    unsigned interface_index = 0;
+
+    /// True when @ref local_address and @ref interface_index are set.
+    bool has_local_address = false;
+
+    /// True when @ref timestamp is set.
+    bool has_timestamp = false;
+
+    /// True when @ref tos is set.
+    bool has_tos = false;
+
+    /// True when @ref drops is set.
+    bool has_drops = false;
+
+    /** IPv4 type-of-service byte or IPv6 traffic class.
+
+        The low two bits are the ECN codepoint, see @ref ecn.
+    */
+    std::uint8_t tos = 0;
+
+    /** Datagrams dropped by the socket so far.
+
+        A cumulative counter of datagrams discarded because the
+        receive queue was full. Compare successive values to detect
+        loss between two receives.
+    */
+    std::uint32_t drops = 0;
+
+    /** Kernel receive timestamp.
+
+        Time since the Unix epoch (`CLOCK_REALTIME`) at which the
+        kernel received the datagram.
+    */
+    std::chrono::nanoseconds timestamp{};
+
+    /// Return the ECN codepoint carried in @ref tos.
+    std::uint8_t ecn() const noexcept
+    {
+        return static_cast<std::uint8_t>(tos & 0x03);
+    }
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_DATAGRAM_INFO_HPP
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_DATAGRAM_SLOT_HPP
+#define BOOST_COROSIO_DATAGRAM_SLOT_HPP
+
+#include <boost/corosio/datagram_info.hpp>
+#include <boost/corosio/endpoint.hpp>
+#include <boost/capy/buffers.hpp>
+
+#include <cstddef>
+
+namespace boost::corosio {
+
+/** Maximum number of datagrams transferred by one batch operation.
+
+    `udp_socket::recv_batch` and `udp_socket::send_batch` consider at
+    most this many slots per call. Extra slots are left untouched;
+    call the operation again to process them.
+*/
+inline constexpr std::size_t max_datagram_batch = 16;
+
+/** One datagram in a batched receive.
+
+    The caller fills in @ref buffer before the operation starts. On
+    completion, the first `n` slots (where `n` is the count returned
+    by the operation) hold the received size and source endpoint.
+
+    @see udp_socket::recv_batch
+*/
+struct datagram_slot
+{
+    /// Storage for the datagram payload. Owned by the caller.
+    capy::mutable_buffer buffer;
+
+    /// Source endpoint of the received datagram.
+    endpoint peer;
+
+    /// Number of bytes received into @ref buffer.
+    std::size_t size = 0;
+
+    /** Segment size of a coalesced receive.
+
+        Zero when @ref buffer holds a single datagram. When UDP
+        generic receive offload is enabled (`udp_gro`), the kernel
+        may merge consecutive datagrams from the same flow into one
+        buffer; this is then the size of each merged datagram, and
+        only the last one may be shorter.
+    */
+    std::size_t segment_size = 0;
+
+    /** Ancillary data of the received datagram.
+
+        Filled like `udp_socket::recv_msg` fills its
+        @ref datagram_info: a group is only present when the
+        matching socket option is enabled, so with
+        `receive_packet_info_v4` the destination address of each
+        datagram in the batch is available here.
+    */
+    datagram_info info;
+};
+
+/** One datagram in a batched send.
+
+    The caller fills in @ref buffer and @ref peer before the
+    operation starts. On completion, the first `n` slots (where `n`
+    is the count returned by the operation) hold the sent size.
+
+    @see udp_socket::send_batch
+*/
+struct const_datagram_slot
+{
+    /// The datagram payload. Owned by the caller.
+    capy::const_buffer buffer;
+
+    /// Destination endpoint. Ignored on a connected socket when
+    /// default-constructed.
+    endpoint peer;
+
+    /// Number of bytes sent from @ref buffer.
+    std::size_t size = 0;
+
+    /** Segment size for generic segmentation offload.
+
+        When non-zero, @ref buffer is sent as consecutive datagrams
+        of this size (the last may be shorter) with a single
+        `UDP_SEGMENT` send. All segments go to the same @ref peer.
+        Only Linux supports this; elsewhere the slot fails with
+        `std::errc::operation_not_supported`.
+    */
+    std::size_t segment_size = 0;
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_DATAGRAM_SLOT_HPP
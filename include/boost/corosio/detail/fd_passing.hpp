@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_DETAIL_FD_PASSING_HPP
+#define BOOST_COROSIO_DETAIL_FD_PASSING_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/native_handle.hpp>
+
+#include <cstddef>
+
+namespace boost::corosio {
+
+/** Maximum number of descriptors passed in one message.
+
+    Bounds `send_with_fds` and the storage that `recv_with_fds`
+    reserves inside its awaitable, so descriptor passing never
+    allocates.
+*/
+inline constexpr std::size_t max_passed_fds = 16;
+
+namespace detail {
+
+/* Raw SCM_RIGHTS control-message storage.
+
+   Lives inside the send/recv awaitables so the backend only moves
+   opaque bytes; encoding and decoding happen in the library where
+   platform headers are available. Sized for max_passed_fds ints
+   plus a generous cmsghdr allowance.
+*/
+struct fd_control_buffer
+{
+    alignas(std::max_align_t) unsigned char data[
+        max_passed_fds * sizeof(int) + 64];
+};
+
+/** Encode @p n descriptors as one SCM_RIGHTS control message.
+
+    @return The control length, or 0 when @p n is 0 or descriptor
+        passing is unsupported on this platform.
+*/
+BOOST_COROSIO_DECL std::size_t
+encode_passed_fds(
+    fd_control_buffer& buf,
+    native_handle_type const* fds,
+    std::size_t n) noexcept;
+
+/** Extract received descriptors from a control buffer.
+
+    Copies up to @p cap descriptors to @p out and closes any that
+    do not fit, so nothing leaks when the caller wants fewer (pass
+    @p cap of 0 to close them all). Marks each kept descriptor
+    close-on-exec where the kernel could not do so atomically.
+
+    @return The number of descriptors written to @p out.
+*/
+BOOST_COROSIO_DECL std::size_t
+decode_passed_fds(
+    fd_control_buffer const& buf,
+    std::size_t len,
+    native_handle_type* out,
+    std::size_t cap) noexcept;
+
+} // namespace detail
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_DETAIL_FD_PASSING_HPP
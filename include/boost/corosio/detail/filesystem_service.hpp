@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_DETAIL_FILESYSTEM_SERVICE_HPP
+#define BOOST_COROSIO_DETAIL_FILESYSTEM_SERVICE_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/filesystem.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+
+#include <coroutine>
+#include <filesystem>
+#include <stop_token>
+#include <system_error>
+
+namespace boost::corosio::detail {
+
+/// One path operation of @ref async_stat and its siblings.
+struct fs_request
+{
+    enum class kind
+    {
+        stat,
+        unlink,
+        rename,
+        mkdir
+    };
+
+    kind op = kind::stat;
+    std::filesystem::path const* path     = nullptr;
+    std::filesystem::path const* new_path = nullptr; // rename
+    std::filesystem::perms perms = std::filesystem::perms::all; // mkdir
+    file_status* status          = nullptr; // stat
+    std::error_code* ec          = nullptr;
+};
+
+/** Abstract service for kernel-native path operations.
+
+    Backends with asynchronous path syscalls (io_uring) register an
+    implementation. Without one, or when it declines a request,
+    the operation runs on the thread pool.
+*/
+class BOOST_COROSIO_DECL filesystem_service
+    : public capy::execution_context::service
+{
+public:
+    /// Identifies this service for `execution_context` lookup.
+    using key_type = filesystem_service;
+
+    /** Start a request.
+
+        On acceptance the coroutine is resumed through @p ex once
+        `*req.ec` (and `*req.status` for a stat) is set.
+
+        @return false if the request is not supported, in which
+            case nothing was started.
+    */
+    virtual bool submit(
+        fs_request& req,
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        std::stop_token const& token) = 0;
+
+protected:
+    filesystem_service()           = default;
+    ~filesystem_service() override = default;
+};
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_DETAIL_FILESYSTEM_SERVICE_HPP
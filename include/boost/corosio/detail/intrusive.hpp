@@ -222,6 +222,11 @@ public:
         other.tail_ = nullptr;
     }
 
+    T* front() const noexcept
+    {
+        return head_;
+    }
+
     T* pop() noexcept
     {
         if (!head_)
@@ -12,15 +12,17 @@
 
 #include <boost/corosio/detail/config.hpp>
 #include <boost/corosio/detail/intrusive.hpp>
+#include <boost/corosio/thread_pool_stats.hpp>
 #include <boost/capy/ex/execution_context.hpp>
 #include <boost/capy/test/thread_name.hpp>
 
+#include <chrono>
 #include <condition_variable>
 #include <cstdio>
+#include <list>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
-#include <vector>
 
 namespace boost::corosio::detail {
 
@@ -55,50 +57,121 @@ struct pool_work_item : intrusive_queue<pool_work_item>::node
 
     /// Completion handler invoked by the worker thread.
     func_type func_ = nullptr;
+
+    /// Set by @ref thread_pool::post for wait-time accounting.
+    std::chrono::steady_clock::time_point enqueued_;
 };
 
-/** Shared thread pool for dispatching blocking operations.
+/// Sizing and elasticity of one @ref thread_pool lane.
+struct thread_pool_lane_config
+{
+    /// Threads kept alive while idle. Started on first use.
+    unsigned min_threads = 1;
+
+    /// Upper bound on threads; growth stops here.
+    unsigned max_threads = 1;
+
+    /// Queue wait that triggers starting another thread.
+    std::chrono::microseconds grow_after{1000};
+
+    /// Idle time after which a thread above the minimum exits.
+    std::chrono::milliseconds idle_timeout{30000};
+};
 
-    Provides a fixed pool of reusable worker threads for operations
-    that cannot be integrated with async I/O (e.g. blocking DNS
-    calls). Registered as an `execution_context::service` so it
-    is a singleton per io_context.
+/** Shared thread pool for dispatching blocking operations.
 
-    Threads are created eagerly in the constructor. The default
-    thread count is 1.
+    Runs operations that cannot be integrated with async I/O
+    (blocking file reads, `getaddrinfo`) on worker threads.
+    Registered as an `execution_context::service` so it is a
+    singleton per io_context.
+
+    Work is split into lanes, one per @ref thread_pool_lane, each
+    with its own queue, condition variable and threads, so a
+    stalled DNS lookup cannot hold up queued file I/O. A lane
+    starts threads on demand up to its minimum, then grows by one
+    whenever no thread is idle and the oldest queued item has
+    waited longer than `grow_after`, up to its maximum. Threads
+    above the minimum exit after `idle_timeout` without work.
+
+    Growth is checked on every post and dequeue, and an elastic
+    lane (`max_threads > min_threads`) also keeps a monitor thread
+    that sleeps until the oldest queued item reaches `grow_after`.
+    A burst queued behind threads that are all blocked therefore
+    still grows the lane without waiting for another post.
 
     @par Thread Safety
     All public member functions are thread-safe.
 
     @par Shutdown
     Sets a shutdown flag, notifies all threads, and joins them.
-    In-flight blocking calls complete naturally before the thread
-    exits.
+    Queued work is drained and in-flight blocking calls complete
+    naturally before the threads exit.
 */
 class thread_pool final : public capy::execution_context::service
 {
+    static constexpr unsigned num_lanes = 2;
+
+    struct lane
+    {
+        thread_pool_lane_config cfg;
+        char const* name = "";
+        std::condition_variable cv;
+        intrusive_queue<pool_work_item> queue;
+        std::list<std::thread> threads;
+        std::thread monitor;
+        std::condition_variable monitor_cv;
+        unsigned next_index = 1;
+        thread_pool_stats stats;
+    };
+
     std::mutex mutex_;
-    std::condition_variable cv_;
-    intrusive_queue<pool_work_item> work_queue_;
-    std::vector<std::thread> threads_;
+    lane lanes_[num_lanes];
+    std::list<std::thread> exited_;
     bool shutdown_ = false;
 
-    void worker_loop(unsigned index);
+    void worker_loop(lane& l, std::list<std::thread>::iterator self);
+    void monitor_loop(lane& l);
+    bool start_thread(lane& l) noexcept;
+    void start_monitor(lane& l) noexcept;
+    void wake_monitor(lane& l) noexcept;
+    void maybe_grow(lane& l, std::chrono::steady_clock::time_point now) noexcept;
+    void reap_exited() noexcept;
+
+    lane& get(thread_pool_lane which) noexcept
+    {
+        return lanes_[static_cast<unsigned>(which)];
+    }
+
+    void configure(
+        thread_pool_lane_config const& file,
+        thread_pool_lane_config const& resolver)
+    {
+        auto check = [](thread_pool_lane_config const& c) {
+            if (!c.min_threads)
+                throw std::logic_error(
+                    "thread_pool requires at least 1 thread");
+            if (c.max_threads < c.min_threads)
+                throw std::logic_error(
+                    "thread_pool max_threads below min_threads");
+        };
+        check(file);
+        check(resolver);
+        get(thread_pool_lane::file).cfg      = file;
+        get(thread_pool_lane::file).name     = "tpool-file-";
+        get(thread_pool_lane::resolver).cfg  = resolver;
+        get(thread_pool_lane::resolver).name = "tpool-dns-";
+    }
 
 public:
     using key_type = thread_pool;
 
-    /** Construct the thread pool service.
+    /** Construct the thread pool service with fixed-size lanes.
 
-        Eagerly creates all worker threads.
-
-        @par Exception Safety
-        Strong guarantee. If thread creation fails, all
-        already-created threads are shut down and joined
-        before the exception propagates.
+        The file lane holds `num_threads` threads and the resolver
+        lane one, neither growing. Threads start on first use.
 
         @param ctx Reference to the owning execution_context.
-        @param num_threads Number of worker threads. Must be
+        @param num_threads Number of file-lane threads. Must be
                at least 1.
 
         @throws std::logic_error If `num_threads` is 0.
@@ -106,19 +179,28 @@ public:
     explicit thread_pool(capy::execution_context& ctx, unsigned num_threads = 1)
     {
         (void)ctx;
-        if (!num_threads)
-            throw std::logic_error("thread_pool requires at least 1 thread");
-        threads_.reserve(num_threads);
-        try
-        {
-            for (unsigned i = 0; i < num_threads; ++i)
-                threads_.emplace_back([this, i] { worker_loop(i + 1); });
-        }
-        catch (...)
-        {
-            shutdown();
-            throw;
-        }
+        thread_pool_lane_config file;
+        file.min_threads = num_threads;
+        file.max_threads = num_threads;
+        configure(file, thread_pool_lane_config{});
+    }
+
+    /** Construct the thread pool service with per-lane settings.
+
+        @param ctx Reference to the owning execution_context.
+        @param file Settings for @ref thread_pool_lane::file.
+        @param resolver Settings for @ref thread_pool_lane::resolver.
+
+        @throws std::logic_error If a lane's `min_threads` is 0 or
+                exceeds its `max_threads`.
+    */
+    thread_pool(
+        capy::execution_context& ctx,
+        thread_pool_lane_config const& file,
+        thread_pool_lane_config const& resolver)
+    {
+        (void)ctx;
+        configure(file, resolver);
     }
 
     ~thread_pool() override = default;
@@ -132,11 +214,18 @@ public:
 
         @param w The work item to execute. Must remain valid until
                  its `func_` has been called.
+        @param which The lane to run the item on.
 
         @return `true` if the item was enqueued, `false` if the
-                pool has already shut down.
+                pool has already shut down or the lane has no
+                thread and none could be started.
     */
-    bool post(pool_work_item* w) noexcept;
+    bool post(
+        pool_work_item* w,
+        thread_pool_lane which = thread_pool_lane::file) noexcept;
+
+    /// Return a snapshot of one lane's counters.
+    thread_pool_stats stats(thread_pool_lane which);
 
     /** Shut down the thread pool.
 
@@ -147,67 +236,251 @@ public:
 };
 
 inline void
-thread_pool::worker_loop(unsigned index)
+thread_pool::worker_loop(lane& l, std::list<std::thread>::iterator self)
 {
+    unsigned index;
+    {
+        // Also waits until start_thread has stored our std::thread
+        std::lock_guard<std::mutex> lock(mutex_);
+        index = l.next_index++;
+    }
+
     // Name format chosen to fit Linux's 15-char pthread limit:
-    // "tpool-svc-" (10) + up to 4 digit index leaves "tpool-svc-9999".
+    // "tpool-file-" (11) + up to 4 digit index.
     char name[16];
-    std::snprintf(name, sizeof(name), "tpool-svc-%u", index);
+    std::snprintf(name, sizeof(name), "%s%u", l.name, index);
     capy::set_current_thread_name(name);
 
+    std::unique_lock<std::mutex> lock(mutex_);
     for (;;)
     {
-        pool_work_item* w;
+        ++l.stats.idle;
+        bool const have_work = l.cv.wait_for(
+            lock, l.cfg.idle_timeout,
+            [&] { return shutdown_ || !l.queue.empty(); });
+        --l.stats.idle;
+
+        pool_work_item* w = l.queue.pop();
+        if (!w)
         {
-            std::unique_lock<std::mutex> lock(mutex_);
-            cv_.wait(
-                lock, [this] { return shutdown_ || !work_queue_.empty(); });
-
-            w = work_queue_.pop();
-            if (!w)
+            // Retire on shutdown, or when idle above the minimum
+            if (shutdown_ ||
+                (!have_work && l.stats.threads > l.cfg.min_threads))
             {
-                if (shutdown_)
-                    return;
-                continue;
+                --l.stats.threads;
+                if (!shutdown_)
+                    ++l.stats.threads_retired;
+                exited_.splice(exited_.end(), l.threads, self);
+                l.cv.notify_all();
+                return;
             }
+            continue;
         }
+
+        auto const now = std::chrono::steady_clock::now();
+        auto const waited =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                now - w->enqueued_);
+        --l.stats.queue_depth;
+        l.stats.total_wait += waited;
+        if (waited > l.stats.max_wait)
+            l.stats.max_wait = waited;
+
+        // A long wait with work still queued means the lane is
+        // saturated even if nobody is posting right now
+        maybe_grow(l, now);
+        wake_monitor(l);
+
+        lock.unlock();
         w->func_(w);
+        lock.lock();
+        ++l.stats.completed;
     }
 }
 
+// Called with mutex_ held.
 inline bool
-thread_pool::post(pool_work_item* w) noexcept
+thread_pool::start_thread(lane& l) noexcept
 {
+    try
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (shutdown_)
+        auto it = l.threads.emplace(l.threads.end());
+        try
+        {
+            *it = std::thread([this, &l, it] { worker_loop(l, it); });
+        }
+        catch (...)
+        {
+            l.threads.erase(it);
             return false;
-        work_queue_.push(w);
+        }
     }
-    cv_.notify_one();
+    catch (...)
+    {
+        return false;
+    }
+    ++l.stats.threads;
+    ++l.stats.threads_started;
     return true;
 }
 
 inline void
-thread_pool::shutdown()
+thread_pool::monitor_loop(lane& l)
 {
+    // "tpool-file-grow" is exactly Linux's 15-char limit
+    char name[16];
+    std::snprintf(name, sizeof(name), "%sgrow", l.name);
+    capy::set_current_thread_name(name);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shutdown_)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        shutdown_ = true;
+        if (l.stats.idle != 0 || l.queue.empty() ||
+            l.stats.threads >= l.cfg.max_threads)
+        {
+            l.monitor_cv.wait(lock);
+            continue;
+        }
+        auto const deadline = l.queue.front()->enqueued_ + l.cfg.grow_after;
+        auto const now      = std::chrono::steady_clock::now();
+        if (now < deadline)
+        {
+            l.monitor_cv.wait_until(lock, deadline);
+            continue;
+        }
+        maybe_grow(l, now);
+        // The new thread counts as idle until it dequeues, which
+        // parks the monitor until the next stall
+        if (l.stats.idle == 0 && !l.queue.empty() &&
+            l.stats.threads < l.cfg.max_threads)
+            l.monitor_cv.wait_until(lock, now + l.cfg.grow_after);
+    }
+}
+
+// Called with mutex_ held.
+inline void
+thread_pool::start_monitor(lane& l) noexcept
+{
+    if (l.monitor.joinable() || l.cfg.max_threads <= l.cfg.min_threads)
+        return;
+    try
+    {
+        l.monitor = std::thread([this, &l] { monitor_loop(l); });
     }
-    cv_.notify_all();
+    catch (...)
+    {
+        // Growth still happens on post and dequeue
+    }
+}
 
-    for (auto& t : threads_)
+// Called with mutex_ held.
+inline void
+thread_pool::wake_monitor(lane& l) noexcept
+{
+    if (l.monitor.joinable() && l.stats.idle == 0 && !l.queue.empty() &&
+        l.stats.threads < l.cfg.max_threads)
+        l.monitor_cv.notify_one();
+}
+
+// Called with mutex_ held.
+inline void
+thread_pool::maybe_grow(
+    lane& l, std::chrono::steady_clock::time_point now) noexcept
+{
+    // First use brings the lane up to its minimum
+    while (l.stats.threads < l.cfg.min_threads)
+        if (!start_thread(l))
+            return;
+    if (l.stats.idle != 0 || l.queue.empty())
+        return;
+    if (l.stats.threads >= l.cfg.max_threads)
+        return;
+    if (now - l.queue.front()->enqueued_ >= l.cfg.grow_after)
+        start_thread(l);
+}
+
+inline void
+thread_pool::reap_exited() noexcept
+{
+    std::list<std::thread> done;
     {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done.splice(done.end(), exited_);
+    }
+    for (auto& t : done)
         if (t.joinable())
             t.join();
+}
+
+inline bool
+thread_pool::post(pool_work_item* w, thread_pool_lane which) noexcept
+{
+    auto& l = get(which);
+    bool have_exited;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (shutdown_)
+            return false;
+
+        auto const now = std::chrono::steady_clock::now();
+        w->enqueued_ = now;
+        l.queue.push(w);
+        if (++l.stats.queue_depth > l.stats.peak_queue_depth)
+            l.stats.peak_queue_depth = l.stats.queue_depth;
+
+        maybe_grow(l, now);
+        if (l.stats.threads == 0)
+        {
+            // The first thread failed to start. Lanes never drop
+            // below one thread once started, so w is the only item.
+            l.queue.pop();
+            --l.stats.queue_depth;
+            return false;
+        }
+        start_monitor(l);
+        wake_monitor(l);
+        have_exited = !exited_.empty();
     }
-    threads_.clear();
+    l.cv.notify_one();
+    if (have_exited)
+        reap_exited();
+    return true;
+}
+
+inline thread_pool_stats
+thread_pool::stats(thread_pool_lane which)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return get(which).stats;
+}
+
+inline void
+thread_pool::shutdown()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        shutdown_ = true;
+        for (auto& l : lanes_)
+        {
+            l.monitor_cv.notify_all();
+            l.cv.notify_all();
+            // Workers drain their queue, then move themselves to exited_
+            l.cv.wait(lock, [&] { return l.threads.empty(); });
+        }
+    }
+    reap_exited();
+    for (auto& l : lanes_)
+        if (l.monitor.joinable())
+            l.monitor.join();
 
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        while (work_queue_.pop())
-            ;
+        for (auto& l : lanes_)
+        {
+            while (l.queue.pop())
+                ;
+            l.stats.queue_depth = 0;
+        }
     }
 }
 
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_DNS_RESOLVER_HPP
+#define BOOST_COROSIO_DNS_RESOLVER_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/endpoint.hpp>
+#include <boost/corosio/resolver.hpp>
+#include <boost/corosio/resolver_results.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/// Settings of a @ref dns_resolver.
+struct dns_resolver_options
+{
+    /** Name servers to query, in order.
+
+        Empty means the `nameserver` lines of @ref resolv_conf, or
+        `127.0.0.1:53` if it lists none.
+    */
+    std::vector<endpoint> servers;
+
+    /** Time to wait for each server's answer.
+
+        Zero means the `timeout` option of @ref resolv_conf, or
+        5 seconds.
+    */
+    std::chrono::milliseconds timeout{0};
+
+    /** Rounds over the server list before giving up.
+
+        Zero means the `attempts` option of @ref resolv_conf, or 2.
+    */
+    unsigned attempts = 0;
+
+    /// The resolver configuration file; empty to skip it.
+    std::filesystem::path resolv_conf = "/etc/resolv.conf";
+
+    /// The hosts file consulted before DNS; empty to skip it.
+    std::filesystem::path hosts = "/etc/hosts";
+};
+
+/** A resolver that speaks DNS itself.
+
+    Unlike @ref resolver, which runs the blocking `getaddrinfo` on
+    the thread pool, this resolver sends its queries over corosio's
+    own sockets, so a lookup occupies no thread while it waits and
+    lookup concurrency is not bounded by the pool size.
+
+    A name is looked up in the hosts file first. Otherwise an A and
+    an AAAA query are sent together over UDP to each server in turn,
+    for the configured number of rounds, until one answers. A
+    truncated answer is retried over TCP. "No such name" from a
+    server ends the lookup; a timeout, a refusal or a server
+    failure moves on to the next server.
+
+    Both files are read once, at construction. Search domains and
+    `ndots` are not applied: names are always queried as given.
+
+    @par Cancellation
+    A stop request cancels the lookup at once, whatever it is
+    waiting for; completes with `capy::error::canceled`.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe. Any number of lookups may be in
+    flight on one resolver.
+
+    @par Example
+    @code
+    dns_resolver r(ioc);
+    auto [ec, results] = co_await r.resolve("www.example.com", "443");
+    @endcode
+*/
+class BOOST_COROSIO_DECL dns_resolver
+{
+    struct state;
+
+    capy::execution_context* ctx_;
+    std::unique_ptr<state> st_;
+
+public:
+    /** Construct a resolver, reading its configuration files.
+
+        @param ctx The execution context whose sockets carry the
+            queries.
+        @param opts The resolver settings.
+    */
+    explicit dns_resolver(
+        capy::execution_context& ctx, dns_resolver_options const& opts = {});
+
+    /** Construct a resolver from an executor.
+
+        @param ex The executor whose context's sockets carry the
+            queries.
+        @param opts The resolver settings.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, dns_resolver>) &&
+        capy::Executor<Ex>
+    explicit dns_resolver(Ex const& ex, dns_resolver_options const& opts = {})
+        : dns_resolver(ex.context(), opts)
+    {
+    }
+
+    /// Destroy the resolver.
+    ~dns_resolver();
+
+    dns_resolver(dns_resolver&&) noexcept;
+    dns_resolver& operator=(dns_resolver&&) noexcept;
+
+    dns_resolver(dns_resolver const&)            = delete;
+    dns_resolver& operator=(dns_resolver const&) = delete;
+
+    /// Return the name servers queried, in order.
+    std::vector<endpoint> const& servers() const noexcept;
+
+    /** Resolve a host name and service to endpoints.
+
+        An empty host yields the loopback addresses, or the
+        wildcard addresses with `resolve_flags::passive`. A numeric
+        host is converted without a lookup.
+
+        @param host The host name or numeric address.
+        @param service The port number or service name.
+        @param flags `numeric_host` and `numeric_service` forbid
+            lookups; `passive` selects wildcard addresses for an
+            empty host. The other flags are ignored.
+
+        @return An awaitable completing with
+            `io_result<resolver_results>`. A name that does not
+            exist, or has no addresses, yields
+            `std::errc::no_such_device_or_address`. When no server
+            answers, the error of the last failed exchange is
+            returned, such as `std::errc::connection_refused`, or
+            `std::errc::resource_unavailable_try_again` if every
+            exchange timed out.
+    */
+    capy::task<capy::io_result<resolver_results>> resolve(
+        std::string host,
+        std::string service,
+        resolve_flags flags = resolve_flags::none);
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_DNS_RESOLVER_HPP
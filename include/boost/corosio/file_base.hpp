@@ -50,7 +50,24 @@ struct file_base
         truncate = 32,
 
         /// Synchronize data to disk on each write.
-        sync_all_on_write = 64
+        sync_all_on_write = 64,
+
+        /** Bypass the page cache (`O_DIRECT`).
+
+            Reads and writes move data directly between the device
+            and the caller's buffers, so nothing is cached or
+            double-buffered. Every buffer address, buffer length
+            and file offset must be a multiple of the device's
+            logical block size; use @ref aligned_allocator to
+            obtain suitable storage. Misaligned requests complete
+            with `std::errc::invalid_argument`.
+
+            Honoured by @ref random_access_file. Maps to
+            `F_NOCACHE` on macOS and `FILE_FLAG_NO_BUFFERING` on
+            Windows. Opening fails on filesystems that do not
+            support direct I/O, such as older tmpfs.
+        */
+        direct = 128
     };
 
     /** Origin for seek operations. */
@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_FILESYSTEM_HPP
+#define BOOST_COROSIO_FILESYSTEM_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/// Metadata of a filesystem object.
+struct file_status
+{
+    /// The kind of object.
+    std::filesystem::file_type type = std::filesystem::file_type::none;
+
+    /// The permission bits.
+    std::filesystem::perms permissions = std::filesystem::perms::unknown;
+
+    /// The size in bytes of a regular file; zero otherwise.
+    std::uint64_t size = 0;
+
+    /// The time of the last modification.
+    std::chrono::system_clock::time_point last_write_time;
+};
+
+/** Read the metadata of a filesystem object.
+
+    Symbolic links are followed. The call does not block the
+    calling thread: on io_uring it is an `IORING_OP_STATX`, and
+    elsewhere (or on kernels without that opcode) a `stat` on the
+    thread pool of the awaiting coroutine's execution context.
+
+    @param path The object to inspect.
+
+    @return An awaitable completing with `io_result<file_status>`.
+        A missing object yields `std::errc::no_such_file_or_directory`.
+
+    @par Cancellation
+    A stop request cancels the call if it has not started;
+    completes with `capy::error::canceled`.
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<file_status>>
+async_stat(std::filesystem::path path);
+
+/** Remove a file.
+
+    Directories are not removed. Uses `IORING_OP_UNLINKAT` on
+    io_uring and `unlink` on the thread pool elsewhere.
+
+    @param path The file to remove.
+
+    @return An awaitable completing with `io_result<>`.
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<>>
+async_unlink(std::filesystem::path path);
+
+/** Rename a filesystem object, replacing any file at the target.
+
+    Uses `IORING_OP_RENAMEAT` on io_uring and `rename` on the
+    thread pool elsewhere. Within one filesystem the rename is
+    atomic.
+
+    @param from The current path.
+    @param to The new path.
+
+    @return An awaitable completing with `io_result<>`.
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<>>
+async_rename(std::filesystem::path from, std::filesystem::path to);
+
+/** Create a directory.
+
+    The parent must exist. Uses `IORING_OP_MKDIRAT` on io_uring
+    and `mkdir` on the thread pool elsewhere.
+
+    @param path The directory to create.
+    @param perms The permission bits, subject to the process umask.
+
+    @return An awaitable completing with `io_result<>`. An
+        existing object at @p path yields `std::errc::file_exists`.
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<>>
+async_mkdir(
+    std::filesystem::path path,
+    std::filesystem::perms perms = std::filesystem::perms::all);
+
+/// One entry of a directory listing.
+struct directory_entry
+{
+    /// The directory's path joined with the entry's name.
+    std::filesystem::path path;
+
+    /** The entry's metadata.
+
+        Symbolic links are not followed. Without
+        @ref directory_options::stat_entries only `type` is set.
+    */
+    file_status status;
+};
+
+/// Settings of a @ref directory_reader.
+struct directory_options
+{
+    /// Entries read per trip to the thread pool.
+    std::size_t batch_size = 256;
+
+    /** Fill in each entry's full status.
+
+        Costs one `stat` per entry, made in the same pool trip as
+        the listing.
+    */
+    bool stat_entries = false;
+};
+
+/** An asynchronous directory listing.
+
+    `readdir` and `stat` block on slow or remote filesystems, so
+    they run on the thread pool, @ref directory_options::batch_size
+    entries per trip. @ref next_batch hands out a whole batch;
+    @ref next hands out one entry at a time from it. The entries
+    `.` and `..` are skipped; the order is the filesystem's.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. At most one operation may be
+    outstanding.
+
+    @par Example
+    @code
+    directory_reader dir(ioc);
+    if (auto [ec] = co_await dir.open("/var/spool/jobs"); ec)
+        co_return;
+    for (;;)
+    {
+        auto [ec, batch] = co_await dir.next_batch();
+        if (ec)
+            break; // capy::cond::eof at the end
+        for (auto const& e : batch)
+            enqueue(e.path);
+    }
+    @endcode
+*/
+class BOOST_COROSIO_DECL directory_reader
+{
+    struct state;
+
+    capy::execution_context* ctx_;
+    directory_options opts_;
+    std::unique_ptr<state> st_;
+
+    capy::task<capy::io_result<std::span<directory_entry const>>>
+    do_next_batch();
+    capy::task<capy::io_result<directory_entry>> do_next();
+
+public:
+    /** Construct a closed reader.
+
+        @param ctx The execution context whose thread pool reads.
+        @param opts The reader settings.
+
+        @throws std::invalid_argument if `opts.batch_size` is zero.
+    */
+    explicit directory_reader(
+        capy::execution_context& ctx, directory_options const& opts = {});
+
+    /** Construct a closed reader from an executor.
+
+        @param ex The executor whose context's thread pool reads.
+        @param opts The reader settings.
+
+        @throws std::invalid_argument if `opts.batch_size` is zero.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, directory_reader>) &&
+        capy::Executor<Ex>
+    explicit directory_reader(Ex const& ex, directory_options const& opts = {})
+        : directory_reader(ex.context(), opts)
+    {
+    }
+
+    /// Destroy the reader, closing the directory.
+    ~directory_reader();
+
+    directory_reader(directory_reader&&) noexcept;
+    directory_reader& operator=(directory_reader&&) noexcept;
+
+    directory_reader(directory_reader const&)            = delete;
+    directory_reader& operator=(directory_reader const&) = delete;
+
+    /** Open a directory, closing any open one.
+
+        @param path The directory to list.
+
+        @return An awaitable completing with `io_result<>`.
+    */
+    capy::task<capy::io_result<>> open(std::filesystem::path path);
+
+    /// Close the directory.
+    void close() noexcept;
+
+    /// Check if a directory is open.
+    bool is_open() const noexcept;
+
+    /** Read the next batch of entries.
+
+        Returns the entries of the current batch not yet taken by
+        @ref next, or reads a new batch when there are none.
+
+        @return An awaitable completing with
+            `io_result<std::span<directory_entry const>>`. The span
+            stays valid until the next call on this reader. At the
+            end of the listing it is empty and the error is
+            `capy::error::eof`.
+
+        @throws std::logic_error if no directory is open.
+    */
+    capy::task<capy::io_result<std::span<directory_entry const>>>
+    next_batch();
+
+    /** Read the next entry.
+
+        Takes entries from the current batch, reading the next
+        batch when it runs out.
+
+        @return An awaitable completing with
+            `io_result<directory_entry>`; `capy::error::eof` at the
+            end of the listing.
+
+        @throws std::logic_error if no directory is open.
+    */
+    capy::task<capy::io_result<directory_entry>> next();
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_FILESYSTEM_HPP
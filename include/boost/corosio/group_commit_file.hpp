@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_GROUP_COMMIT_FILE_HPP
+#define BOOST_COROSIO_GROUP_COMMIT_FILE_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/file_base.hpp>
+#include <boost/corosio/random_access_file.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/any_executor.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/// Batching settings of a @ref group_commit_file.
+struct group_commit_options
+{
+    /** Upper bound on the bytes written by one batch.
+
+        A record larger than this is written in a batch of its
+        own.
+    */
+    std::size_t max_batch_bytes = 4 * 1024 * 1024;
+
+    /** Flush each batch to the device before completing it.
+
+        When false, appends are still coalesced into one write
+        per batch but complete once the data reaches the page
+        cache.
+    */
+    bool sync = true;
+};
+
+/// Counters of a @ref group_commit_file.
+struct group_commit_stats
+{
+    /// Batches written.
+    std::uint64_t batches = 0;
+
+    /// Records appended.
+    std::uint64_t records = 0;
+
+    /// Bytes appended.
+    std::uint64_t bytes = 0;
+
+    /// Records in the largest batch.
+    std::uint64_t max_batch_records = 0;
+};
+
+/** An append-only file that commits concurrent appends together.
+
+    Many small appends each followed by `sync_data` spend nearly
+    all their time waiting for the device, one flush per record.
+    This class instead lets any number of coroutines @ref append
+    concurrently. Each record is assigned its offset at once and
+    queued; whenever no batch is in flight, everything queued so
+    far goes out as one batch: a single gathered write
+    (`pwritev` on POSIX) and, with @ref group_commit_options::sync,
+    a single `fdatasync`, both in one trip to the thread pool.
+    Records that arrive meanwhile form the next batch, so the batch
+    size grows with the load and the flush cost is shared.
+
+    Records land in the file in the order @ref append was called.
+    Each appender resumes, on its own executor, once its whole
+    batch has been written and flushed.
+
+    A failed write or flush fails every record of its batch and
+    every later append with the same error, since the state of the
+    file's tail is then unknown. Close and reopen the file to
+    recover.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe for concurrent @ref append calls.
+
+    @par Example
+    @code
+    group_commit_file wal(ioc);
+    wal.open("wal.log");
+
+    // From any number of coroutines:
+    auto [ec, end] = co_await wal.append(
+        capy::const_buffer(rec.data(), rec.size()));
+    if (!ec)
+        ack(end); // durable up to `end`
+    @endcode
+
+    @see random_access_file
+*/
+class BOOST_COROSIO_DECL group_commit_file
+{
+    struct state;
+
+    std::shared_ptr<state> st_;
+
+    void init(
+        capy::any_executor ex,
+        random_access_file file,
+        group_commit_options const& opts);
+    capy::task<capy::io_result<std::uint64_t>> do_append(
+        std::vector<capy::const_buffer> bufs);
+
+public:
+    /** Construct a closed file from an executor.
+
+        Batches are written from a coroutine running on @p ex.
+
+        @param ex The executor whose context will own the file.
+        @param opts The batching settings.
+
+        @throws std::invalid_argument if `opts.max_batch_bytes` is
+            zero.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, group_commit_file>) &&
+        capy::Executor<Ex>
+    explicit group_commit_file(
+        Ex const& ex, group_commit_options const& opts = {})
+    {
+        init(capy::any_executor(ex), random_access_file(ex), opts);
+    }
+
+    /** Construct a closed file from an io_context.
+
+        @param ctx The context that will own the file.
+        @param opts The batching settings.
+
+        @throws std::invalid_argument if `opts.max_batch_bytes` is
+            zero.
+    */
+    template<class Ctx>
+        requires requires(Ctx& c) {
+            { c.get_executor() } -> capy::Executor;
+        }
+    explicit group_commit_file(
+        Ctx& ctx, group_commit_options const& opts = {})
+        : group_commit_file(ctx.get_executor(), opts)
+    {
+    }
+
+    /// Destroy the object, closing the file.
+    ~group_commit_file();
+
+    group_commit_file(group_commit_file&&) noexcept            = default;
+    group_commit_file& operator=(group_commit_file&&) noexcept = default;
+
+    group_commit_file(group_commit_file const&)            = delete;
+    group_commit_file& operator=(group_commit_file const&) = delete;
+
+    /** Open a file for appending.
+
+        Records are appended at the file's current end.
+
+        @param path The filesystem path to open.
+        @param mode Bitmask of @ref file_base::flags. Must allow
+            writing; `append` is implied.
+
+        @throws std::system_error on failure.
+    */
+    void open(
+        std::filesystem::path const& path,
+        file_base::flags mode = file_base::write_only | file_base::create);
+
+    /** Close the file.
+
+        Must not be called while appends are outstanding.
+    */
+    void close();
+
+    /// Check if the file is open.
+    bool is_open() const noexcept;
+
+    /** Append a record.
+
+        The record is written contiguously at the end of the file,
+        after every record appended before it.
+
+        @param buffers The record data, of any number of buffers.
+            The data must stay valid until the append completes.
+
+        @return An awaitable yielding `(error_code, std::uint64_t)`,
+            the offset just past the record. When the error is
+            clear, the file is written (and with
+            @ref group_commit_options::sync, flushed) up to that
+            offset.
+
+        @par Cancellation
+        Not cancellable: the record keeps its place in the file
+        and completes with its batch.
+
+        @throws std::logic_error if the file is not open.
+    */
+    template<capy::ConstBufferSequence CB>
+    capy::task<capy::io_result<std::uint64_t>> append(CB const& buffers)
+    {
+        if (!is_open())
+            detail::throw_logic_error("append: file not open");
+        // Every buffer is kept: a truncated record would still
+        // report a commit offset
+        std::vector<capy::const_buffer> bufs;
+        auto const end_it = capy::end(buffers);
+        for (auto it = capy::begin(buffers); it != end_it; ++it)
+        {
+            capy::const_buffer b(*it);
+            if (b.size() != 0)
+                bufs.push_back(b);
+        }
+        return do_append(std::move(bufs));
+    }
+
+    /// Return the offset the next record will be written at.
+    std::uint64_t size() const noexcept;
+
+    /// Return the batching settings.
+    group_commit_options const& options() const noexcept;
+
+    /// Return the file's counters.
+    group_commit_stats stats() const noexcept;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_GROUP_COMMIT_FILE_HPP
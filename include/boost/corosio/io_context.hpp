@@ -16,6 +16,7 @@
 #include <boost/corosio/detail/continuation_op.hpp>
 #include <boost/corosio/detail/platform.hpp>
 #include <boost/corosio/detail/scheduler.hpp>
+#include <boost/corosio/thread_pool_stats.hpp>
 #include <boost/capy/continuation.hpp>
 #include <boost/capy/ex/execution_context.hpp>
 
@@ -42,6 +43,7 @@ namespace boost::corosio {
     opts.max_events_per_poll  = 256;   // larger batch per syscall
     opts.inline_budget_max    = 32;    // more speculative completions
     opts.thread_pool_size     = 4;     // more file-I/O workers
+    opts.thread_pool_max_size = 16;    // grow under backlog
 
     io_context ioc(opts);
     @endcode
@@ -97,15 +99,78 @@ struct io_context_options
     */
     unsigned gqcs_timeout_ms = 500;
 
-    /** Thread pool size for blocking I/O (file I/O, DNS resolution).
+    /** Thread pool size for blocking file I/O.
 
-        Sets the number of worker threads in the shared thread pool
-        used by POSIX file services and DNS resolution. Must be at
-        least 1. Applies to POSIX backends only; ignored on IOCP
-        where file I/O uses native overlapped I/O.
+        Sets the number of worker threads in the file lane of the
+        thread pool used by POSIX file services. Must be at least
+        1. Threads start on first use. Applies to POSIX backends
+        only; ignored on IOCP where file I/O uses native
+        overlapped I/O.
     */
     unsigned thread_pool_size = 1;
 
+    /** Upper bound for elastic growth of the file lane.
+
+        When no file-lane thread is idle and a queued operation has
+        waited longer than @ref thread_pool_grow_after_us, another
+        thread is started, up to this many. 0 means
+        @ref thread_pool_size, i.e. a fixed-size lane.
+    */
+    unsigned thread_pool_max_size = 0;
+
+    /** Thread count for blocking DNS resolution.
+
+        DNS lookups run on their own lane so a slow `getaddrinfo`
+        cannot delay queued file I/O. Must be at least 1.
+    */
+    unsigned resolver_pool_size = 1;
+
+    /** Upper bound for elastic growth of the resolver lane.
+
+        0 means @ref resolver_pool_size, i.e. a fixed-size lane.
+    */
+    unsigned resolver_pool_max_size = 0;
+
+    /** Queue wait, in microseconds, that triggers lane growth.
+
+        Applies to both lanes when their maximum exceeds their
+        size.
+    */
+    unsigned thread_pool_grow_after_us = 1000;
+
+    /** Idle time, in milliseconds, before a grown thread exits.
+
+        Threads above a lane's configured size retire after this
+        long without work.
+    */
+    unsigned thread_pool_idle_ms = 30000;
+
+    /** Lifetime, in milliseconds, of a cached DNS answer.
+
+        A nonzero value (or a nonzero
+        @ref resolver_cache_negative_ttl_ms) gives the context a
+        resolution cache keyed on host, service and flags. Cache
+        hits complete without a trip to the resolver lane, and
+        concurrent lookups of the same key share one `getaddrinfo`.
+        `getaddrinfo` does not report record TTLs, so every answer
+        lives this long. 0 disables caching of successful answers.
+        Applies to POSIX backends only.
+    */
+    unsigned resolver_cache_ttl_ms = 0;
+
+    /** Lifetime, in milliseconds, of a cached "host not found".
+
+        Transient failures such as a timed-out server are never
+        cached. 0 disables negative caching.
+    */
+    unsigned resolver_cache_negative_ttl_ms = 0;
+
+    /** Maximum number of entries in the resolution cache.
+
+        Must be at least 1 when the cache is enabled.
+    */
+    unsigned resolver_cache_max_entries = 1024;
+
     /** Enable single-threaded mode (disable scheduler locking).
 
         When true, the scheduler skips all mutex lock/unlock and
@@ -163,6 +228,21 @@ struct io_context_options
         non-io_uring backends.
     */
     int sq_thread_cpu = -1;
+
+    /** Deliver signals through a signalfd on Linux.
+
+        The epoll and io_uring backends then read signals for
+        @ref signal_set as ordinary readiness events on the run
+        thread, in batches, instead of relaying them from a signal
+        handler. A signal is only queued on the signalfd while it
+        is blocked, so block the signals you wait for in every
+        thread (for example with `pthread_sigmask` before starting
+        threads); a signal that reaches a thread where it is not
+        blocked still arrives through the handler.
+
+        Ignored on other backends.
+    */
+    bool signal_fd = false;
 };
 
 namespace detail {
@@ -305,6 +385,16 @@ public:
     */
     executor_type get_executor() const noexcept;
 
+    /** Return the counters of a blocking-work thread pool lane.
+
+        Reports thread counts, queue depth and queue wait times
+        for the lane that runs blocking file I/O or DNS lookups.
+        Zeros if no blocking work has been set up yet.
+
+        @param lane The lane to report on.
+    */
+    thread_pool_stats pool_stats(thread_pool_lane lane) const;
+
     /** Signal the context to stop processing.
 
         This causes `run()` to return as soon as possible. Any pending
@@ -16,6 +16,7 @@
 
 #if BOOST_COROSIO_POSIX
 #include <boost/corosio/local_datagram_socket.hpp>
+#include <boost/corosio/local_seqpacket_socket.hpp>
 #endif
 
 #include <system_error>
@@ -73,6 +74,26 @@ BOOST_COROSIO_DECL
 std::error_code
 connect_pair(local_datagram_socket& a, local_datagram_socket& b) noexcept;
 
+/** Synchronously connect two AF_UNIX sequenced-packet sockets as a pair.
+
+    POSIX only. Uses `socketpair(AF_UNIX, SOCK_SEQPACKET)` and adopts
+    the descriptors via `assign()`.
+
+    @par Preconditions
+    Both sockets must be in the closed state.
+
+    @par Exception Safety
+    Nothrow.
+
+    @param a First socket of the pair.
+    @param b Second socket of the pair.
+
+    @return Empty on success; otherwise the underlying system error.
+*/
+BOOST_COROSIO_DECL
+std::error_code
+connect_pair(local_seqpacket_socket& a, local_seqpacket_socket& b) noexcept;
+
 #endif // BOOST_COROSIO_POSIX
 
 } // namespace boost::corosio
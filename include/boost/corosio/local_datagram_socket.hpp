@@ -16,11 +16,13 @@
 #if BOOST_COROSIO_POSIX
 
 #include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/fd_passing.hpp>
 #include <boost/corosio/detail/native_handle.hpp>
 #include <boost/corosio/detail/op_base.hpp>
 #include <boost/corosio/io/io_object.hpp>
 #include <boost/capy/io_result.hpp>
 #include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/datagram_slot.hpp>
 #include <boost/corosio/local_endpoint.hpp>
 #include <boost/corosio/local_datagram.hpp>
 #include <boost/corosio/message_flags.hpp>
@@ -36,6 +38,7 @@
 #include <concepts>
 #include <coroutine>
 #include <cstddef>
+#include <span>
 #include <stop_token>
 #include <type_traits>
 
@@ -297,6 +300,84 @@ public:
         */
         virtual std::error_code
         bind(corosio::local_endpoint ep) noexcept = 0;
+
+        /** Initiate a connected send carrying descriptor-passing
+            control data.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer data to send.
+            @param control Encoded `SCM_RIGHTS` control message.
+            @param control_len Length of @p control in bytes.
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> send_with_fds(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            void const* control,
+            std::size_t control_len,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
+
+        /** Initiate a connected recv that also receives passed
+            descriptors.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer to receive into.
+            @param control Buffer for received control messages.
+            @param control_cap Capacity of @p control in bytes.
+            @param control_len Set to the received control length
+                on success; left untouched otherwise.
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> recv_with_fds(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            void* control,
+            std::size_t control_cap,
+            std::size_t* control_len,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
+
+        /** Initiate an asynchronous batched connected receive.
+
+            Completes once at least one message is available, then
+            drains whatever else is queued, up to @p count slots.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param slots The receive slots. On success the first
+                `*count_out` slots hold the message size.
+            @param count Number of entries in @p slots.
+            @param flags Message flags (e.g. MSG_PEEK).
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param count_out Output number of messages received.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> recv_batch(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            datagram_slot* slots,
+            std::size_t count,
+            int flags,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* count_out) = 0;
     };
 
     /** Represent the awaitable returned by @ref send_to.
@@ -442,6 +523,77 @@ public:
         }
     };
 
+    /** Represent the awaitable returned by @ref send_with_fds.
+
+        Encodes the descriptors into control storage held by the
+        awaitable itself, so the send never allocates.
+    */
+    struct send_with_fds_awaitable
+        : detail::bytes_op_base<send_with_fds_awaitable>
+    {
+        local_datagram_socket& s_;
+        buffer_param buf_;
+        detail::fd_control_buffer control_;
+        std::size_t control_len_;
+
+        send_with_fds_awaitable(
+            local_datagram_socket& s, buffer_param buf,
+            std::span<native_handle_type const> fds) noexcept
+            : s_(s), buf_(buf)
+            , control_len_(detail::encode_passed_fds(
+                  control_, fds.data(), fds.size())) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().send_with_fds(
+                h, ex, buf_, control_.data, control_len_, token_, &ec_,
+                &bytes_);
+        }
+    };
+
+    /** Represent the awaitable returned by @ref recv_with_fds.
+
+        Decodes received descriptors on resumption. Descriptors that
+        do not fit, or that arrive with a failed or cancelled
+        receive, are closed.
+    */
+    struct recv_with_fds_awaitable
+        : detail::bytes_op_base<recv_with_fds_awaitable>
+    {
+        local_datagram_socket& s_;
+        buffer_param buf_;
+        std::span<native_handle_type> fds_;
+        std::size_t& fd_count_;
+        mutable detail::fd_control_buffer control_;
+        mutable std::size_t control_len_ = 0;
+
+        recv_with_fds_awaitable(
+            local_datagram_socket& s, buffer_param buf,
+            std::span<native_handle_type> fds,
+            std::size_t& fd_count) noexcept
+            : s_(s), buf_(buf), fds_(fds), fd_count_(fd_count) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv_with_fds(
+                h, ex, buf_, control_.data, sizeof(control_.data),
+                &control_len_, token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            bool failed = token_.stop_requested() || ec_;
+            fd_count_   = detail::decode_passed_fds(
+                control_, control_len_, fds_.data(),
+                failed ? 0 : fds_.size());
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            return {ec_, bytes_};
+        }
+    };
+
 public:
     /** Destructor.
 
@@ -731,6 +883,74 @@ public:
         return recv(buf, corosio::message_flags::none);
     }
 
+    /** Send a datagram with open file descriptors to the connected peer.
+
+        Attaches the descriptors as an `SCM_RIGHTS` control message.
+        The peer receives duplicates of them via @ref recv_with_fds;
+        the caller keeps ownership of its own copies.
+
+        @pre connect() has been called successfully.
+
+        @param buf The buffer containing data to send.
+        @param fds The descriptors to pass, at most
+            @ref max_passed_fds.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>.
+
+        @throws std::logic_error if the socket is not open or
+            @p fds holds more than @ref max_passed_fds descriptors.
+    */
+    template<capy::ConstBufferSequence Buffers>
+    auto send_with_fds(
+        Buffers const& buf, std::span<native_handle_type const> fds)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send_with_fds: socket not open");
+        if (fds.size() > max_passed_fds)
+            detail::throw_logic_error("send_with_fds: too many descriptors");
+        return send_with_fds_awaitable(*this, buf, fds);
+    }
+
+    /** Receive a datagram and any passed file descriptors.
+
+        Received descriptors are close-on-exec and owned by the
+        caller. Descriptors beyond `fds.size()` are closed, as are
+        any that arrive when the receive fails or is cancelled.
+
+        @pre connect() has been called successfully.
+
+        @param buf The buffer to receive data into.
+        @param fds Storage for received descriptors.
+        @param fd_count Set to the number of descriptors written to
+            @p fds when the operation completes.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>.
+
+        @throws std::logic_error if the socket is not open.
+
+        @par Preconditions
+        @p fds and @p fd_count must outlive the returned awaitable.
+    */
+    template<capy::MutableBufferSequence Buffers>
+    auto recv_with_fds(
+        Buffers const& buf,
+        std::span<native_handle_type> fds,
+        std::size_t& fd_count)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv_with_fds: socket not open");
+        fd_count = 0;
+        return recv_with_fds_awaitable(*this, buf, fds, fd_count);
+    }
+
     /** Cancel any pending asynchronous operations.
 
         All outstanding operations complete with
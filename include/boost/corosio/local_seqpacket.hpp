@@ -0,0 +1,67 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_LOCAL_SEQPACKET_HPP
+#define BOOST_COROSIO_LOCAL_SEQPACKET_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+namespace boost::corosio {
+
+class local_seqpacket_socket;
+class local_seqpacket_acceptor;
+
+/** Protocol tag for local (Unix domain) sequenced-packet sockets.
+
+    A sequenced-packet socket is connection-oriented like a stream
+    socket but preserves message boundaries like a datagram socket:
+    each send is delivered as one whole message, in order.
+
+    The family(), type(), and protocol() members return the
+    three integers passed to the operating system's socket()
+    call. Their values are platform-defined constants taken from
+    the system socket headers.
+
+    @note Not available on Windows, which has no AF_UNIX
+        `SOCK_SEQPACKET` sockets.
+
+    @see local_seqpacket_socket, local_seqpacket_acceptor
+*/
+class BOOST_COROSIO_DECL local_seqpacket
+{
+public:
+    /// Return the address family, the platform's `AF_UNIX` constant.
+    static int family() noexcept;
+
+    /// Return the socket type, the platform's `SOCK_SEQPACKET` constant.
+    static int type() noexcept;
+
+    /** Return the protocol number, always `0`.
+
+        A value of `0` directs the operating system to select the
+        default protocol for an `AF_UNIX` `SOCK_SEQPACKET` socket,
+        which is the only one.
+    */
+    static int protocol() noexcept;
+
+    /// The socket type to use with this protocol, @ref local_seqpacket_socket.
+    using socket = local_seqpacket_socket;
+
+    /// The acceptor type to use with this protocol, @ref local_seqpacket_acceptor.
+    using acceptor = local_seqpacket_acceptor;
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_LOCAL_SEQPACKET_HPP
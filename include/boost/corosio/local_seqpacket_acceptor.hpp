@@ -0,0 +1,262 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_LOCAL_SEQPACKET_ACCEPTOR_HPP
+#define BOOST_COROSIO_LOCAL_SEQPACKET_ACCEPTOR_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/native_handle.hpp>
+#include <boost/corosio/local_endpoint.hpp>
+#include <boost/corosio/local_seqpacket.hpp>
+#include <boost/corosio/local_seqpacket_socket.hpp>
+#include <boost/corosio/local_stream_acceptor.hpp>
+#include <boost/corosio/wait_type.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/concept/executor.hpp>
+
+#include <concepts>
+#include <system_error>
+#include <type_traits>
+
+namespace boost::corosio {
+
+/** An asynchronous acceptor for Unix sequenced-packet connections.
+
+    Listens on a local endpoint and yields connected
+    @ref local_seqpacket_socket objects. Listening, readiness and
+    accept are delegated to a @ref local_stream_acceptor opened with
+    `SOCK_SEQPACKET`, so the backend acceptor services are shared
+    with stream sockets; each accepted descriptor is then adopted
+    by a sequenced-packet socket.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. An acceptor must not have concurrent
+    accept operations.
+
+    @par Example
+    @code
+    local_seqpacket_acceptor acc(ioc);
+    acc.open();
+    acc.bind(local_endpoint("/tmp/control.sock"),
+        bind_option::unlink_existing);
+    acc.listen();
+    auto [ec, peer] = co_await acc.accept();
+    @endcode
+
+    @note Not available on Windows.
+
+    @see local_seqpacket_socket
+*/
+class BOOST_COROSIO_DECL local_seqpacket_acceptor
+{
+    local_stream_acceptor acc_;
+    capy::execution_context* ctx_;
+
+public:
+    /** Construct an acceptor from an execution context.
+
+        @param ctx The execution context that will own this acceptor.
+    */
+    explicit local_seqpacket_acceptor(capy::execution_context& ctx);
+
+    /** Construct an acceptor from an executor.
+
+        @param ex The executor whose context will own the acceptor.
+    */
+    template<class Ex>
+        requires(
+            !std::same_as<std::remove_cvref_t<Ex>, local_seqpacket_acceptor>) &&
+        capy::Executor<Ex>
+    explicit local_seqpacket_acceptor(Ex const& ex)
+        : local_seqpacket_acceptor(ex.context())
+    {
+    }
+
+    /** Move constructor.
+
+        @param other The acceptor to move from.
+    */
+    local_seqpacket_acceptor(local_seqpacket_acceptor&& other) noexcept =
+        default;
+
+    /** Move assignment operator.
+
+        Closes any existing acceptor and transfers ownership. Both
+        acceptors must share the same execution context.
+
+        @param other The acceptor to move from.
+        @return Reference to this acceptor.
+    */
+    local_seqpacket_acceptor&
+    operator=(local_seqpacket_acceptor&& other) noexcept = default;
+
+    local_seqpacket_acceptor(local_seqpacket_acceptor const&) = delete;
+    local_seqpacket_acceptor&
+    operator=(local_seqpacket_acceptor const&) = delete;
+
+    /** Create the acceptor socket.
+
+        @param proto The protocol. Defaults to local_seqpacket{}.
+
+        @throws std::system_error on failure.
+    */
+    void open(local_seqpacket proto = {});
+
+    /** Bind to a local endpoint.
+
+        @param ep The local endpoint (path) to bind to.
+        @param opt Bind options; see @ref local_stream_acceptor::bind.
+
+        @return An error code on failure, empty on success.
+
+        @throws std::logic_error if the acceptor is not open.
+    */
+    [[nodiscard]] std::error_code
+    bind(corosio::local_endpoint ep, bind_option opt = bind_option::none)
+    {
+        return acc_.bind(ep, opt);
+    }
+
+    /** Start listening for incoming connections.
+
+        @param backlog The maximum pending connection queue length.
+
+        @return An error code on failure, empty on success.
+
+        @throws std::logic_error if the acceptor is not open.
+    */
+    [[nodiscard]] std::error_code listen(int backlog = 128)
+    {
+        return acc_.listen(backlog);
+    }
+
+    /** Close the acceptor.
+
+        Cancels any pending accept operations and releases the
+        underlying socket.
+
+        @post is_open() == false
+    */
+    void close()
+    {
+        acc_.close();
+    }
+
+    /// Check if the acceptor has an open socket handle.
+    bool is_open() const noexcept
+    {
+        return acc_.is_open();
+    }
+
+    /** Accept a connection into an existing socket.
+
+        On success @p peer, closed first if open, holds the
+        accepted connection.
+
+        @param peer The socket to receive the connection.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+        On cancellation, yields `capy::cond::canceled` and
+        @p peer is not modified.
+
+        @return An awaitable that completes with io_result<>.
+
+        @throws std::logic_error if the acceptor is not open.
+    */
+    capy::task<capy::io_result<>> accept(local_seqpacket_socket& peer);
+
+    /** Accept a connection, returning the socket.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<local_seqpacket_socket>.
+
+        @throws std::logic_error if the acceptor is not open.
+    */
+    capy::task<capy::io_result<local_seqpacket_socket>> accept();
+
+    /** Wait for an incoming connection.
+
+        @param w The wait direction.
+
+        @return An awaitable that completes with `io_result<>`.
+    */
+    [[nodiscard]] auto wait(wait_type w)
+    {
+        return acc_.wait(w);
+    }
+
+    /// Cancel pending asynchronous accept operations.
+    void cancel()
+    {
+        acc_.cancel();
+    }
+
+    /** Release ownership of the native socket handle.
+
+        @return The native handle.
+
+        @throws std::logic_error if the acceptor is not open.
+
+        @post is_open() == false
+    */
+    native_handle_type release()
+    {
+        return acc_.release();
+    }
+
+    /// Return the bound local endpoint, or an empty one.
+    corosio::local_endpoint local_endpoint() const noexcept
+    {
+        return acc_.local_endpoint();
+    }
+
+    /** Set a socket option on the acceptor.
+
+        @param opt The option to set.
+
+        @throws std::logic_error if the acceptor is not open.
+        @throws std::system_error on failure.
+    */
+    template<class Option>
+    void set_option(Option const& opt)
+    {
+        acc_.set_option(opt);
+    }
+
+    /** Get a socket option from the acceptor.
+
+        @return The current option value.
+
+        @throws std::logic_error if the acceptor is not open.
+        @throws std::system_error on failure.
+    */
+    template<class Option>
+    Option get_option() const
+    {
+        return acc_.template get_option<Option>();
+    }
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_LOCAL_SEQPACKET_ACCEPTOR_HPP
@@ -0,0 +1,582 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_LOCAL_SEQPACKET_SOCKET_HPP
+#define BOOST_COROSIO_LOCAL_SEQPACKET_SOCKET_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/native_handle.hpp>
+#include <boost/corosio/detail/op_base.hpp>
+#include <boost/corosio/io/io_object.hpp>
+#include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/datagram_slot.hpp>
+#include <boost/corosio/local_datagram_socket.hpp>
+#include <boost/corosio/local_endpoint.hpp>
+#include <boost/corosio/local_seqpacket.hpp>
+#include <boost/corosio/message_flags.hpp>
+#include <boost/corosio/shutdown_type.hpp>
+#include <boost/corosio/wait_type.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/ex/io_env.hpp>
+#include <boost/capy/concept/executor.hpp>
+
+#include <system_error>
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <span>
+#include <stop_token>
+#include <type_traits>
+
+namespace boost::corosio {
+
+/** An asynchronous Unix sequenced-packet socket for coroutine I/O.
+
+    A `SOCK_SEQPACKET` socket is connected like a stream socket but
+    keeps message boundaries: every @ref send is delivered to the
+    peer as exactly one @ref recv, so framed protocols need no
+    length prefix and no partial-read state. @ref recv_batch drains
+    several queued messages with one `recvmmsg` call.
+
+    Connections come from @ref connect, from
+    @ref local_seqpacket_acceptor, or from @ref connect_pair.
+
+    The socket shares the local datagram backend implementation;
+    only the socket type passed to the operating system differs.
+
+    @par Message Semantics
+    A message larger than the receive buffer is truncated and the
+    receive completes with `std::errc::message_size` (detected on
+    Linux; elsewhere the excess is discarded silently). An orderly
+    shutdown by the peer is reported as `capy::error::eof`, so
+    zero-length messages should not be sent.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. At most one send and one receive may be
+    in flight at a time.
+
+    @par Example
+    @code
+    local_seqpacket_socket sock(ioc);
+    co_await sock.connect(local_endpoint("/tmp/control.sock"));
+    co_await sock.send(capy::const_buffer(req, req_len));
+
+    char buf[4096];
+    auto [ec, n] = co_await sock.recv(
+        capy::mutable_buffer(buf, sizeof(buf)));
+    // buf[0..n) holds exactly one message
+    @endcode
+
+    @note Not available on Windows.
+
+    @see local_seqpacket_acceptor
+*/
+class BOOST_COROSIO_DECL local_seqpacket_socket : public io_object
+{
+public:
+    /// The shutdown direction type used by shutdown().
+    using shutdown_type = corosio::shutdown_type;
+    using enum corosio::shutdown_type;
+
+    /// Backend hooks, shared with @ref local_datagram_socket.
+    using implementation = local_datagram_socket::implementation;
+
+private:
+    struct connect_awaitable
+        : detail::void_op_base<connect_awaitable>
+    {
+        local_seqpacket_socket& s_;
+        corosio::local_endpoint endpoint_;
+
+        connect_awaitable(
+            local_seqpacket_socket& s,
+            corosio::local_endpoint ep) noexcept
+            : s_(s), endpoint_(ep) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().connect(h, ex, endpoint_, token_, &ec_);
+        }
+    };
+
+    struct wait_awaitable
+        : detail::void_op_base<wait_awaitable>
+    {
+        local_seqpacket_socket& s_;
+        wait_type w_;
+
+        wait_awaitable(local_seqpacket_socket& s, wait_type w) noexcept
+            : s_(s), w_(w) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().wait(h, ex, w_, token_, &ec_);
+        }
+    };
+
+    struct send_awaitable
+        : detail::bytes_op_base<send_awaitable>
+    {
+        local_seqpacket_socket& s_;
+        buffer_param buf_;
+        int flags_;
+
+        send_awaitable(
+            local_seqpacket_socket& s, buffer_param buf,
+            int flags = 0) noexcept
+            : s_(s), buf_(buf), flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().send(
+                h, ex, buf_, flags_, token_, &ec_, &bytes_);
+        }
+    };
+
+    /** Represent the awaitable returned by @ref recv.
+
+        Always asks the kernel for the full message length so an
+        oversized message can be reported instead of silently
+        clipped, and maps a zero-length read to end of file.
+    */
+    struct recv_awaitable
+        : detail::bytes_op_base<recv_awaitable>
+    {
+        local_seqpacket_socket& s_;
+        buffer_param buf_;
+        std::size_t capacity_;
+        int flags_;
+
+        recv_awaitable(
+            local_seqpacket_socket& s, buffer_param buf,
+            std::size_t capacity, int flags = 0) noexcept
+            : s_(s), buf_(buf), capacity_(capacity), flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv(
+                h, ex, buf_,
+                flags_ | static_cast<int>(message_flags::truncate),
+                token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            if (ec_)
+                return {ec_, 0};
+            if (bytes_ == 0 && capacity_ > 0)
+                return {capy::error::eof, 0};
+            if (bytes_ > capacity_)
+                return {make_error_code(std::errc::message_size), capacity_};
+            return {ec_, bytes_};
+        }
+    };
+
+    /** Represent the awaitable returned by @ref recv_batch.
+
+        The result value is the number of messages. A zero-length
+        slot marks the peer's shutdown: the count stops before it,
+        and a batch that starts with one yields end of file.
+    */
+    struct recv_batch_awaitable
+        : detail::bytes_op_base<recv_batch_awaitable>
+    {
+        local_seqpacket_socket& s_;
+        datagram_slot* slots_;
+        std::size_t count_;
+        int flags_;
+
+        recv_batch_awaitable(
+            local_seqpacket_socket& s, std::span<datagram_slot> slots,
+            int flags = 0) noexcept
+            : s_(s), slots_(slots.data()), count_(slots.size())
+            , flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv_batch(
+                h, ex, slots_, count_,
+                flags_ | static_cast<int>(message_flags::truncate),
+                token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            if (ec_)
+                return {ec_, 0};
+            std::size_t n = 0;
+            while (n < bytes_ && slots_[n].size > 0)
+                ++n;
+            if (n == 0 && bytes_ > 0)
+                return {capy::error::eof, 0};
+            return {ec_, n};
+        }
+    };
+
+public:
+    /** Destructor.
+
+        Closes the socket if open, cancelling any pending operations.
+    */
+    ~local_seqpacket_socket() override;
+
+    /** Construct a socket from an execution context.
+
+        @param ctx The execution context that will own this socket.
+    */
+    explicit local_seqpacket_socket(capy::execution_context& ctx);
+
+    /** Construct a socket from an executor.
+
+        The socket is associated with the executor's context.
+
+        @param ex The executor whose context will own the socket.
+    */
+    template<class Ex>
+        requires(
+            !std::same_as<std::remove_cvref_t<Ex>, local_seqpacket_socket>) &&
+        capy::Executor<Ex>
+    explicit local_seqpacket_socket(Ex const& ex)
+        : local_seqpacket_socket(ex.context())
+    {
+    }
+
+    /** Move constructor.
+
+        Transfers ownership of the socket resources.
+
+        @param other The socket to move from.
+    */
+    local_seqpacket_socket(local_seqpacket_socket&& other) noexcept
+        : io_object(std::move(other))
+    {
+    }
+
+    /** Move assignment operator.
+
+        Closes any existing socket and transfers ownership.
+
+        @param other The socket to move from.
+        @return Reference to this socket.
+    */
+    local_seqpacket_socket& operator=(local_seqpacket_socket&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            io_object::operator=(std::move(other));
+        }
+        return *this;
+    }
+
+    local_seqpacket_socket(local_seqpacket_socket const&)            = delete;
+    local_seqpacket_socket& operator=(local_seqpacket_socket const&) = delete;
+
+    /** Open the socket.
+
+        Creates a Unix sequenced-packet socket and associates it
+        with the platform reactor.
+
+        @param proto The protocol. Defaults to local_seqpacket{}.
+
+        @throws std::system_error on failure.
+    */
+    void open(local_seqpacket proto = {});
+
+    /** Close the socket.
+
+        Cancels any pending asynchronous operations and releases
+        the underlying file descriptor. Has no effect if the
+        socket is not open.
+
+        @post is_open() == false
+    */
+    void close();
+
+    /// Check if the socket holds a valid file descriptor.
+    bool is_open() const noexcept
+    {
+        return h_ && get().native_handle() >= 0;
+    }
+
+    /** Initiate an asynchronous connect to a listening peer.
+
+        If the socket is not already open, it is opened automatically.
+
+        @param ep The endpoint of a @ref local_seqpacket_acceptor.
+
+        @par Cancellation
+        Supports cancellation via the awaitable's stop_token or by
+        calling cancel(). On cancellation, yields
+        `capy::cond::canceled`.
+
+        @return An awaitable that completes with io_result<>.
+
+        @throws std::system_error if the socket needs to be opened
+            and the open fails.
+    */
+    auto connect(corosio::local_endpoint ep)
+    {
+        if (!is_open())
+            open();
+        return connect_awaitable(*this, ep);
+    }
+
+    /** Wait for the socket to become ready in a given direction.
+
+        @param w The wait direction (read, write, or error).
+
+        @return An awaitable that completes with `io_result<>`.
+
+        @par Preconditions
+        The socket must be open. This socket must outlive the
+        returned awaitable.
+    */
+    [[nodiscard]] auto wait(wait_type w)
+    {
+        return wait_awaitable(*this, w);
+    }
+
+    /** Send one message to the connected peer.
+
+        The whole buffer sequence is sent as a single message, or
+        the operation fails; a successful send never transfers a
+        prefix.
+
+        @param buf The message payload.
+        @param flags Message flags.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    template<capy::ConstBufferSequence Buffers>
+    auto send(Buffers const& buf, corosio::message_flags flags)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send: socket not open");
+        return send_awaitable(*this, buf, static_cast<int>(flags));
+    }
+
+    /// @overload
+    template<capy::ConstBufferSequence Buffers>
+    auto send(Buffers const& buf)
+    {
+        return send(buf, corosio::message_flags::none);
+    }
+
+    /** Receive one message from the connected peer.
+
+        Completes with exactly one message. If it does not fit in
+        @p buf, the leading bytes are kept, the rest is discarded,
+        and the result is `std::errc::message_size` with the buffer
+        size as the byte count.
+
+        @param buf The buffer to receive the message into.
+        @param flags Message flags (e.g. message_flags::peek).
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>. `capy::error::eof` once the
+            peer has shut down.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    template<capy::MutableBufferSequence Buffers>
+    auto recv(Buffers const& buf, corosio::message_flags flags)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv: socket not open");
+        return recv_awaitable(
+            *this, buf, capy::buffer_size(buf), static_cast<int>(flags));
+    }
+
+    /// @overload
+    template<capy::MutableBufferSequence Buffers>
+    auto recv(Buffers const& buf)
+    {
+        return recv(buf, corosio::message_flags::none);
+    }
+
+    /** Receive several messages with one operation.
+
+        Fills up to @ref max_datagram_batch slots per call. The
+        operation completes as soon as one message is available and
+        then drains whatever else is already queued, up to the slot
+        count, without suspending again. On Linux this is a single
+        `recvmmsg` call.
+
+        Each slot's `buffer` must be set by the caller. On success
+        the first `n` slots hold one message each. On Linux a slot
+        whose `size` exceeds its buffer size was truncated.
+
+        @param slots The receive slots. Must remain valid until
+            the operation completes.
+        @param flags Message flags (e.g. message_flags::peek).
+
+        @return An awaitable that completes with
+            `io_result<std::size_t>` holding the number of messages,
+            or `capy::error::eof` once the peer has shut down.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    auto recv_batch(
+        std::span<datagram_slot> slots,
+        corosio::message_flags flags = corosio::message_flags::none)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv_batch: socket not open");
+        return recv_batch_awaitable(*this, slots, static_cast<int>(flags));
+    }
+
+    /** Cancel any pending asynchronous operations.
+
+        All outstanding operations complete with
+        errc::operation_canceled. Check ec == cond::canceled
+        for portable comparison.
+    */
+    void cancel();
+
+    /** Get the native socket handle.
+
+        @return The native socket handle, or -1 if not open.
+    */
+    native_handle_type native_handle() const noexcept;
+
+    /** Release ownership of the native socket handle.
+
+        Deregisters the socket from the reactor and cancels pending
+        operations without closing the fd. The caller takes ownership
+        of the returned descriptor.
+
+        @return The native handle.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    native_handle_type release();
+
+    /** Shut down part or all of the socket.
+
+        @param what Which direction to shut down.
+    */
+    void shutdown(shutdown_type what);
+
+    /** Shut down part or all of the socket (non-throwing).
+
+        @param what Which direction to shut down.
+        @param ec Set to the error code on failure.
+    */
+    void shutdown(shutdown_type what, std::error_code& ec) noexcept;
+
+    /** Set a socket option.
+
+        @tparam Option A socket option type that provides static
+            `level()` and `name()` members, and `data()` / `size()`
+            accessors for the option value.
+
+        @param opt The option to set.
+
+        @throws std::logic_error if the socket is not open.
+        @throws std::system_error on failure.
+    */
+    template<class Option>
+    void set_option(Option const& opt)
+    {
+        if (!is_open())
+            detail::throw_logic_error("set_option: socket not open");
+        std::error_code ec = get().set_option(
+            Option::level(), Option::name(), opt.data(), opt.size());
+        if (ec)
+            detail::throw_system_error(
+                ec, "local_seqpacket_socket::set_option");
+    }
+
+    /** Get a socket option.
+
+        @tparam Option A socket option type that provides static
+            `level()` and `name()` members, `data()` / `size()`
+            accessors, and a `resize()` member.
+
+        @return The current option value.
+
+        @throws std::logic_error if the socket is not open.
+        @throws std::system_error on failure.
+    */
+    template<class Option>
+    Option get_option() const
+    {
+        if (!is_open())
+            detail::throw_logic_error("get_option: socket not open");
+        Option opt{};
+        std::size_t sz = opt.size();
+        std::error_code ec =
+            get().get_option(Option::level(), Option::name(), opt.data(), &sz);
+        if (ec)
+            detail::throw_system_error(
+                ec, "local_seqpacket_socket::get_option");
+        opt.resize(sz);
+        return opt;
+    }
+
+    /** Assign an existing file descriptor to this socket.
+
+        The socket must not already be open. The fd must be a
+        non-blocking `SOCK_SEQPACKET` socket; it is adopted and
+        registered with the platform reactor.
+
+        @param fd The file descriptor to adopt.
+
+        @throws std::system_error on failure.
+    */
+    void assign(native_handle_type fd);
+
+    /// Return the local endpoint, or a default endpoint if not bound.
+    corosio::local_endpoint local_endpoint() const noexcept;
+
+    /// Return the connected peer's endpoint, or a default endpoint.
+    corosio::local_endpoint remote_endpoint() const noexcept;
+
+private:
+    inline implementation& get() const noexcept
+    {
+        return *static_cast<implementation*>(h_.get());
+    }
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_LOCAL_SEQPACKET_SOCKET_HPP
@@ -531,8 +531,12 @@ protected:
     }
 
 private:
+    friend class local_seqpacket_acceptor;
+
     capy::execution_context& ctx_;
 
+    void open_for_family(int family, int type, int protocol);
+
     inline implementation& get() const noexcept
     {
         return *static_cast<implementation*>(h_.get());
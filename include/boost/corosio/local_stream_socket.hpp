@@ -13,6 +13,7 @@
 #include <boost/corosio/detail/config.hpp>
 #include <boost/corosio/detail/platform.hpp>
 #include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/fd_passing.hpp>
 #include <boost/corosio/detail/native_handle.hpp>
 #include <boost/corosio/detail/op_base.hpp>
 #include <boost/corosio/io/io_stream.hpp>
@@ -32,6 +33,7 @@
 #include <concepts>
 #include <coroutine>
 #include <cstddef>
+#include <span>
 #include <stop_token>
 #include <type_traits>
 
@@ -188,6 +190,55 @@ public:
 
         /// Return the cached remote endpoint.
         virtual corosio::local_endpoint remote_endpoint() const noexcept = 0;
+
+        /** Initiate a write carrying descriptor-passing control data.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer data to write.
+            @param control Encoded `SCM_RIGHTS` control message.
+            @param control_len Length of @p control in bytes.
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> send_with_fds(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            void const* control,
+            std::size_t control_len,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
+
+        /** Initiate a read that also receives passed descriptors.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer to read into.
+            @param control Buffer for received control messages.
+            @param control_cap Capacity of @p control in bytes.
+            @param control_len Set to the received control length
+                on success; left untouched otherwise.
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> recv_with_fds(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            void* control,
+            std::size_t control_cap,
+            std::size_t* control_len,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
     };
 
     /// Represent the awaitable returned by @ref connect.
@@ -225,6 +276,86 @@ public:
         }
     };
 
+    /** Represent the awaitable returned by @ref send_with_fds.
+
+        Encodes the descriptors into control storage held by the
+        awaitable itself, so the send never allocates.
+    */
+    struct send_with_fds_awaitable
+        : detail::bytes_op_base<send_with_fds_awaitable>
+    {
+        local_stream_socket& s_;
+        buffer_param buf_;
+        detail::fd_control_buffer control_;
+        std::size_t control_len_;
+
+        send_with_fds_awaitable(
+            local_stream_socket& s, buffer_param buf,
+            std::span<native_handle_type const> fds) noexcept
+            : s_(s), buf_(buf)
+            , control_len_(detail::encode_passed_fds(
+                  control_, fds.data(), fds.size())) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            // An empty write sends nothing and would drop the
+            // descriptors while reporting success
+            capy::mutable_buffer first;
+            if (buf_.copy_to(&first, 1) == 0)
+            {
+                ec_    = make_error_code(std::errc::invalid_argument);
+                bytes_ = 0;
+                return h;
+            }
+            return s_.get().send_with_fds(
+                h, ex, buf_, control_.data, control_len_, token_, &ec_,
+                &bytes_);
+        }
+    };
+
+    /** Represent the awaitable returned by @ref recv_with_fds.
+
+        Decodes received descriptors on resumption. Descriptors that
+        do not fit, or that arrive with a failed or cancelled read,
+        are closed.
+    */
+    struct recv_with_fds_awaitable
+        : detail::bytes_op_base<recv_with_fds_awaitable>
+    {
+        local_stream_socket& s_;
+        buffer_param buf_;
+        std::span<native_handle_type> fds_;
+        std::size_t& fd_count_;
+        mutable detail::fd_control_buffer control_;
+        mutable std::size_t control_len_ = 0;
+
+        recv_with_fds_awaitable(
+            local_stream_socket& s, buffer_param buf,
+            std::span<native_handle_type> fds,
+            std::size_t& fd_count) noexcept
+            : s_(s), buf_(buf), fds_(fds), fd_count_(fd_count) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv_with_fds(
+                h, ex, buf_, control_.data, sizeof(control_.data),
+                &control_len_, token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            bool failed = token_.stop_requested() || ec_;
+            fd_count_   = detail::decode_passed_fds(
+                control_, control_len_, fds_.data(),
+                failed ? 0 : fds_.size());
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            return {ec_, bytes_};
+        }
+    };
+
 public:
     /** Destructor.
 
@@ -347,6 +478,10 @@ public:
         direction, or an error condition is reported. No bytes
         are transferred.
 
+        A write wait completes at once while the send buffer has
+        space and otherwise parks until the peer drains it; see
+        @ref wait_type::write.
+
         @param w The wait direction (read, write, or error).
 
         @return An awaitable that completes with `io_result<>`.
@@ -360,6 +495,85 @@ public:
         return wait_awaitable(*this, w);
     }
 
+    /** Write data together with open file descriptors.
+
+        Sends the descriptors as an `SCM_RIGHTS` control message
+        attached to the first byte of @p buf. The peer receives
+        duplicates of them via @ref recv_with_fds; the caller keeps
+        ownership of its own copies and may close them once the
+        write completes.
+
+        @param buf The data to write. Must be non-empty, since the
+            descriptors travel with the first byte.
+        @param fds The descriptors to pass, at most
+            @ref max_passed_fds.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>, or `std::errc::invalid_argument`
+            without sending anything if @p buf is empty.
+
+        @throws std::logic_error if the socket is not open or
+            @p fds holds more than @ref max_passed_fds descriptors.
+
+        @par Preconditions
+        This socket must outlive the returned awaitable. Not
+        supported on Windows, where the operation completes with
+        `std::errc::operation_not_supported`.
+    */
+    template<capy::ConstBufferSequence Buffers>
+    auto send_with_fds(
+        Buffers const& buf, std::span<native_handle_type const> fds)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send_with_fds: socket not open");
+        if (fds.size() > max_passed_fds)
+            detail::throw_logic_error("send_with_fds: too many descriptors");
+        return send_with_fds_awaitable(*this, buf, fds);
+    }
+
+    /** Read data and receive any passed file descriptors.
+
+        Like `read_some`, and additionally collects descriptors sent
+        with @ref send_with_fds. The read stops at the boundary of a
+        write that carried descriptors, so they are never merged
+        with data from a different write.
+
+        Received descriptors are close-on-exec and owned by the
+        caller. Descriptors beyond `fds.size()` are closed, as are
+        any that arrive when the read fails or is cancelled.
+
+        @param buf The buffer to read into.
+        @param fds Storage for received descriptors.
+        @param fd_count Set to the number of descriptors written to
+            @p fds when the operation completes.
+
+        @par Cancellation
+        Supports cancellation via stop_token or cancel().
+
+        @return An awaitable that completes with
+            io_result<std::size_t>.
+
+        @throws std::logic_error if the socket is not open.
+
+        @par Preconditions
+        This socket, @p fds, and @p fd_count must outlive the
+        returned awaitable.
+    */
+    template<capy::MutableBufferSequence Buffers>
+    auto recv_with_fds(
+        Buffers const& buf,
+        std::span<native_handle_type> fds,
+        std::size_t& fd_count)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv_with_fds: socket not open");
+        fd_count = 0;
+        return recv_with_fds_awaitable(*this, buf, fds, fd_count);
+    }
+
     /** Cancel any pending asynchronous operations.
 
         All outstanding operations complete with `errc::operation_canceled`.
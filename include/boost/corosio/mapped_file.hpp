@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_MAPPED_FILE_HPP
+#define BOOST_COROSIO_MAPPED_FILE_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/random_access_file.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace boost::corosio {
+
+/** A read-only memory mapping of a file.
+
+    Maps the whole of an open @ref random_access_file so its
+    contents can be served without copying: @ref view returns a
+    `capy::const_buffer` pointing into the mapping, which can be
+    passed straight to `tcp_socket::write_some` or any other
+    write operation.
+
+    Touching a page that is not resident takes a major fault, which
+    would block the thread running the event loop for the duration
+    of a disk read. Await @ref ensure_resident on a range before
+    using it: the thread pool populates the range (with
+    `MADV_POPULATE_READ` where the kernel has it, otherwise by
+    `MADV_WILLNEED` followed by touching each page) and the
+    coroutine resumes on its executor once the pages are in memory.
+    The kernel may still evict pages later under memory pressure.
+
+    The mapping is a snapshot of the file's length at construction;
+    bytes appended afterwards are not visible. Truncating the file
+    while it is mapped makes access to the lost pages fault with
+    `SIGBUS` on POSIX systems, so only map files that are not
+    modified while in use.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Safe for @ref view, @ref data, @ref size and
+    concurrent @ref ensure_resident calls.
+
+    @par Example
+    @code
+    random_access_file f(ioc);
+    f.open("assets.pak", file_base::read_only);
+    mapped_file m(f);
+
+    auto [ec] = co_await m.ensure_resident(offset, len);
+    if (!ec)
+        co_await capy::write(sock, m.view(offset, len));
+    @endcode
+
+    @see random_access_file
+*/
+class BOOST_COROSIO_DECL mapped_file
+{
+    capy::execution_context* ctx_ = nullptr;
+    unsigned char const* data_    = nullptr;
+    std::size_t size_             = 0;
+    void* mapping_                = nullptr; // Windows section handle
+
+    void reset() noexcept;
+
+public:
+    /// Construct an empty object that maps nothing.
+    mapped_file() noexcept = default;
+
+    /** Map an open file for reading.
+
+        The file may be closed afterwards; the mapping stays valid.
+        An empty file yields an open mapping of size zero.
+
+        @param file The file to map. It must be open for reading.
+
+        @throws std::logic_error if @p file is not open.
+        @throws std::system_error if the mapping fails.
+    */
+    explicit mapped_file(random_access_file const& file);
+
+    /// Destroy the object, unmapping the file.
+    ~mapped_file();
+
+    /// Move construct, leaving @p other empty.
+    mapped_file(mapped_file&& other) noexcept;
+
+    /// Move assign, unmapping any current mapping first.
+    mapped_file& operator=(mapped_file&& other) noexcept;
+
+    mapped_file(mapped_file const&)            = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    /// Check if a file is mapped.
+    bool is_open() const noexcept
+    {
+        return ctx_ != nullptr;
+    }
+
+    /// Return the mapped length in bytes.
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// Return the start of the mapping, or null when empty.
+    unsigned char const* data() const noexcept
+    {
+        return data_;
+    }
+
+    /** Return a range of the mapping as a buffer.
+
+        No data is copied. The buffer stays valid until the
+        mapping is destroyed or assigned over.
+
+        @param offset The start of the range.
+        @param len The length; clamped to the end of the mapping.
+
+        @throws std::out_of_range if @p offset exceeds @ref size.
+    */
+    capy::const_buffer
+    view(std::uint64_t offset, std::size_t len = ~std::size_t(0)) const;
+
+    /** Fault a range into memory on the thread pool.
+
+        Completes once every page of the range is resident, so the
+        caller can then read it without blocking. The range is
+        clamped to the mapping; an empty range completes at once.
+        The mapping must outlive the operation.
+
+        @param offset The start of the range.
+        @param len The length of the range.
+
+        @return An awaitable completing with `io_result<>`.
+            `capy::error::canceled` if a stop was requested before
+            the work started or the pool has shut down.
+
+        @throws std::logic_error if nothing is mapped.
+    */
+    capy::task<capy::io_result<>>
+    ensure_resident(std::uint64_t offset, std::size_t len);
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_MAPPED_FILE_HPP
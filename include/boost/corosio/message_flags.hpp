@@ -15,7 +15,7 @@ namespace boost::corosio {
 /** Flags for datagram send/recv operations.
 
     Platform-agnostic flag values that are mapped to native
-    constants (MSG_PEEK, MSG_OOB, MSG_DONTROUTE) at the
+    constants (MSG_PEEK, MSG_OOB, MSG_DONTROUTE, MSG_TRUNC) at the
     syscall boundary in the reactor implementation.
 */
 enum class message_flags : int
@@ -27,7 +27,14 @@ enum class message_flags : int
     /// Send or receive out-of-band data (MSG_OOB).
     out_of_band  = 2,
     /// Bypass routing tables (MSG_DONTROUTE).
-    do_not_route = 4
+    do_not_route = 4,
+    /** Report the full message length on receive (MSG_TRUNC).
+
+        A message longer than the buffer is still truncated, but
+        the operation yields its original size. Honored by Linux;
+        ignored elsewhere.
+    */
+    truncate     = 8
 };
 
 /// Combine two flag sets with bitwise OR.
@@ -53,7 +60,8 @@ operator~(message_flags a) noexcept
     constexpr int mask =
         static_cast<int>(message_flags::peek) |
         static_cast<int>(message_flags::out_of_band) |
-        static_cast<int>(message_flags::do_not_route);
+        static_cast<int>(message_flags::do_not_route) |
+        static_cast<int>(message_flags::truncate);
     return static_cast<message_flags>(~static_cast<int>(a) & mask);
 }
 
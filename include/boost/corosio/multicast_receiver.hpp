@@ -0,0 +1,376 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_MULTICAST_RECEIVER_HPP
+#define BOOST_COROSIO_MULTICAST_RECEIVER_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/datagram_slot.hpp>
+#include <boost/corosio/endpoint.hpp>
+#include <boost/corosio/ipv4_address.hpp>
+#include <boost/corosio/ipv6_address.hpp>
+#include <boost/corosio/udp_socket.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/** One datagram delivered to a multicast group handler.
+
+    @ref data refers to the receiver's batch storage; it stays
+    valid until the handler's task completes and must be copied
+    to be kept longer.
+*/
+struct multicast_packet
+{
+    /// The datagram payload.
+    capy::const_buffer data;
+
+    /// The sender's endpoint.
+    endpoint source;
+
+    /// The group the datagram was sent to (port zero).
+    endpoint group;
+
+    /// Index of the interface the datagram arrived on.
+    unsigned interface_index = 0;
+};
+
+/// Per-group receive counters of a @ref multicast_receiver.
+struct multicast_group_stats
+{
+    /// Datagrams delivered to the group's handler.
+    std::uint64_t packets = 0;
+
+    /// Payload bytes delivered to the group's handler.
+    std::uint64_t bytes = 0;
+
+    /** Sequence numbers skipped between consecutive datagrams.
+
+        Only counted when the group has a sequence function. Each
+        missing number counts once, so this is the group's loss as
+        seen by the application protocol.
+    */
+    std::uint64_t gaps = 0;
+
+    /// Datagrams whose sequence number was not above the last one.
+    std::uint64_t reordered = 0;
+};
+
+/** A receiver for many multicast groups on one UDP socket.
+
+    Market-data style consumers join dozens of groups that share a
+    port. Opening a socket per group multiplies descriptors and
+    receive loops; this class instead joins every group on a single
+    socket, enables packet info (`IP_PKTINFO`, `IPV6_RECVPKTINFO`)
+    so each datagram reports the group it was sent to, and reads
+    with @ref udp_socket::recv_batch. Each datagram is routed by
+    destination address to the handler registered for its group,
+    which receives a view into the batch storage rather than a copy.
+
+    Handlers of every group share the single loop in @ref run and
+    run one at a time, in arrival order. A handler returns a
+    `capy::task<>`; the next datagram, for any group, is not
+    dispatched until it completes, which is what keeps the view
+    valid without copying. A handler that suspends for long thus
+    stalls every group and lets the socket's receive queue fill, so
+    work that may block should copy the payload and hand it to a
+    consumer coroutine of its own. Each call creates the handler's
+    coroutine frame; keep handlers short and free of suspension on
+    the hot path.
+
+    Loss is tracked per group when a sequence function is given to
+    @ref join: it extracts the application sequence number from a
+    payload, and skipped numbers accumulate in
+    @ref multicast_group_stats::gaps. Kernel receive-queue drops
+    (`SO_RXQ_OVFL`, Linux) are per socket and reported by
+    @ref kernel_drops.
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe. Only one @ref run may be active, and
+    join and leave must not race with it across threads.
+
+    @par Example
+    @code
+    multicast_receiver rx(ioc);
+    if (auto ec = rx.open(endpoint(ipv4_address::any(), 30001)))
+        throw std::system_error(ec);
+
+    for (auto group : feed_groups)
+        rx.join(group,
+            [&book](multicast_packet const& p) -> capy::task<>
+            {
+                book.apply(p.data);
+                co_return;
+            },
+            [](capy::const_buffer b) -> std::optional<std::uint64_t>
+            {
+                return read_seqno(b);
+            });
+
+    auto [ec] = co_await rx.run();
+    @endcode
+
+    @note Routing needs packet info, which Windows does not report;
+        there every datagram counts as @ref unrouted.
+
+    @see udp_socket, socket_option::join_group_v4
+*/
+class BOOST_COROSIO_DECL multicast_receiver
+{
+public:
+    /// The handler invoked for each datagram of a group.
+    using handler_type =
+        std::function<capy::task<>(multicast_packet const&)>;
+
+    /** Extracts a sequence number from a payload.
+
+        Returns `std::nullopt` for datagrams that carry none, such
+        as heartbeats; those are not checked for gaps.
+    */
+    using sequence_type =
+        std::function<std::optional<std::uint64_t>(capy::const_buffer)>;
+
+private:
+    struct group_state
+    {
+        endpoint addr;
+        handler_type handler;
+        sequence_type sequence;
+        std::uint64_t next_seq = 0;
+        bool have_seq          = false;
+        bool left              = false;
+        multicast_group_stats stats;
+    };
+
+    udp_socket sock_;
+    std::vector<std::unique_ptr<group_state>> groups_;
+    std::vector<char> storage_;
+    std::vector<datagram_slot> slots_;
+    std::uint64_t unrouted_     = 0;
+    std::uint32_t kernel_drops_ = 0;
+
+    // While a handler runs, leave() and close() only mark groups as
+    // left; the handler's group_state is freed once it returns
+    bool dispatching_ = false;
+    std::size_t left_ = 0;
+
+    group_state* find(endpoint const& addr) const noexcept;
+    void add_group(
+        endpoint addr, handler_type handler, sequence_type sequence);
+    void drop(endpoint const& addr);
+    void end_dispatch() noexcept;
+    group_state* route(datagram_slot const& slot, capy::const_buffer data);
+    capy::task<capy::io_result<>> do_run();
+
+public:
+    /** Construct a closed receiver.
+
+        @param ctx The execution context that will own the socket.
+    */
+    explicit multicast_receiver(capy::execution_context& ctx);
+
+    /** Construct a closed receiver from an executor.
+
+        @param ex The executor whose context will own the socket.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, multicast_receiver>) &&
+        capy::Executor<Ex>
+    explicit multicast_receiver(Ex const& ex)
+        : multicast_receiver(ex.context())
+    {
+    }
+
+    /// Destroy the receiver, closing the socket.
+    ~multicast_receiver();
+
+    multicast_receiver(multicast_receiver&&) noexcept            = default;
+    multicast_receiver& operator=(multicast_receiver&&) noexcept = default;
+
+    multicast_receiver(multicast_receiver const&)            = delete;
+    multicast_receiver& operator=(multicast_receiver const&) = delete;
+
+    /** Open the socket and bind it to the feed port.
+
+        Binds to @p ep with `SO_REUSEADDR`, so other receivers on
+        the host may share the port, and enables packet info for
+        the endpoint's family. The kernel drop counter is enabled
+        where supported. Any previous socket and groups are
+        discarded.
+
+        @param ep The local endpoint, usually the wildcard address
+            with the feed's port.
+        @param max_datagram_size Capacity of each batch slot.
+            Longer datagrams are truncated.
+
+        @return Error code on failure, empty on success.
+    */
+    [[nodiscard]] std::error_code
+    open(endpoint ep, std::size_t max_datagram_size = 2048);
+
+    /** Join an IPv4 group and register its handler.
+
+        @param group The multicast group address.
+        @param handler Invoked for each datagram sent to @p group.
+        @param sequence Optional sequence number extractor used to
+            count gaps.
+        @param iface The local interface to join on (default: any).
+
+        @return Error code on failure, empty on success.
+            `std::errc::address_in_use` if @p group is already
+            joined, `std::errc::invalid_argument` if @p handler
+            is empty.
+
+        @throws std::logic_error if the receiver is not open.
+    */
+    [[nodiscard]] std::error_code join(
+        ipv4_address group,
+        handler_type handler,
+        sequence_type sequence = {},
+        ipv4_address iface     = ipv4_address());
+
+    /** Join an IPv6 group and register its handler.
+
+        @param group The multicast group address.
+        @param handler Invoked for each datagram sent to @p group.
+        @param sequence Optional sequence number extractor used to
+            count gaps.
+        @param if_index The interface index (0 = kernel chooses).
+
+        @return Error code on failure, empty on success.
+            `std::errc::address_in_use` if @p group is already
+            joined, `std::errc::invalid_argument` if @p handler
+            is empty.
+
+        @throws std::logic_error if the receiver is not open.
+    */
+    [[nodiscard]] std::error_code join(
+        ipv6_address group,
+        handler_type handler,
+        sequence_type sequence = {},
+        unsigned if_index      = 0);
+
+    /** Leave an IPv4 group and drop its handler.
+
+        May be called from a handler, including the group's own:
+        the group receives no further datagrams, and its handler
+        is destroyed after the running one returns.
+
+        @return Error code on failure, empty on success.
+    */
+    std::error_code
+    leave(ipv4_address group, ipv4_address iface = ipv4_address());
+
+    /** Leave an IPv6 group and drop its handler.
+
+        May be called from a handler, including the group's own:
+        the group receives no further datagrams, and its handler
+        is destroyed after the running one returns.
+
+        @return Error code on failure, empty on success.
+    */
+    std::error_code leave(ipv6_address group, unsigned if_index = 0);
+
+    /** Receive and dispatch datagrams until cancelled or an error.
+
+        @par Cancellation
+        Supports cancellation via stop_token or @ref cancel.
+        On cancellation, yields `capy::cond::canceled`.
+
+        @return An awaitable that completes with `io_result<>`.
+
+        @throws std::logic_error if the receiver is not open.
+    */
+    capy::task<capy::io_result<>> run();
+
+    /// Return the counters for @p group, or zeros if not joined.
+    multicast_group_stats stats(ipv4_address group) const noexcept;
+
+    /// Return the counters for @p group, or zeros if not joined.
+    multicast_group_stats stats(ipv6_address group) const noexcept;
+
+    /// Return the number of datagrams that matched no joined group.
+    std::uint64_t unrouted() const noexcept
+    {
+        return unrouted_;
+    }
+
+    /** Return the socket's receive-queue drop count.
+
+        The latest cumulative `SO_RXQ_OVFL` value seen. Always
+        zero where the counter is unsupported.
+    */
+    std::uint32_t kernel_drops() const noexcept
+    {
+        return kernel_drops_;
+    }
+
+    /// Return the number of joined groups.
+    std::size_t size() const noexcept
+    {
+        return groups_.size() - left_;
+    }
+
+    /// Return true if the socket is open.
+    bool is_open() const noexcept
+    {
+        return sock_.is_open();
+    }
+
+    /// Return the bound local endpoint.
+    endpoint local_endpoint() const noexcept
+    {
+        return sock_.local_endpoint();
+    }
+
+    /// Return the underlying socket, e.g. to set further options.
+    udp_socket& socket() noexcept
+    {
+        return sock_;
+    }
+
+    /// Cancel a pending @ref run.
+    void cancel();
+
+    /** Close the socket and drop every group.
+
+        Called from a handler, @ref run completes with
+        `capy::error::canceled` once that handler returns, without
+        dispatching the rest of its batch.
+    */
+    void close();
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_MULTICAST_RECEIVER_HPP
@@ -0,0 +1,337 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_BATCH_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_BATCH_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/datagram_slot.hpp>
+#include <boost/corosio/native/detail/datagram_control.hpp>
+#include <boost/corosio/native/detail/endpoint_convert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#if defined(__linux__)
+#include <netinet/udp.h>
+// Older libc headers lack the UDP offload options (Linux 4.18 / 5.0)
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
+
+/*
+    Batched datagram I/O shared by the reactor and io_uring backends.
+
+    On Linux a batch is a single recvmmsg(2)/sendmmsg(2) call. Other
+    POSIX systems lack these syscalls, so the helpers below emulate
+    them with a loop of recvmsg(2)/sendmsg(2) on the non-blocking fd:
+    the loop stops at the first EAGAIN and reports the datagrams it
+    already moved, which matches the mmsg semantics callers rely on
+    (a positive count means "this many slots are valid").
+
+    The msghdr array, iovecs, sockaddr storage, and control buffers all
+    live inside the owning op, so a batch never allocates.
+
+    Each slot may carry one UDP offload control message: UDP_SEGMENT
+    on send (one buffer leaves as many equal-size datagrams) and
+    UDP_GRO on receive (the kernel reports the size of the datagrams
+    it coalesced into the buffer). Both are Linux-only; the emulated
+    send loop rejects segmented slots with EOPNOTSUPP. Received
+    slots also carry the control messages datagram_info understands
+    (packet info, timestamp, traffic class, drop counter), parsed
+    into datagram_slot::info.
+*/
+
+namespace boost::corosio::detail {
+
+#if defined(__linux__)
+using batch_msghdr = ::mmsghdr;
+#else
+struct batch_msghdr
+{
+    msghdr msg_hdr;
+    unsigned int msg_len;
+    bool segmented;
+};
+#endif
+
+/** Control message storage for one datagram of a batch.
+
+    Sized for UDP_GRO plus one of each datagram_info group; the
+    packet info term covers in6_pktinfo, the larger of the two.
+*/
+struct batch_control
+{
+    alignas(cmsghdr) unsigned char buf[
+        CMSG_SPACE(sizeof(int)) +
+        CMSG_SPACE(sizeof(in6_addr) + sizeof(unsigned)) +
+        CMSG_SPACE(sizeof(timespec)) +
+        CMSG_SPACE(sizeof(int)) +
+        CMSG_SPACE(sizeof(std::uint32_t))];
+};
+
+/** Point each msghdr at its slot buffer and name storage for receive.
+
+    @return The number of slots prepared (at most @p max).
+*/
+inline unsigned
+prepare_recv_batch(
+    batch_msghdr* msgs,
+    iovec* iovecs,
+    sockaddr_storage* names,
+    batch_control* controls,
+    datagram_slot* slots,
+    std::size_t count,
+    std::size_t max) noexcept
+{
+    unsigned n = static_cast<unsigned>(count < max ? count : max);
+    for (unsigned i = 0; i < n; ++i)
+    {
+        iovecs[i].iov_base = slots[i].buffer.data();
+        iovecs[i].iov_len  = slots[i].buffer.size();
+
+        msgs[i]                     = {};
+        msgs[i].msg_hdr.msg_name    = &names[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(names[i]);
+        msgs[i].msg_hdr.msg_iov     = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+        msgs[i].msg_hdr.msg_control    = controls[i].buf;
+        msgs[i].msg_hdr.msg_controllen = sizeof(controls[i].buf);
+    }
+    return n;
+}
+
+/** Point each msghdr at its slot payload and destination for send.
+
+    A default-constructed slot peer leaves msg_name empty so the
+    datagram goes to the connected peer. A non-zero segment size
+    attaches a UDP_SEGMENT control message.
+
+    @return The number of slots prepared (at most @p max).
+*/
+inline unsigned
+prepare_send_batch(
+    int fd,
+    batch_msghdr* msgs,
+    iovec* iovecs,
+    sockaddr_storage* names,
+    batch_control* controls,
+    const_datagram_slot const* slots,
+    std::size_t count,
+    std::size_t max) noexcept
+{
+    unsigned n = static_cast<unsigned>(count < max ? count : max);
+    int family = n ? socket_family(fd) : 0;
+    for (unsigned i = 0; i < n; ++i)
+    {
+        iovecs[i].iov_base = const_cast<void*>(slots[i].buffer.data());
+        iovecs[i].iov_len  = slots[i].buffer.size();
+
+        msgs[i]                    = {};
+        msgs[i].msg_hdr.msg_iov    = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        if (slots[i].peer != endpoint{})
+        {
+            msgs[i].msg_hdr.msg_name = &names[i];
+            msgs[i].msg_hdr.msg_namelen =
+                to_sockaddr(slots[i].peer, family, names[i]);
+        }
+        if (slots[i].segment_size != 0)
+        {
+#if defined(__linux__)
+            auto& hdr          = msgs[i].msg_hdr;
+            hdr.msg_control    = controls[i].buf;
+            hdr.msg_controllen = CMSG_SPACE(sizeof(std::uint16_t));
+
+            cmsghdr* cm    = CMSG_FIRSTHDR(&hdr);
+            cm->cmsg_level = IPPROTO_UDP;
+            cm->cmsg_type  = UDP_SEGMENT;
+            cm->cmsg_len   = CMSG_LEN(sizeof(std::uint16_t));
+
+            // Larger values exceed any datagram; the kernel rejects them
+            std::uint16_t gso = slots[i].segment_size > 0xffff
+                ? std::uint16_t(0xffff)
+                : static_cast<std::uint16_t>(slots[i].segment_size);
+            std::memcpy(CMSG_DATA(cm), &gso, sizeof(gso));
+#else
+            (void)controls;
+            msgs[i].segmented = true;
+#endif
+        }
+    }
+    return n;
+}
+
+/** Reset per-message lengths before a (re)try of a receive batch.
+
+    recvmmsg overwrites msg_namelen and msg_controllen, so a batch
+    retried after EAGAIN must restore the full storage sizes first.
+*/
+inline void
+reset_recv_batch(batch_msghdr* msgs, unsigned n) noexcept
+{
+    for (unsigned i = 0; i < n; ++i)
+    {
+        msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        if (msgs[i].msg_hdr.msg_control)
+            msgs[i].msg_hdr.msg_controllen = sizeof(batch_control::buf);
+        msgs[i].msg_len = 0;
+    }
+}
+
+/** Receive up to @p n datagrams without blocking.
+
+    @return The number of datagrams received, or -1 with errno set.
+*/
+inline int
+recv_batch_msgs(int fd, batch_msghdr* msgs, unsigned n, int flags) noexcept
+{
+#if defined(__linux__)
+    int r;
+    do
+    {
+        r = ::recvmmsg(fd, msgs, n, flags, nullptr);
+    }
+    while (r < 0 && errno == EINTR);
+    return r;
+#else
+    unsigned i = 0;
+    for (; i < n; ++i)
+    {
+        ssize_t r;
+        do
+        {
+            r = ::recvmsg(fd, &msgs[i].msg_hdr, flags);
+        }
+        while (r < 0 && errno == EINTR);
+
+        if (r < 0)
+            return i ? static_cast<int>(i) : -1;
+        msgs[i].msg_len = static_cast<unsigned int>(r);
+    }
+    return static_cast<int>(i);
+#endif
+}
+
+/** Send up to @p n datagrams without blocking.
+
+    @return The number of datagrams sent, or -1 with errno set.
+*/
+inline int
+send_batch_msgs(int fd, batch_msghdr* msgs, unsigned n, int flags) noexcept
+{
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+#if defined(__linux__)
+    int r;
+    do
+    {
+        r = ::sendmmsg(fd, msgs, n, flags);
+    }
+    while (r < 0 && errno == EINTR);
+    return r;
+#else
+    unsigned i = 0;
+    for (; i < n; ++i)
+    {
+        if (msgs[i].segmented)
+        {
+            if (i)
+                break;
+            errno = EOPNOTSUPP;
+            return -1;
+        }
+
+        ssize_t r;
+        do
+        {
+            r = ::sendmsg(fd, &msgs[i].msg_hdr, flags);
+        }
+        while (r < 0 && errno == EINTR);
+
+        if (r < 0)
+            return i ? static_cast<int>(i) : -1;
+        msgs[i].msg_len = static_cast<unsigned int>(r);
+    }
+    return static_cast<int>(i);
+#endif
+}
+
+/// Return the UDP_GRO segment size of a received message, or 0.
+inline std::size_t
+gro_segment_size(msghdr const& hdr) noexcept
+{
+#if defined(__linux__)
+    auto* h = const_cast<msghdr*>(&hdr);
+    for (cmsghdr* cm = CMSG_FIRSTHDR(h); cm; cm = CMSG_NXTHDR(h, cm))
+    {
+        if (cm->cmsg_level == IPPROTO_UDP && cm->cmsg_type == UDP_GRO)
+        {
+            int gso = 0;
+            std::memcpy(&gso, CMSG_DATA(cm), sizeof(gso));
+            return gso > 0 ? static_cast<std::size_t>(gso) : 0;
+        }
+    }
+#else
+    (void)hdr;
+#endif
+    return 0;
+}
+
+/// Copy received sizes, sources, GRO segment sizes, and ancillary
+/// data into the slots.
+inline void
+finish_recv_batch(
+    batch_msghdr const* msgs,
+    sockaddr_storage const* names,
+    datagram_slot* slots,
+    std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        slots[i].size = msgs[i].msg_len;
+        slots[i].peer = from_sockaddr_as(
+            names[i], msgs[i].msg_hdr.msg_namelen, endpoint{});
+        slots[i].segment_size = gro_segment_size(msgs[i].msg_hdr);
+        parse_datagram_info(
+            msgs[i].msg_hdr.msg_control, msgs[i].msg_hdr.msg_controllen,
+            slots[i].info);
+    }
+}
+
+/// Copy sent sizes back into the slots.
+inline void
+finish_send_batch(
+    batch_msghdr const* msgs,
+    const_datagram_slot* slots,
+    std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+        slots[i].size = msgs[i].msg_len;
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_BATCH_HPP
@@ -0,0 +1,272 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_CONTROL_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_CONTROL_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/datagram_info.hpp>
+#include <boost/corosio/endpoint.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+
+/*
+    Translation between datagram_info and the control messages carried
+    by recvmsg(2)/sendmsg(2).
+
+    Each recv_from / send_to op embeds one datagram_control buffer, so
+    recv_msg and send_msg never allocate. Unknown control messages are
+    skipped; a truncated buffer (MSG_CTRUNC) only loses the tail.
+*/
+
+namespace boost::corosio::detail {
+
+/// Control message storage for one datagram.
+struct datagram_control
+{
+    alignas(cmsghdr) unsigned char buf[256];
+};
+
+/** Fill a datagram_info from received control messages.
+
+    Every field is reset first, so groups the kernel did not report
+    read as absent.
+*/
+inline void
+parse_datagram_info(
+    void const* control, std::size_t len, datagram_info& info) noexcept
+{
+    info = {};
+    if (!control || len == 0)
+        return;
+
+    msghdr msg{};
+    msg.msg_control    = const_cast<void*>(control);
+    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(len);
+
+    for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+    {
+        unsigned char const* data = CMSG_DATA(cm);
+
+        if (cm->cmsg_level == IPPROTO_IP)
+        {
+#if defined(IP_PKTINFO)
+            if (cm->cmsg_type == IP_PKTINFO)
+            {
+                in_pktinfo pi;
+                std::memcpy(&pi, data, sizeof(pi));
+                ipv4_address::bytes_type b;
+                std::memcpy(b.data(), &pi.ipi_addr, 4);
+                info.local_address     = endpoint(ipv4_address(b), 0);
+                info.interface_index   = static_cast<unsigned>(pi.ipi_ifindex);
+                info.has_local_address = true;
+                continue;
+            }
+#elif defined(IP_RECVDSTADDR)
+            if (cm->cmsg_type == IP_RECVDSTADDR)
+            {
+                ipv4_address::bytes_type b;
+                std::memcpy(b.data(), data, 4);
+                info.local_address     = endpoint(ipv4_address(b), 0);
+                info.has_local_address = true;
+                continue;
+            }
+#endif
+            // Linux reports the byte as IP_TOS, BSDs as IP_RECVTOS
+#if defined(IP_RECVTOS)
+            if (cm->cmsg_type == IP_TOS || cm->cmsg_type == IP_RECVTOS)
+#else
+            if (cm->cmsg_type == IP_TOS)
+#endif
+            {
+                info.tos     = data[0];
+                info.has_tos = true;
+                continue;
+            }
+        }
+        else if (cm->cmsg_level == IPPROTO_IPV6)
+        {
+#if defined(IPV6_PKTINFO)
+            if (cm->cmsg_type == IPV6_PKTINFO)
+            {
+                in6_pktinfo pi;
+                std::memcpy(&pi, data, sizeof(pi));
+                ipv6_address::bytes_type b;
+                std::memcpy(b.data(), &pi.ipi6_addr, 16);
+                info.local_address     = endpoint(ipv6_address(b), 0);
+                info.interface_index   = static_cast<unsigned>(pi.ipi6_ifindex);
+                info.has_local_address = true;
+                continue;
+            }
+#endif
+#if defined(IPV6_TCLASS)
+            if (cm->cmsg_type == IPV6_TCLASS)
+            {
+                int tclass = 0;
+                std::memcpy(&tclass, data, sizeof(tclass));
+                info.tos     = static_cast<std::uint8_t>(tclass);
+                info.has_tos = true;
+                continue;
+            }
+#endif
+        }
+        else if (cm->cmsg_level == SOL_SOCKET)
+        {
+#if defined(SCM_TIMESTAMPNS)
+            if (cm->cmsg_type == SCM_TIMESTAMPNS)
+            {
+                timespec ts;
+                std::memcpy(&ts, data, sizeof(ts));
+                info.timestamp = std::chrono::seconds(ts.tv_sec) +
+                    std::chrono::nanoseconds(ts.tv_nsec);
+                info.has_timestamp = true;
+                continue;
+            }
+#endif
+#if defined(SCM_TIMESTAMP)
+            if (cm->cmsg_type == SCM_TIMESTAMP)
+            {
+                timeval tv;
+                std::memcpy(&tv, data, sizeof(tv));
+                info.timestamp = std::chrono::seconds(tv.tv_sec) +
+                    std::chrono::microseconds(tv.tv_usec);
+                info.has_timestamp = true;
+                continue;
+            }
+#endif
+#if defined(SO_RXQ_OVFL)
+            if (cm->cmsg_type == SO_RXQ_OVFL)
+            {
+                std::uint32_t drops = 0;
+                std::memcpy(&drops, data, sizeof(drops));
+                info.drops     = drops;
+                info.has_drops = true;
+                continue;
+            }
+#endif
+        }
+    }
+}
+
+/// Append one control message; returns false when @p ctl is full.
+inline bool
+append_control(
+    datagram_control& ctl,
+    std::size_t& len,
+    int level,
+    int type,
+    void const* data,
+    std::size_t size) noexcept
+{
+    if (len + CMSG_SPACE(size) > sizeof(ctl.buf))
+        return false;
+
+    // CMSG_FIRSTHDR/NXTHDR would need a zeroed buffer; lay out directly
+    auto* cm = reinterpret_cast<cmsghdr*>(ctl.buf + len);
+    std::memset(cm, 0, CMSG_SPACE(size));
+    cm->cmsg_level = level;
+    cm->cmsg_type  = type;
+    cm->cmsg_len   = CMSG_LEN(size);
+    std::memcpy(CMSG_DATA(cm), data, size);
+    len += CMSG_SPACE(size);
+    return true;
+}
+
+/** Build the control messages for sending with @p info.
+
+    Applies the source address and interface (`IP_PKTINFO`,
+    `IP_SENDSRCADDR`, or `IPV6_PKTINFO`) and the traffic class
+    (`IP_TOS` on Linux, `IPV6_TCLASS`). Timestamp and drop
+    fields are receive-only and ignored.
+
+    @param family The socket's address family.
+    @return The control length to pass as msg_controllen, or 0.
+*/
+inline std::size_t
+build_datagram_control(
+    datagram_control& ctl, int family, datagram_info const& info) noexcept
+{
+    std::size_t len = 0;
+
+    if (family == AF_INET)
+    {
+        if (info.has_local_address && info.local_address.is_v4())
+        {
+            auto bytes = info.local_address.v4_address().to_bytes();
+#if defined(IP_PKTINFO)
+            in_pktinfo pi{};
+            pi.ipi_ifindex = static_cast<int>(info.interface_index);
+            std::memcpy(&pi.ipi_spec_dst, bytes.data(), 4);
+            append_control(ctl, len, IPPROTO_IP, IP_PKTINFO, &pi, sizeof(pi));
+#elif defined(IP_SENDSRCADDR)
+            in_addr a;
+            std::memcpy(&a, bytes.data(), 4);
+            append_control(ctl, len, IPPROTO_IP, IP_SENDSRCADDR, &a, sizeof(a));
+#endif
+        }
+#if defined(__linux__)
+        if (info.has_tos)
+        {
+            int tos = info.tos;
+            append_control(ctl, len, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+        }
+#endif
+    }
+    else if (family == AF_INET6)
+    {
+#if defined(IPV6_PKTINFO)
+        if (info.has_local_address)
+        {
+            in6_pktinfo pi{};
+            pi.ipi6_ifindex = info.interface_index;
+            if (info.local_address.is_v6())
+            {
+                auto bytes = info.local_address.v6_address().to_bytes();
+                std::memcpy(&pi.ipi6_addr, bytes.data(), 16);
+            }
+            else
+            {
+                // IPv4 source on a dual-stack socket: ::ffff:a.b.c.d
+                auto bytes = info.local_address.v4_address().to_bytes();
+                pi.ipi6_addr.s6_addr[10] = 0xff;
+                pi.ipi6_addr.s6_addr[11] = 0xff;
+                std::memcpy(&pi.ipi6_addr.s6_addr[12], bytes.data(), 4);
+            }
+            append_control(
+                ctl, len, IPPROTO_IPV6, IPV6_PKTINFO, &pi, sizeof(pi));
+        }
+#endif
+#if defined(IPV6_TCLASS)
+        if (info.has_tos)
+        {
+            int tclass = info.tos;
+            append_control(
+                ctl, len, IPPROTO_IPV6, IPV6_TCLASS, &tclass, sizeof(tclass));
+        }
+#endif
+    }
+    return len;
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_DATAGRAM_CONTROL_HPP
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_DIRECT_IO_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_DIRECT_IO_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/capy/buffers.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if BOOST_COROSIO_POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#endif
+
+/*
+    Direct (unbuffered) file I/O helpers
+    ====================================
+
+    file_base::direct maps to O_DIRECT (Linux, FreeBSD), F_NOCACHE
+    (macOS) or FILE_FLAG_NO_BUFFERING (Windows). The kernel then
+    DMAs straight into the caller's buffers, which must be aligned
+    to the device's logical block size, as must the file offset and
+    every transfer length.
+
+    A misaligned request fails inside the kernel with EINVAL, or on
+    some filesystems silently falls back to buffered I/O. Backends
+    check alignment up front with direct_io_aligned instead, so the
+    error is immediate, portable, and never reaches the thread pool
+    or the ring.
+*/
+
+namespace boost::corosio::detail {
+
+/// Alignment assumed when the kernel cannot report one.
+inline constexpr std::size_t default_direct_io_alignment = 4096;
+
+#if BOOST_COROSIO_POSIX
+
+/** Return the O_DIRECT alignment required by an open file.
+
+    Uses `statx(STATX_DIOALIGN)` where available (Linux 6.1),
+    taking the larger of the memory and offset alignments.
+    Otherwise returns @ref default_direct_io_alignment, which
+    satisfies every device with logical blocks up to 4 KiB.
+*/
+inline std::size_t
+direct_io_alignment(int fd) noexcept
+{
+#if defined(__linux__) && defined(STATX_DIOALIGN)
+    struct statx stx{};
+    if (::statx(fd, "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx) == 0 &&
+        (stx.stx_mask & STATX_DIOALIGN) && stx.stx_dio_offset_align != 0)
+    {
+        std::size_t a = stx.stx_dio_offset_align;
+        if (stx.stx_dio_mem_align > a)
+            a = stx.stx_dio_mem_align;
+        return a;
+    }
+#else
+    (void)fd;
+#endif
+    return default_direct_io_alignment;
+}
+
+/** Return the direct I/O alignment of an adopted descriptor.
+
+    Zero when the descriptor was not opened with O_DIRECT, or
+    when the flag cannot be observed (F_NOCACHE is not reported
+    by F_GETFL).
+*/
+inline std::size_t
+adopted_direct_io_alignment(int fd) noexcept
+{
+#ifdef O_DIRECT
+    int fl = ::fcntl(fd, F_GETFL);
+    if (fl >= 0 && (fl & O_DIRECT) != 0)
+        return direct_io_alignment(fd);
+#else
+    (void)fd;
+#endif
+    return 0;
+}
+
+/** Request direct I/O on an open descriptor where the flag is
+    not an open(2) option.
+
+    Sets F_NOCACHE on macOS; a no-op where O_DIRECT is an
+    open(2) flag instead.
+*/
+inline int
+enable_direct_io(int fd) noexcept
+{
+#if defined(F_NOCACHE)
+    return ::fcntl(fd, F_NOCACHE, 1);
+#else
+    (void)fd;
+    return 0;
+#endif
+}
+
+/// open(2) flag for file_base::direct, or zero.
+#ifdef O_DIRECT
+inline constexpr int direct_open_flag = O_DIRECT;
+#else
+inline constexpr int direct_open_flag = 0;
+#endif
+
+#endif // BOOST_COROSIO_POSIX
+
+/** Check that a direct I/O request meets the alignment rules.
+
+    Every buffer address, every buffer length, and the file
+    offset must be multiples of @p align.
+
+    @param bufs The unrolled buffer descriptors.
+    @param count Number of descriptors in @p bufs.
+    @param offset The file offset of the transfer.
+    @param align The required alignment, a power of two.
+*/
+inline bool
+direct_io_aligned(
+    capy::mutable_buffer const* bufs,
+    std::size_t count,
+    std::uint64_t offset,
+    std::size_t align) noexcept
+{
+    std::size_t const mask = align - 1;
+    if ((offset & mask) != 0)
+        return false;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto addr = reinterpret_cast<std::uintptr_t>(bufs[i].data());
+        if ((addr & mask) != 0 || (bufs[i].size() & mask) != 0)
+            return false;
+    }
+    return true;
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_DIRECT_IO_HPP
@@ -23,6 +23,7 @@
 #include <boost/corosio/detail/timer_service.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
 #include <boost/corosio/native/detail/posix/posix_resolver_service.hpp>
+#include <boost/corosio/native/detail/posix/posix_process_service.hpp>
 #include <boost/corosio/native/detail/posix/posix_signal_service.hpp>
 #include <boost/corosio/native/detail/posix/posix_stream_file_service.hpp>
 #include <boost/corosio/native/detail/posix/posix_random_access_file_service.hpp>
@@ -120,7 +121,20 @@ public:
     */
     void deregister_descriptor(int fd) const;
 
+    /** Receive signals through the signal service's signalfd.
+
+        Registers the descriptor next to the timerfd so queued
+        signals are read on the reactor thread instead of in a
+        signal handler. Idempotent.
+
+        @throws std::system_error on failure.
+    */
+    void enable_signal_fd();
+
 private:
+    // Register the process service's epoll instance (on_open callback)
+    void watch_process_fd();
+
     void
     run_task(lock_type& lock, context_type* ctx,
         long timeout_us) override;
@@ -130,6 +144,10 @@ private:
     int epoll_fd_;
     int event_fd_;
     int timer_fd_;
+    int signal_fd_                      = -1;
+    posix_signal_service* signal_svc_   = nullptr;
+    int process_fd_                     = -1;
+    posix_process_service* process_svc_ = nullptr;
 
     // Edge-triggered eventfd state
     mutable std::atomic<bool> eventfd_armed_{false};
@@ -202,7 +220,12 @@ inline epoll_scheduler::epoll_scheduler(capy::execution_context& ctx, int)
         }));
 
     get_resolver_service(ctx, *this);
-    get_signal_service(ctx, *this);
+    signal_svc_  = &get_signal_service(ctx, *this);
+    process_svc_ = &get_process_service(ctx, *this);
+    process_svc_->set_on_open(
+        timer_service::callback(this, [](void* p) {
+            static_cast<epoll_scheduler*>(p)->watch_process_fd();
+        }));
     get_stream_file_service(ctx, *this);
     get_random_access_file_service(ctx, *this);
 
@@ -268,6 +291,37 @@ epoll_scheduler::deregister_descriptor(int fd) const
     ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
 }
 
+inline void
+epoll_scheduler::enable_signal_fd()
+{
+    if (signal_fd_ >= 0)
+        return;
+
+    int fd = signal_svc_->open_signal_fd();
+
+    epoll_event ev{};
+    ev.events   = EPOLLIN | EPOLLET;
+    ev.data.ptr = &signal_fd_;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0)
+        detail::throw_system_error(make_err(errno), "epoll_ctl (signalfd)");
+
+    signal_fd_ = fd;
+}
+
+inline void
+epoll_scheduler::watch_process_fd()
+{
+    int fd = process_svc_->watch_fd();
+
+    epoll_event ev{};
+    ev.events   = EPOLLIN | EPOLLET;
+    ev.data.ptr = &process_fd_;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) < 0)
+        detail::throw_system_error(make_err(errno), "epoll_ctl (process)");
+
+    process_fd_ = fd;
+}
+
 inline void
 epoll_scheduler::interrupt_reactor() const
 {
@@ -345,7 +399,9 @@ epoll_scheduler::run_task(
     if (nfds < 0 && errno != EINTR)
         detail::throw_system_error(make_err(errno), "epoll_wait");
 
-    bool check_timers = false;
+    bool check_timers  = false;
+    bool check_signals = false;
+    bool check_process = false;
     op_queue local_ops;
 
     for (int i = 0; i < nfds; ++i)
@@ -369,6 +425,18 @@ epoll_scheduler::run_task(
             continue;
         }
 
+        if (event_buffer_[i].data.ptr == &signal_fd_)
+        {
+            check_signals = true;
+            continue;
+        }
+
+        if (event_buffer_[i].data.ptr == &process_fd_)
+        {
+            check_process = true;
+            continue;
+        }
+
         auto* desc =
             static_cast<reactor_descriptor_state*>(event_buffer_[i].data.ptr);
         desc->add_ready_events(event_buffer_[i].events);
@@ -388,6 +456,12 @@ epoll_scheduler::run_task(
         update_timerfd();
     }
 
+    if (check_signals)
+        signal_svc_->read_signal_fd();
+
+    if (check_process)
+        process_svc_->read_ready();
+
     lock.lock();
 
     if (!local_ops.empty())
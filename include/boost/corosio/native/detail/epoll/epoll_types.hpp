@@ -73,6 +73,36 @@ public:
     explicit epoll_local_stream_socket(epoll_local_stream_service& svc) noexcept
         : base_type(svc) {}
 
+    std::coroutine_handle<> send_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        void const* control,
+        std::size_t control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_write_some(
+            h, ex, buf, token, ec, bytes_out, control, control_len);
+    }
+
+    std::coroutine_handle<> recv_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        void* control,
+        std::size_t control_cap,
+        std::size_t* control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_read_some(
+            h, ex, buf, token, ec, bytes_out, control, control_cap,
+            control_len);
+    }
+
     native_handle_type release_socket() noexcept override
     {
         hook_ = {};
@@ -94,6 +124,64 @@ class epoll_udp_socket final
 public:
     explicit epoll_udp_socket(epoll_udp_service& svc) noexcept
         : base_type(svc) {}
+
+    std::coroutine_handle<> send_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        const_datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* count_out) override
+    {
+        return this->do_send_batch(
+            h, ex, slots, count, flags, token, ec, count_out);
+    }
+
+    std::coroutine_handle<> recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* count_out) override
+    {
+        return this->do_recv_batch(
+            h, ex, slots, count, flags, token, ec, count_out);
+    }
+
+    std::coroutine_handle<> send_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        endpoint dest,
+        datagram_info const* info,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_send_to(
+            h, ex, buf, dest, flags, token, ec, bytes_out, info);
+    }
+
+    std::coroutine_handle<> recv_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        endpoint* source,
+        datagram_info* info,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_recv_from(
+            h, ex, buf, source, flags, token, ec, bytes_out, info);
+    }
 };
 
 class epoll_local_datagram_socket final
@@ -111,6 +199,50 @@ public:
     explicit epoll_local_datagram_socket(epoll_local_datagram_service& svc) noexcept
         : base_type(svc) {}
 
+    std::coroutine_handle<> send_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        void const* control,
+        std::size_t control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_send(
+            h, ex, buf, 0, token, ec, bytes_out, control, control_len);
+    }
+
+    std::coroutine_handle<> recv_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        buffer_param buf,
+        void* control,
+        std::size_t control_cap,
+        std::size_t* control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes_out) override
+    {
+        return this->do_recv(
+            h, ex, buf, 0, token, ec, bytes_out, control, control_cap,
+            control_len);
+    }
+
+    std::coroutine_handle<> recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* count_out) override
+    {
+        return this->do_recv_batch(
+            h, ex, slots, count, flags, token, ec, count_out);
+    }
+
     std::error_code shutdown(corosio::shutdown_type what) noexcept override
     {
         return this->do_shutdown(static_cast<int>(what));
@@ -0,0 +1,37 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_FD_CONTROL_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_FD_CONTROL_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <sys/socket.h>
+
+namespace boost::corosio::detail {
+
+/* recvmsg flags for receives that may carry SCM_RIGHTS.
+
+   MSG_CMSG_CLOEXEC closes the fork/exec window atomically where
+   the kernel offers it; elsewhere decode_passed_fds sets
+   FD_CLOEXEC after the fact.
+*/
+#ifdef MSG_CMSG_CLOEXEC
+inline constexpr int fd_recv_flags = MSG_CMSG_CLOEXEC;
+#else
+inline constexpr int fd_recv_flags = 0;
+#endif
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_FD_CONTROL_HPP
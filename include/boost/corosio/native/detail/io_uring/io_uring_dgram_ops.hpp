@@ -22,10 +22,13 @@
 #include <boost/corosio/native/detail/speculative_state.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_socket_ops.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/datagram_batch.hpp>
+#include <boost/corosio/native/detail/datagram_control.hpp>
 #include <boost/capy/error.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include <netinet/in.h>
 #include <sys/socket.h>
@@ -41,6 +44,9 @@ namespace boost::corosio::detail {
 
     `iovec[io_uring_max_iov]` for scatter/gather: a single datagram
     can be assembled from N user buffers via `msg.msg_iov`.
+
+    send_msg passes prebuilt control messages, which are copied into
+    `control` so they outlive the submitting call.
 */
 struct uring_dgram_send_op : io_uring_op
 {
@@ -48,6 +54,7 @@ struct uring_dgram_send_op : io_uring_op
     int              iovec_count = 0;
     msghdr           msg{};
     sockaddr_storage dest_storage{};
+    datagram_control control;
     socklen_t        dest_len  = 0;
     int              fd        = -1;
     int              msg_flags = 0;
@@ -75,7 +82,9 @@ struct uring_dgram_send_op : io_uring_op
         socklen_t                  dest_addr_len,
         sockaddr_storage const&    dest_addr_storage,
         int                        flags,
-        std::stop_token const&     token) noexcept
+        std::stop_token const&     token,
+        datagram_control const*    ctl     = nullptr,
+        std::size_t                ctl_len = 0) noexcept
     {
         h          = handle;
         ex         = executor;
@@ -108,9 +117,28 @@ struct uring_dgram_send_op : io_uring_op
         {
             dest_len = 0;
         }
+        if (ctl && ctl_len > 0)
+        {
+            std::memcpy(control.buf, ctl->buf, ctl_len);
+            msg.msg_control    = control.buf;
+            msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(
+                ctl_len);
+        }
         start(token);
     }
 
+    /** Attach caller-owned control data after prepare().
+
+        Used by send_with_fds, whose SCM_RIGHTS buffer lives in the
+        awaitable and outlives the op, so no copy is needed.
+    */
+    void attach_control(void const* ctl, std::size_t ctl_len) noexcept
+    {
+        msg.msg_control    = const_cast<void*>(ctl);
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(ctl_len);
+    }
+
     static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
     {
         auto* self = static_cast<uring_dgram_send_op*>(base);
@@ -170,6 +198,9 @@ struct uring_dgram_send_op : io_uring_op
     The `source_writer` callback lets the concrete socket type
     translate `sockaddr_storage` into `endpoint*` or `local_endpoint*`
     without the op needing to know which family it is.
+
+    For recv_msg, `info_out` is set and the kernel writes control
+    messages into `control`; the handler decodes them on success.
 */
 struct uring_dgram_recv_op : io_uring_op
 {
@@ -177,6 +208,9 @@ struct uring_dgram_recv_op : io_uring_op
     int              iovec_count = 0;
     msghdr           msg{};
     sockaddr_storage source_storage{};
+    datagram_control control;
+    datagram_info*   info_out = nullptr;
+    std::size_t*     control_len_out = nullptr;
     socklen_t        source_len = 0;
     int              fd         = -1;
     int              msg_flags  = 0;
@@ -217,7 +251,8 @@ struct uring_dgram_recv_op : io_uring_op
         void*                      source_ctx,
         void (*source_fn)(void*, sockaddr_storage const&, socklen_t) noexcept,
         int                        flags,
-        std::stop_token const&     token) noexcept
+        std::stop_token const&     token,
+        datagram_info*             info = nullptr) noexcept
     {
         h          = handle;
         ex         = executor;
@@ -266,9 +301,33 @@ struct uring_dgram_recv_op : io_uring_op
             source_writer_ctx = nullptr;
             source_writer     = nullptr;
         }
+        info_out = (iovec_count > 0) ? info : nullptr;
+        if (info_out)
+        {
+            msg.msg_control    = control.buf;
+            msg.msg_controllen = sizeof(control.buf);
+        }
+        control_len_out = nullptr;
         start(token);
     }
 
+    /** Receive control data into a caller-owned buffer.
+
+        Used by recv_with_fds. Call after prepare(); the handler
+        stores the received control length in @p len_out on success.
+    */
+    void attach_control(
+        void* ctl, std::size_t ctl_cap, std::size_t* len_out) noexcept
+    {
+        if (iovec_count == 0)
+            return;
+        msg.msg_control    = ctl;
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(ctl_cap);
+        msg_flags |= MSG_CMSG_CLOEXEC;
+        control_len_out = len_out;
+    }
+
     static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
     {
         auto* self = static_cast<uring_dgram_recv_op*>(base);
@@ -321,6 +380,265 @@ struct uring_dgram_recv_op : io_uring_op
             self->source_writer(self->source_writer_ctx,
                 self->source_storage, self->source_len);
 
+        if (self->info_out && self->res >= 0 &&
+            !self->cancelled.load(std::memory_order_acquire))
+            parse_datagram_info(
+                self->control.buf, self->msg.msg_controllen, *self->info_out);
+
+        if (self->control_len_out && self->res >= 0)
+            *self->control_len_out = self->msg.msg_controllen;
+
+        coro_resume(self);
+    }
+};
+
+/** Batched datagram receive op.
+
+    io_uring has no recvmmsg opcode, so a batch is submitted as a single
+    `IORING_OP_RECVMSG` for the first slot. When that CQE arrives the
+    socket is known to be readable, and the handler drains the remaining
+    slots with one non-blocking recvmmsg(2) before resuming the caller.
+    The result is one SQE plus at most one syscall per wakeup, with the
+    same "at least one, then whatever is queued" contract as the
+    reactor backends.
+
+    Every msghdr carries its own control buffer, so UDP_GRO segment
+    sizes arrive with the RECVMSG completion and UDP_SEGMENT sends
+    need no extra submission.
+
+    `sync_count` is non-zero when the socket already moved the batch
+    speculatively and the op was only queued to defer the resume.
+
+    `bytes_out` receives the number of datagrams, not bytes.
+*/
+struct uring_dgram_recv_batch_op : io_uring_op
+{
+    batch_msghdr     msgs[max_datagram_batch];
+    iovec            iovecs[max_datagram_batch];
+    sockaddr_storage names[max_datagram_batch];
+    batch_control    controls[max_datagram_batch];
+    datagram_slot*   slots      = nullptr;
+    unsigned         msg_count  = 0;
+    std::size_t      sync_count = 0;
+    int              fd        = -1;
+    int              msg_flags = 0;
+    detail::speculative_state* spec_state = nullptr;
+
+    uring_dgram_recv_batch_op() noexcept
+        : io_uring_op(&do_handler, &do_cqe, &do_prep) {}
+
+    /// Reset and initialize for a new submission.
+    void prepare(
+        std::coroutine_handle<>    handle,
+        capy::executor_ref         executor,
+        std::error_code*           ec,
+        std::size_t*               count_out,
+        int                        file_descriptor,
+        io_uring_scheduler*        scheduler,
+        std::shared_ptr<void>      impl,
+        detail::speculative_state* spec,
+        datagram_slot*             user_slots,
+        std::size_t                count,
+        int                        flags,
+        std::stop_token const&     token) noexcept
+    {
+        h          = handle;
+        ex         = executor;
+        ec_out     = ec;
+        bytes_out  = count_out;
+        fd         = file_descriptor;
+        sched_     = scheduler;
+        impl_ptr   = std::move(impl);
+        spec_state = spec;
+        res        = 0;
+        cqe_flags  = 0;
+        msg_flags  = flags;
+        slots      = user_slots;
+        sync_count = 0;
+        msg_count  = prepare_recv_batch(
+            msgs, iovecs, names, controls, user_slots, count,
+            max_datagram_batch);
+        start(token);
+    }
+
+    static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
+    {
+        auto* self = static_cast<uring_dgram_recv_batch_op*>(base);
+        ::io_uring_prep_recvmsg(
+            sqe, self->fd, &self->msgs[0].msg_hdr, self->msg_flags);
+    }
+
+    static void do_cqe(
+        io_uring_op* base, int res, unsigned flags, op_queue& local) noexcept
+    {
+        auto* self = static_cast<uring_dgram_recv_batch_op*>(base);
+        self->res       = res;
+        self->cqe_flags = flags;
+        local.push(self);
+    }
+
+    static void do_handler(
+        void* owner, scheduler_op* base,
+        std::uint32_t /*bytes*/, std::uint32_t /*error*/) noexcept
+    {
+        auto* self = static_cast<uring_dgram_recv_batch_op*>(base);
+        if (coro_drain_if_shutdown(owner, self))
+            return;
+
+        if (self->sched_)
+            self->sched_->reset_inline_budget();
+
+        bool cancelled = self->cancelled.load(std::memory_order_acquire);
+        decode_io_result(
+            self->ec_out, cancelled,
+            self->res < 0 ? make_err(-self->res) : std::error_code{},
+            /*is_read=*/false, /*bytes=*/0, /*empty_buffer=*/false);
+
+        std::size_t n = 0;
+        if (!cancelled && self->sync_count > 0)
+        {
+            n = self->sync_count;
+        }
+        else if (!cancelled && self->res >= 0 && self->msg_count > 0)
+        {
+            self->msgs[0].msg_len = static_cast<unsigned>(self->res);
+            n = 1;
+            if (self->msg_count > 1)
+            {
+                int more = recv_batch_msgs(
+                    self->fd, self->msgs + 1, self->msg_count - 1,
+                    self->msg_flags | MSG_DONTWAIT);
+                if (more > 0)
+                    n += static_cast<std::size_t>(more);
+            }
+            if (self->spec_state)
+                self->spec_state->on_async_read_ready();
+        }
+        finish_recv_batch(self->msgs, self->names, self->slots, n);
+        if (self->bytes_out)
+            *self->bytes_out = n;
+
+        coro_resume(self);
+    }
+};
+
+/** Batched datagram send op.
+
+    Mirrors `uring_dgram_recv_batch_op`: the first slot goes out as an
+    `IORING_OP_SENDMSG`, and once it completes the remaining slots are
+    flushed with one non-blocking sendmmsg(2). A short count is reported
+    as-is; the caller resubmits the tail.
+
+    `bytes_out` receives the number of datagrams, not bytes.
+*/
+struct uring_dgram_send_batch_op : io_uring_op
+{
+    batch_msghdr         msgs[max_datagram_batch];
+    iovec                iovecs[max_datagram_batch];
+    sockaddr_storage     names[max_datagram_batch];
+    batch_control        controls[max_datagram_batch];
+    const_datagram_slot* slots      = nullptr;
+    unsigned             msg_count  = 0;
+    std::size_t          sync_count = 0;
+    int                  fd        = -1;
+    int                  msg_flags = 0;
+    detail::speculative_state* spec_state = nullptr;
+
+    uring_dgram_send_batch_op() noexcept
+        : io_uring_op(&do_handler, &do_cqe, &do_prep) {}
+
+    /// Reset and initialize for a new submission.
+    void prepare(
+        std::coroutine_handle<>    handle,
+        capy::executor_ref         executor,
+        std::error_code*           ec,
+        std::size_t*               count_out,
+        int                        file_descriptor,
+        io_uring_scheduler*        scheduler,
+        std::shared_ptr<void>      impl,
+        detail::speculative_state* spec,
+        const_datagram_slot*       user_slots,
+        std::size_t                count,
+        int                        flags,
+        std::stop_token const&     token) noexcept
+    {
+        h          = handle;
+        ex         = executor;
+        ec_out     = ec;
+        bytes_out  = count_out;
+        fd         = file_descriptor;
+        sched_     = scheduler;
+        impl_ptr   = std::move(impl);
+        spec_state = spec;
+        res        = 0;
+        cqe_flags  = 0;
+        msg_flags  = flags;
+        slots      = user_slots;
+        sync_count = 0;
+        msg_count  = prepare_send_batch(
+            file_descriptor, msgs, iovecs, names, controls, user_slots,
+            count, max_datagram_batch);
+        start(token);
+    }
+
+    static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
+    {
+        auto* self = static_cast<uring_dgram_send_batch_op*>(base);
+        ::io_uring_prep_sendmsg(
+            sqe, self->fd, &self->msgs[0].msg_hdr,
+            self->msg_flags | MSG_NOSIGNAL);
+    }
+
+    static void do_cqe(
+        io_uring_op* base, int res, unsigned flags, op_queue& local) noexcept
+    {
+        auto* self = static_cast<uring_dgram_send_batch_op*>(base);
+        self->res       = res;
+        self->cqe_flags = flags;
+        local.push(self);
+    }
+
+    static void do_handler(
+        void* owner, scheduler_op* base,
+        std::uint32_t /*bytes*/, std::uint32_t /*error*/) noexcept
+    {
+        auto* self = static_cast<uring_dgram_send_batch_op*>(base);
+        if (coro_drain_if_shutdown(owner, self))
+            return;
+
+        if (self->sched_)
+            self->sched_->reset_inline_budget();
+
+        bool cancelled = self->cancelled.load(std::memory_order_acquire);
+        decode_io_result(
+            self->ec_out, cancelled,
+            self->res < 0 ? make_err(-self->res) : std::error_code{},
+            /*is_read=*/false, /*bytes=*/0, /*empty_buffer=*/false);
+
+        std::size_t n = 0;
+        if (!cancelled && self->sync_count > 0)
+        {
+            n = self->sync_count;
+        }
+        else if (!cancelled && self->res >= 0 && self->msg_count > 0)
+        {
+            self->msgs[0].msg_len = static_cast<unsigned>(self->res);
+            n = 1;
+            if (self->msg_count > 1)
+            {
+                int more = send_batch_msgs(
+                    self->fd, self->msgs + 1, self->msg_count - 1,
+                    self->msg_flags | MSG_DONTWAIT);
+                if (more > 0)
+                    n += static_cast<std::size_t>(more);
+            }
+            if (self->spec_state)
+                self->spec_state->on_async_write_ready();
+        }
+        finish_send_batch(self->msgs, self->slots, n);
+        if (self->bytes_out)
+            *self->bytes_out = n;
+
         coro_resume(self);
     }
 };
@@ -17,8 +17,11 @@
 #include <boost/corosio/native/detail/io_uring/io_uring_op.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_socket_ops.hpp>
 #include <boost/corosio/native/detail/coro_op_complete.hpp>
+#include <boost/corosio/native/detail/read_batch.hpp>
+#include <boost/corosio/detail/continuation_op.hpp>
 #include <boost/corosio/detail/dispatch_coro.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <sys/uio.h>
 
@@ -178,6 +181,62 @@ struct uring_random_access_read_op : uring_file_read_op_base
     }
 };
 
+/// Completion state shared by the ops of one random_access_file
+/// read_batch. The last op to complete resumes the caller.
+struct uring_read_batch
+{
+    std::coroutine_handle<>            h;
+    capy::executor_ref                 ex;
+    std::error_code*                   ec_out    = nullptr;
+    std::size_t*                       bytes_out = nullptr;
+    random_access_file::read_request*  reqs      = nullptr;
+    std::size_t                        count     = 0;
+    std::atomic<std::size_t>           remaining{0};
+    continuation_op                    cont_op;
+};
+
+/// One range of a read_batch. Its own `ec_out`/`bytes_out` point
+/// into the caller's read_request.
+struct uring_batch_read_op : uring_file_read_op_base
+{
+    uring_read_batch* batch = nullptr;
+
+    uring_batch_read_op() noexcept
+        : uring_file_read_op_base(&do_handler) {}
+
+    static void do_handler(
+        void* owner, scheduler_op* base,
+        std::uint32_t /*bytes*/, std::uint32_t /*error*/) noexcept
+    {
+        auto* self = static_cast<uring_batch_read_op*>(base);
+        self->stop_cb.reset();
+
+        auto* b = self->batch;
+        if (owner != nullptr)
+        {
+            uring_set_result(self, /*is_read=*/true, self->empty_buffer);
+            if (self->bytes_out)
+                *self->bytes_out =
+                    self->res >= 0 ? static_cast<std::size_t>(self->res) : 0u;
+        }
+        delete self;
+
+        if (b->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        if (owner == nullptr)
+        {
+            delete b;
+            return;
+        }
+
+        finish_read_batch(b->reqs, b->count, b->ec_out, b->bytes_out);
+        b->cont_op.cont.h = b->h;
+        auto next = dispatch_coro(b->ex, b->cont_op.cont);
+        delete b;
+        next.resume();
+    }
+};
+
 /** Scatter-gather file write via `IORING_OP_WRITEV`.
 
     Stream files pass `offset == -1` (kernel f_pos); random-access
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_IO_URING_IO_URING_FILESYSTEM_SERVICE_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_IO_URING_IO_URING_FILESYSTEM_SERVICE_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_HAS_IO_URING
+
+#include <boost/corosio/detail/filesystem_service.hpp>
+#include <boost/corosio/native/detail/io_uring/io_uring_op.hpp>
+#include <boost/corosio/native/detail/io_uring/io_uring_scheduler.hpp>
+#include <boost/corosio/native/detail/io_uring/io_uring_socket_ops.hpp>
+#include <boost/corosio/native/detail/posix/posix_file_status.hpp>
+#include <boost/corosio/detail/dispatch_coro.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <fcntl.h>
+#include <liburing.h>
+
+/*
+    Path operations on the ring
+    ===========================
+
+    STATX (5.6), UNLINKAT and RENAMEAT (5.11) and MKDIRAT (5.15)
+    resolve the path in the kernel, so a stat or rename never
+    occupies a run() thread or a pool thread. The ring is probed
+    once, on first use; an opcode the kernel lacks makes submit
+    decline and the caller falls back to the thread pool.
+
+    Each request is a heap-allocated op holding pointers to the
+    caller's paths (which live in the awaiting coroutine's frame
+    until completion) and, for a stat, the statx buffer the kernel
+    fills in.
+*/
+
+namespace boost::corosio::detail {
+
+/// One path operation submitted to the ring.
+struct uring_fs_op : io_uring_op
+{
+    fs_request req;
+    struct ::statx stx{};
+
+    uring_fs_op() noexcept : io_uring_op(&do_handler, &do_cqe, &do_prep) {}
+
+    static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
+    {
+        auto* self    = static_cast<uring_fs_op*>(base);
+        auto const& r = self->req;
+        switch (r.op)
+        {
+        case fs_request::kind::stat:
+            ::io_uring_prep_statx(
+                sqe, AT_FDCWD, r.path->c_str(), 0,
+                STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_MTIME,
+                &self->stx);
+            break;
+        case fs_request::kind::unlink:
+            ::io_uring_prep_unlinkat(sqe, AT_FDCWD, r.path->c_str(), 0);
+            break;
+        case fs_request::kind::rename:
+            ::io_uring_prep_renameat(
+                sqe, AT_FDCWD, r.path->c_str(), AT_FDCWD,
+                r.new_path->c_str(), 0);
+            break;
+        case fs_request::kind::mkdir:
+            ::io_uring_prep_mkdirat(
+                sqe, AT_FDCWD, r.path->c_str(),
+                static_cast<mode_t>(r.perms) & 07777);
+            break;
+        }
+    }
+
+    static void do_cqe(
+        io_uring_op* base, int res, unsigned flags,
+        op_queue& local) noexcept
+    {
+        auto* self      = static_cast<uring_fs_op*>(base);
+        self->res       = res;
+        self->cqe_flags = flags;
+        local.push(self);
+    }
+
+    static void do_handler(
+        void* owner, scheduler_op* base,
+        std::uint32_t /*bytes*/, std::uint32_t /*error*/) noexcept
+    {
+        auto* self = static_cast<uring_fs_op*>(base);
+        self->stop_cb.reset();
+
+        if (owner == nullptr)
+        {
+            delete self;
+            return;
+        }
+
+        uring_set_result(self, /*is_read=*/false, /*empty_buf=*/false);
+        if (!*self->ec_out && self->req.op == fs_request::kind::stat)
+        {
+            auto const& x     = self->stx;
+            *self->req.status = make_file_status(
+                x.stx_mode, x.stx_size, x.stx_mtime.tv_sec,
+                static_cast<long>(x.stx_mtime.tv_nsec));
+        }
+        self->cont_op.cont.h = self->h;
+        auto next            = dispatch_coro(self->ex, self->cont_op.cont);
+        delete self;
+        next.resume();
+    }
+};
+
+/** Native io_uring filesystem service.
+
+    Registered under the abstract `filesystem_service` key by
+    `io_uring_t::construct`.
+*/
+class BOOST_COROSIO_DECL io_uring_filesystem_service final
+    : public filesystem_service
+{
+    io_uring_scheduler* sched_;
+    std::once_flag probe_once_;
+    bool supported_[4] = {};
+
+    void probe() noexcept
+    {
+        ::io_uring_probe* p = ::io_uring_get_probe();
+        if (!p)
+            return;
+        supported_[int(fs_request::kind::stat)] =
+            ::io_uring_opcode_supported(p, IORING_OP_STATX);
+        supported_[int(fs_request::kind::unlink)] =
+            ::io_uring_opcode_supported(p, IORING_OP_UNLINKAT);
+        supported_[int(fs_request::kind::rename)] =
+            ::io_uring_opcode_supported(p, IORING_OP_RENAMEAT);
+        supported_[int(fs_request::kind::mkdir)] =
+            ::io_uring_opcode_supported(p, IORING_OP_MKDIRAT);
+        ::io_uring_free_probe(p);
+    }
+
+public:
+    explicit io_uring_filesystem_service(
+        capy::execution_context& /*ctx*/, io_uring_scheduler& sched) noexcept
+        : sched_(&sched)
+    {
+    }
+
+    void shutdown() override {}
+
+    bool submit(
+        fs_request& req,
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        std::stop_token const& token) override
+    {
+        std::call_once(probe_once_, [this] { probe(); });
+        if (!supported_[int(req.op)])
+            return false;
+
+        auto op_guard = std::make_unique<uring_fs_op>();
+        auto* op      = op_guard.get();
+        op->req       = req;
+        op->h         = h;
+        op->ex        = ex;
+        op->ec_out    = req.ec;
+        op->sched_    = sched_;
+        op->res       = 0;
+        op->start(token);
+        sched_->work_started();
+
+        if (op->cancelled.load(std::memory_order_acquire))
+        {
+            io_uring_scheduler::lock_type lock(sched_->dispatch_mutex());
+            sched_->push_completed_locked(op_guard.release());
+            return true;
+        }
+
+        io_uring_submit_op(*sched_, op_guard.release());
+        return true;
+    }
+};
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_HAS_IO_URING
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_IO_URING_IO_URING_FILESYSTEM_SERVICE_HPP
@@ -19,6 +19,7 @@
 #include <boost/corosio/native/detail/io_uring/io_uring_file_ops.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_file_service_base.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_scheduler.hpp>
+#include <boost/corosio/native/detail/direct_io.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
 #include <boost/corosio/random_access_file.hpp>
 
@@ -46,6 +47,15 @@ class io_uring_random_access_file_service;
     operations (open, size, resize, sync, close) are synchronous
     syscalls.
 
+    `read_batch` queues one `READV` per range; they reach the kernel
+    in the same submit, and only the last completion resumes the
+    caller.
+
+    Buffered regular-file reads that miss the page cache are punted
+    to io-wq worker threads by the kernel. Files opened with
+    `file_base::direct` avoid that: O_DIRECT reads and writes are
+    issued to the block layer straight from the submitting task.
+
     @par Thread Safety
     Concurrent `read_some_at` / `write_some_at` calls on the same
     file at distinct offsets are safe; ordering between two
@@ -61,6 +71,7 @@ class BOOST_COROSIO_DECL io_uring_random_access_file final
 
     int                  fd_    = -1;
     io_uring_scheduler*  sched_ = nullptr;
+    std::size_t          direct_align_ = 0; // nonzero when O_DIRECT
 
     // Random-access files legitimately support concurrent ops at
     // different offsets on the same fd (e.g. parallel reads in
@@ -97,6 +108,15 @@ public:
         std::error_code*,
         std::size_t*) override;
 
+    std::coroutine_handle<> read_batch(
+        random_access_file::read_request*,
+        std::size_t,
+        std::coroutine_handle<>,
+        capy::executor_ref,
+        std::stop_token,
+        std::error_code*,
+        std::size_t*) override;
+
     native_handle_type native_handle() const noexcept override
     {
         return fd_;
@@ -150,6 +170,7 @@ public:
     {
         int fd = fd_;
         fd_ = -1;
+        direct_align_ = 0;
         return fd;
     }
 
@@ -157,6 +178,7 @@ public:
     {
         close_file();
         fd_ = handle;
+        direct_align_ = adopted_direct_io_alignment(handle);
     }
 
     // -- Internal --
@@ -184,6 +206,10 @@ public:
             oflags |= O_TRUNC;
         if ((mode & file_base::sync_all_on_write) != file_base::flags(0))
             oflags |= O_SYNC;
+        bool const direct =
+            (mode & file_base::direct) != file_base::flags(0);
+        if (direct)
+            oflags |= direct_open_flag;
 
         oflags |= O_CLOEXEC;
 
@@ -192,11 +218,14 @@ public:
             return make_err(errno);
 
         fd_ = fd;
+        if (direct)
+            direct_align_ = direct_io_alignment(fd_);
 
 #ifdef POSIX_FADV_RANDOM
         // Hint the page cache that access will be random; matches
         // the POSIX backend.
-        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_RANDOM);
+        if (!direct)
+            ::posix_fadvise(fd_, 0, 0, POSIX_FADV_RANDOM);
 #endif
 
         return {};
@@ -211,6 +240,19 @@ public:
             ::close(fd_);
             fd_ = -1;
         }
+        direct_align_ = 0;
+    }
+
+private:
+    // Reject misaligned direct I/O before it reaches the ring.
+    bool misaligned(
+        std::uint64_t offset, buffer_param const& buffers) const noexcept
+    {
+        if (direct_align_ == 0)
+            return false;
+        capy::mutable_buffer bufs[io_uring_max_iov];
+        auto n = buffers.copy_to(bufs, io_uring_max_iov);
+        return !direct_io_aligned(bufs, n, offset, direct_align_);
     }
 };
 
@@ -224,6 +266,13 @@ io_uring_random_access_file::read_some_at(
     std::error_code*        ec,
     std::size_t*            bytes)
 {
+    if (misaligned(user_offset, buffers))
+    {
+        *ec    = make_err(EINVAL);
+        *bytes = 0;
+        return h;
+    }
+
     auto op_guard = std::make_unique<uring_random_access_read_op>();
     op_guard->prepare(h, ex, ec, bytes, fd_,
         static_cast<std::int64_t>(user_offset),
@@ -252,6 +301,13 @@ io_uring_random_access_file::write_some_at(
     std::error_code*        ec,
     std::size_t*            bytes)
 {
+    if (misaligned(user_offset, buffers))
+    {
+        *ec    = make_err(EINVAL);
+        *bytes = 0;
+        return h;
+    }
+
     auto op_guard = std::make_unique<uring_random_access_write_op>();
     op_guard->prepare(h, ex, ec, bytes, fd_,
         static_cast<std::int64_t>(user_offset),
@@ -270,6 +326,56 @@ io_uring_random_access_file::write_some_at(
     return std::noop_coroutine();
 }
 
+inline std::coroutine_handle<>
+io_uring_random_access_file::read_batch(
+    random_access_file::read_request* reqs,
+    std::size_t             count,
+    std::coroutine_handle<> h,
+    capy::executor_ref      ex,
+    std::stop_token         token,
+    std::error_code*        ec,
+    std::size_t*            bytes)
+{
+    init_read_batch(reqs, count);
+
+    auto* batch      = new uring_read_batch();
+    batch->h         = h;
+    batch->ex        = ex;
+    batch->ec_out    = ec;
+    batch->bytes_out = bytes;
+    batch->reqs      = reqs;
+    batch->count     = count;
+    // Set before the first submit: any op may complete at once
+    batch->remaining.store(count, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& r = reqs[i];
+        auto* op  = new uring_batch_read_op();
+        op->batch = batch;
+        op->prepare(h, ex, &r.ec, &r.bytes_transferred, fd_,
+            static_cast<std::int64_t>(r.offset),
+            sched_, shared_from_this(), buffer_param(r.buffer), token);
+        sched_->work_started();
+
+        bool const bad = direct_align_ != 0 &&
+            !direct_io_aligned(&r.buffer, 1, r.offset, direct_align_);
+        if (bad)
+            op->res = -EINVAL;
+
+        if (bad || op->empty_buffer ||
+            op->cancelled.load(std::memory_order_acquire))
+        {
+            io_uring_scheduler::lock_type lock(sched_->dispatch_mutex());
+            sched_->push_completed_locked(op);
+            continue;
+        }
+
+        io_uring_submit_op(*sched_, op);
+    }
+    return std::noop_coroutine();
+}
+
 /** Native io_uring random-access-file service.
 
     Owns all `io_uring_random_access_file` impls. Replaces
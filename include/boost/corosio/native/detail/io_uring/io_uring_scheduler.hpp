@@ -28,6 +28,7 @@
 #include <boost/corosio/native/detail/io_uring/io_uring_op.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
 #include <boost/corosio/native/detail/posix/posix_resolver_service.hpp>
+#include <boost/corosio/native/detail/posix/posix_process_service.hpp>
 #include <boost/corosio/native/detail/posix/posix_signal_service.hpp>
 #include <boost/capy/ex/execution_context.hpp>
 
@@ -268,6 +269,17 @@ public:
     /// Return true if single-threaded (lockless) mode is active.
     bool is_single_threaded() const noexcept override { return single_threaded_; }
 
+    /** Receive signals through the signal service's signalfd.
+
+        Arms a multishot POLL_ADD on the descriptor (at ring init,
+        or immediately if the ring is already up) so queued signals
+        are read in process_completions instead of in a signal
+        handler. Idempotent.
+
+        @throws std::system_error if the signalfd cannot be created.
+    */
+    void enable_signal_fd();
+
 private:
     // ring_ + wakeup_eventfd_ are mutable so lazy_init_ring() (called
     // from const contexts like post()) can populate them on first use.
@@ -316,6 +328,12 @@ private:
     int                               sq_thread_cpu_     = -1;
 
     int                               cancel_sentinel_ = 0;
+    // Descriptors of the signal and process services; the address of
+    // each member is the user_data of its multishot poll.
+    int                               signal_fd_       = -1;
+    posix_signal_service*             signal_svc_      = nullptr;
+    int                               process_fd_      = -1;
+    posix_process_service*            process_svc_     = nullptr;
     mutable std::atomic<bool>         wakeup_armed_{false};
 
     /// Flushes the SQ ring and drains CQEs in one mutex-held pass.
@@ -356,6 +374,8 @@ private:
     std::size_t do_one(long timeout_us);
     void        process_completions();
     void        drain_wakeup_eventfd() const noexcept;
+    void        arm_fd_poll(int const& fd) const noexcept;
+    void        watch_process_fd();
     void        lazy_init_ring_unlocked() const;
 };
 
@@ -376,7 +396,12 @@ io_uring_scheduler::io_uring_scheduler(
         }));
 
     get_resolver_service(ctx, *this);
-    get_signal_service(ctx, *this);
+    signal_svc_  = &get_signal_service(ctx, *this);
+    process_svc_ = &get_process_service(ctx, *this);
+    process_svc_->set_on_open(
+        timer_service::callback(this, [](void* p) {
+            static_cast<io_uring_scheduler*>(p)->watch_process_fd();
+        }));
 
     // Ring init is deferred to lazy_init_ring() so configure_single_-
     // threaded(true), which the io_context applies after construction,
@@ -495,6 +520,8 @@ io_uring_scheduler::lazy_init_ring_unlocked() const
     // full SQ, leaving no SQE to detect future wakes).
     ::io_uring_prep_poll_multishot(sqe, wakeup_eventfd_, POLLIN);
     ::io_uring_sqe_set_data(sqe, nullptr);
+    if (signal_fd_ >= 0)
+        arm_fd_poll(signal_fd_);
     int submit_rc = ::io_uring_submit(&ring_);
     if (submit_rc < 0)
     {
@@ -624,6 +651,54 @@ io_uring_scheduler::drain_wakeup_eventfd() const noexcept
     wakeup_armed_.store(false, std::memory_order_release);
 }
 
+inline void
+io_uring_scheduler::enable_signal_fd()
+{
+    if (signal_fd_ >= 0)
+        return;
+
+    int fd = signal_svc_->open_signal_fd();
+
+    // lazy_init_ring arms the poll if the ring is not up yet
+    lock_type ring_lock(ring_mutex_);
+    signal_fd_ = fd;
+    if (ring_inited_)
+    {
+        arm_fd_poll(signal_fd_);
+        ::io_uring_submit(&ring_);
+    }
+}
+
+inline void
+io_uring_scheduler::watch_process_fd()
+{
+    // Runs on the first process wait, once the context is running,
+    // so the ring settings are final.
+    lazy_init_ring();
+
+    lock_type ring_lock(ring_mutex_);
+    process_fd_ = process_svc_->watch_fd();
+    arm_fd_poll(process_fd_);
+    ::io_uring_submit(&ring_);
+}
+
+inline void
+io_uring_scheduler::arm_fd_poll(int const& fd) const noexcept
+{
+    // Caller holds ring_mutex_ or is initializing the ring
+    ::io_uring_sqe* sqe = ::io_uring_get_sqe(&ring_);
+    if (!sqe)
+    {
+        ::io_uring_submit(&ring_);
+        sqe = ::io_uring_get_sqe(&ring_);
+    }
+    if (sqe)
+    {
+        ::io_uring_prep_poll_multishot(sqe, fd, POLLIN);
+        ::io_uring_sqe_set_data(sqe, const_cast<int*>(&fd));
+    }
+}
+
 inline void
 io_uring_scheduler::post(std::coroutine_handle<> h) const
 {
@@ -1107,6 +1182,23 @@ io_uring_scheduler::process_completions()
                 }
             }
         }
+        else if (ud == &signal_fd_)
+        {
+            // signalfd readable: deliver the queued signals. Like the
+            // wakeup poll it is not counted in io_uring_inflight_;
+            // re-arm if the kernel ended the multishot.
+            signal_svc_->read_signal_fd();
+            if ((cqe->flags & IORING_CQE_F_MORE) == 0)
+                arm_fd_poll(signal_fd_);
+        }
+        else if (ud == &process_fd_)
+        {
+            // Process service epoll instance readable: reap the exited
+            // children. Uncounted and re-armed like the signalfd poll.
+            process_svc_->read_ready();
+            if ((cqe->flags & IORING_CQE_F_MORE) == 0)
+                arm_fd_poll(process_fd_);
+        }
         else if (ud == &cancel_sentinel_)
         {
             // CQE for an ASYNC_CANCEL op — ignore; the actual op's
@@ -81,6 +81,12 @@ struct uring_read_op : io_uring_op
     int    fd          = -1;
     detail::speculative_state* spec_state = nullptr;
 
+    // recv_with_fds: the read goes through IORING_OP_RECVMSG so the
+    // control buffer can collect SCM_RIGHTS.
+    msghdr       msg{};
+    void*        control     = nullptr;
+    std::size_t* control_len = nullptr;
+
     uring_read_op() noexcept
         : io_uring_op(&do_handler, &do_cqe, &do_prep)
     {
@@ -105,7 +111,10 @@ struct uring_read_op : io_uring_op
         std::shared_ptr<void>      impl,
         detail::speculative_state* spec,
         buffer_param               buffers,
-        std::stop_token const&     token) noexcept
+        std::stop_token const&     token,
+        void*                      ctl     = nullptr,
+        std::size_t                ctl_cap = 0,
+        std::size_t*               ctl_len = nullptr) noexcept
     {
         h          = handle;
         ex         = executor;
@@ -122,12 +131,28 @@ struct uring_read_op : io_uring_op
                 reinterpret_cast<capy::mutable_buffer*>(iovecs),
                 io_uring_max_iov));
         empty_buffer = (iovec_count == 0);
+        control      = ctl;
+        control_len  = ctl_len;
+        if (ctl)
+        {
+            msg = {};
+            msg.msg_iov    = iovecs;
+            msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovec_count);
+            msg.msg_control    = ctl;
+            msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(ctl_cap);
+        }
         start(token);
     }
 
     static void do_prep(io_uring_op* base, ::io_uring_sqe* sqe) noexcept
     {
         auto* self = static_cast<uring_read_op*>(base);
+        if (self->control)
+        {
+            ::io_uring_prep_recvmsg(
+                sqe, self->fd, &self->msg, MSG_CMSG_CLOEXEC);
+            return;
+        }
         // Single-buffer fast path: IORING_OP_RECV with a flat
         // (buffer, length) skips the iovec-array indirection that
         // IORING_OP_READV pays. For multi-iovec scatter reads, fall
@@ -180,6 +205,9 @@ struct uring_read_op : io_uring_op
             *self->bytes_out =
                 self->res >= 0 ? static_cast<std::size_t>(self->res) : 0u;
 
+        if (self->control && self->res >= 0)
+            *self->control_len = self->msg.msg_controllen;
+
         coro_resume(self);
         // suicide drops here; may destroy impl + self.
     }
@@ -213,7 +241,9 @@ struct uring_write_op : io_uring_op
         std::shared_ptr<void>      impl,
         detail::speculative_state* spec,
         buffer_param               buffers,
-        std::stop_token const&     token) noexcept
+        std::stop_token const&     token,
+        void const*                ctl     = nullptr,
+        std::size_t                ctl_len = 0) noexcept
     {
         h          = handle;
         ex         = executor;
@@ -235,6 +265,9 @@ struct uring_write_op : io_uring_op
             msg = {};
             msg.msg_iov    = iovecs;
             msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovec_count);
+            // send_with_fds: SCM_RIGHTS rides on the sendmsg path
+            msg.msg_control    = const_cast<void*>(ctl);
+            msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(ctl_len);
         }
         start(token);
     }
@@ -244,8 +277,9 @@ struct uring_write_op : io_uring_op
         auto* self = static_cast<uring_write_op*>(base);
         // Single-buffer fast path: IORING_OP_SEND with MSG_NOSIGNAL
         // skips the msghdr indirection that IORING_OP_SENDMSG pays.
-        // For multi-iovec scatter writes, fall back to sendmsg.
-        if (self->iovec_count == 1)
+        // For multi-iovec scatter writes, or when control data is
+        // attached, fall back to sendmsg.
+        if (self->iovec_count == 1 && !self->msg.msg_control)
         {
             ::io_uring_prep_send(
                 sqe, self->fd,
@@ -40,9 +40,11 @@
 #include <boost/corosio/tcp_socket.hpp>
 #include <boost/corosio/udp_socket.hpp>
 
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -905,6 +907,64 @@ public:
         std::stop_token         token,
         std::error_code*        ec,
         std::size_t*            bytes) override
+    {
+        return submit_read(h, ex, buffers, token, ec, bytes);
+    }
+
+    std::coroutine_handle<> write_some(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buffers,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes) override
+    {
+        return submit_write(h, ex, buffers, token, ec, bytes);
+    }
+
+    std::coroutine_handle<> send_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buffers,
+        void const*             control,
+        std::size_t             control_len,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes) override
+    {
+        return submit_write(
+            h, ex, buffers, token, ec, bytes, control, control_len);
+    }
+
+    std::coroutine_handle<> recv_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buffers,
+        void*                   control,
+        std::size_t             control_cap,
+        std::size_t*            control_len,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes) override
+    {
+        return submit_read(
+            h, ex, buffers, token, ec, bytes, control, control_cap,
+            control_len);
+    }
+
+private:
+    // Shared by read_some and recv_with_fds. With a control buffer
+    // the read uses recvmsg so passed descriptors are collected.
+    std::coroutine_handle<> submit_read(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buffers,
+        std::stop_token const&  token,
+        std::error_code*        ec,
+        std::size_t*            bytes,
+        void*                   control     = nullptr,
+        std::size_t             control_cap = 0,
+        std::size_t*            control_len = nullptr)
     {
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
@@ -919,8 +979,24 @@ public:
         bool    have_sync_res = stop_now || empty_buf;
         if (!have_sync_res && spec_.may_speculate_read())
         {
-            do { n = ::readv(fd_, iovecs, iovec_count); }
-            while (n < 0 && errno == EINTR);
+            if (control)
+            {
+                msghdr msg{};
+                msg.msg_iov    = iovecs;
+                msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovec_count);
+                msg.msg_control    = control;
+                msg.msg_controllen =
+                    static_cast<decltype(msg.msg_controllen)>(control_cap);
+                do { n = ::recvmsg(fd_, &msg, MSG_CMSG_CLOEXEC); }
+                while (n < 0 && errno == EINTR);
+                if (n >= 0)
+                    *control_len = msg.msg_controllen;
+            }
+            else
+            {
+                do { n = ::readv(fd_, iovecs, iovec_count); }
+                while (n < 0 && errno == EINTR);
+            }
             if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
             {
                 have_sync_res = true;
@@ -966,7 +1042,8 @@ public:
         }
 
         rd_.prepare(h, ex, ec, bytes, fd_, sched_,
-            shared_from_this(), &spec_, buffers, token);
+            shared_from_this(), &spec_, buffers, token,
+            control, control_cap, control_len);
         sched_->work_started();
         if (rd_.cancelled.load(std::memory_order_acquire))
         {
@@ -978,13 +1055,17 @@ public:
         return std::noop_coroutine();
     }
 
-    std::coroutine_handle<> write_some(
+    // Shared by write_some and send_with_fds. Control data always
+    // goes out through sendmsg.
+    std::coroutine_handle<> submit_write(
         std::coroutine_handle<> h,
         capy::executor_ref      ex,
         buffer_param            buffers,
-        std::stop_token         token,
+        std::stop_token const&  token,
         std::error_code*        ec,
-        std::size_t*            bytes) override
+        std::size_t*            bytes,
+        void const*             control     = nullptr,
+        std::size_t             control_len = 0)
     {
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
@@ -1002,6 +1083,9 @@ public:
             msghdr msg{};
             msg.msg_iov    = iovecs;
             msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iovec_count);
+            msg.msg_control    = const_cast<void*>(control);
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_len);
             do { n = ::sendmsg(fd_, &msg, MSG_NOSIGNAL); }
             while (n < 0 && errno == EINTR);
             if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
@@ -1042,7 +1126,8 @@ public:
         }
 
         wr_.prepare(h, ex, ec, bytes, fd_, sched_,
-            shared_from_this(), &spec_, buffers, token);
+            shared_from_this(), &spec_, buffers, token,
+            control, control_len);
         sched_->work_started();
         if (wr_.cancelled.load(std::memory_order_acquire))
         {
@@ -1054,6 +1139,7 @@ public:
         return std::noop_coroutine();
     }
 
+public:
     // ----------------------------------------------------------------
     // local_stream_socket::implementation
     // ----------------------------------------------------------------
@@ -1578,6 +1664,55 @@ private:
         std::shared_ptr<io_uring_local_stream_acceptor>> impls_;
 };
 
+/* Finish a batch whose result is already known (speculative mmsg,
+   empty slot span, or stop already requested). The op was prepared
+   before speculating, so on the budget-exhausted path it is parked
+   on the completed queue with the synchronous count recorded; its
+   handler then finishes the slots exactly as a CQE would. `n` is
+   the mmsg return value (count, or -1 with errno set). Shared by the
+   UDP and local datagram sockets. */
+template<class BatchOp>
+std::coroutine_handle<>
+complete_dgram_batch_inline(
+    io_uring_scheduler&     sched,
+    BatchOp&                op,
+    std::coroutine_handle<> h,
+    capy::executor_ref      ex,
+    int                     n,
+    bool                    stop_now)
+{
+    int err = (n < 0) ? errno : 0;
+    std::size_t done = (n > 0) ? static_cast<std::size_t>(n) : 0;
+    if (sched.try_consume_inline_budget())
+    {
+        decode_io_result(
+            op.ec_out, stop_now, err ? make_err(err) : std::error_code{},
+            /*is_read=*/false, /*bytes=*/0, /*empty_buffer=*/false);
+        if constexpr (std::is_same_v<BatchOp, uring_dgram_recv_batch_op>)
+            finish_recv_batch(op.msgs, op.names, op.slots, done);
+        else
+            finish_send_batch(op.msgs, op.slots, done);
+        if (op.bytes_out)
+            *op.bytes_out = done;
+        op.stop_cb.reset();
+        op.impl_ptr.reset();
+        op.cont_op.cont.h = h;
+        return dispatch_coro(ex, op.cont_op.cont);
+    }
+
+    if (!stop_now)
+    {
+        op.res        = err ? -err : 0;
+        op.sync_count = done;
+    }
+    sched.work_started();
+    {
+        io_uring_scheduler::lock_type lock(sched.dispatch_mutex());
+        sched.push_completed_locked(&op);
+    }
+    return std::noop_coroutine();
+}
+
 /** UDP socket implementation for io_uring.
 
     Implements `udp_socket::implementation` using a proactor model:
@@ -1610,10 +1745,12 @@ class BOOST_COROSIO_DECL io_uring_udp_socket final
 
     // Per-fd op slots — embedded to eliminate per-call heap allocation.
     // Single-pending invariant per slot.
-    uring_connect_op    conn_;
-    uring_dgram_send_op send_;
-    uring_dgram_recv_op recv_;
-    uring_wait_op       wait_op_;
+    uring_connect_op          conn_;
+    uring_dgram_send_op       send_;
+    uring_dgram_recv_op       recv_;
+    uring_wait_op             wait_op_;
+    uring_dgram_send_batch_op send_batch_;
+    uring_dgram_recv_batch_op recv_batch_;
 
     mutable detail::speculative_state spec_;
 
@@ -1672,6 +1809,38 @@ public:
             token, ec, bytes_out);
     }
 
+    std::coroutine_handle<> send_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buf,
+        endpoint                dest,
+        datagram_info const*    info,
+        int                     flags,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes_out) override
+    {
+        sockaddr_storage addr{};
+        socklen_t len = endpoint_to_sockaddr(dest, addr);
+        return submit_send(h, ex, buf, len, addr, flags,
+            token, ec, bytes_out, info);
+    }
+
+    std::coroutine_handle<> recv_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buf,
+        endpoint*               source,
+        datagram_info*          info,
+        int                     flags,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes_out) override
+    {
+        return submit_recv(h, ex, buf, source != nullptr, source, flags,
+            token, ec, bytes_out, info);
+    }
+
     std::coroutine_handle<> send(
         std::coroutine_handle<> h,
         capy::executor_ref      ex,
@@ -1699,6 +1868,79 @@ public:
             token, ec, bytes_out);
     }
 
+    std::coroutine_handle<> send_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        const_datagram_slot*    slots,
+        std::size_t             count,
+        int                     flags,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            count_out) override
+    {
+        auto& op = send_batch_;
+        op.prepare(h, ex, ec, count_out, fd_, sched_, shared_from_this(),
+            &spec_, slots, count, to_native_msg_flags(flags), token);
+
+        bool stop_now = op.cancelled.load(std::memory_order_acquire);
+        bool have_sync_res = stop_now || op.msg_count == 0;
+        int  n = 0;
+        if (!have_sync_res && spec_.may_speculate_write())
+        {
+            n = send_batch_msgs(fd_, op.msgs, op.msg_count, op.msg_flags);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                have_sync_res = true;
+            else
+                spec_.on_write_exhausted();
+        }
+
+        if (have_sync_res)
+            return complete_dgram_batch_inline(
+                *sched_, op, h, ex, n, stop_now);
+
+        sched_->work_started();
+        io_uring_submit_op(*sched_, &op);
+        return std::noop_coroutine();
+    }
+
+    std::coroutine_handle<> recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        datagram_slot*          slots,
+        std::size_t             count,
+        int                     flags,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            count_out) override
+    {
+        auto& op = recv_batch_;
+        op.prepare(h, ex, ec, count_out, fd_, sched_, shared_from_this(),
+            &spec_, slots, count, to_native_msg_flags(flags), token);
+
+        bool stop_now = op.cancelled.load(std::memory_order_acquire);
+        bool have_sync_res = stop_now || op.msg_count == 0;
+        int  n = 0;
+        if (!have_sync_res && spec_.may_speculate_read())
+        {
+            n = recv_batch_msgs(fd_, op.msgs, op.msg_count, op.msg_flags);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                have_sync_res = true;
+            else
+            {
+                spec_.on_read_exhausted();
+                reset_recv_batch(op.msgs, op.msg_count);
+            }
+        }
+
+        if (have_sync_res)
+            return complete_dgram_batch_inline(
+                *sched_, op, h, ex, n, stop_now);
+
+        sched_->work_started();
+        io_uring_submit_op(*sched_, &op);
+        return std::noop_coroutine();
+    }
+
     std::coroutine_handle<> connect(
         std::coroutine_handle<> h,
         capy::executor_ref      ex,
@@ -1808,8 +2050,13 @@ private:
         int                            flags,
         std::stop_token const&         token,
         std::error_code*               ec,
-        std::size_t*                   bytes)
+        std::size_t*                   bytes,
+        datagram_info const*           info = nullptr)
     {
+        datagram_control ctl;
+        std::size_t ctl_len =
+            info ? build_datagram_control(ctl, family_, *info) : 0;
+
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
             buffers.copy_to(
@@ -1832,6 +2079,12 @@ private:
                 msg.msg_name    = &dest_copy;
                 msg.msg_namelen = dest_len;
             }
+            if (ctl_len > 0)
+            {
+                msg.msg_control    = ctl.buf;
+                msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(
+                    ctl_len);
+            }
             int native_flags = to_native_msg_flags(flags) | MSG_NOSIGNAL;
             do { n = ::sendmsg(fd_, &msg, native_flags); }
             while (n < 0 && errno == EINTR);
@@ -1860,7 +2113,7 @@ private:
             }
             send_.prepare(h, ex, ec, bytes, fd_, sched_,
                 shared_from_this(), &spec_, buffers, dest_len, dest_storage,
-                to_native_msg_flags(flags), token);
+                to_native_msg_flags(flags), token, &ctl, ctl_len);
             if (stop_now)
                 send_.cancelled.store(true, std::memory_order_release);
             else
@@ -1875,7 +2128,7 @@ private:
 
         send_.prepare(h, ex, ec, bytes, fd_, sched_, shared_from_this(),
             &spec_, buffers, dest_len, dest_storage,
-            to_native_msg_flags(flags), token);
+            to_native_msg_flags(flags), token, &ctl, ctl_len);
         sched_->work_started();
         if (send_.cancelled.load(std::memory_order_acquire))
         {
@@ -1896,7 +2149,8 @@ private:
         int                      flags,
         std::stop_token const&   token,
         std::error_code*         ec,
-        std::size_t*             bytes)
+        std::size_t*             bytes,
+        datagram_info*           info = nullptr)
     {
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
@@ -1911,6 +2165,8 @@ private:
         bool             have_sync_res = stop_now || empty_buf;
         sockaddr_storage src_storage{};
         socklen_t        src_namelen   = 0;
+        datagram_control ctl;
+        std::size_t      ctl_len       = 0;
         if (!have_sync_res && spec_.may_speculate_read())
         {
             msghdr msg{};
@@ -1921,6 +2177,11 @@ private:
                 msg.msg_name    = &src_storage;
                 msg.msg_namelen = sizeof(src_storage);
             }
+            if (info)
+            {
+                msg.msg_control    = ctl.buf;
+                msg.msg_controllen = sizeof(ctl.buf);
+            }
             int native_flags = to_native_msg_flags(flags);
             do { n = ::recvmsg(fd_, &msg, native_flags); }
             while (n < 0 && errno == EINTR);
@@ -1929,6 +2190,7 @@ private:
                 have_sync_res = true;
                 if (n < 0) err = errno;
                 src_namelen = (n >= 0) ? msg.msg_namelen : 0;
+                ctl_len     = (n >= 0 && info) ? msg.msg_controllen : 0;
             }
             else
             {
@@ -1947,13 +2209,15 @@ private:
                     *bytes = (n < 0) ? 0u : static_cast<std::size_t>(n);
                 if (n >= 0 && want_source && source_out && !empty_buf)
                     *source_out = sockaddr_to_endpoint(src_storage);
+                if (n >= 0 && info && !empty_buf && !stop_now)
+                    parse_datagram_info(ctl.buf, ctl_len, *info);
                 recv_.cont_op.cont.h = h;
                 return dispatch_coro(ex, recv_.cont_op.cont);
             }
             recv_.prepare(h, ex, ec, bytes, fd_, sched_, shared_from_this(),
                 &spec_, buffers, source_out,
                 want_source ? &write_ip_source : nullptr,
-                to_native_msg_flags(flags), token);
+                to_native_msg_flags(flags), token, info);
             if (stop_now)
                 recv_.cancelled.store(true, std::memory_order_release);
             else
@@ -1967,6 +2231,13 @@ private:
                     recv_.source_storage = src_storage;
                     recv_.source_len     = src_namelen;
                 }
+                if (n >= 0 && recv_.info_out)
+                {
+                    std::memcpy(recv_.control.buf, ctl.buf, ctl_len);
+                    recv_.msg.msg_controllen =
+                        static_cast<decltype(recv_.msg.msg_controllen)>(
+                            ctl_len);
+                }
             }
             sched_->work_started();
             {
@@ -1979,7 +2250,7 @@ private:
         recv_.prepare(h, ex, ec, bytes, fd_, sched_, shared_from_this(),
             &spec_, buffers, source_out,
             want_source ? &write_ip_source : nullptr,
-            to_native_msg_flags(flags), token);
+            to_native_msg_flags(flags), token, info);
         sched_->work_started();
         if (recv_.iovec_count == 0 ||
             recv_.cancelled.load(std::memory_order_acquire))
@@ -2131,10 +2402,11 @@ class BOOST_COROSIO_DECL io_uring_local_datagram_socket final
 
     // Per-fd op slots — embedded to eliminate per-call heap allocation.
     // Single-pending invariant per slot.
-    uring_local_connect_op conn_;
-    uring_dgram_send_op    send_;
-    uring_dgram_recv_op    recv_;
-    uring_wait_op          wait_op_;
+    uring_local_connect_op    conn_;
+    uring_dgram_send_op       send_;
+    uring_dgram_recv_op       recv_;
+    uring_wait_op             wait_op_;
+    uring_dgram_recv_batch_op recv_batch_;
 
     mutable detail::speculative_state spec_;
 
@@ -2220,6 +2492,36 @@ public:
             token, ec, bytes_out);
     }
 
+    std::coroutine_handle<> send_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buf,
+        void const*             control,
+        std::size_t             control_len,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes_out) override
+    {
+        sockaddr_storage empty{};
+        return submit_send(h, ex, buf, 0, empty, 0,
+            token, ec, bytes_out, control, control_len);
+    }
+
+    std::coroutine_handle<> recv_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        buffer_param            buf,
+        void*                   control,
+        std::size_t             control_cap,
+        std::size_t*            control_len,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            bytes_out) override
+    {
+        return submit_recv(h, ex, buf, false, nullptr, 0,
+            token, ec, bytes_out, control, control_cap, control_len);
+    }
+
     std::coroutine_handle<> connect(
         std::coroutine_handle<>  h,
         capy::executor_ref       ex,
@@ -2291,6 +2593,44 @@ public:
         return std::noop_coroutine();
     }
 
+    std::coroutine_handle<> recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref      ex,
+        datagram_slot*          slots,
+        std::size_t             count,
+        int                     flags,
+        std::stop_token         token,
+        std::error_code*        ec,
+        std::size_t*            count_out) override
+    {
+        auto& op = recv_batch_;
+        op.prepare(h, ex, ec, count_out, fd_, sched_, shared_from_this(),
+            &spec_, slots, count, to_native_msg_flags(flags), token);
+
+        bool stop_now = op.cancelled.load(std::memory_order_acquire);
+        bool have_sync_res = stop_now || op.msg_count == 0;
+        int  n = 0;
+        if (!have_sync_res && spec_.may_speculate_read())
+        {
+            n = recv_batch_msgs(fd_, op.msgs, op.msg_count, op.msg_flags);
+            if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                have_sync_res = true;
+            else
+            {
+                spec_.on_read_exhausted();
+                reset_recv_batch(op.msgs, op.msg_count);
+            }
+        }
+
+        if (have_sync_res)
+            return complete_dgram_batch_inline(
+                *sched_, op, h, ex, n, stop_now);
+
+        sched_->work_started();
+        io_uring_submit_op(*sched_, &op);
+        return std::noop_coroutine();
+    }
+
     std::error_code shutdown(
         local_datagram_socket::shutdown_type what) noexcept override
     {
@@ -2362,7 +2702,9 @@ private:
         int                            flags,
         std::stop_token const&         token,
         std::error_code*               ec,
-        std::size_t*                   bytes)
+        std::size_t*                   bytes,
+        void const*                    control     = nullptr,
+        std::size_t                    control_len = 0)
     {
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
@@ -2386,6 +2728,9 @@ private:
                 msg.msg_name    = &dest_copy;
                 msg.msg_namelen = dest_len;
             }
+            msg.msg_control    = const_cast<void*>(control);
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_len);
             int native_flags = to_native_msg_flags(flags) | MSG_NOSIGNAL;
             do { n = ::sendmsg(fd_, &msg, native_flags); }
             while (n < 0 && errno == EINTR);
@@ -2430,6 +2775,8 @@ private:
         send_.prepare(h, ex, ec, bytes, fd_, sched_, shared_from_this(),
             &spec_, buffers, dest_len, dest_storage,
             to_native_msg_flags(flags), token);
+        if (control)
+            send_.attach_control(control, control_len);
         sched_->work_started();
         if (send_.cancelled.load(std::memory_order_acquire))
         {
@@ -2450,7 +2797,10 @@ private:
         int                        flags,
         std::stop_token const&     token,
         std::error_code*           ec,
-        std::size_t*               bytes)
+        std::size_t*               bytes,
+        void*                      control     = nullptr,
+        std::size_t                control_cap = 0,
+        std::size_t*               control_len = nullptr)
     {
         iovec iovecs[io_uring_max_iov];
         int   iovec_count = static_cast<int>(
@@ -2476,8 +2826,17 @@ private:
                 msg.msg_namelen = sizeof(src_storage);
             }
             int native_flags = to_native_msg_flags(flags);
+            if (control)
+            {
+                msg.msg_control    = control;
+                msg.msg_controllen =
+                    static_cast<decltype(msg.msg_controllen)>(control_cap);
+                native_flags |= MSG_CMSG_CLOEXEC;
+            }
             do { n = ::recvmsg(fd_, &msg, native_flags); }
             while (n < 0 && errno == EINTR);
+            if (n >= 0 && control)
+                *control_len = msg.msg_controllen;
             if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
             {
                 have_sync_res = true;
@@ -2534,6 +2893,8 @@ private:
             &spec_, buffers, source_out,
             want_source ? &write_local_source : nullptr,
             to_native_msg_flags(flags), token);
+        if (control)
+            recv_.attach_control(control, control_cap, control_len);
         sched_->work_started();
         if (recv_.iovec_count == 0 ||
             recv_.cancelled.load(std::memory_order_acquire))
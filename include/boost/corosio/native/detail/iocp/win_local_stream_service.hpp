@@ -725,6 +725,55 @@ win_local_stream_socket::write_some(
     return internal_->write_some(h, d, buf, token, ec, bytes);
 }
 
+inline std::coroutine_handle<>
+win_local_stream_socket::send_with_fds(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    buffer_param,
+    void const*,
+    std::size_t,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes)
+{
+    auto& op        = internal_->wr_;
+    op.internal_ptr = internal_;
+    op.reset();
+    op.h         = h;
+    op.ex        = d;
+    op.ec_out    = ec;
+    op.bytes_out = bytes;
+    op.start(token);
+    internal_->svc_.work_started();
+    internal_->svc_.on_completion(&op, WSAEOPNOTSUPP, 0);
+    return std::noop_coroutine();
+}
+
+inline std::coroutine_handle<>
+win_local_stream_socket::recv_with_fds(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    buffer_param,
+    void*,
+    std::size_t,
+    std::size_t*,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes)
+{
+    auto& op        = internal_->rd_;
+    op.internal_ptr = internal_;
+    op.reset();
+    op.h         = h;
+    op.ex        = d;
+    op.ec_out    = ec;
+    op.bytes_out = bytes;
+    op.start(token);
+    internal_->svc_.work_started();
+    internal_->svc_.on_completion(&op, WSAEOPNOTSUPP, 0);
+    return std::noop_coroutine();
+}
+
 inline std::coroutine_handle<>
 win_local_stream_socket::wait(
     std::coroutine_handle<> h,
@@ -254,6 +254,29 @@ public:
     corosio::local_endpoint remote_endpoint() const noexcept override;
     void cancel() noexcept override;
 
+    // Windows AF_UNIX has no SCM_RIGHTS; both complete with
+    // operation_not_supported.
+    std::coroutine_handle<> send_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        buffer_param buf,
+        void const* control,
+        std::size_t control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes) override;
+
+    std::coroutine_handle<> recv_with_fds(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        buffer_param buf,
+        void* control,
+        std::size_t control_cap,
+        std::size_t* control_len,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes) override;
+
     win_local_stream_socket_internal* get_internal() const noexcept;
 };
 
@@ -23,6 +23,7 @@
 #include <boost/corosio/native/detail/iocp/win_mutex.hpp>
 #include <boost/corosio/native/detail/iocp/win_windows.hpp>
 
+#include <atomic>
 #include <coroutine>
 #include <cstdint>
 #include <memory>
@@ -32,6 +33,18 @@ namespace boost::corosio::detail {
 class win_random_access_file_service;
 class win_random_access_file_internal;
 
+/// Completion state shared by the ops of one read_batch. The last
+/// op to complete resumes the caller.
+struct raf_read_batch
+{
+    std::coroutine_handle<> h;
+    std::error_code* ec_out   = nullptr;
+    std::size_t* bytes_out    = nullptr;
+    random_access_file::read_request* reqs = nullptr;
+    std::size_t count = 0;
+    std::atomic<std::size_t> remaining{0};
+};
+
 /** Per-operation state for concurrent random-access file IOCP I/O.
 
     Heap-allocated for each async read/write, enabling unlimited
@@ -46,6 +59,7 @@ struct raf_concurrent_op
     DWORD buf_len  = 0;
     win_random_access_file_internal* file_ = nullptr;
     std::shared_ptr<win_random_access_file_internal> file_ref;
+    raf_read_batch* batch = nullptr; // non-null for one range of a batch
 
     static void do_complete(
         void* owner,
@@ -61,7 +75,9 @@ struct raf_concurrent_op
 /** Internal random-access file state for IOCP-based I/O.
 
     Each async operation heap-allocates a raf_concurrent_op,
-    allowing unlimited concurrent reads and writes.
+    allowing unlimited concurrent reads and writes. A read_batch
+    issues one overlapped ReadFile per range, all sharing a
+    raf_read_batch.
 */
 class win_random_access_file_internal
     : public intrusive_list<win_random_access_file_internal>::node
@@ -75,6 +91,7 @@ class win_random_access_file_internal
     win_mutex ops_mutex_;
     intrusive_list<raf_concurrent_op> outstanding_ops_;
     HANDLE handle_ = INVALID_HANDLE_VALUE;
+    std::size_t direct_align_ = 0; // nonzero with FILE_FLAG_NO_BUFFERING
 
 public:
     explicit win_random_access_file_internal(
@@ -99,6 +116,15 @@ public:
         std::error_code*,
         std::size_t*);
 
+    std::coroutine_handle<> read_batch(
+        random_access_file::read_request* reqs,
+        std::size_t count,
+        std::coroutine_handle<>,
+        capy::executor_ref,
+        std::stop_token,
+        std::error_code*,
+        std::size_t*);
+
     HANDLE native_handle() const noexcept;
     bool is_open() const noexcept;
     void cancel() noexcept;
@@ -143,6 +169,15 @@ public:
         std::error_code* ec,
         std::size_t* bytes) override;
 
+    std::coroutine_handle<> read_batch(
+        random_access_file::read_request* reqs,
+        std::size_t count,
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes) override;
+
     native_handle_type native_handle() const noexcept override;
     void cancel() noexcept override;
     std::uint64_t size() const override;
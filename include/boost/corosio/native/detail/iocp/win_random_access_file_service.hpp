@@ -23,7 +23,9 @@
 #include <boost/corosio/native/detail/iocp/win_random_access_file.hpp>
 #include <boost/corosio/native/detail/iocp/win_scheduler.hpp>
 #include <boost/corosio/native/detail/iocp/win_completion_key.hpp>
+#include <boost/corosio/native/detail/direct_io.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/read_batch.hpp>
 #include <boost/corosio/detail/buffer_param.hpp>
 #include <boost/capy/buffers.hpp>
 #include <boost/capy/error.hpp>
@@ -150,7 +152,10 @@ raf_concurrent_op::do_complete(
             op->file_->outstanding_ops_.remove(op);
         }
         op->file_ref.reset();
+        auto* b = op->batch;
         delete op;
+        if (b && b->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete b;
         return;
     }
 
@@ -179,6 +184,18 @@ raf_concurrent_op::do_complete(
 
     op->file_ref.reset();
 
+    if (auto* b = op->batch)
+    {
+        delete op;
+        if (b->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+        finish_read_batch(b->reqs, b->count, b->ec_out, b->bytes_out);
+        auto coro = b->h;
+        delete b;
+        coro.resume();
+        return;
+    }
+
     auto coro = op->h;
     delete op;
     coro.resume();
@@ -234,6 +251,7 @@ win_random_access_file_internal::close_handle() noexcept
         ::CloseHandle(handle_);
         handle_ = INVALID_HANDLE_VALUE;
     }
+    direct_align_ = 0;
 }
 
 inline std::uint64_t
@@ -283,6 +301,7 @@ win_random_access_file_internal::release()
 {
     HANDLE h = handle_;
     handle_ = INVALID_HANDLE_VALUE;
+    direct_align_ = 0;
     return reinterpret_cast<native_handle_type>(h);
 }
 
@@ -313,6 +332,18 @@ win_random_access_file_internal::read_some_at(
 {
     static constexpr std::size_t max_buffers = 16;
 
+    if (direct_align_ != 0)
+    {
+        capy::mutable_buffer check[max_buffers];
+        auto n = param.copy_to(check, max_buffers);
+        if (!direct_io_aligned(check, n, offset, direct_align_))
+        {
+            *ec        = make_err(ERROR_INVALID_PARAMETER);
+            *bytes_out = 0;
+            return h;
+        }
+    }
+
     auto* op = new raf_concurrent_op(*this);
     op->file_ref = shared_from_this();
 
@@ -370,6 +401,84 @@ win_random_access_file_internal::read_some_at(
     return std::noop_coroutine();
 }
 
+inline std::coroutine_handle<>
+win_random_access_file_internal::read_batch(
+    random_access_file::read_request* reqs,
+    std::size_t count,
+    std::coroutine_handle<> h,
+    capy::executor_ref ex,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes_out)
+{
+    init_read_batch(reqs, count);
+
+    auto* batch      = new raf_read_batch();
+    batch->h         = h;
+    batch->ec_out    = ec;
+    batch->bytes_out = bytes_out;
+    batch->reqs      = reqs;
+    batch->count     = count;
+    // Set before the first ReadFile: any op may complete at once
+    batch->remaining.store(count, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& r = reqs[i];
+        auto* op = new raf_concurrent_op(*this);
+        op->file_ref = shared_from_this();
+        op->batch    = batch;
+
+        op->reset();
+        op->is_read   = true;
+        op->h         = h;
+        op->ex        = ex;
+        op->ec_out    = &r.ec;
+        op->bytes_out = &r.bytes_transferred;
+        op->start(token);
+
+        svc_.work_started();
+
+        {
+            std::lock_guard<win_mutex> lock(ops_mutex_);
+            outstanding_ops_.push_back(op);
+        }
+
+        if (r.buffer.size() == 0)
+        {
+            op->empty_buffer = true;
+            svc_.on_completion(op, 0, 0);
+            continue;
+        }
+        if (direct_align_ != 0 &&
+            !direct_io_aligned(&r.buffer, 1, r.offset, direct_align_))
+        {
+            svc_.on_completion(op, ERROR_INVALID_PARAMETER, 0);
+            continue;
+        }
+
+        op->buf     = r.buffer.data();
+        op->buf_len = static_cast<DWORD>(r.buffer.size());
+        op->Offset     = static_cast<DWORD>(r.offset & 0xFFFFFFFF);
+        op->OffsetHigh = static_cast<DWORD>(r.offset >> 32);
+
+        BOOL ok = ::ReadFile(handle_, op->buf, op->buf_len, nullptr, op);
+        DWORD err = ok ? 0 : ::GetLastError();
+
+        if (err != 0 && err != ERROR_IO_PENDING)
+        {
+            svc_.on_completion(op, err, 0);
+            continue;
+        }
+
+        svc_.on_pending(op);
+
+        if (op->cancelled.load(std::memory_order_acquire))
+            ::CancelIoEx(handle_, op);
+    }
+    return std::noop_coroutine();
+}
+
 inline std::coroutine_handle<>
 win_random_access_file_internal::write_some_at(
     std::uint64_t offset,
@@ -382,6 +491,18 @@ win_random_access_file_internal::write_some_at(
 {
     static constexpr std::size_t max_buffers = 16;
 
+    if (direct_align_ != 0)
+    {
+        capy::mutable_buffer check[max_buffers];
+        auto n = param.copy_to(check, max_buffers);
+        if (!direct_io_aligned(check, n, offset, direct_align_))
+        {
+            *ec        = make_err(ERROR_INVALID_PARAMETER);
+            *bytes_out = 0;
+            return h;
+        }
+    }
+
     auto* op = new raf_concurrent_op(*this);
     op->file_ref = shared_from_this();
 
@@ -485,6 +606,19 @@ win_random_access_file::write_some_at(
     return internal_->write_some_at(offset, h, d, buf, token, ec, bytes);
 }
 
+inline std::coroutine_handle<>
+win_random_access_file::read_batch(
+    random_access_file::read_request* reqs,
+    std::size_t count,
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes)
+{
+    return internal_->read_batch(reqs, count, h, d, token, ec, bytes);
+}
+
 inline native_handle_type
 win_random_access_file::native_handle() const noexcept
 {
@@ -650,6 +784,8 @@ win_random_access_file_service::open_file(
                 | FILE_FLAG_RANDOM_ACCESS;
     if (mode & file_base::sync_all_on_write)
         flags |= FILE_FLAG_WRITE_THROUGH;
+    if (mode & file_base::direct)
+        flags |= FILE_FLAG_NO_BUFFERING;
 
     HANDLE h = ::CreateFileW(
         path.c_str(),
@@ -687,6 +823,9 @@ win_random_access_file_service::open_file(
     auto& internal =
         *static_cast<win_random_access_file&>(impl).get_internal();
     internal.handle_ = h;
+    // Sector size is not queried; 4096 covers 512e and 4Kn disks
+    internal.direct_align_ =
+        (mode & file_base::direct) ? default_direct_io_alignment : 0;
 
     return {};
 }
@@ -414,7 +414,7 @@ win_resolver::reverse_resolve(
     reverse_pool_op_.resolver_ = this;
     reverse_pool_op_.ref_      = this->shared_from_this();
     reverse_pool_op_.func_     = &win_resolver::do_reverse_resolve_work;
-    if (!svc_.pool().post(&reverse_pool_op_))
+    if (!svc_.pool().post(&reverse_pool_op_, thread_pool_lane::resolver))
     {
         // Pool shut down — complete with cancellation
         reverse_pool_op_.ref_.reset();
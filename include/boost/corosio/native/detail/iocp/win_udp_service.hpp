@@ -804,6 +804,119 @@ win_udp_socket::recv_from(
     return internal_->recv_from(h, d, buf, source, flags, token, ec, bytes);
 }
 
+/* Winsock has no recvmmsg/sendmmsg, so a batch degrades to a single
+   overlapped datagram on slot 0. The count is reported as 1 up front;
+   udp_socket's batch awaitables report 0 whenever ec is set. UDP
+   segmentation offload is not wired up, so a segmented slot fails
+   with WSAEOPNOTSUPP and received slots never report coalescing. */
+inline std::coroutine_handle<>
+win_udp_socket::send_batch(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    const_datagram_slot* slots,
+    std::size_t count,
+    int flags,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* count_out)
+{
+    *count_out = count ? 1 : 0;
+    if (count && slots[0].segment_size != 0)
+    {
+        auto& op        = internal_->send_wr_;
+        op.internal_ptr = internal_;
+        op.reset();
+        op.h         = h;
+        op.ex        = d;
+        op.ec_out    = ec;
+        op.bytes_out = &slots[0].size;
+        op.start(token);
+        internal_->svc_.work_started();
+        internal_->svc_.on_completion(&op, WSAEOPNOTSUPP, 0);
+        return std::noop_coroutine();
+    }
+    capy::const_buffer buf =
+        count ? slots[0].buffer : capy::const_buffer();
+    std::size_t* bytes = count ? &slots[0].size : count_out;
+    if (count && slots[0].peer != endpoint{})
+        return internal_->send_to(
+            h, d, buf, slots[0].peer, flags, token, ec, bytes);
+    return internal_->send(h, d, buf, flags, token, ec, bytes);
+}
+
+inline std::coroutine_handle<>
+win_udp_socket::recv_batch(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    datagram_slot* slots,
+    std::size_t count,
+    int flags,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* count_out)
+{
+    *count_out = count ? 1 : 0;
+    if (!count)
+        return internal_->recv_from(
+            h, d, capy::mutable_buffer(), nullptr, flags, token, ec,
+            count_out);
+    slots[0].segment_size = 0;
+    slots[0].info         = {};
+    return internal_->recv_from(
+        h, d, slots[0].buffer, &slots[0].peer, flags, token, ec,
+        &slots[0].size);
+}
+
+/* Ancillary data would need WSASendMsg/WSARecvMsg through the
+   extension function pointers. Until then recv_msg reports no
+   control data, and send_msg rejects fields it cannot honor
+   rather than silently sending from the wrong address. */
+inline std::coroutine_handle<>
+win_udp_socket::send_msg(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    buffer_param buf,
+    endpoint dest,
+    datagram_info const* info,
+    int flags,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes)
+{
+    if (info && (info->has_local_address || info->has_tos))
+    {
+        auto& op        = internal_->wr_;
+        op.internal_ptr = internal_;
+        op.reset();
+        op.h         = h;
+        op.ex        = d;
+        op.ec_out    = ec;
+        op.bytes_out = bytes;
+        op.start(token);
+        internal_->svc_.work_started();
+        internal_->svc_.on_completion(&op, WSAEOPNOTSUPP, 0);
+        return std::noop_coroutine();
+    }
+    return internal_->send_to(h, d, buf, dest, flags, token, ec, bytes);
+}
+
+inline std::coroutine_handle<>
+win_udp_socket::recv_msg(
+    std::coroutine_handle<> h,
+    capy::executor_ref d,
+    buffer_param buf,
+    endpoint* source,
+    datagram_info* info,
+    int flags,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes)
+{
+    if (info)
+        *info = {};
+    return internal_->recv_from(h, d, buf, source, flags, token, ec, bytes);
+}
+
 inline std::coroutine_handle<>
 win_udp_socket::connect(
     std::coroutine_handle<> h,
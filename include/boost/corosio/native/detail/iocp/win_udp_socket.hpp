@@ -318,6 +318,48 @@ public:
         std::stop_token token,
         std::error_code* ec) override;
 
+    std::coroutine_handle<> send_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        const_datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* count_out) override;
+
+    std::coroutine_handle<> recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* count_out) override;
+
+    std::coroutine_handle<> send_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        buffer_param buf,
+        endpoint dest,
+        datagram_info const* info,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes) override;
+
+    std::coroutine_handle<> recv_msg(
+        std::coroutine_handle<> h,
+        capy::executor_ref d,
+        buffer_param buf,
+        endpoint* source,
+        datagram_info* info,
+        int flags,
+        std::stop_token token,
+        std::error_code* ec,
+        std::size_t* bytes) override;
+
     native_handle_type native_handle() const noexcept override;
 
     std::error_code set_option(
@@ -34,6 +34,9 @@ to_native_msg_flags(int flags) noexcept
     if (flags & 1) native |= MSG_PEEK;
     if (flags & 2) native |= MSG_OOB;
     if (flags & 4) native |= MSG_DONTROUTE;
+#if defined(__linux__)
+    if (flags & 8) native |= MSG_TRUNC;
+#endif
     return native;
 }
 
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_FILE_STATUS_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_FILE_STATUS_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/filesystem.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+#include <sys/stat.h>
+
+namespace boost::corosio::detail {
+
+/// Map the `S_IFMT` bits of a mode to a file type.
+inline std::filesystem::file_type
+file_type_from_mode(unsigned mode) noexcept
+{
+    using ft = std::filesystem::file_type;
+    switch (mode & S_IFMT)
+    {
+    case S_IFREG:
+        return ft::regular;
+    case S_IFDIR:
+        return ft::directory;
+    case S_IFLNK:
+        return ft::symlink;
+    case S_IFBLK:
+        return ft::block;
+    case S_IFCHR:
+        return ft::character;
+    case S_IFIFO:
+        return ft::fifo;
+    case S_IFSOCK:
+        return ft::socket;
+    default:
+        return ft::unknown;
+    }
+}
+
+/** Build a @ref file_status from the fields of a `stat` or `statx`.
+
+    @param mode The `st_mode` / `stx_mode` bits.
+    @param size The size in bytes.
+    @param sec The modification time, seconds since the epoch.
+    @param nsec The nanoseconds part of the modification time.
+*/
+inline file_status
+make_file_status(
+    unsigned mode, std::uint64_t size, std::int64_t sec, long nsec) noexcept
+{
+    file_status st;
+    st.type        = file_type_from_mode(mode);
+    st.permissions = static_cast<std::filesystem::perms>(mode & 07777);
+    st.size        = st.type == std::filesystem::file_type::regular ? size : 0;
+    st.last_write_time = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::seconds(sec) + std::chrono::nanoseconds(nsec)));
+    return st;
+}
+
+/// Build a @ref file_status from a `stat` result.
+inline file_status
+make_file_status(struct ::stat const& s) noexcept
+{
+#if defined(__APPLE__)
+    auto const& mtime = s.st_mtimespec;
+#else
+    auto const& mtime = s.st_mtim;
+#endif
+    return make_file_status(
+        static_cast<unsigned>(s.st_mode),
+        static_cast<std::uint64_t>(s.st_size),
+        static_cast<std::int64_t>(mtime.tv_sec),
+        static_cast<long>(mtime.tv_nsec));
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_FILE_STATUS_HPP
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_NOWAIT_READ_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_NOWAIT_READ_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <cstdint>
+#include <limits>
+
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+/*
+    Page-cache fast path for file reads
+    ===================================
+
+    The reactor backends run file reads on the thread pool because a
+    read that misses the page cache blocks. A read that hits it is a
+    memcpy, and the hop to a pool thread and back costs two context
+    switches for it.
+
+    On Linux, preadv2 with RWF_NOWAIT reads only what is already
+    cached and fails with EAGAIN instead of waiting for the device.
+    The file services try it first on the calling thread and fall
+    back to the pool only when it would block. It may return fewer
+    bytes than asked for, which read_some semantics allow.
+
+    Filesystems without nowait support, and kernels older than 4.14,
+    reject the flag with EOPNOTSUPP or EINVAL; the file then stops
+    trying. Files opened for direct I/O skip the fast path, since
+    with no page cache in the way nearly every read would block.
+*/
+
+namespace boost::corosio::detail {
+
+/// Outcome of @ref try_nowait_preadv.
+enum class nowait_result
+{
+    /// The read completed; the byte count is valid (0 at end of file).
+    done,
+
+    /// The data is not cached, or the read failed; use the pool.
+    would_block,
+
+    /// The file or kernel does not support nowait reads.
+    unsupported
+};
+
+/** Try to read from the page cache without blocking.
+
+    @param fd The file descriptor.
+    @param iov The buffers to read into.
+    @param iovcnt Number of entries in @p iov.
+    @param offset The file offset.
+    @param n Set to the bytes read on @ref nowait_result::done.
+*/
+inline nowait_result
+try_nowait_preadv(
+    int fd,
+    iovec const* iov,
+    int iovcnt,
+    std::uint64_t offset,
+    std::size_t& n) noexcept
+{
+#if defined(__linux__) && defined(RWF_NOWAIT)
+    // Out-of-range offsets get their EOVERFLOW from the pool path
+    if (offset > static_cast<std::uint64_t>(
+                     (std::numeric_limits<off_t>::max)()))
+        return nowait_result::would_block;
+
+    ssize_t r;
+    do
+    {
+        r = ::preadv2(
+            fd, iov, iovcnt, static_cast<off_t>(offset), RWF_NOWAIT);
+    }
+    while (r < 0 && errno == EINTR);
+
+    if (r >= 0)
+    {
+        n = static_cast<std::size_t>(r);
+        return nowait_result::done;
+    }
+    if (errno == EOPNOTSUPP || errno == EINVAL || errno == ENOSYS)
+        return nowait_result::unsupported;
+    // EAGAIN, or a real error the pool will report
+    return nowait_result::would_block;
+#else
+    (void)fd;
+    (void)iov;
+    (void)iovcnt;
+    (void)offset;
+    (void)n;
+    return nowait_result::unsupported;
+#endif
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_NOWAIT_READ_HPP
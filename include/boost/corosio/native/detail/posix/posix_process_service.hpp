@@ -0,0 +1,390 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_PROCESS_SERVICE_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_PROCESS_SERVICE_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_HAS_EPOLL
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/corosio/detail/scheduler.hpp>
+#include <boost/corosio/detail/scheduler_op.hpp>
+#include <boost/corosio/detail/timer_service.hpp>
+#include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <stop_token>
+#include <system_error>
+#include <unordered_map>
+
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+    POSIX Process Service
+    =====================
+
+    Waits for child processes to exit through their pidfds. One
+    instance per execution_context, created by the epoll and io_uring
+    schedulers via get_process_service().
+
+    The service owns a private epoll instance holding the pidfd of
+    every process being waited on. The scheduler watches that one
+    descriptor, the way it watches the timerfd and the signalfd: epoll
+    registers it edge-triggered, io_uring arms a multishot POLL_ADD on
+    it. Opening the instance is deferred to the first wait, which
+    calls the scheduler's on_open callback so a context that never
+    spawns a process pays nothing.
+
+    A pidfd polls readable once its process has exited. read_ready()
+    runs on the reactor thread, drains the private instance, reaps
+    each exited child with waitid(P_PIDFD) and posts its op. Nothing
+    involves SIGCHLD, so there is no handler and no race with other
+    code calling waitpid() on unrelated children.
+
+    Each registration carries an id rather than the op's address:
+    epoll_wait can report a pidfd that a cancellation removed a moment
+    earlier, after its op's frame is gone. mutex_ guards the id table,
+    and whichever of the reactor or a cancellation takes an op out of
+    it completes the op. A second table holds the pidfds of destroyed
+    process objects whose children were still running; those are
+    reaped and closed with no op to post. Ops are posted after mutex_
+    is released, and only work_started() runs under it, because
+    io_uring calls read_ready() with its ring mutex held.
+*/
+
+namespace boost::corosio::detail {
+
+class posix_process_service;
+
+// P_PIDFD, which older C library headers do not declare
+inline constexpr idtype_t p_pidfd = static_cast<idtype_t>(3);
+
+/// A pending wait for one child process to exit.
+struct process_wait_op : scheduler_op
+{
+    std::coroutine_handle<> h;
+    detail::continuation_op cont_op;
+    capy::executor_ref ex;
+    posix_process_service* svc = nullptr;
+    int pidfd                  = -1;
+    int exit_code              = 0;
+    std::error_code ec;
+
+    // Key in posix_process_service::ops_
+    std::uint64_t id = 0;
+
+    void operator()() override;
+    void destroy() override;
+};
+
+/** Exit notification service for child processes.
+
+    Holds the pidfds of waited-on children in a private epoll
+    instance that the scheduler watches for readability.
+*/
+class BOOST_COROSIO_DECL posix_process_service final
+    : public capy::execution_context::service
+{
+public:
+    using key_type = posix_process_service;
+
+    posix_process_service(capy::execution_context& ctx, scheduler& sched);
+    ~posix_process_service() override;
+
+    posix_process_service(posix_process_service const&)            = delete;
+    posix_process_service& operator=(posix_process_service const&) = delete;
+
+    void shutdown() override;
+
+    /** Set the callback run when the epoll instance opens.
+
+        The scheduler installs it at construction and starts
+        watching watch_fd() from it.
+    */
+    void set_on_open(timer_service::callback cb) noexcept
+    {
+        on_open_ = cb;
+    }
+
+    /// Return the descriptor the scheduler watches, or -1.
+    int watch_fd() const noexcept
+    {
+        return epoll_fd_;
+    }
+
+    /** Start waiting for the child behind `op->pidfd` to exit.
+
+        @return An error if the wait could not start; the op is
+            then not queued. `capy::error::canceled` if @p token
+            already has a stop request.
+    */
+    std::error_code start_wait(process_wait_op* op, std::stop_token token);
+
+    /// Complete `op` with `capy::error::canceled` if still queued.
+    void cancel_wait(process_wait_op* op);
+
+    /** Take ownership of a pidfd and reap its child once it exits.
+
+        Keeps no work outstanding, so a running child does not keep
+        the context's run() from returning.
+
+        @return `false` if the pidfd cannot be watched; the caller
+            keeps ownership.
+    */
+    bool reap_later(int pidfd);
+
+    /// Reap every exited child and post its op.
+    void read_ready();
+
+    void work_finished() noexcept
+    {
+        sched_->work_finished();
+    }
+
+private:
+    std::error_code open();
+
+    scheduler* sched_;
+    std::mutex mutex_;
+    std::unordered_map<std::uint64_t, process_wait_op*> ops_;
+    // Pidfds handed over by destroyed process objects
+    std::unordered_map<std::uint64_t, int> orphans_;
+    std::uint64_t next_id_ = 0;
+    std::once_flag open_once_;
+    std::error_code open_ec_;
+    int epoll_fd_ = -1;
+    timer_service::callback on_open_;
+};
+
+/** Get or create the process service for the given context.
+
+    @param ctx Reference to the owning execution_context.
+    @param sched Reference to the scheduler for posting completions.
+    @return Reference to the process service.
+*/
+inline posix_process_service&
+get_process_service(capy::execution_context& ctx, scheduler& sched)
+{
+    return ctx.make_service<posix_process_service>(sched);
+}
+
+// process_wait_op implementation
+
+inline void
+process_wait_op::operator()()
+{
+    // Capture svc before resuming (coro may destroy us)
+    auto* service = svc;
+
+    cont_op.cont.h = h;
+    ex.post(cont_op.cont);
+
+    // Balance the work_started() from start_wait
+    service->work_finished();
+}
+
+inline void
+process_wait_op::destroy()
+{
+    // No-op: the op lives in the awaiting coroutine's frame
+}
+
+// posix_process_service implementation
+
+inline posix_process_service::posix_process_service(
+    capy::execution_context&, scheduler& sched)
+    : sched_(&sched)
+{
+}
+
+inline posix_process_service::~posix_process_service()
+{
+    // Children still running stay unreaped until the program ends
+    for (auto const& o : orphans_)
+        ::close(o.second);
+    if (epoll_fd_ >= 0)
+        ::close(epoll_fd_);
+}
+
+inline void
+posix_process_service::shutdown()
+{
+    // Pending ops die with their coroutine frames; the scheduler's
+    // drain accounts for the outstanding work.
+}
+
+inline std::error_code
+posix_process_service::open()
+{
+    std::call_once(open_once_, [this] {
+        int fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (fd < 0)
+        {
+            open_ec_ = make_err(errno);
+            return;
+        }
+        epoll_fd_ = fd;
+        if (!on_open_)
+        {
+            // No scheduler watches the instance
+            open_ec_ = make_error_code(std::errc::operation_not_supported);
+            return;
+        }
+        try
+        {
+            on_open_();
+        }
+        catch (std::system_error const& e)
+        {
+            ::close(epoll_fd_);
+            epoll_fd_ = -1;
+            open_ec_  = e.code();
+        }
+    });
+    return open_ec_;
+}
+
+inline std::error_code
+posix_process_service::start_wait(process_wait_op* op, std::stop_token token)
+{
+    if (auto ec = open())
+        return ec;
+
+    op->svc = this;
+
+    std::lock_guard lock(mutex_);
+    if (token.stop_requested())
+        return make_error_code(capy::error::canceled);
+
+    op->id = ++next_id_;
+
+    epoll_event ev{};
+    ev.events   = EPOLLIN;
+    ev.data.u64 = op->id;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, op->pidfd, &ev) < 0)
+        return make_err(errno);
+
+    ops_.emplace(op->id, op);
+    sched_->work_started();
+    return {};
+}
+
+inline void
+posix_process_service::cancel_wait(process_wait_op* op)
+{
+    {
+        std::lock_guard lock(mutex_);
+        if (ops_.erase(op->id) == 0)
+            return;
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, op->pidfd, nullptr);
+    }
+
+    op->ec = make_error_code(capy::error::canceled);
+    sched_->post(op);
+}
+
+inline bool
+posix_process_service::reap_later(int pidfd)
+{
+    if (open())
+        return false;
+
+    std::lock_guard lock(mutex_);
+    auto id = ++next_id_;
+
+    epoll_event ev{};
+    ev.events   = EPOLLIN;
+    ev.data.u64 = id;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, pidfd, &ev) < 0)
+        return false;
+
+    orphans_.emplace(id, pidfd);
+    return true;
+}
+
+inline void
+posix_process_service::read_ready()
+{
+    epoll_event events[64];
+    for (;;)
+    {
+        int n = ::epoll_wait(epoll_fd_, events, 64, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return;
+
+        for (int i = 0; i < n; ++i)
+        {
+            process_wait_op* op = nullptr;
+            int orphan          = -1;
+            {
+                std::lock_guard lock(mutex_);
+                auto const id = events[i].data.u64;
+                if (auto it = ops_.find(id); it != ops_.end())
+                {
+                    op = it->second;
+                    ops_.erase(it);
+                    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, op->pidfd, nullptr);
+                }
+                else if (auto ot = orphans_.find(id); ot != orphans_.end())
+                {
+                    orphan = ot->second;
+                    orphans_.erase(ot);
+                }
+                else
+                {
+                    continue;
+                }
+            }
+
+            if (orphan >= 0)
+            {
+                // Closing the pidfd also removes it from the instance
+                siginfo_t info{};
+                ::waitid(
+                    p_pidfd, static_cast<id_t>(orphan), &info, WEXITED);
+                ::close(orphan);
+                continue;
+            }
+
+            siginfo_t info{};
+            if (::waitid(
+                    p_pidfd, static_cast<id_t>(op->pidfd), &info, WEXITED) < 0)
+                op->ec = make_err(errno);
+            else if (info.si_code == CLD_EXITED)
+                op->exit_code = info.si_status;
+            else
+                op->exit_code = -info.si_status;
+
+            sched_->post(op);
+        }
+
+        // A short batch means the instance is drained
+        if (n < 64)
+            return;
+    }
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_HAS_EPOLL
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_PROCESS_SERVICE_HPP
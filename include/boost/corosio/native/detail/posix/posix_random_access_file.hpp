@@ -22,7 +22,10 @@
 #include <boost/corosio/detail/thread_pool.hpp>
 #include <boost/corosio/detail/scheduler.hpp>
 #include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/native/detail/direct_io.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/posix/posix_nowait_read.hpp>
+#include <boost/corosio/native/detail/read_batch.hpp>
 #include <boost/capy/ex/executor_ref.hpp>
 #include <boost/capy/error.hpp>
 #include <boost/capy/buffers.hpp>
@@ -55,6 +58,21 @@
     file object, matching Asio's per-op allocation model.
 
     The raf_op self-deletes on completion or shutdown.
+
+    Files opened with file_base::direct record the device alignment
+    in direct_align_; misaligned requests complete inline with
+    invalid_argument rather than occupying a pool thread.
+
+    A read_batch is a single raf_op whose pool work preads every
+    range in turn, so the whole batch costs one dispatch and one
+    resumption.
+
+    Reads first try preadv2 with RWF_NOWAIT on the calling thread
+    (see posix_nowait_read.hpp). A page-cache hit completes inline
+    while the scheduler's inline budget lasts, and is otherwise
+    posted straight to the scheduler queue; only a read that would
+    block goes to the pool. read_batch does the same per range and
+    leaves the pool just the ranges still marked canceled.
 */
 
 namespace boost::corosio::detail {
@@ -107,6 +125,10 @@ public:
         std::size_t bytes_transferred = 0;
         bool is_read                = false;
 
+        // Non-null for read_batch; iovecs and offset are unused
+        random_access_file::read_request* batch = nullptr;
+        std::size_t batch_count                 = 0;
+
         std::atomic<bool> cancelled{false};
         std::optional<std::stop_callback<canceller>> stop_cb;
 
@@ -151,6 +173,15 @@ public:
         std::error_code*,
         std::size_t*) override;
 
+    std::coroutine_handle<> read_batch(
+        random_access_file::read_request*,
+        std::size_t,
+        std::coroutine_handle<>,
+        capy::executor_ref,
+        std::stop_token,
+        std::error_code*,
+        std::size_t*) override;
+
     native_handle_type native_handle() const noexcept override
     {
         return fd_;
@@ -176,8 +207,20 @@ public:
     void close_file() noexcept;
 
 private:
+    // Pool thread: perform one range of a read_batch.
+    void read_one(random_access_file::read_request& r) const noexcept;
+
+    // Caller thread: try a page-cache read without blocking.
+    bool try_read_nowait(
+        iovec const* iov,
+        int iovcnt,
+        std::uint64_t offset,
+        std::size_t& n) noexcept;
+
     posix_random_access_file_service& svc_;
     int fd_ = -1;
+    std::size_t direct_align_ = 0; // nonzero when opened with direct
+    std::atomic<bool> nowait_{true}; // cleared when RWF_NOWAIT is refused
     std::mutex ops_mutex_;
     intrusive_list<raf_op> outstanding_ops_;
 };
@@ -217,16 +260,33 @@ posix_random_access_file::open_file(
         oflags |= O_TRUNC;
     if ((mode & file_base::sync_all_on_write) != file_base::flags(0))
         oflags |= O_SYNC;
+    bool const direct = (mode & file_base::direct) != file_base::flags(0);
+    if (direct)
+        oflags |= direct_open_flag;
     // Note: no O_APPEND for random access files
 
     int fd = ::open(path.c_str(), oflags, 0666);
     if (fd < 0)
         return make_err(errno);
 
+    if (direct)
+    {
+        if (enable_direct_io(fd) < 0)
+        {
+            int err = errno;
+            ::close(fd);
+            return make_err(err);
+        }
+        direct_align_ = direct_io_alignment(fd);
+    }
+
     fd_ = fd;
+    nowait_.store(true, std::memory_order_relaxed);
 
 #ifdef POSIX_FADV_RANDOM
-    ::posix_fadvise(fd_, 0, 0, POSIX_FADV_RANDOM);
+    // Pointless without a page cache in the path
+    if (!direct)
+        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_RANDOM);
 #endif
 
     return {};
@@ -240,6 +300,7 @@ posix_random_access_file::close_file() noexcept
         ::close(fd_);
         fd_ = -1;
     }
+    direct_align_ = 0;
 }
 
 inline std::uint64_t
@@ -283,6 +344,7 @@ posix_random_access_file::release()
 {
     int fd = fd_;
     fd_ = -1;
+    direct_align_ = 0;
     return fd;
 }
 
@@ -291,6 +353,29 @@ posix_random_access_file::assign(native_handle_type handle)
 {
     close_file();
     fd_ = handle;
+    direct_align_ = adopted_direct_io_alignment(handle);
+    nowait_.store(true, std::memory_order_relaxed);
+}
+
+inline bool
+posix_random_access_file::try_read_nowait(
+    iovec const* iov,
+    int iovcnt,
+    std::uint64_t offset,
+    std::size_t& n) noexcept
+{
+    if (direct_align_ != 0 || !nowait_.load(std::memory_order_relaxed))
+        return false;
+    switch (try_nowait_preadv(fd_, iov, iovcnt, offset, n))
+    {
+    case nowait_result::done:
+        return true;
+    case nowait_result::unsupported:
+        nowait_.store(false, std::memory_order_relaxed);
+        return false;
+    default:
+        return false;
+    }
 }
 
 // read_some_at, write_some_at are defined in
@@ -305,7 +390,12 @@ posix_random_access_file::raf_op::operator()()
 
     bool const was_cancelled = cancelled.load(std::memory_order_acquire);
 
-    if (ec_out)
+    if (batch)
+    {
+        // Ranges finished before a cancel keep their results
+        finish_read_batch(batch, batch_count, ec_out, bytes_out);
+    }
+    else if (ec_out)
     {
         if (was_cancelled)
             *ec_out = capy::error::canceled;
@@ -317,7 +407,7 @@ posix_random_access_file::raf_op::operator()()
             *ec_out = {};
     }
 
-    if (bytes_out)
+    if (bytes_out && !batch)
         *bytes_out = was_cancelled ? 0 : bytes_transferred;
 
     {
@@ -31,7 +31,7 @@ class BOOST_COROSIO_DECL posix_random_access_file_service final
 {
 public:
     posix_random_access_file_service(
-        capy::execution_context& ctx, scheduler& sched)
+        capy::execution_context& ctx, reactor_scheduler& sched)
         : sched_(&sched)
         , pool_(get_or_create_pool(ctx))
     {
@@ -121,6 +121,12 @@ public:
         sched_->work_finished();
     }
 
+    /// Return true if a read served inline may complete inline.
+    bool try_consume_inline_budget() const noexcept
+    {
+        return sched_->try_consume_inline_budget();
+    }
+
     thread_pool& pool() noexcept
     {
         return pool_;
@@ -135,7 +141,7 @@ private:
         return ctx.make_service<thread_pool>();
     }
 
-    scheduler* sched_;
+    reactor_scheduler* sched_;
     thread_pool& pool_;
     std::mutex mutex_;
     intrusive_list<posix_random_access_file> file_list_;
@@ -147,7 +153,8 @@ private:
 
 /** Get or create the random-access file service for the given context. */
 inline posix_random_access_file_service&
-get_random_access_file_service(capy::execution_context& ctx, scheduler& sched)
+get_random_access_file_service(
+    capy::execution_context& ctx, reactor_scheduler& sched)
 {
     return ctx.make_service<posix_random_access_file_service>(sched);
 }
@@ -176,16 +183,43 @@ posix_random_access_file::read_some_at(
         return h;
     }
 
+    if (direct_align_ != 0 &&
+        !direct_io_aligned(bufs, count, offset, direct_align_))
+    {
+        *ec        = make_err(EINVAL);
+        *bytes_out = 0;
+        return h;
+    }
+
+    iovec iov[max_buffers];
+    int const iovcnt = static_cast<int>(count);
+    for (int i = 0; i < iovcnt; ++i)
+    {
+        iov[i].iov_base = bufs[i].data();
+        iov[i].iov_len  = bufs[i].size();
+    }
+
+    // Page-cache hit: no pool round trip
+    std::size_t hit = 0;
+    bool const cached = !token.stop_requested() &&
+        try_read_nowait(iov, iovcnt, offset, hit);
+    if (cached && svc_.try_consume_inline_budget())
+    {
+        if (hit == 0)
+            *ec = capy::error::eof;
+        else
+            *ec = {};
+        *bytes_out = hit;
+        return h;
+    }
+
     auto* op = new raf_op();
     op->is_read = true;
     op->offset  = offset;
 
-    op->iovec_count = static_cast<int>(count);
-    for (int i = 0; i < op->iovec_count; ++i)
-    {
-        op->iovecs[i].iov_base = bufs[i].data();
-        op->iovecs[i].iov_len  = bufs[i].size();
-    }
+    op->iovec_count = iovcnt;
+    for (int i = 0; i < iovcnt; ++i)
+        op->iovecs[i] = iov[i];
 
     op->h         = h;
     op->ex        = ex;
@@ -202,6 +236,14 @@ posix_random_access_file::read_some_at(
         outstanding_ops_.push_back(op);
     }
 
+    if (cached)
+    {
+        // Out of inline budget: complete through the scheduler queue
+        op->bytes_transferred = hit;
+        svc_.post(static_cast<scheduler_op*>(op));
+        return std::noop_coroutine();
+    }
+
     static_cast<pool_work_item*>(op)->func_ = &raf_op::do_work;
     if (!svc_.pool().post(static_cast<pool_work_item*>(op)))
     {
@@ -231,6 +273,14 @@ posix_random_access_file::write_some_at(
         return h;
     }
 
+    if (direct_align_ != 0 &&
+        !direct_io_aligned(bufs, count, offset, direct_align_))
+    {
+        *ec        = make_err(EINVAL);
+        *bytes_out = 0;
+        return h;
+    }
+
     auto* op = new raf_op();
     op->is_read = false;
     op->offset  = offset;
@@ -266,6 +316,124 @@ posix_random_access_file::write_some_at(
     return std::noop_coroutine();
 }
 
+inline std::coroutine_handle<>
+posix_random_access_file::read_batch(
+    random_access_file::read_request* reqs,
+    std::size_t count,
+    std::coroutine_handle<> h,
+    capy::executor_ref ex,
+    std::stop_token token,
+    std::error_code* ec,
+    std::size_t* bytes_out)
+{
+    init_read_batch(reqs, count);
+
+    // Serve the ranges the page cache holds; the pool reads the rest
+    bool pending = token.stop_requested();
+    for (std::size_t i = 0; i < count && !token.stop_requested(); ++i)
+    {
+        auto& r = reqs[i];
+        if (r.buffer.size() == 0)
+        {
+            r.ec = {};
+            continue;
+        }
+        iovec iov{r.buffer.data(), r.buffer.size()};
+        std::size_t n = 0;
+        if (!try_read_nowait(&iov, 1, r.offset, n))
+        {
+            pending = true;
+            continue;
+        }
+        if (n == 0)
+            r.ec = capy::error::eof;
+        else
+            r.ec = {};
+        r.bytes_transferred = n;
+    }
+    if (!pending && svc_.try_consume_inline_budget())
+    {
+        finish_read_batch(reqs, count, ec, bytes_out);
+        return h;
+    }
+
+    auto* op = new raf_op();
+    op->is_read     = true;
+    op->batch       = reqs;
+    op->batch_count = count;
+
+    op->h         = h;
+    op->ex        = ex;
+    op->ec_out    = ec;
+    op->bytes_out = bytes_out;
+    op->file_     = this;
+    op->file_ref  = this->shared_from_this();
+    op->start(token);
+
+    op->ex.on_work_started();
+
+    {
+        std::lock_guard<std::mutex> lock(ops_mutex_);
+        outstanding_ops_.push_back(op);
+    }
+
+    if (!pending)
+    {
+        svc_.post(static_cast<scheduler_op*>(op));
+        return std::noop_coroutine();
+    }
+
+    static_cast<pool_work_item*>(op)->func_ = &raf_op::do_work;
+    if (!svc_.pool().post(static_cast<pool_work_item*>(op)))
+    {
+        op->cancelled.store(true, std::memory_order_release);
+        svc_.post(static_cast<scheduler_op*>(op));
+    }
+    return std::noop_coroutine();
+}
+
+inline void
+posix_random_access_file::read_one(
+    random_access_file::read_request& r) const noexcept
+{
+    r.bytes_transferred = 0;
+    if (r.buffer.size() == 0)
+    {
+        r.ec = {};
+        return;
+    }
+    if (direct_align_ != 0 &&
+        !direct_io_aligned(&r.buffer, 1, r.offset, direct_align_))
+    {
+        r.ec = make_err(EINVAL);
+        return;
+    }
+    if (r.offset >
+        static_cast<std::uint64_t>(std::numeric_limits<off_t>::max()))
+    {
+        r.ec = make_err(EOVERFLOW);
+        return;
+    }
+
+    ssize_t n;
+    do
+    {
+        n = ::pread(fd_, r.buffer.data(), r.buffer.size(),
+                    static_cast<off_t>(r.offset));
+    }
+    while (n < 0 && errno == EINTR);
+
+    if (n < 0)
+        r.ec = make_err(errno);
+    else if (n == 0)
+        r.ec = capy::error::eof;
+    else
+    {
+        r.ec                = {};
+        r.bytes_transferred = static_cast<std::size_t>(n);
+    }
+}
+
 // -- raf_op thread-pool work function --
 
 inline void
@@ -274,7 +442,19 @@ posix_random_access_file::raf_op::do_work(pool_work_item* w) noexcept
     auto* op   = static_cast<raf_op*>(w);
     auto* self = op->file_;
 
-    if (op->cancelled.load(std::memory_order_acquire))
+    if (op->batch)
+    {
+        // Ranges still marked canceled were not served inline;
+        // those left after a cancel stay that way
+        for (std::size_t i = 0; i < op->batch_count; ++i)
+        {
+            if (op->cancelled.load(std::memory_order_acquire))
+                break;
+            if (op->batch[i].ec == capy::error::canceled)
+                self->read_one(op->batch[i]);
+        }
+    }
+    else if (op->cancelled.load(std::memory_order_acquire))
     {
         op->errn              = ECANCELED;
         op->bytes_transferred = 0;
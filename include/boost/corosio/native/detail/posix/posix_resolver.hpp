@@ -78,6 +78,14 @@
 
     Reverse resolution follows the same pattern using getnameinfo().
 
+    Caching
+    -------
+    When the context has a posix_resolver_cache, resolve() consults it
+    after setting up op_. A hit completes inline without a pool hop.
+    A lookup already in flight for the same host/service/flags parks
+    this resolver on the cache entry; the leader's pool thread fills
+    in each parked op_ and posts it alongside its own.
+
     Single-Inflight Constraint
     --------------------------
     Each resolver has ONE embedded op_ for forward and ONE reverse_op_ for
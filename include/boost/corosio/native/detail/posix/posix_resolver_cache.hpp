@@ -0,0 +1,298 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_RESOLVER_CACHE_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_RESOLVER_CACHE_HPP
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/resolver.hpp>
+#include <boost/corosio/resolver_results.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <netdb.h>
+
+/*
+    Resolver Cache
+    ==============
+
+    getaddrinfo() runs on the resolver lane of the thread pool, so
+    without a cache every resolve() costs a pool hop and a lookup,
+    even when thousands of coroutines ask for the same host at once.
+    The cache is an optional execution_context service, created by
+    io_context when a resolver cache TTL is configured, and keyed on
+    host, service and flags.
+
+    An entry is either pending or ready. The first lookup of a key
+    inserts a pending entry and becomes its leader: it runs
+    getaddrinfo() as usual. Lookups that find the entry pending join
+    it; their resolver is parked in the entry (holding a shared_ptr,
+    like the pool work item does) and completed by the leader's pool
+    thread. Lookups that find a ready, unexpired entry are hits and
+    complete inline with a copy of the results.
+
+    getaddrinfo() does not report record TTLs, so successful answers
+    live for the configured TTL. "Host not found" is cached for the
+    negative TTL; transient failures (EAI_AGAIN and the like) are not
+    cached, so the next lookup retries.
+
+    When the cache is full, expired entries are swept; if it is
+    still full the lookup leads without an entry and its answer is
+    not kept.
+*/
+
+namespace boost::corosio::detail {
+
+class posix_resolver;
+
+/// Settings of the resolver cache.
+struct posix_resolver_cache_config
+{
+    /// Lifetime of a successful answer; zero disables.
+    std::chrono::milliseconds ttl{0};
+
+    /// Lifetime of a "host not found" answer; zero disables.
+    std::chrono::milliseconds negative_ttl{0};
+
+    /// Maximum number of entries, pending ones included.
+    std::size_t max_entries = 1024;
+};
+
+/** Per-context cache of forward resolutions.
+
+    @par Thread Safety
+    All member functions are safe to call concurrently.
+*/
+class BOOST_COROSIO_DECL posix_resolver_cache final
+    : public capy::execution_context::service
+{
+public:
+    using key_type = posix_resolver_cache;
+
+    /// Outcome of @ref lookup.
+    enum class lookup_status
+    {
+        /// The answer was cached and has been copied out.
+        hit,
+
+        /// No usable entry; the caller must resolve and `complete`.
+        leader,
+
+        /// A lookup is in flight; the waiter will be completed.
+        joined
+    };
+
+    /// Resolvers parked on a pending entry.
+    using waiter_list = std::vector<std::shared_ptr<posix_resolver>>;
+
+    posix_resolver_cache(
+        capy::execution_context& ctx,
+        posix_resolver_cache_config const& cfg) noexcept
+        : cfg_(cfg)
+    {
+        (void)ctx;
+    }
+
+    ~posix_resolver_cache() override = default;
+
+    posix_resolver_cache(posix_resolver_cache const&)            = delete;
+    posix_resolver_cache& operator=(posix_resolver_cache const&) = delete;
+
+    /** Look up a key, joining or leading on a miss.
+
+        @param waiter The resolver to park if a lookup is in flight.
+        @param gai_error Set to the cached error on a hit.
+        @param out Set to the cached results on a successful hit.
+    */
+    lookup_status lookup(
+        std::string_view host,
+        std::string_view service,
+        resolve_flags flags,
+        std::shared_ptr<posix_resolver> const& waiter,
+        int& gai_error,
+        resolver_results& out);
+
+    /** Publish the answer of a leader's lookup.
+
+        @return The waiters parked on the entry. The caller hands
+            each the answer and posts its completion.
+    */
+    waiter_list complete(
+        std::string_view host,
+        std::string_view service,
+        resolve_flags flags,
+        int gai_error,
+        resolver_results const& results);
+
+    void shutdown() override;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct entry
+    {
+        bool pending = true;
+        clock::time_point expires;
+        int gai_error = 0;
+        resolver_results results;
+        waiter_list waiters;
+    };
+
+    static std::string
+    make_key(
+        std::string_view host, std::string_view service, resolve_flags flags)
+    {
+        std::string key;
+        key.reserve(host.size() + service.size() + 8);
+        key.append(host);
+        key.push_back('\0');
+        key.append(service);
+        key.push_back('\0');
+        key.append(std::to_string(static_cast<unsigned>(flags)));
+        return key;
+    }
+
+    static bool is_negative(int gai_error) noexcept
+    {
+#ifdef EAI_NODATA
+        if (gai_error == EAI_NODATA)
+            return true;
+#endif
+        return gai_error == EAI_NONAME;
+    }
+
+    void sweep(clock::time_point now);
+
+    posix_resolver_cache_config cfg_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, entry> entries_;
+};
+
+// ---------------------------------------------------------------------------
+// Inline implementation
+// ---------------------------------------------------------------------------
+
+inline posix_resolver_cache::lookup_status
+posix_resolver_cache::lookup(
+    std::string_view host,
+    std::string_view service,
+    resolve_flags flags,
+    std::shared_ptr<posix_resolver> const& waiter,
+    int& gai_error,
+    resolver_results& out)
+{
+    auto key = make_key(host, service, flags);
+    auto now = clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        auto& e = it->second;
+        if (e.pending)
+        {
+            e.waiters.push_back(waiter);
+            return lookup_status::joined;
+        }
+        if (now < e.expires)
+        {
+            gai_error = e.gai_error;
+            if (e.gai_error == 0)
+                out = e.results;
+            return lookup_status::hit;
+        }
+        e = entry{};
+        return lookup_status::leader;
+    }
+
+    if (entries_.size() >= cfg_.max_entries)
+    {
+        sweep(now);
+        if (entries_.size() >= cfg_.max_entries)
+            return lookup_status::leader;
+    }
+    entries_.emplace(std::move(key), entry{});
+    return lookup_status::leader;
+}
+
+inline posix_resolver_cache::waiter_list
+posix_resolver_cache::complete(
+    std::string_view host,
+    std::string_view service,
+    resolve_flags flags,
+    int gai_error,
+    resolver_results const& results)
+{
+    auto key = make_key(host, service, flags);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || !it->second.pending)
+        return {};
+
+    auto& e      = it->second;
+    auto waiters = std::move(e.waiters);
+    std::chrono::milliseconds ttl{0};
+    if (gai_error == 0)
+        ttl = cfg_.ttl;
+    else if (is_negative(gai_error))
+        ttl = cfg_.negative_ttl;
+    if (ttl.count() == 0)
+    {
+        entries_.erase(it);
+        return waiters;
+    }
+
+    e.pending   = false;
+    e.expires   = clock::now() + ttl;
+    e.gai_error = gai_error;
+    e.waiters   = {};
+    if (gai_error == 0)
+        e.results = results;
+    return waiters;
+}
+
+inline void
+posix_resolver_cache::sweep(clock::time_point now)
+{
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        if (!it->second.pending && it->second.expires <= now)
+            it = entries_.erase(it);
+        else
+            ++it;
+    }
+}
+
+inline void
+posix_resolver_cache::shutdown()
+{
+    // Drop parked resolvers; the resolver service cancels them and
+    // the scheduler abandons their outstanding work.
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_POSIX
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_POSIX_POSIX_RESOLVER_CACHE_HPP
@@ -16,6 +16,7 @@
 #if BOOST_COROSIO_POSIX
 
 #include <boost/corosio/native/detail/posix/posix_resolver.hpp>
+#include <boost/corosio/native/detail/posix/posix_resolver_cache.hpp>
 #include <boost/corosio/native/detail/reactor/reactor_scheduler.hpp>
 #include <boost/corosio/detail/thread_pool.hpp>
 
@@ -38,6 +39,7 @@ public:
     posix_resolver_service(capy::execution_context& ctx, scheduler& sched)
         : sched_(&sched)
         , pool_(ctx.use_service<thread_pool>())
+        , cache_(ctx.find_service<posix_resolver_cache>())
     {
     }
 
@@ -68,6 +70,12 @@ public:
         return pool_;
     }
 
+    /** Return the resolution cache, or null if none is configured. */
+    posix_resolver_cache* cache() noexcept
+    {
+        return cache_;
+    }
+
     /** Return true if single-threaded mode is active. */
     bool single_threaded() const noexcept
     {
@@ -77,6 +85,7 @@ public:
 private:
     scheduler* sched_;
     thread_pool& pool_;
+    posix_resolver_cache* cache_;
     std::mutex mutex_;
     intrusive_list<posix_resolver> resolver_list_;
     std::unordered_map<posix_resolver*, std::shared_ptr<posix_resolver>>
@@ -397,6 +406,37 @@ posix_resolver::resolve(
     op.flags   = flags;
     op.start(token);
 
+    bool leader = false;
+    if (auto* cache = svc_.cache())
+    {
+        // The op must be fully set up before the lookup: a joined
+        // op can be completed by the leader's pool thread as soon
+        // as the cache lock is released.
+        using status = posix_resolver_cache::lookup_status;
+        auto st      = cache->lookup(
+            op.host, op.service, flags, this->shared_from_this(),
+            op.gai_error, op.stored_results);
+        if (st == status::hit)
+        {
+            op.stop_cb.reset();
+            if (op.gai_error != 0)
+            {
+                *ec = posix_resolver_detail::make_gai_error(op.gai_error);
+            }
+            else
+            {
+                *ec  = {};
+                *out = std::move(op.stored_results);
+            }
+            op.cont_op.cont.h = h;
+            return dispatch_coro(ex, op.cont_op.cont);
+        }
+        // The leader counts work for its waiters when it posts them
+        if (st == status::joined)
+            return std::noop_coroutine();
+        leader = true;
+    }
+
     // Keep io_context alive while resolution is pending
     op.ex.on_work_started();
 
@@ -404,11 +444,26 @@ posix_resolver::resolve(
     resolve_pool_op_.resolver_ = this;
     resolve_pool_op_.ref_      = this->shared_from_this();
     resolve_pool_op_.func_     = &posix_resolver::do_resolve_work;
-    if (!svc_.pool().post(&resolve_pool_op_))
+    if (!svc_.pool().post(&resolve_pool_op_, thread_pool_lane::resolver))
     {
         // Pool shut down — complete with cancellation
         resolve_pool_op_.ref_.reset();
         op.cancelled.store(true, std::memory_order_release);
+
+        // Release the pending entry, or its waiters and every later
+        // lookup of the key would park forever. The waiters share the
+        // leader's fate; EAI_AGAIN is transient, so nothing is cached.
+        if (leader)
+        {
+            auto waiters = svc_.cache()->complete(
+                op.host, op.service, flags, EAI_AGAIN, {});
+            for (auto& w : waiters)
+            {
+                w->op_.cancelled.store(true, std::memory_order_release);
+                svc_.work_started();
+                svc_.post(&w->op_);
+            }
+        }
         svc_.post(&op_);
     }
     return std::noop_coroutine();
@@ -449,7 +504,7 @@ posix_resolver::reverse_resolve(
     reverse_pool_op_.resolver_ = this;
     reverse_pool_op_.ref_      = this->shared_from_this();
     reverse_pool_op_.func_     = &posix_resolver::do_reverse_resolve_work;
-    if (!svc_.pool().post(&reverse_pool_op_))
+    if (!svc_.pool().post(&reverse_pool_op_, thread_pool_lane::resolver))
     {
         // Pool shut down — complete with cancellation
         reverse_pool_op_.ref_.reset();
@@ -483,22 +538,41 @@ posix_resolver::do_resolve_work(pool_work_item* w) noexcept
         self->op_.service.empty() ? nullptr : self->op_.service.c_str(), &hints,
         &ai);
 
-    if (!self->op_.cancelled.load(std::memory_order_acquire))
+    resolver_results results;
+    if (result == 0 && ai)
+        results = posix_resolver_detail::convert_results(
+            ai, self->op_.host, self->op_.service);
+
+    if (ai)
+        ::freeaddrinfo(ai);
+
+    // Hand the answer to coalesced lookups before posting our own
+    // completion, so the work count cannot drop to zero in between
+    if (auto* cache = self->svc_.cache())
     {
-        if (result == 0 && ai)
-        {
-            self->op_.stored_results = posix_resolver_detail::convert_results(
-                ai, self->op_.host, self->op_.service);
-            self->op_.gai_error = 0;
-        }
-        else
+        auto waiters = cache->complete(
+            self->op_.host, self->op_.service, self->op_.flags, result,
+            results);
+        for (auto& w : waiters)
         {
-            self->op_.gai_error = result;
+            auto& wop = w->op_;
+            if (!wop.cancelled.load(std::memory_order_acquire))
+            {
+                wop.gai_error = result;
+                if (result == 0)
+                    wop.stored_results = results;
+            }
+            self->svc_.work_started();
+            self->svc_.post(&wop);
         }
     }
 
-    if (ai)
-        ::freeaddrinfo(ai);
+    if (!self->op_.cancelled.load(std::memory_order_acquire))
+    {
+        self->op_.gai_error = result;
+        if (result == 0)
+            self->op_.stored_results = std::move(results);
+    }
 
     // Move ref to stack before post — post may trigger destroy_impl
     // which erases the last shared_ptr, destroying *self (and *pw)
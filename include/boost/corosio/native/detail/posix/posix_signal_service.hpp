@@ -21,10 +21,21 @@
 #include <boost/corosio/detail/scheduler.hpp>
 #include <boost/capy/error.hpp>
 
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/native/detail/make_err.hpp>
+#endif
+
 #include <mutex>
 
 #include <signal.h>
 
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+#include <errno.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+#endif
+
 /*
     POSIX Signal Service
     ====================
@@ -132,6 +143,28 @@
 
     If a signal was already queued (undelivered > 0), no work tracking is needed
     because completion is posted immediately.
+
+    signalfd Delivery (Linux)
+    -------------------------
+
+    With io_context_options::signal_fd on the epoll or io_uring backend,
+    the scheduler calls open_signal_fd() after construction and watches
+    the returned descriptor: epoll registers it edge-triggered next to
+    the timerfd, io_uring arms a multishot POLL_ADD on it. The signalfd
+    mask tracks the signals this service has registrations for.
+
+    A signal that is blocked in every thread stays pending until the
+    reactor reports the signalfd readable; read_signal_fd() then reads
+    the queued signals in batches and calls deliver_signal() from an
+    ordinary thread, so the locking above is safe. Standard signals
+    raised several times while pending coalesce into one read, as they
+    do with the handler.
+
+    The sigaction() handler stays installed, so a signal that reaches a
+    thread where it is not blocked still arrives through the handler.
+    Either path ends in deliver_signal(), which feeds every service, so
+    a signal read by one context's signalfd still wakes signal_sets on
+    other contexts.
 */
 
 namespace boost::corosio {
@@ -186,10 +219,35 @@ public:
     void work_finished() noexcept;
     void post(signal_op* op);
 
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+    /** Start receiving registered signals through a signalfd.
+
+        Called once by the scheduler, which then watches the
+        returned descriptor for readability and calls
+        read_signal_fd() when it fires.
+
+        @return The non-blocking signalfd, owned by this service.
+
+        @throws std::system_error if the signalfd cannot be created.
+    */
+    int open_signal_fd();
+
+    /// Read every queued signal from the signalfd and deliver it.
+    void read_signal_fd();
+#endif
+
 private:
     static void add_service(posix_signal_service* service);
     static void remove_service(posix_signal_service* service);
 
+    // Add or drop a signal in the signalfd mask (caller holds mutex_)
+    void update_signal_fd(int signal_number, bool add);
+
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+    int signal_fd_ = -1;
+    sigset_t signal_fd_mask_;
+#endif
+
     scheduler* sched_;
     std::mutex mutex_;
     intrusive_list<posix_signal> impl_list_;
@@ -406,6 +464,10 @@ inline posix_signal_service::posix_signal_service(
 inline posix_signal_service::~posix_signal_service()
 {
     remove_service(this);
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+    if (signal_fd_ >= 0)
+        ::close(signal_fd_);
+#endif
 }
 
 inline void
@@ -527,7 +589,8 @@ posix_signal_service::add_signal(
     registrations_[signal_number] = new_reg;
 
     ++state->registration_count[signal_number];
-    ++registration_count_[signal_number];
+    if (registration_count_[signal_number]++ == 0)
+        update_signal_fd(signal_number, true);
 
     return {};
 }
@@ -579,7 +642,8 @@ posix_signal_service::remove_signal(posix_signal& impl, int signal_number)
         reg->next_in_table->prev_in_table = reg->prev_in_table;
 
     --state->registration_count[signal_number];
-    --registration_count_[signal_number];
+    if (--registration_count_[signal_number] == 0)
+        update_signal_fd(signal_number, false);
 
     delete reg;
     return {};
@@ -623,7 +687,8 @@ posix_signal_service::clear_signals(posix_signal& impl)
             reg->next_in_table->prev_in_table = reg->prev_in_table;
 
         --state->registration_count[signal_number];
-        --registration_count_[signal_number];
+        if (--registration_count_[signal_number] == 0)
+            update_signal_fd(signal_number, false);
 
         delete reg;
     }
@@ -761,6 +826,71 @@ posix_signal_service::post(signal_op* op)
     sched_->post(op);
 }
 
+#if BOOST_COROSIO_HAS_EPOLL || BOOST_COROSIO_HAS_IO_URING
+
+inline int
+posix_signal_service::open_signal_fd()
+{
+    std::lock_guard lock(mutex_);
+    if (signal_fd_ >= 0)
+        return signal_fd_;
+
+    sigemptyset(&signal_fd_mask_);
+    for (int i = 1; i < max_signal_number; ++i)
+        if (registration_count_[i] > 0)
+            sigaddset(&signal_fd_mask_, i);
+
+    signal_fd_ = ::signalfd(-1, &signal_fd_mask_, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (signal_fd_ < 0)
+        detail::throw_system_error(make_err(errno), "signalfd");
+    return signal_fd_;
+}
+
+inline void
+posix_signal_service::update_signal_fd(int signal_number, bool add)
+{
+    if (signal_fd_ < 0)
+        return;
+    if (add)
+        sigaddset(&signal_fd_mask_, signal_number);
+    else
+        sigdelset(&signal_fd_mask_, signal_number);
+    // Only fails for a bad descriptor or mask; the handler still
+    // delivers the signal if it ever did.
+    [[maybe_unused]] int r = ::signalfd(signal_fd_, &signal_fd_mask_, 0);
+}
+
+inline void
+posix_signal_service::read_signal_fd()
+{
+    signalfd_siginfo infos[16];
+    for (;;)
+    {
+        auto n = ::read(signal_fd_, infos, sizeof(infos));
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return;
+
+        auto count = static_cast<std::size_t>(n) / sizeof(signalfd_siginfo);
+        for (std::size_t i = 0; i < count; ++i)
+            deliver_signal(static_cast<int>(infos[i].ssi_signo));
+
+        // A short read means the queue is drained
+        if (count < sizeof(infos) / sizeof(infos[0]))
+            return;
+    }
+}
+
+#else
+
+inline void
+posix_signal_service::update_signal_fd(int, bool)
+{
+}
+
+#endif
+
 inline void
 posix_signal_service::add_service(posix_signal_service* service)
 {
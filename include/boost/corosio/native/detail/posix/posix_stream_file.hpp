@@ -25,6 +25,7 @@
 #include <boost/corosio/detail/scheduler.hpp>
 #include <boost/corosio/detail/buffer_param.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/posix/posix_nowait_read.hpp>
 #include <boost/capy/ex/executor_ref.hpp>
 #include <boost/capy/error.hpp>
 #include <boost/capy/buffers.hpp>
@@ -64,6 +65,12 @@
     3. Pool thread stores results, posts scheduler_op to scheduler
     4. Scheduler invokes op() which resumes the coroutine
 
+    Reads first try preadv2 with RWF_NOWAIT on the calling thread
+    (see posix_nowait_read.hpp). A page-cache hit skips steps 1-3:
+    it resumes the caller inline while the scheduler's inline
+    budget lasts, and otherwise posts read_op_ with its result
+    already stored.
+
     Single-Inflight Constraint
     --------------------------
     Only one asynchronous operation may be in flight at a time on a
@@ -221,6 +228,7 @@ private:
     posix_stream_file_service& svc_;
     int fd_ = -1;
     std::uint64_t offset_ = 0;
+    bool nowait_ = true; // cleared when RWF_NOWAIT is refused
 
     file_op read_op_;
     file_op write_op_;
@@ -276,6 +284,7 @@ posix_stream_file::open_file(
 
     fd_     = fd;
     offset_ = 0;
+    nowait_ = true;
 
     // Append mode: position at end-of-file (preadv/pwritev use
     // explicit offsets, so O_APPEND alone is not sufficient).
@@ -360,6 +369,7 @@ posix_stream_file::assign(native_handle_type handle)
     close_file();
     fd_ = handle;
     offset_ = 0;
+    nowait_ = true;
 }
 
 inline std::uint64_t
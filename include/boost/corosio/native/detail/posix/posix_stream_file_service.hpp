@@ -27,14 +27,14 @@ namespace boost::corosio::detail {
 /** Stream file service for POSIX backends.
 
     Owns all posix_stream_file instances. Thread lifecycle is
-    managed by the thread_pool service (shared with resolver).
+    managed by the thread_pool service, on its file lane.
 */
 class BOOST_COROSIO_DECL posix_stream_file_service final
     : public file_service
 {
 public:
     posix_stream_file_service(
-        capy::execution_context& ctx, scheduler& sched)
+        capy::execution_context& ctx, reactor_scheduler& sched)
         : sched_(&sched)
         , pool_(get_or_create_pool(ctx))
     {
@@ -121,6 +121,12 @@ public:
         sched_->work_finished();
     }
 
+    /// Return true if a read served inline may complete inline.
+    bool try_consume_inline_budget() const noexcept
+    {
+        return sched_->try_consume_inline_budget();
+    }
+
     thread_pool& pool() noexcept
     {
         return pool_;
@@ -135,7 +141,7 @@ private:
         return ctx.make_service<thread_pool>();
     }
 
-    scheduler* sched_;
+    reactor_scheduler* sched_;
     thread_pool& pool_;
     std::mutex mutex_;
     intrusive_list<posix_stream_file> file_list_;
@@ -145,7 +151,7 @@ private:
 
 /** Get or create the stream file service for the given context. */
 inline posix_stream_file_service&
-get_stream_file_service(capy::execution_context& ctx, scheduler& sched)
+get_stream_file_service(capy::execution_context& ctx, reactor_scheduler& sched)
 {
     return ctx.make_service<posix_stream_file_service>(sched);
 }
@@ -184,6 +190,36 @@ posix_stream_file::read_some(
         op.iovecs[i].iov_len  = bufs[i].size();
     }
 
+    // Page-cache hit: no pool round trip
+    std::size_t hit = 0;
+    bool cached     = false;
+    if (nowait_ && !token.stop_requested())
+    {
+        switch (try_nowait_preadv(
+            fd_, op.iovecs, op.iovec_count, offset_, hit))
+        {
+        case nowait_result::done:
+            cached = true;
+            offset_ += hit;
+            break;
+        case nowait_result::unsupported:
+            nowait_ = false;
+            break;
+        default:
+            break;
+        }
+    }
+    if (cached && svc_.try_consume_inline_budget())
+    {
+        if (hit == 0)
+            *ec = capy::error::eof;
+        else
+            *ec = {};
+        *bytes_out        = hit;
+        op.cont_op.cont.h = h;
+        return dispatch_coro(ex, op.cont_op.cont);
+    }
+
     op.h         = h;
     op.ex        = ex;
     op.ec_out    = ec;
@@ -192,6 +228,15 @@ posix_stream_file::read_some(
 
     op.ex.on_work_started();
 
+    if (cached)
+    {
+        // Out of inline budget: complete through the scheduler queue
+        op.bytes_transferred = hit;
+        op.impl_ref          = this->shared_from_this();
+        svc_.post(&read_op_);
+        return std::noop_coroutine();
+    }
+
     read_pool_op_.file_ = this;
     read_pool_op_.ref_  = this->shared_from_this();
     read_pool_op_.func_ = &posix_stream_file::do_read_work;
@@ -60,7 +60,7 @@ class reactor_basic_socket
     template<class, class, class, class, class, class, class, class, class>
     friend class reactor_stream_socket;
 
-    template<class, class, class, class, class, class, class, class, class, class, class>
+    template<class, class, class, class, class, class, class, class, class, class, class, class, class>
     friend class reactor_datagram_socket;
 
     explicit reactor_basic_socket(Service& svc) noexcept : svc_(svc) {}
@@ -259,8 +259,9 @@ reactor_basic_socket<Derived, ImplBase, Service, DescState, Endpoint>::
         reactor_op_base* op   = nullptr;
         reactor_op_base* base = nullptr;
     };
-    // Max 8 ops: conn, rd, wr, wait_rd, wait_wr, wait_er, recv_rd, send_wr
-    claimed_entry claimed[8];
+    // Max 10 ops: conn, rd, wr, wait_rd, wait_wr, wait_er, recv_rd, send_wr,
+    // recv_batch_rd, send_batch_wr
+    claimed_entry claimed[10];
     int count = 0;
 
     {
@@ -299,7 +300,7 @@ reactor_basic_socket<Derived, ImplBase, Service, DescState, Endpoint>::
         {
             reactor_op_base* base = nullptr;
         };
-        claimed_entry claimed[8];
+        claimed_entry claimed[10];
         int count = 0;
 
         {
@@ -365,7 +366,7 @@ reactor_basic_socket<Derived, ImplBase, Service, DescState, Endpoint>::
         {
             reactor_op_base* base = nullptr;
         };
-        claimed_entry claimed[8];
+        claimed_entry claimed[10];
         int count = 0;
 
         {
@@ -79,6 +79,22 @@ struct reactor_dgram_wait_op final
     void operator()() override;
 };
 
+template<class Traits, class Socket, class DummyAcc, class Endpoint>
+struct reactor_dgram_send_batch_op final
+    : reactor_send_batch_op<
+          reactor_dgram_base_op<Traits, Socket, DummyAcc, Endpoint>>
+{
+    void operator()() override;
+};
+
+template<class Traits, class Socket, class DummyAcc, class Endpoint>
+struct reactor_dgram_recv_batch_op final
+    : reactor_recv_batch_op<
+          reactor_dgram_base_op<Traits, Socket, DummyAcc, Endpoint>>
+{
+    void operator()() override;
+};
+
 // --- Deferred implementations ---
 
 template<class Traits, class Socket, class DummyAcc, class Endpoint>
@@ -127,6 +143,20 @@ reactor_dgram_wait_op<Traits, Socket, DummyAcc, Endpoint>::operator()()
     complete_wait_op(*this);
 }
 
+template<class Traits, class Socket, class DummyAcc, class Endpoint>
+void
+reactor_dgram_send_batch_op<Traits, Socket, DummyAcc, Endpoint>::operator()()
+{
+    complete_datagram_batch_op(*this);
+}
+
+template<class Traits, class Socket, class DummyAcc, class Endpoint>
+void
+reactor_dgram_recv_batch_op<Traits, Socket, DummyAcc, Endpoint>::operator()()
+{
+    complete_datagram_batch_op(*this);
+}
+
 } // namespace boost::corosio::detail
 
 #endif // BOOST_COROSIO_NATIVE_DETAIL_REACTOR_REACTOR_DATAGRAM_OPS_HPP
@@ -16,10 +16,14 @@
 #include <boost/corosio/native/detail/reactor/reactor_basic_socket.hpp>
 #include <boost/corosio/native/detail/reactor/reactor_descriptor_state.hpp>
 #include <boost/corosio/native/detail/msg_flags.hpp>
+#include <boost/corosio/native/detail/datagram_batch.hpp>
+#include <boost/corosio/native/detail/datagram_control.hpp>
+#include <boost/corosio/native/detail/fd_control.hpp>
 #include <boost/corosio/detail/dispatch_coro.hpp>
 #include <boost/capy/buffers.hpp>
 
 #include <coroutine>
+#include <memory>
 
 #include <errno.h>
 #include <sys/socket.h>
@@ -42,6 +46,8 @@ namespace boost::corosio::detail {
     @tparam SendOp     The backend's connected send op type.
     @tparam RecvOp     The backend's connected recv op type.
     @tparam WaitOp     The backend's wait op type.
+    @tparam SendBatchOp The backend's batched send op type.
+    @tparam RecvBatchOp The backend's batched recv op type.
     @tparam DescState  The backend's descriptor_state type.
     @tparam ImplBase   The public vtable base
                        (udp_socket::implementation or
@@ -57,6 +63,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase = udp_socket::implementation,
     class Endpoint = endpoint>
@@ -76,7 +84,7 @@ class reactor_datagram_socket
         Endpoint>;
     using self_type = reactor_datagram_socket<
         Derived, Service, ConnOp, SendToOp, RecvFromOp, SendOp, RecvOp, WaitOp,
-        DescState, ImplBase, Endpoint>;
+        SendBatchOp, RecvBatchOp, DescState, ImplBase, Endpoint>;
     friend base_type;
     friend Derived;
 
@@ -112,6 +120,17 @@ public:
     /// Pending wait-for-error operation slot.
     WaitOp wait_er_;
 
+    /** Pending batched send operation slot.
+
+        Allocated by the first send_batch: the op carries
+        max_datagram_batch headers, addresses and control buffers,
+        which most sockets never use.
+    */
+    std::unique_ptr<SendBatchOp> send_batch_wr_;
+
+    /// Pending batched recv operation slot, allocated like send_batch_wr_.
+    std::unique_ptr<RecvBatchOp> recv_batch_rd_;
+
     ~reactor_datagram_socket() override = default;
 
     /// Return the cached remote endpoint.
@@ -216,7 +235,9 @@ public:
 
         Tries sendmsg() speculatively. On success or hard error,
         returns via inline budget or posts through queue.
-        On EAGAIN, registers with the reactor.
+        On EAGAIN, registers with the reactor. A non-null `info`
+        (send_msg) attaches source-address and traffic-class
+        control messages.
     */
     std::coroutine_handle<> do_send_to(
         std::coroutine_handle<>,
@@ -226,13 +247,15 @@ public:
         int flags,
         std::stop_token const&,
         std::error_code*,
-        std::size_t*);
+        std::size_t*,
+        datagram_info const* info = nullptr);
 
     /** Shared recv_from dispatch.
 
         Tries recvmsg() speculatively. On success or hard error,
         returns via inline budget or posts through queue.
-        On EAGAIN, registers with the reactor.
+        On EAGAIN, registers with the reactor. A non-null `info`
+        (recv_msg) receives the decoded control messages.
     */
     std::coroutine_handle<> do_recv_from(
         std::coroutine_handle<>,
@@ -242,7 +265,8 @@ public:
         int flags,
         std::stop_token const&,
         std::error_code*,
-        std::size_t*);
+        std::size_t*,
+        datagram_info* info = nullptr);
 
     /** Shared connect dispatch.
 
@@ -260,7 +284,8 @@ public:
     /** Shared connected send dispatch.
 
         Like do_send_to but uses send_wr_ slot and sendmsg()
-        with msg_name=nullptr.
+        with msg_name=nullptr. An optional @p control buffer is
+        attached as ancillary data (fd passing).
     */
     std::coroutine_handle<> do_send(
         std::coroutine_handle<>,
@@ -269,12 +294,15 @@ public:
         int flags,
         std::stop_token const&,
         std::error_code*,
-        std::size_t*);
+        std::size_t*,
+        void const* control     = nullptr,
+        std::size_t control_len = 0);
 
     /** Shared connected recv dispatch.
 
         Like do_recv_from but uses recv_rd_ slot and recvmsg()
-        with msg_name=nullptr.
+        with msg_name=nullptr. An optional @p control buffer
+        receives ancillary data; its length lands in @p control_len.
     */
     std::coroutine_handle<> do_recv(
         std::coroutine_handle<>,
@@ -283,6 +311,43 @@ public:
         int flags,
         std::stop_token const&,
         std::error_code*,
+        std::size_t*,
+        void* control            = nullptr,
+        std::size_t control_cap  = 0,
+        std::size_t* control_len = nullptr);
+
+    /** Shared batched send dispatch.
+
+        Tries sendmmsg() speculatively. On success or hard error,
+        returns via inline budget or posts through queue.
+        On EAGAIN, registers with the reactor. Not an override —
+        only UDP sockets forward here.
+    */
+    std::coroutine_handle<> do_send_batch(
+        std::coroutine_handle<>,
+        capy::executor_ref,
+        const_datagram_slot*,
+        std::size_t,
+        int flags,
+        std::stop_token const&,
+        std::error_code*,
+        std::size_t*);
+
+    /** Shared batched recv dispatch.
+
+        Tries recvmmsg() speculatively. On success or hard error,
+        returns via inline budget or posts through queue.
+        On EAGAIN, registers with the reactor. Not an override —
+        only UDP sockets forward here.
+    */
+    std::coroutine_handle<> do_recv_batch(
+        std::coroutine_handle<>,
+        capy::executor_ref,
+        datagram_slot*,
+        std::size_t,
+        int flags,
+        std::stop_token const&,
+        std::error_code*,
         std::size_t*);
 
     /** Shared readiness-wait dispatch.
@@ -366,7 +431,11 @@ private:
             return &this->desc_state_.wait_write_op;
         if (&op == static_cast<void*>(&wait_er_))
             return &this->desc_state_.wait_error_op;
-        return nullptr;
+        // Only a batch op is left. Its direction picks the slot without
+        // reading the other direction's pointer, which a concurrent
+        // first batch call may be allocating
+        return op.is_read_operation() ? &this->desc_state_.read_op
+                                      : &this->desc_state_.write_op;
     }
 
     template<class Op>
@@ -388,7 +457,9 @@ private:
             return &this->desc_state_.wait_write_cancel_pending;
         if (&op == static_cast<void*>(&wait_er_))
             return &this->desc_state_.wait_error_cancel_pending;
-        return nullptr;
+        return op.is_read_operation()
+            ? &this->desc_state_.read_cancel_pending
+            : &this->desc_state_.write_cancel_pending;
     }
 
     template<class Fn>
@@ -402,6 +473,10 @@ private:
         fn(wait_rd_);
         fn(wait_wr_);
         fn(wait_er_);
+        if (recv_batch_rd_)
+            fn(*recv_batch_rd_);
+        if (send_batch_wr_)
+            fn(*send_batch_wr_);
     }
 
     template<class Fn>
@@ -415,6 +490,10 @@ private:
         fn(wait_rd_, this->desc_state_.wait_read_op);
         fn(wait_wr_, this->desc_state_.wait_write_op);
         fn(wait_er_, this->desc_state_.wait_error_op);
+        if (recv_batch_rd_)
+            fn(*recv_batch_rd_, this->desc_state_.read_op);
+        if (send_batch_wr_)
+            fn(*send_batch_wr_, this->desc_state_.write_op);
     }
 };
 
@@ -429,6 +508,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -442,6 +523,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -453,7 +536,8 @@ reactor_datagram_socket<
         int flags,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        datagram_info const* info)
 {
     auto& op = wr_;
     op.reset();
@@ -469,9 +553,12 @@ reactor_datagram_socket<
     }
 
     // Set up destination address
-    op.dest_len  = to_sockaddr(dest, socket_family(this->fd_), op.dest_storage);
+    int family   = socket_family(this->fd_);
+    op.dest_len  = to_sockaddr(dest, family, op.dest_storage);
     op.fd        = this->fd_;
     op.msg_flags = to_native_msg_flags(flags);
+    if (info)
+        op.control_len = build_datagram_control(op.control, family, *info);
 
     // Speculative sendmsg
     msghdr msg{};
@@ -479,6 +566,12 @@ reactor_datagram_socket<
     msg.msg_namelen = op.dest_len;
     msg.msg_iov     = op.iovecs;
     msg.msg_iovlen  = static_cast<std::size_t>(op.iovec_count);
+    if (op.control_len)
+    {
+        msg.msg_control    = op.control.buf;
+        msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(
+            op.control_len);
+    }
 
 #ifdef MSG_NOSIGNAL
     int send_flags = op.msg_flags | MSG_NOSIGNAL;
@@ -541,6 +634,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -554,6 +649,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -565,7 +662,8 @@ reactor_datagram_socket<
         int flags,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        datagram_info* info)
 {
     auto& op = rd_;
     op.reset();
@@ -595,6 +693,7 @@ reactor_datagram_socket<
 
     op.fd         = this->fd_;
     op.source_out = source;
+    op.info_out   = info;
     op.msg_flags  = to_native_msg_flags(flags);
 
     // Speculative recvmsg
@@ -603,6 +702,11 @@ reactor_datagram_socket<
     msg.msg_namelen = sizeof(op.source_storage);
     msg.msg_iov     = op.iovecs;
     msg.msg_iovlen  = static_cast<std::size_t>(op.iovec_count);
+    if (info)
+    {
+        msg.msg_control    = op.control.buf;
+        msg.msg_controllen = sizeof(op.control.buf);
+    }
 
     ssize_t n;
     do
@@ -616,7 +720,10 @@ reactor_datagram_socket<
         int err    = (n < 0) ? errno : 0;
         auto bytes = (n > 0) ? static_cast<std::size_t>(n) : std::size_t(0);
         if (n >= 0)
+        {
             op.source_addrlen = msg.msg_namelen;
+            op.control_len    = info ? msg.msg_controllen : 0;
+        }
 
         if (this->svc_.scheduler().try_consume_inline_budget())
         {
@@ -627,6 +734,8 @@ reactor_datagram_socket<
                     op.source_storage,
                     op.source_addrlen,
                     Endpoint{});
+            if (info && !err && n >= 0)
+                parse_datagram_info(op.control.buf, op.control_len, *info);
             op.cont_op.cont.h = h;
             return dispatch_coro(ex, op.cont_op.cont);
         }
@@ -666,6 +775,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -679,6 +790,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -757,6 +870,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -770,6 +885,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -780,10 +897,14 @@ reactor_datagram_socket<
         int flags,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        void const* control,
+        std::size_t control_len)
 {
     auto& op = send_wr_;
     op.reset();
+    op.control     = control;
+    op.control_len = control_len;
 
     capy::mutable_buffer bufs[SendOp::max_buffers];
     op.iovec_count = static_cast<int>(param.copy_to(bufs, SendOp::max_buffers));
@@ -801,6 +922,12 @@ reactor_datagram_socket<
     msghdr msg{};
     msg.msg_iov    = op.iovecs;
     msg.msg_iovlen = static_cast<std::size_t>(op.iovec_count);
+    if (control)
+    {
+        msg.msg_control    = const_cast<void*>(control);
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(control_len);
+    }
 
 #ifdef MSG_NOSIGNAL
     int send_flags = op.msg_flags | MSG_NOSIGNAL;
@@ -863,6 +990,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -876,6 +1005,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -886,10 +1017,16 @@ reactor_datagram_socket<
         int flags,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        void* control,
+        std::size_t control_cap,
+        std::size_t* control_len)
 {
     auto& op = recv_rd_;
     op.reset();
+    op.control     = control;
+    op.control_cap = control_cap;
+    op.control_len = control_len;
 
     capy::mutable_buffer bufs[RecvOp::max_buffers];
     op.iovec_count = static_cast<int>(param.copy_to(bufs, RecvOp::max_buffers));
@@ -920,14 +1057,25 @@ reactor_datagram_socket<
     msghdr msg{};
     msg.msg_iov    = op.iovecs;
     msg.msg_iovlen = static_cast<std::size_t>(op.iovec_count);
+    int recv_flags = op.msg_flags;
+    if (control)
+    {
+        msg.msg_control    = control;
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(control_cap);
+        recv_flags |= fd_recv_flags;
+    }
 
     ssize_t n;
     do
     {
-        n = ::recvmsg(this->fd_, &msg, op.msg_flags);
+        n = ::recvmsg(this->fd_, &msg, recv_flags);
     }
     while (n < 0 && errno == EINTR);
 
+    if (n >= 0 && control)
+        *control_len = msg.msg_controllen;
+
     if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
     {
         int err    = (n < 0) ? errno : 0;
@@ -965,6 +1113,220 @@ reactor_datagram_socket<
     return std::noop_coroutine();
 }
 
+// do_send_batch
+
+template<
+    class Derived,
+    class Service,
+    class ConnOp,
+    class SendToOp,
+    class RecvFromOp,
+    class SendOp,
+    class RecvOp,
+    class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
+    class DescState,
+    class ImplBase,
+    class Endpoint>
+std::coroutine_handle<>
+reactor_datagram_socket<
+    Derived,
+    Service,
+    ConnOp,
+    SendToOp,
+    RecvFromOp,
+    SendOp,
+    RecvOp,
+    WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
+    DescState,
+    ImplBase,
+    Endpoint>::
+    do_send_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        const_datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token const& token,
+        std::error_code* ec,
+        std::size_t* count_out)
+{
+    if (!send_batch_wr_)
+        send_batch_wr_ = std::make_unique<SendBatchOp>();
+    auto& op = *send_batch_wr_;
+    op.reset();
+
+    op.msg_count = prepare_send_batch(
+        this->fd_, op.msgs, op.iovecs, op.names, op.controls, slots, count,
+        SendBatchOp::max_batch);
+    op.slots     = slots;
+    op.fd        = this->fd_;
+    op.msg_flags = to_native_msg_flags(flags);
+
+    if (op.msg_count == 0)
+    {
+        op.h         = h;
+        op.ex        = ex;
+        op.ec_out    = ec;
+        op.bytes_out = count_out;
+        op.start(token, static_cast<Derived*>(this));
+        op.impl_ptr = this->shared_from_this();
+        op.complete(0, 0);
+        this->svc_.post(&op);
+        return std::noop_coroutine();
+    }
+
+    // Speculative sendmmsg
+    int n = send_batch_msgs(this->fd_, op.msgs, op.msg_count, op.msg_flags);
+
+    if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        int err   = (n < 0) ? errno : 0;
+        auto sent = (n > 0) ? static_cast<std::size_t>(n) : std::size_t(0);
+
+        if (this->svc_.scheduler().try_consume_inline_budget())
+        {
+            *ec        = err ? make_err(err) : std::error_code{};
+            *count_out = sent;
+            finish_send_batch(op.msgs, slots, sent);
+            op.cont_op.cont.h = h;
+            return dispatch_coro(ex, op.cont_op.cont);
+        }
+        op.h         = h;
+        op.ex        = ex;
+        op.ec_out    = ec;
+        op.bytes_out = count_out;
+        op.start(token, static_cast<Derived*>(this));
+        op.impl_ptr = this->shared_from_this();
+        op.complete(err, sent);
+        this->svc_.post(&op);
+        return std::noop_coroutine();
+    }
+
+    // EAGAIN — register with reactor
+    op.h         = h;
+    op.ex        = ex;
+    op.ec_out    = ec;
+    op.bytes_out = count_out;
+    op.start(token, static_cast<Derived*>(this));
+    op.impl_ptr = this->shared_from_this();
+
+    this->register_op(
+        op, this->desc_state_.write_op, this->desc_state_.write_ready,
+        this->desc_state_.write_cancel_pending, true);
+    return std::noop_coroutine();
+}
+
+// do_recv_batch
+
+template<
+    class Derived,
+    class Service,
+    class ConnOp,
+    class SendToOp,
+    class RecvFromOp,
+    class SendOp,
+    class RecvOp,
+    class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
+    class DescState,
+    class ImplBase,
+    class Endpoint>
+std::coroutine_handle<>
+reactor_datagram_socket<
+    Derived,
+    Service,
+    ConnOp,
+    SendToOp,
+    RecvFromOp,
+    SendOp,
+    RecvOp,
+    WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
+    DescState,
+    ImplBase,
+    Endpoint>::
+    do_recv_batch(
+        std::coroutine_handle<> h,
+        capy::executor_ref ex,
+        datagram_slot* slots,
+        std::size_t count,
+        int flags,
+        std::stop_token const& token,
+        std::error_code* ec,
+        std::size_t* count_out)
+{
+    if (!recv_batch_rd_)
+        recv_batch_rd_ = std::make_unique<RecvBatchOp>();
+    auto& op = *recv_batch_rd_;
+    op.reset();
+
+    op.msg_count = prepare_recv_batch(
+        op.msgs, op.iovecs, op.names, op.controls, slots, count,
+        RecvBatchOp::max_batch);
+    op.slots     = slots;
+    op.fd        = this->fd_;
+    op.msg_flags = to_native_msg_flags(flags);
+
+    if (op.msg_count == 0)
+    {
+        op.h         = h;
+        op.ex        = ex;
+        op.ec_out    = ec;
+        op.bytes_out = count_out;
+        op.start(token, static_cast<Derived*>(this));
+        op.impl_ptr = this->shared_from_this();
+        op.complete(0, 0);
+        this->svc_.post(&op);
+        return std::noop_coroutine();
+    }
+
+    // Speculative recvmmsg
+    int n = recv_batch_msgs(this->fd_, op.msgs, op.msg_count, op.msg_flags);
+
+    if (n >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        int err  = (n < 0) ? errno : 0;
+        auto got = (n > 0) ? static_cast<std::size_t>(n) : std::size_t(0);
+
+        if (this->svc_.scheduler().try_consume_inline_budget())
+        {
+            *ec        = err ? make_err(err) : std::error_code{};
+            *count_out = got;
+            finish_recv_batch(op.msgs, op.names, slots, got);
+            op.cont_op.cont.h = h;
+            return dispatch_coro(ex, op.cont_op.cont);
+        }
+        op.h         = h;
+        op.ex        = ex;
+        op.ec_out    = ec;
+        op.bytes_out = count_out;
+        op.start(token, static_cast<Derived*>(this));
+        op.impl_ptr = this->shared_from_this();
+        op.complete(err, got);
+        this->svc_.post(&op);
+        return std::noop_coroutine();
+    }
+
+    // EAGAIN — register with reactor
+    op.h         = h;
+    op.ex        = ex;
+    op.ec_out    = ec;
+    op.bytes_out = count_out;
+    op.start(token, static_cast<Derived*>(this));
+    op.impl_ptr = this->shared_from_this();
+
+    this->register_op(
+        op, this->desc_state_.read_op, this->desc_state_.read_ready,
+        this->desc_state_.read_cancel_pending);
+    return std::noop_coroutine();
+}
+
 // do_wait
 
 template<
@@ -976,6 +1338,8 @@ template<
     class SendOp,
     class RecvOp,
     class WaitOp,
+    class SendBatchOp,
+    class RecvBatchOp,
     class DescState,
     class ImplBase,
     class Endpoint>
@@ -989,6 +1353,8 @@ reactor_datagram_socket<
     SendOp,
     RecvOp,
     WaitOp,
+    SendBatchOp,
+    RecvBatchOp,
     DescState,
     ImplBase,
     Endpoint>::
@@ -14,6 +14,9 @@
 #include <boost/corosio/io/io_object.hpp>
 #include <boost/corosio/endpoint.hpp>
 #include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/corosio/native/detail/datagram_batch.hpp>
+#include <boost/corosio/native/detail/datagram_control.hpp>
+#include <boost/corosio/native/detail/fd_control.hpp>
 #include <boost/capy/ex/executor_ref.hpp>
 
 #include <atomic>
@@ -210,6 +213,15 @@ struct reactor_read_op : Base
     /// True for zero-length reads (completed immediately).
     bool empty_buffer_read = false;
 
+    /// Control buffer for recv_with_fds, or null for plain reads.
+    void* control = nullptr;
+
+    /// Capacity of @ref control in bytes.
+    std::size_t control_cap = 0;
+
+    /// Receives the control length on success.
+    std::size_t* control_len = nullptr;
+
     /// Return true (this is a read-direction operation).
     bool is_read_operation() const noexcept override
     {
@@ -221,16 +233,38 @@ struct reactor_read_op : Base
         Base::reset();
         iovec_count       = 0;
         empty_buffer_read = false;
+        control           = nullptr;
+        control_cap       = 0;
+        control_len       = nullptr;
     }
 
     void perform_io() noexcept override
     {
         ssize_t n;
-        do
+        if (control)
         {
-            n = ::readv(this->fd, iovecs, iovec_count);
+            msghdr msg{};
+            msg.msg_iov        = iovecs;
+            msg.msg_iovlen     = static_cast<std::size_t>(iovec_count);
+            msg.msg_control    = control;
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_cap);
+            do
+            {
+                n = ::recvmsg(this->fd, &msg, fd_recv_flags);
+            }
+            while (n < 0 && errno == EINTR);
+            if (n >= 0)
+                *control_len = msg.msg_controllen;
+        }
+        else
+        {
+            do
+            {
+                n = ::readv(this->fd, iovecs, iovec_count);
+            }
+            while (n < 0 && errno == EINTR);
         }
-        while (n < 0 && errno == EINTR);
 
         if (n >= 0)
             this->complete(0, static_cast<std::size_t>(n));
@@ -262,15 +296,46 @@ struct reactor_write_op : Base
     /// Number of active I/O vectors.
     int iovec_count = 0;
 
+    /// Outgoing control messages for send_with_fds, or null.
+    void const* control = nullptr;
+
+    /// Length of @ref control in bytes.
+    std::size_t control_len = 0;
+
     void reset() noexcept
     {
         Base::reset();
         iovec_count = 0;
+        control     = nullptr;
+        control_len = 0;
     }
 
     void perform_io() noexcept override
     {
-        ssize_t n = WritePolicy::write(this->fd, iovecs, iovec_count);
+        ssize_t n;
+        if (control)
+        {
+            msghdr msg{};
+            msg.msg_iov        = iovecs;
+            msg.msg_iovlen     = static_cast<std::size_t>(iovec_count);
+            msg.msg_control    = const_cast<void*>(control);
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_len);
+#ifdef MSG_NOSIGNAL
+            int send_flags = MSG_NOSIGNAL;
+#else
+            int send_flags = 0;
+#endif
+            do
+            {
+                n = ::sendmsg(this->fd, &msg, send_flags);
+            }
+            while (n < 0 && errno == EINTR);
+        }
+        else
+        {
+            n = WritePolicy::write(this->fd, iovecs, iovec_count);
+        }
         if (n >= 0)
             this->complete(0, static_cast<std::size_t>(n));
         else
@@ -351,11 +416,19 @@ struct reactor_send_op : Base
     /// User-supplied message flags.
     int msg_flags = 0;
 
+    /// Outgoing control messages for send_with_fds, or null.
+    void const* control = nullptr;
+
+    /// Length of @ref control in bytes.
+    std::size_t control_len = 0;
+
     void reset() noexcept
     {
         Base::reset();
         iovec_count = 0;
         msg_flags   = 0;
+        control     = nullptr;
+        control_len = 0;
     }
 
     void perform_io() noexcept override
@@ -363,6 +436,12 @@ struct reactor_send_op : Base
         msghdr msg{};
         msg.msg_iov    = iovecs;
         msg.msg_iovlen = static_cast<std::size_t>(iovec_count);
+        if (control)
+        {
+            msg.msg_control    = const_cast<void*>(control);
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_len);
+        }
 
 #ifdef MSG_NOSIGNAL
         int send_flags = msg_flags | MSG_NOSIGNAL;
@@ -407,6 +486,15 @@ struct reactor_recv_op : Base
     /// User-supplied message flags.
     int msg_flags = 0;
 
+    /// Control buffer for recv_with_fds, or null.
+    void* control = nullptr;
+
+    /// Capacity of @ref control in bytes.
+    std::size_t control_cap = 0;
+
+    /// Receives the control length on success.
+    std::size_t* control_len = nullptr;
+
     /// Return true (this is a read-direction operation).
     bool is_read_operation() const noexcept override
     {
@@ -418,6 +506,9 @@ struct reactor_recv_op : Base
         Base::reset();
         iovec_count = 0;
         msg_flags   = 0;
+        control     = nullptr;
+        control_cap = 0;
+        control_len = nullptr;
     }
 
     void perform_io() noexcept override
@@ -425,14 +516,24 @@ struct reactor_recv_op : Base
         msghdr msg{};
         msg.msg_iov    = iovecs;
         msg.msg_iovlen = static_cast<std::size_t>(iovec_count);
+        if (control)
+        {
+            msg.msg_control    = control;
+            msg.msg_controllen =
+                static_cast<decltype(msg.msg_controllen)>(control_cap);
+        }
 
         ssize_t n;
         do
         {
-            n = ::recvmsg(this->fd, &msg, msg_flags);
+            n = ::recvmsg(
+                this->fd, &msg, control ? msg_flags | fd_recv_flags : msg_flags);
         }
         while (n < 0 && errno == EINTR);
 
+        if (n >= 0 && control)
+            *control_len = msg.msg_controllen;
+
         if (n >= 0)
             this->complete(0, static_cast<std::size_t>(n));
         else
@@ -464,6 +565,12 @@ struct reactor_send_to_op : Base
     /// Destination address length.
     socklen_t dest_len = 0;
 
+    /// Outgoing control messages (send_msg only).
+    datagram_control control;
+
+    /// Length of the control messages in use, or 0.
+    std::size_t control_len = 0;
+
     /// User-supplied message flags.
     int msg_flags = 0;
 
@@ -473,6 +580,7 @@ struct reactor_send_to_op : Base
         iovec_count  = 0;
         dest_storage = {};
         dest_len     = 0;
+        control_len  = 0;
         msg_flags    = 0;
     }
 
@@ -483,6 +591,12 @@ struct reactor_send_to_op : Base
         msg.msg_namelen = dest_len;
         msg.msg_iov     = iovecs;
         msg.msg_iovlen  = static_cast<std::size_t>(iovec_count);
+        if (control_len)
+        {
+            msg.msg_control    = control.buf;
+            msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(
+                control_len);
+        }
 
 #ifdef MSG_NOSIGNAL
         int send_flags = msg_flags | MSG_NOSIGNAL;
@@ -532,6 +646,15 @@ struct reactor_recv_from_op : Base
     /// Output pointer for the source endpoint (set by do_recv_from).
     Endpoint* source_out = nullptr;
 
+    /// Output pointer for ancillary data (recv_msg only).
+    datagram_info* info_out = nullptr;
+
+    /// Received control messages, when info_out is set.
+    datagram_control control;
+
+    /// Length of the received control messages.
+    std::size_t control_len = 0;
+
     /// User-supplied message flags.
     int msg_flags = 0;
 
@@ -548,6 +671,8 @@ struct reactor_recv_from_op : Base
         source_storage = {};
         source_addrlen = 0;
         source_out     = nullptr;
+        info_out       = nullptr;
+        control_len    = 0;
         msg_flags      = 0;
     }
 
@@ -558,6 +683,11 @@ struct reactor_recv_from_op : Base
         msg.msg_namelen = sizeof(source_storage);
         msg.msg_iov     = iovecs;
         msg.msg_iovlen  = static_cast<std::size_t>(iovec_count);
+        if (info_out)
+        {
+            msg.msg_control    = control.buf;
+            msg.msg_controllen = sizeof(control.buf);
+        }
 
         ssize_t n;
         do
@@ -569,6 +699,7 @@ struct reactor_recv_from_op : Base
         if (n >= 0)
         {
             source_addrlen = msg.msg_namelen;
+            control_len    = info_out ? msg.msg_controllen : 0;
             this->complete(0, static_cast<std::size_t>(n));
         }
         else
@@ -576,6 +707,119 @@ struct reactor_recv_from_op : Base
     }
 };
 
+/** Shared batched receive operation for datagram sockets.
+
+    Uses recvmmsg() (or a recvmsg() loop where unavailable) to fill
+    several caller slots per readiness event. bytes_transferred
+    holds the number of datagrams received.
+
+    @tparam Base The backend's base op type.
+*/
+template<class Base>
+struct reactor_recv_batch_op : Base
+{
+    /// Maximum datagrams per batch.
+    static constexpr std::size_t max_batch = max_datagram_batch;
+
+    /// Per-datagram message headers.
+    batch_msghdr msgs[max_batch];
+
+    /// One I/O vector per datagram.
+    iovec iovecs[max_batch];
+
+    /// Source address storage, one per datagram.
+    sockaddr_storage names[max_batch];
+
+    /// UDP_GRO control message storage, one per datagram.
+    batch_control controls[max_batch];
+
+    /// Caller slots receiving sizes and source endpoints.
+    datagram_slot* slots = nullptr;
+
+    /// Number of prepared messages.
+    unsigned msg_count = 0;
+
+    /// User-supplied message flags.
+    int msg_flags = 0;
+
+    /// Return true (this is a read-direction operation).
+    bool is_read_operation() const noexcept override
+    {
+        return true;
+    }
+
+    void reset() noexcept
+    {
+        Base::reset();
+        slots     = nullptr;
+        msg_count = 0;
+        msg_flags = 0;
+    }
+
+    void perform_io() noexcept override
+    {
+        reset_recv_batch(msgs, msg_count);
+        int n = recv_batch_msgs(this->fd, msgs, msg_count, msg_flags);
+        if (n >= 0)
+            this->complete(0, static_cast<std::size_t>(n));
+        else
+            this->complete(errno, 0);
+    }
+};
+
+/** Shared batched send operation for datagram sockets.
+
+    Uses sendmmsg() (or a sendmsg() loop where unavailable) to send
+    several caller slots per writability event. bytes_transferred
+    holds the number of datagrams sent.
+
+    @tparam Base The backend's base op type.
+*/
+template<class Base>
+struct reactor_send_batch_op : Base
+{
+    /// Maximum datagrams per batch.
+    static constexpr std::size_t max_batch = max_datagram_batch;
+
+    /// Per-datagram message headers.
+    batch_msghdr msgs[max_batch];
+
+    /// One I/O vector per datagram.
+    iovec iovecs[max_batch];
+
+    /// Destination address storage, one per datagram.
+    sockaddr_storage names[max_batch];
+
+    /// UDP_SEGMENT control message storage, one per datagram.
+    batch_control controls[max_batch];
+
+    /// Caller slots receiving sent sizes.
+    const_datagram_slot* slots = nullptr;
+
+    /// Number of prepared messages.
+    unsigned msg_count = 0;
+
+    /// User-supplied message flags.
+    int msg_flags = 0;
+
+    void reset() noexcept
+    {
+        Base::reset();
+        slots     = nullptr;
+        msg_count = 0;
+        msg_flags = 0;
+    }
+
+    void perform_io() noexcept override
+    {
+        int n = send_batch_msgs(this->fd, msgs, msg_count, msg_flags);
+        if (n >= 0)
+            this->complete(0, static_cast<std::size_t>(n));
+        else
+            this->complete(errno, 0);
+    }
+};
+
 } // namespace boost::corosio::detail
 
 #endif // BOOST_COROSIO_NATIVE_DETAIL_REACTOR_REACTOR_OP_HPP
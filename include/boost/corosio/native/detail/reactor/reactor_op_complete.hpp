@@ -12,12 +12,15 @@
 
 #include <boost/corosio/detail/dispatch_coro.hpp>
 #include <boost/corosio/native/detail/coro_op_complete.hpp>
+#include <boost/corosio/native/detail/datagram_batch.hpp>
+#include <boost/corosio/native/detail/datagram_control.hpp>
 #include <boost/corosio/native/detail/endpoint_convert.hpp>
 #include <boost/corosio/native/detail/make_err.hpp>
 #include <boost/corosio/io/io_object.hpp>
 
 #include <coroutine>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 
 #include <netinet/in.h>
@@ -292,7 +295,8 @@ complete_datagram_op(Op& op)
 /** Complete a datagram operation with source endpoint capture.
 
     For recv_from operations, writes the source endpoint from the
-    recorded sockaddr_storage into the caller's endpoint pointer.
+    recorded sockaddr_storage into the caller's endpoint pointer,
+    and for recv_msg also decodes the received control messages.
     Then resumes the caller via symmetric transfer.
 
     @tparam Op The concrete datagram operation type.
@@ -316,12 +320,52 @@ complete_datagram_op(Op& op, Endpoint* source_out)
 
     *op.bytes_out = op.bytes_transferred;
 
-    if (source_out && !op.cancelled.load(std::memory_order_acquire) &&
-        op.errn == 0)
-        *source_out = from_sockaddr_as(
-            op.source_storage,
-            op.source_addrlen,
-            Endpoint{});
+    if (!op.cancelled.load(std::memory_order_acquire) && op.errn == 0)
+    {
+        if (source_out)
+            *source_out = from_sockaddr_as(
+                op.source_storage,
+                op.source_addrlen,
+                Endpoint{});
+        if (op.info_out)
+            parse_datagram_info(op.control.buf, op.control_len, *op.info_out);
+    }
+
+    coro_resume(&op);
+}
+
+/** Complete a batched datagram operation.
+
+    Reports the number of datagrams transferred through bytes_out
+    and, on success, copies per-slot sizes (and, for receives,
+    source endpoints) back into the caller's slots.
+
+    @tparam Op The concrete batch operation type.
+    @param op The operation to complete.
+*/
+template<typename Op>
+void
+complete_datagram_batch_op(Op& op)
+{
+    op.stop_cb.reset();
+    op.socket_impl_->desc_state_.scheduler_->reset_inline_budget();
+
+    bool cancelled = op.cancelled.load(std::memory_order_acquire);
+    decode_io_result(
+        op.ec_out, cancelled,
+        op.errn != 0 ? make_err(op.errn) : std::error_code{},
+        /*is_read=*/false, /*bytes=*/0, /*empty_buffer=*/false);
+
+    std::size_t n = 0;
+    if (!cancelled && op.errn == 0)
+    {
+        n = op.bytes_transferred;
+        if constexpr (std::is_same_v<decltype(op.slots), datagram_slot*>)
+            finish_recv_batch(op.msgs, op.names, op.slots, n);
+        else
+            finish_send_batch(op.msgs, op.slots, n);
+    }
+    *op.bytes_out = n;
 
     coro_resume(&op);
 }
@@ -75,14 +75,16 @@ std::error_code
 do_assign_fd(
     SocketFinal* socket_impl,
     int fd,
-    int expected_type) noexcept
+    int expected_type,
+    int alt_type = -1) noexcept
 {
     if (fd < 0)
         return make_err(EBADF);
 
     socket_impl->close_socket();
 
-    // Validate that fd is actually an AF_UNIX socket of the expected type.
+    // Validate that fd is actually an AF_UNIX socket of the expected
+    // type (or the alternative one, when given).
     {
         sockaddr_storage st{};
         socklen_t st_len = sizeof(st);
@@ -97,7 +99,7 @@ do_assign_fd(
         if (::getsockopt(
                 fd, SOL_SOCKET, SO_TYPE, &sock_type, &opt_len) != 0)
             return make_err(errno);
-        if (sock_type != expected_type)
+        if (sock_type != expected_type && sock_type != alt_type)
             return make_err(EPROTOTYPE);
     }
 
@@ -327,11 +329,15 @@ public:
             family, type, protocol, false);
     }
 
+    // Also adopts SOCK_SEQPACKET: local_seqpacket_socket shares this
+    // service, and a connected seqpacket socket behaves like a
+    // connected datagram socket for every operation it exposes.
     std::error_code assign_socket(
         local_datagram_socket::implementation& impl, int fd) override
     {
         return do_assign_fd<Traits>(
-            static_cast<SocketFinal*>(&impl), fd, SOCK_DGRAM);
+            static_cast<SocketFinal*>(&impl), fd, SOCK_DGRAM,
+            SOCK_SEQPACKET);
     }
 
     std::error_code bind_socket(
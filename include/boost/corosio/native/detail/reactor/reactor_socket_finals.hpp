@@ -123,6 +123,8 @@ class reactor_dgram_socket_impl
           reactor_dgram_send_op<Traits, Derived, AcceptorType, Endpoint>,
           reactor_dgram_recv_op<Traits, Derived, AcceptorType, Endpoint>,
           reactor_dgram_wait_op<Traits, Derived, AcceptorType, Endpoint>,
+          reactor_dgram_send_batch_op<Traits, Derived, AcceptorType, Endpoint>,
+          reactor_dgram_recv_batch_op<Traits, Derived, AcceptorType, Endpoint>,
           typename Traits::desc_state_type,
           ImplBase,
           Endpoint>
@@ -15,17 +15,38 @@
 #include <boost/corosio/wait_type.hpp>
 #include <boost/corosio/native/detail/reactor/reactor_basic_socket.hpp>
 #include <boost/corosio/native/detail/reactor/reactor_descriptor_state.hpp>
+#include <boost/corosio/native/detail/fd_control.hpp>
 #include <boost/corosio/detail/dispatch_coro.hpp>
 #include <boost/capy/buffers.hpp>
 
 #include <coroutine>
+#include <mutex>
+#include <utility>
 
 #include <errno.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/uio.h>
 
 namespace boost::corosio::detail {
 
+/* True when fd has send-buffer space, or a condition that the
+   next write will report. */
+inline bool
+stream_socket_writable(int fd) noexcept
+{
+    pollfd p{};
+    p.fd     = fd;
+    p.events = POLLOUT;
+    int r;
+    do
+    {
+        r = ::poll(&p, 1, 0);
+    }
+    while (r < 0 && errno == EINTR);
+    return r != 0;
+}
+
 /** CRTP base for reactor-backed stream socket implementations.
 
     Inherits shared data members and cancel/close/register logic
@@ -222,6 +243,9 @@ public:
         Tries readv() speculatively. On success or hard error,
         returns via inline budget or posts through queue.
         On EAGAIN, registers with the reactor.
+
+        With a @p control buffer the read uses recvmsg() and stores
+        the received control length in @p control_len (fd passing).
     */
     std::coroutine_handle<> do_read_some(
         std::coroutine_handle<>,
@@ -229,13 +253,19 @@ public:
         buffer_param,
         std::stop_token const&,
         std::error_code*,
-        std::size_t*);
+        std::size_t*,
+        void* control            = nullptr,
+        std::size_t control_cap  = 0,
+        std::size_t* control_len = nullptr);
 
     /** Shared gather-write dispatch.
 
         Tries the write via WriteOp::write_policy speculatively.
         On success or hard error, returns via inline budget or
         posts through queue. On EAGAIN, registers with the reactor.
+
+        With a @p control buffer the write uses sendmsg() so the
+        control messages travel with the first byte (fd passing).
     */
     std::coroutine_handle<> do_write_some(
         std::coroutine_handle<>,
@@ -243,7 +273,9 @@ public:
         buffer_param,
         std::stop_token const&,
         std::error_code*,
-        std::size_t*);
+        std::size_t*,
+        void const* control     = nullptr,
+        std::size_t control_len = 0);
 
     /** Shared readiness-wait dispatch.
 
@@ -425,10 +457,16 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
         buffer_param param,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        void* control,
+        std::size_t control_cap,
+        std::size_t* control_len)
 {
     auto& op = rd_;
     op.reset();
+    op.control     = control;
+    op.control_cap = control_cap;
+    op.control_len = control_len;
 
     capy::mutable_buffer bufs[ReadOp::max_buffers];
     op.iovec_count = static_cast<int>(param.copy_to(bufs, ReadOp::max_buffers));
@@ -456,7 +494,23 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
     // Speculative read; for the single-buffer case use recv() so the
     // kernel skips the readv iov_iter setup.
     ssize_t n;
-    if (op.iovec_count == 1)
+    if (control)
+    {
+        msghdr msg{};
+        msg.msg_iov        = op.iovecs;
+        msg.msg_iovlen     = static_cast<std::size_t>(op.iovec_count);
+        msg.msg_control    = control;
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(control_cap);
+        do
+        {
+            n = ::recvmsg(this->fd_, &msg, fd_recv_flags);
+        }
+        while (n < 0 && errno == EINTR);
+        if (n >= 0)
+            *control_len = msg.msg_controllen;
+    }
+    else if (op.iovec_count == 1)
     {
         do
         {
@@ -534,10 +588,14 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
         buffer_param param,
         std::stop_token const& token,
         std::error_code* ec,
-        std::size_t* bytes_out)
+        std::size_t* bytes_out,
+        void const* control,
+        std::size_t control_len)
 {
     auto& op = wr_;
     op.reset();
+    op.control     = control;
+    op.control_len = control_len;
 
     capy::mutable_buffer bufs[WriteOp::max_buffers];
     op.iovec_count =
@@ -566,7 +624,26 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
     // backend-specific fast path so the kernel skips msghdr/iov_iter
     // setup (and so each backend can pick the right SIGPIPE strategy).
     ssize_t n;
-    if (op.iovec_count == 1)
+    if (control)
+    {
+        msghdr msg{};
+        msg.msg_iov        = op.iovecs;
+        msg.msg_iovlen     = static_cast<std::size_t>(op.iovec_count);
+        msg.msg_control    = const_cast<void*>(control);
+        msg.msg_controllen =
+            static_cast<decltype(msg.msg_controllen)>(control_len);
+#ifdef MSG_NOSIGNAL
+        int send_flags = MSG_NOSIGNAL;
+#else
+        int send_flags = 0;
+#endif
+        do
+        {
+            n = ::sendmsg(this->fd_, &msg, send_flags);
+        }
+        while (n < 0 && errno == EINTR);
+    }
+    else if (op.iovec_count == 1)
     {
         n = WriteOp::write_policy::write_one(
             this->fd_, bufs[0].data(), bufs[0].size());
@@ -634,12 +711,25 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
         std::stop_token const& token,
         std::error_code* ec)
 {
-    // wait_type::write completes immediately on a connected socket,
-    // matching asio's behavior on IOCP. Corosio's reactor backends use
-    // edge-triggered EPOLLOUT, which would never fire on an already-
-    // writable socket; an immediate completion is also a more useful
-    // contract than parking until a non-writable -> writable transition.
+    // wait_type::write completes immediately on a writable socket,
+    // matching asio's behavior on IOCP and io_uring's POLL_ADD with
+    // POLLOUT. A cached write edge is taken without a syscall. With
+    // none cached the socket is probed, since edge-triggered EPOLLOUT
+    // never fires on a socket that is already writable. A full socket
+    // parks until the write edge; an edge that lands between the
+    // probe and registration is kept in write_ready, so at worst the
+    // wait completes once spuriously.
+    bool writable = false;
     if (w == wait_type::write)
+    {
+        {
+            std::lock_guard lock(this->desc_state_.mutex);
+            writable = std::exchange(this->desc_state_.write_ready, false);
+        }
+        if (!writable)
+            writable = stream_socket_writable(this->fd_);
+    }
+    if (writable)
     {
         auto& op = wait_wr_;
         if (this->svc_.scheduler().try_consume_inline_budget())
@@ -678,6 +768,14 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
         cancel_flag_ptr = &this->desc_state_.wait_read_cancel_pending;
         event           = reactor_event_read;
     }
+    else if (w == wait_type::write)
+    {
+        op_ptr          = &wait_wr_;
+        desc_slot_ptr   = &this->desc_state_.wait_write_op;
+        ready_flag_ptr  = &this->desc_state_.write_ready;
+        cancel_flag_ptr = &this->desc_state_.wait_write_cancel_pending;
+        event           = reactor_event_write;
+    }
     else // wait_type::error
     {
         op_ptr          = &wait_er_;
@@ -698,7 +796,7 @@ reactor_stream_socket<Derived, Service, ConnOp, ReadOp, WriteOp, WaitOp, DescSta
     op.impl_ptr = this->shared_from_this();
 
     this->register_op(op, *desc_slot_ptr, *ready_flag_ptr, *cancel_flag_ptr,
-                      false);
+                      w == wait_type::write);
     return std::noop_coroutine();
 }
 
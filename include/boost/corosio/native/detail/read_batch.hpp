@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_NATIVE_DETAIL_READ_BATCH_HPP
+#define BOOST_COROSIO_NATIVE_DETAIL_READ_BATCH_HPP
+
+#include <boost/corosio/random_access_file.hpp>
+#include <boost/capy/error.hpp>
+
+#include <cstddef>
+#include <system_error>
+
+/*
+    Batched positional reads
+    ========================
+
+    random_access_file::read_batch hands a backend an array of
+    read_request. Each backend stores every request's outcome in
+    place, using the same rules as read_some_at, and completes the
+    batch once:
+
+      POSIX      one raf_op; the pool thread preads each range
+      io_uring   one READV SQE per range, flushed by one submit;
+                 the last CQE resumes the caller
+      IOCP       one overlapped ReadFile per range; the last
+                 completion resumes the caller
+
+    Requests start out canceled so a batch abandoned part way
+    (cancellation, pool shutdown) reports untouched ranges as such.
+*/
+
+namespace boost::corosio::detail {
+
+/// Mark every request of a batch as not yet performed.
+inline void
+init_read_batch(
+    random_access_file::read_request* reqs, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        reqs[i].ec                = capy::error::canceled;
+        reqs[i].bytes_transferred = 0;
+    }
+}
+
+/** Store the aggregate result of a completed batch.
+
+    The error is that of the first failed request in array order;
+    the byte count is the sum over all requests.
+*/
+inline void
+finish_read_batch(
+    random_access_file::read_request const* reqs,
+    std::size_t count,
+    std::error_code* ec,
+    std::size_t* bytes_out) noexcept
+{
+    std::error_code first;
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (!first && reqs[i].ec)
+            first = reqs[i].ec;
+        total += reqs[i].bytes_transferred;
+    }
+    if (ec)
+        *ec = first;
+    if (bytes_out)
+        *bytes_out = total;
+}
+
+} // namespace boost::corosio::detail
+
+#endif // BOOST_COROSIO_NATIVE_DETAIL_READ_BATCH_HPP
@@ -330,7 +330,8 @@ select_scheduler::run_task(
             snapshot[snapshot_count].fd   = fd;
             snapshot[snapshot_count].desc = desc;
             snapshot[snapshot_count].needs_write =
-                (desc->write_op || desc->connect_op);
+                (desc->write_op || desc->connect_op ||
+                 desc->wait_write_op);
             ++snapshot_count;
         }
     }
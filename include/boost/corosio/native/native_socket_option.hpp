@@ -38,6 +38,17 @@
 #include <sys/socket.h>
 #endif
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+// Older libc headers lack the UDP offload options (Linux 4.18 / 5.0)
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
+
 // Some older systems define only the legacy names
 #ifndef IPV6_JOIN_GROUP
 #define IPV6_JOIN_GROUP IPV6_ADD_MEMBERSHIP
@@ -469,6 +480,62 @@ using multicast_hops_v6 = integer<IPPROTO_IPV6, IPV6_MULTICAST_HOPS>;
 /// Set the outgoing interface for IPv6 multicast (IPV6_MULTICAST_IF).
 using multicast_interface_v6 = integer<IPPROTO_IPV6, IPV6_MULTICAST_IF>;
 
+#ifdef UDP_SEGMENT
+/** Set the default UDP segmentation offload size (UDP_SEGMENT).
+
+    When non-zero, every send on the socket is split by the kernel
+    into datagrams of this size. Per-send sizes can instead be given
+    through `const_datagram_slot::segment_size`. Linux only.
+*/
+using udp_segment = integer<IPPROTO_UDP, UDP_SEGMENT>;
+#endif
+
+#ifdef UDP_GRO
+/** Enable UDP generic receive offload (UDP_GRO).
+
+    Lets the kernel coalesce datagrams of one flow into a single
+    receive; `datagram_slot::segment_size` reports the original
+    datagram size. Linux only.
+*/
+using udp_gro = boolean<IPPROTO_UDP, UDP_GRO>;
+#endif
+
+#if defined(IP_PKTINFO)
+/// Report the local address of received IPv4 datagrams (IP_PKTINFO).
+using receive_packet_info_v4 = boolean<IPPROTO_IP, IP_PKTINFO>;
+#elif defined(IP_RECVDSTADDR)
+/// Report the local address of received IPv4 datagrams (IP_RECVDSTADDR).
+using receive_packet_info_v4 = boolean<IPPROTO_IP, IP_RECVDSTADDR>;
+#endif
+
+#ifdef IPV6_RECVPKTINFO
+/// Report the local address of received IPv6 datagrams (IPV6_RECVPKTINFO).
+using receive_packet_info_v6 = boolean<IPPROTO_IPV6, IPV6_RECVPKTINFO>;
+#endif
+
+#if defined(SO_TIMESTAMPNS)
+/// Timestamp received datagrams in nanoseconds (SO_TIMESTAMPNS).
+using receive_timestamp = boolean<SOL_SOCKET, SO_TIMESTAMPNS>;
+#elif defined(SO_TIMESTAMP)
+/// Timestamp received datagrams in microseconds (SO_TIMESTAMP).
+using receive_timestamp = boolean<SOL_SOCKET, SO_TIMESTAMP>;
+#endif
+
+#ifdef IP_RECVTOS
+/// Report the TOS byte of received IPv4 datagrams (IP_RECVTOS).
+using receive_tos_v4 = boolean<IPPROTO_IP, IP_RECVTOS>;
+#endif
+
+#ifdef IPV6_RECVTCLASS
+/// Report the traffic class of received IPv6 datagrams (IPV6_RECVTCLASS).
+using receive_tclass_v6 = boolean<IPPROTO_IPV6, IPV6_RECVTCLASS>;
+#endif
+
+#ifdef SO_RXQ_OVFL
+/// Report the socket's receive-queue drop counter (SO_RXQ_OVFL).
+using receive_drop_count = boolean<SOL_SOCKET, SO_RXQ_OVFL>;
+#endif
+
 /** Join an IPv4 multicast group (IP_ADD_MEMBERSHIP).
 
     @par Example
@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_PROCESS_HPP
+#define BOOST_COROSIO_PROCESS_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_HAS_EPOLL
+
+#include <boost/corosio/local_stream_socket.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <concepts>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace boost::corosio {
+
+/// How a child's standard stream is connected.
+enum class process_stdio
+{
+    /// Share the parent's descriptor.
+    inherit,
+
+    /// Connect it to a socket the parent reads or writes.
+    pipe,
+
+    /// Connect it to `/dev/null`.
+    null
+};
+
+/// Settings of @ref process::spawn.
+struct process_options
+{
+    /** The child's environment, as `NAME=value` strings.
+
+        Empty means the parent's environment.
+    */
+    std::vector<std::string> environment;
+
+    /// The child's working directory; empty for the parent's.
+    std::string working_directory;
+
+    /// Where the child's standard input comes from.
+    process_stdio stdin_mode = process_stdio::inherit;
+
+    /// Where the child's standard output goes.
+    process_stdio stdout_mode = process_stdio::inherit;
+
+    /// Where the child's standard error goes.
+    process_stdio stderr_mode = process_stdio::inherit;
+};
+
+/** A child process whose exit can be awaited.
+
+    The spawn itself yields the child's pidfd, so the handle can
+    never refer to a recycled process id. The child's exit is
+    observed through that pidfd by the context's reactor, so
+    waiting needs neither a `SIGCHLD` handler nor a blocking
+    `waitpid`, and never reaps a child that belongs to someone
+    else. Any number of processes may be waited on at once.
+
+    A standard stream spawned with @ref process_stdio::pipe is one
+    end of a Unix stream socket pair, exposed as a
+    @ref local_stream_socket: write the child's input to
+    @ref stdin_pipe and read its output from @ref stdout_pipe and
+    @ref stderr_pipe. Writing after the child has gone fails with
+    an error rather than raising `SIGPIPE`.
+
+    Destroying a process whose child is still running leaves the
+    child running. The context reaps it once it exits, without
+    keeping `run()` from returning; a child that outlives the
+    context, or any child on the select backend, stays a zombie
+    until the program ends.
+
+    @note Linux only; requires kernel 5.3 or later for pidfds.
+        Waiting needs the epoll or io_uring backend and returns
+        `std::errc::operation_not_supported` on select.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. A process must not have concurrent
+    wait operations.
+
+    @par Example
+    @code
+    process p(ioc);
+    process_options opts;
+    opts.stdout_mode = process_stdio::pipe;
+    p.spawn("ls", {"-l"}, opts);
+
+    char buf[4096];
+    for (;;)
+    {
+        auto [ec, n] = co_await p.stdout_pipe().read_some(
+            capy::mutable_buffer(buf, sizeof(buf)));
+        if (ec)
+            break;
+        consume(buf, n);
+    }
+    auto [ec, status] = co_await p.wait();
+    @endcode
+*/
+class BOOST_COROSIO_DECL process
+{
+    struct state;
+
+    capy::execution_context* ctx_;
+    std::unique_ptr<state> st_;
+
+    capy::task<capy::io_result<int>> do_wait();
+
+public:
+    /** Construct a process with no child.
+
+        @param ctx The execution context whose reactor observes
+            the child and carries its pipes.
+    */
+    explicit process(capy::execution_context& ctx);
+
+    /** Construct a process with no child from an executor.
+
+        @param ex The executor whose context observes the child.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, process>) &&
+        capy::Executor<Ex>
+    explicit process(Ex const& ex) : process(ex.context())
+    {
+    }
+
+    /// Destroy the process, closing its pipes and pidfd.
+    ~process();
+
+    process(process&&) noexcept;
+    process& operator=(process&&) noexcept;
+
+    process(process const&)            = delete;
+    process& operator=(process const&) = delete;
+
+    /** Start a child process.
+
+        The executable is looked up in `PATH` unless @p path
+        contains a slash. The child receives @p path as `argv[0]`,
+        followed by @p args.
+
+        @param path The program to run.
+        @param args The arguments after `argv[0]`.
+        @param opts The environment, directory and stdio settings.
+
+        @throws std::system_error if the program cannot be started.
+        @throws std::logic_error if a previous child has not been
+            waited for.
+    */
+    void spawn(
+        std::string const& path,
+        std::vector<std::string> const& args = {},
+        process_options const& opts          = {});
+
+    /// Return the child's process id, or -1 before spawn().
+    int id() const noexcept;
+
+    /// Return the child's pidfd, or -1 once it has been waited for.
+    int native_handle() const noexcept;
+
+    /// Return the socket connected to the child's standard input.
+    local_stream_socket& stdin_pipe() noexcept;
+
+    /// Return the socket connected to the child's standard output.
+    local_stream_socket& stdout_pipe() noexcept;
+
+    /// Return the socket connected to the child's standard error.
+    local_stream_socket& stderr_pipe() noexcept;
+
+    /** Send a signal to the child.
+
+        Goes through the pidfd, so it can never reach an unrelated
+        process that reused the child's id.
+
+        @param signal_number The signal to send.
+
+        @return Success, `std::errc::no_such_process` if the child
+            has been waited for, or the error from the kernel.
+    */
+    std::error_code send_signal(int signal_number);
+
+    /** Wait for the child to exit and reap it.
+
+        Once the child has been reaped, further waits complete at
+        once with the same status.
+
+        @return An awaitable completing with `io_result<int>`: the
+            exit status if the child exited, or the negated signal
+            number if a signal killed it.
+
+        @throws std::logic_error if no child was spawned.
+
+        @par Cancellation
+        A stop request ends the wait with `capy::error::canceled`;
+        the child keeps running and can be waited for again.
+    */
+    capy::task<capy::io_result<int>> wait();
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_HAS_EPOLL
+
+#endif // BOOST_COROSIO_PROCESS_HPP
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <type_traits>
 #include <filesystem>
+#include <span>
 #include <stop_token>
 #include <system_error>
 
@@ -65,6 +66,28 @@ namespace boost::corosio {
 class BOOST_COROSIO_DECL random_access_file : public io_object
 {
 public:
+    /** One read of a @ref read_batch.
+
+        The caller fills in @ref offset and @ref buffer; the batch
+        stores each read's outcome in @ref ec and
+        @ref bytes_transferred, with the same meaning as the result
+        of @ref read_some_at.
+    */
+    struct read_request
+    {
+        /// Byte offset into the file.
+        std::uint64_t offset = 0;
+
+        /// The buffer to read into.
+        capy::mutable_buffer buffer;
+
+        /// Set on completion: the read's error, if any.
+        std::error_code ec;
+
+        /// Set on completion: the bytes read.
+        std::size_t bytes_transferred = 0;
+    };
+
     /** Platform-specific random-access file implementation interface.
 
         Backends derive from this to provide offset-based file I/O.
@@ -111,6 +134,28 @@ public:
             std::error_code* ec,
             std::size_t* bytes_out) = 0;
 
+        /** Initiate a batch of reads at independent offsets.
+
+            Completes once, after every request has completed.
+
+            @param reqs The requests; results are stored in place.
+            @param count Number of requests, at least one.
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param token Stop token for cancellation.
+            @param ec Output error code: the first failed request's.
+            @param bytes_out Output total bytes read.
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> read_batch(
+            read_request* reqs,
+            std::size_t count,
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
+
         /// Return the platform file descriptor or handle.
         virtual native_handle_type native_handle() const noexcept = 0;
 
@@ -218,6 +263,42 @@ public:
         }
     };
 
+    /** Awaitable for batched reads. */
+    struct read_batch_awaitable
+    {
+        random_access_file& f_;
+        std::span<read_request> reqs_;
+        std::stop_token token_;
+        mutable std::error_code ec_;
+        mutable std::size_t bytes_ = 0;
+
+        read_batch_awaitable(
+            random_access_file& f, std::span<read_request> reqs) noexcept
+            : f_(f)
+            , reqs_(reqs)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return reqs_.empty();
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            return {ec_, bytes_};
+        }
+
+        auto await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+            -> std::coroutine_handle<>
+        {
+            token_ = env->stop_token;
+            return f_.get().read_batch(
+                reqs_.data(), reqs_.size(), h, env->executor, token_, &ec_,
+                &bytes_);
+        }
+    };
+
 public:
     /** Destructor.
 
@@ -308,6 +389,37 @@ public:
         return read_some_at_awaitable<MB>(*this, offset, buffers);
     }
 
+    /** Read at many offsets with a single completion.
+
+        Submits every request together and resumes once, when all
+        have completed. Index lookups issuing dozens of scattered
+        block reads pay one submission and one resumption instead
+        of one per read: io_uring queues all the `READV` entries
+        for a single submit, and the POSIX thread pool runs the
+        whole batch as one work item. Each request's outcome is
+        stored in the request itself.
+
+        @param reqs The reads to perform. The span's storage must
+            stay valid until the operation completes.
+
+        @return An awaitable yielding `(error_code, std::size_t)`:
+            the error of the first request (in span order) that
+            failed, including `capy::cond::eof`, and the total
+            bytes read by all requests.
+
+        @par Cancellation
+        Supports cancellation via stop_token or @ref cancel.
+        Requests not yet complete report `capy::cond::canceled`.
+
+        @throws std::logic_error if the file is not open.
+    */
+    auto read_batch(std::span<read_request> reqs)
+    {
+        if (!is_open())
+            detail::throw_logic_error("read_batch: file not open");
+        return read_batch_awaitable(*this, reqs);
+    }
+
     /** Write data at the given offset.
 
         @param offset Byte offset into the file.
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_READ_AHEAD_FILE_HPP
+#define BOOST_COROSIO_READ_AHEAD_FILE_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/file_base.hpp>
+#include <boost/corosio/random_access_file.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/any_executor.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <type_traits>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/// Window settings of a @ref read_ahead_file.
+struct read_ahead_options
+{
+    /** Bytes fetched by each in-flight read.
+
+        Keep this a multiple of the device block size when the
+        file is opened with @ref file_base::direct.
+    */
+    std::size_t chunk_size = 256 * 1024;
+
+    /// Number of chunks kept in flight ahead of the reader.
+    std::size_t depth = 4;
+};
+
+/// Counters of a @ref read_ahead_file.
+struct read_ahead_stats
+{
+    /// Chunk reads issued.
+    std::uint64_t chunks = 0;
+
+    /// Bytes fetched from the file.
+    std::uint64_t bytes_fetched = 0;
+
+    /// Prefetched bytes thrown away by a seek, end of file, or error.
+    std::uint64_t bytes_discarded = 0;
+
+    /// Reads that had to wait for the next chunk to arrive.
+    std::uint64_t stalls = 0;
+};
+
+/** A sequential file reader that keeps several reads in flight.
+
+    A @ref stream_file issues one read at a time, so a sequential
+    scan pays the full device latency on every call. This class
+    instead keeps @ref read_ahead_options::depth chunk reads
+    outstanding at increasing offsets, using the concurrent
+    positional reads of @ref random_access_file (`preadv` on the
+    thread pool, or io_uring `READV`). Completions may arrive in
+    any order; `read_some` is always served from the chunk at the
+    current position, and each fully consumed chunk is recycled
+    into a new read at the far end of the window.
+
+    A read that finds a short chunk reports `capy::cond::eof` and
+    empties the window, so a later read starts fetching again from
+    the same position and sees data appended in the meantime.
+    @ref seek and errors also empty the window; reads already in
+    flight finish into their own buffers and are discarded.
+
+    Chunk buffers are 4096-byte aligned, so the reader works with
+    files opened with @ref file_base::direct when the chunk size
+    is a multiple of the device block size.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. Only one `read_some` may be
+    outstanding at a time.
+
+    @par Example
+    @code
+    read_ahead_file f(ioc, {.chunk_size = 1024 * 1024, .depth = 8});
+    f.open("trace.log");
+
+    char buf[16384];
+    for (;;)
+    {
+        auto [ec, n] = co_await f.read_some(
+            capy::mutable_buffer(buf, sizeof(buf)));
+        if (ec == capy::cond::eof)
+            break;
+        if (ec)
+            co_return;
+        parse(buf, n);
+    }
+    @endcode
+
+    @see stream_file, random_access_file
+*/
+class BOOST_COROSIO_DECL read_ahead_file
+{
+    static constexpr std::size_t max_buffers = 16;
+
+    struct buffer_array
+    {
+        capy::mutable_buffer b[max_buffers];
+        std::size_t n = 0;
+    };
+
+    struct state;
+
+    std::shared_ptr<state> st_;
+
+    void init(
+        capy::any_executor ex,
+        random_access_file file,
+        read_ahead_options const& opts);
+    capy::task<capy::io_result<std::size_t>> do_read_some(buffer_array bufs);
+
+public:
+    /** Construct a closed reader from an executor.
+
+        Chunk reads run on @p ex.
+
+        @param ex The executor whose context will own the file.
+        @param opts The window settings.
+
+        @throws std::invalid_argument if `opts.chunk_size` or
+            `opts.depth` is zero.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, read_ahead_file>) &&
+        capy::Executor<Ex>
+    explicit read_ahead_file(Ex const& ex, read_ahead_options const& opts = {})
+    {
+        init(capy::any_executor(ex), random_access_file(ex), opts);
+    }
+
+    /** Construct a closed reader from an io_context.
+
+        @param ctx The context that will own the file.
+        @param opts The window settings.
+
+        @throws std::invalid_argument if `opts.chunk_size` or
+            `opts.depth` is zero.
+    */
+    template<class Ctx>
+        requires requires(Ctx& c) {
+            { c.get_executor() } -> capy::Executor;
+        }
+    explicit read_ahead_file(Ctx& ctx, read_ahead_options const& opts = {})
+        : read_ahead_file(ctx.get_executor(), opts)
+    {
+    }
+
+    /// Destroy the reader, closing the file.
+    ~read_ahead_file();
+
+    /** Move constructor.
+
+        After the move, @p other is closed and holds no window.
+        It may be destroyed, assigned to, or queried; calling
+        @ref open, @ref options or @ref file on it is undefined.
+    */
+    read_ahead_file(read_ahead_file&&) noexcept = default;
+
+    /** Move assignment.
+
+        After the move, @p other is left as by the move
+        constructor.
+    */
+    read_ahead_file& operator=(read_ahead_file&&) noexcept = default;
+
+    read_ahead_file(read_ahead_file const&)            = delete;
+    read_ahead_file& operator=(read_ahead_file const&) = delete;
+
+    /** Open a file for reading from the start.
+
+        @param path The filesystem path to open.
+        @param mode Bitmask of @ref file_base::flags. Must allow
+            reading.
+
+        @throws std::system_error on failure.
+    */
+    void open(
+        std::filesystem::path const& path,
+        file_base::flags mode = file_base::read_only);
+
+    /** Close the file.
+
+        Chunk reads in flight complete with
+        `errc::operation_canceled` and are discarded.
+    */
+    void close();
+
+    /// Check if the file is open.
+    bool is_open() const noexcept;
+
+    /** Read data at the current position.
+
+        Copies from the prefetched window, waiting only when the
+        chunk at the current position has not arrived yet, and
+        tops the window back up to its depth.
+
+        @param buffers The buffer sequence to read into. At most
+            16 buffers are used.
+
+        @return An awaitable yielding `(error_code, std::size_t)`.
+            At end of file the error is `capy::cond::eof`.
+
+        @par Cancellation
+        Supports cancellation via stop_token or @ref cancel.
+        Cancellation empties the window; the position is kept.
+
+        @throws std::logic_error if the file is not open.
+    */
+    template<capy::MutableBufferSequence MB>
+    capy::task<capy::io_result<std::size_t>> read_some(MB const& buffers)
+    {
+        if (!is_open())
+            detail::throw_logic_error("read_some: file not open");
+        buffer_array bufs;
+        bufs.n = detail::buffer_param(buffers).copy_to(bufs.b, max_buffers);
+        return do_read_some(bufs);
+    }
+
+    /** Move the read position.
+
+        Empties the window; the next read starts fetching at
+        @p offset.
+
+        @throws std::logic_error if the object was moved from.
+    */
+    void seek(std::uint64_t offset);
+
+    /// Return the offset of the next byte `read_some` returns.
+    std::uint64_t position() const noexcept;
+
+    /// Return the window settings.
+    read_ahead_options const& options() const noexcept;
+
+    /// Return the reader's counters.
+    read_ahead_stats stats() const noexcept;
+
+    /** Cancel a pending `read_some` and every chunk read in flight.
+
+        Empties the window; the position is kept, and the next
+        read fetches from it again.
+    */
+    void cancel();
+
+    /** Return the underlying file.
+
+        Use it for `size`, `native_handle` and the like. Reads and
+        writes through it bypass the window.
+    */
+    random_access_file& file() noexcept;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_READ_AHEAD_FILE_HPP
@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_RELAY_HPP
+#define BOOST_COROSIO_RELAY_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/native_handle.hpp>
+#include <boost/corosio/shutdown_type.hpp>
+#include <boost/corosio/wait_type.hpp>
+
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/when_all.hpp>
+
+#include <cstddef>
+#include <system_error>
+
+/*
+  Bidirectional relay between two connected stream sockets.
+
+  Each direction runs as its own coroutine and the two are joined
+  with when_all. A direction moves bytes with splice(2) through a
+  private non-blocking pipe: splice_in pulls from the source socket
+  into the pipe, splice_out pushes from the pipe into the sink, and
+  the bytes never enter user space. Read readiness comes from the
+  socket's wait(wait_type::read), which parks on every backend.
+
+  When splice_out would block, the direction parks on the sink's
+  wait(wait_type::write) and retries, so a slow sink paces the
+  relay without the payload ever being copied. While parked, the
+  pipe stays full and splice_in stops pulling from the source.
+
+  Where splice is unavailable (non-Linux, or pipe creation fails)
+  the direction falls back to a read_some / write_some copy loop
+  through a fixed buffer. The fallback is decided per direction on
+  the first pipe allocation and never mixes with the splice path.
+
+  End-of-stream on one side is propagated as shutdown_send on the
+  other after the pipe has drained, so half-closed connections are
+  relayed faithfully and the opposite direction keeps running until
+  its own EOF.
+*/
+
+namespace boost::corosio {
+
+namespace detail {
+
+/* A pipe used as the in-kernel buffer for one relay direction. */
+struct relay_pipe
+{
+    int rd = -1;
+    int wr = -1;
+    std::size_t buffered = 0;
+    std::size_t capacity = 0;
+};
+
+/* Create a non-blocking close-on-exec pipe. Returns
+   operation_not_supported where splice(2) is unavailable. */
+BOOST_COROSIO_DECL std::error_code
+open_relay_pipe(relay_pipe& p) noexcept;
+
+BOOST_COROSIO_DECL void
+close_relay_pipe(relay_pipe& p) noexcept;
+
+/* Move up to capacity - buffered bytes from src into the pipe.
+   Sets n to the count moved; n == 0 with no error means EOF.
+   Returns resource_unavailable_try_again when src is not ready. */
+BOOST_COROSIO_DECL std::error_code
+splice_in(relay_pipe& p, native_handle_type src, std::size_t& n) noexcept;
+
+/* Move buffered bytes from the pipe into dst. Returns
+   resource_unavailable_try_again when dst is not ready. */
+BOOST_COROSIO_DECL std::error_code
+splice_out(relay_pipe& p, native_handle_type dst, std::size_t& n) noexcept;
+
+struct relay_pipe_guard
+{
+    relay_pipe& p;
+    ~relay_pipe_guard()
+    {
+        close_relay_pipe(p);
+    }
+};
+
+inline bool
+relay_would_block(std::error_code const& ec) noexcept
+{
+    return ec == std::errc::resource_unavailable_try_again ||
+        ec == std::errc::operation_would_block;
+}
+
+/* Half-close the sink without throwing; the peer may already
+   be gone, which is not an error for the relay. */
+template<class To>
+void
+relay_shutdown_send(To& to) noexcept
+{
+    if constexpr (requires(std::error_code& ec) {
+                      to.shutdown(shutdown_send, ec);
+                  })
+    {
+        std::error_code ec;
+        to.shutdown(shutdown_send, ec);
+    }
+    else
+    {
+        to.shutdown(shutdown_send);
+    }
+}
+
+/* Userspace fallback for one direction. */
+template<class From, class To>
+capy::task<capy::io_result<>>
+relay_copy(From& from, To& to, std::size_t& total)
+{
+    char buf[65536];
+    for (;;)
+    {
+        auto [rec, n] =
+            co_await from.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+        if (rec == capy::cond::eof)
+            break;
+        if (rec)
+            co_return {rec};
+
+        std::size_t off = 0;
+        while (off < n)
+        {
+            auto [wec, m] = co_await to.write_some(
+                capy::const_buffer(buf + off, n - off));
+            if (wec)
+                co_return {wec};
+            off += m;
+            total += m;
+        }
+    }
+    relay_shutdown_send(to);
+    co_return {};
+}
+
+/* One direction: from -> pipe -> to. */
+template<class From, class To>
+capy::task<capy::io_result<>>
+relay_one(From& from, To& to, std::size_t& total)
+{
+    relay_pipe p;
+    if (open_relay_pipe(p))
+        co_return co_await relay_copy(from, to, total);
+    relay_pipe_guard guard{p};
+
+    bool eof = false;
+    for (;;)
+    {
+        if (!eof && p.buffered < p.capacity)
+        {
+            std::size_t n = 0;
+            auto ec       = splice_in(p, from.native_handle(), n);
+            if (!ec && n == 0)
+            {
+                eof = true;
+            }
+            else if (relay_would_block(ec))
+            {
+                if (p.buffered == 0)
+                {
+                    auto [wec] = co_await from.wait(wait_type::read);
+                    if (wec)
+                        co_return {wec};
+                    continue;
+                }
+            }
+            else if (ec)
+            {
+                co_return {ec};
+            }
+        }
+
+        if (p.buffered == 0)
+        {
+            if (eof)
+                break;
+            continue;
+        }
+
+        std::size_t n = 0;
+        auto ec       = splice_out(p, to.native_handle(), n);
+        if (relay_would_block(ec))
+        {
+            auto [wec] = co_await to.wait(wait_type::write);
+            if (wec)
+                co_return {wec};
+            continue;
+        }
+        if (ec)
+            co_return {ec};
+        total += n;
+    }
+    relay_shutdown_send(to);
+    co_return {};
+}
+
+} // namespace detail
+
+/** Relay bytes between two connected stream sockets until both
+    directions reach end-of-stream.
+
+    Data read from @p a is written to @p b and data read from @p b
+    is written to @p a, concurrently. On Linux each direction
+    moves bytes with `splice(2)` through a private pipe, so the
+    payload never enters user space; a sink whose send buffer is
+    full is awaited with `wait(wait_type::write)`. Elsewhere a
+    buffered `read_some` / `write_some` loop is used instead.
+
+    When one side reaches end-of-stream, its pending bytes are
+    flushed and `shutdown(shutdown_send)` is applied to the other
+    side; the opposite direction keeps running. The operation
+    completes when both directions have finished or either fails.
+
+    @par Cancellation
+    Supports cancellation via the affine awaitable protocol. An
+    error or cancellation in one direction stops the other. The
+    byte counts reflect what was delivered before completion.
+
+    @param a The first socket. Must be connected and provide
+        `native_handle()`, `wait()`, `read_some()`, `write_some()`
+        and `shutdown()`.
+    @param b The second socket, with the same requirements.
+
+    @return An awaitable completing with
+        `capy::io_result<std::size_t, std::size_t>` holding the
+        bytes relayed from @p a to @p b and from @p b to @p a.
+
+    @par Preconditions
+    Both sockets must outlive the returned awaitable and have no
+    other reads or writes outstanding.
+
+    @par Example
+    @code
+    auto [ec, up, down] = co_await corosio::relay(client, upstream);
+    @endcode
+*/
+template<class A, class B>
+capy::task<capy::io_result<std::size_t, std::size_t>>
+relay(A& a, B& b)
+{
+    std::size_t a_to_b = 0;
+    std::size_t b_to_a = 0;
+    auto [ec, r1, r2]  = co_await capy::when_all(
+        detail::relay_one(a, b, a_to_b), detail::relay_one(b, a, b_to_a));
+    (void)r1;
+    (void)r2;
+    co_return {ec, a_to_b, b_to_a};
+}
+
+} // namespace boost::corosio
+
+#endif
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_RESOLVE_MANY_HPP
+#define BOOST_COROSIO_RESOLVE_MANY_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/resolver.hpp>
+#include <boost/corosio/resolver_results.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <system_error>
+
+namespace boost::corosio {
+
+/// One name for @ref resolve_many to look up.
+struct host_service
+{
+    /// The host name or numeric address.
+    std::string host;
+
+    /// The service name or port number.
+    std::string service;
+
+    /// Flags passed to @ref resolver::resolve.
+    resolve_flags flags = resolve_flags::none;
+};
+
+/// Settings of @ref resolve_many.
+struct resolve_many_options
+{
+    /** Lookups in flight at once.
+
+        Each runs on its own @ref resolver. Lookups beyond the
+        resolver lane's thread count wait in the pool queue, so
+        raise `io_context_options::resolver_pool_size` or
+        `resolver_pool_max_size` along with this.
+    */
+    std::size_t max_in_flight = 64;
+};
+
+/** Receives each result of @ref resolve_many.
+
+    Called with the index of the query in the input span, the
+    error of its lookup, and its results.
+*/
+using resolve_many_handler =
+    std::function<void(std::size_t, std::error_code, resolver_results)>;
+
+/** Resolve many names concurrently.
+
+    Keeps up to @ref resolve_many_options::max_in_flight lookups
+    running, starting the next query as each one finishes, and
+    hands every result to @p on_result as it arrives, so callers
+    can start connecting before the whole batch is done. Results
+    arrive in completion order, not input order. The lookups run on
+    the execution context of the awaiting coroutine.
+
+    Calls to @p on_result never overlap, even when several threads
+    run the context. It runs on the context's threads and must not
+    block.
+
+    @param queries The names to resolve. Must stay valid until the
+        returned task completes.
+    @param on_result Invoked once per query whose lookup ran.
+    @param opts The concurrency settings.
+
+    @return An awaitable completing with `io_result<>` once every
+        lookup has finished. Per-name failures go to @p on_result
+        and do not fail the batch.
+
+    @throws std::invalid_argument if `opts.max_in_flight` is zero.
+
+    @par Exception Safety
+    If @p on_result throws, no further queries are started, the
+    lookups in flight run to completion and are still delivered,
+    and awaiting the returned task rethrows the first exception.
+
+    @par Cancellation
+    A stop request cancels the lookups in flight, which report
+    `capy::error::canceled` to @p on_result. Queries not yet
+    started are skipped. The batch then completes with
+    `capy::error::canceled`.
+
+    @par Example
+    @code
+    std::vector<host_service> names = load_frontier();
+    auto [ec] = co_await resolve_many(
+        names,
+        [&](std::size_t i, std::error_code ec, resolver_results r) {
+            if (!ec)
+                start_fetch(names[i], std::move(r));
+        });
+    @endcode
+*/
+BOOST_COROSIO_DECL
+capy::task<capy::io_result<>>
+resolve_many(
+    std::span<host_service const> queries,
+    resolve_many_handler on_result,
+    resolve_many_options const& opts = {});
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_RESOLVE_MANY_HPP
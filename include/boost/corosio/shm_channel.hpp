@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_SHM_CHANNEL_HPP
+#define BOOST_COROSIO_SHM_CHANNEL_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/local_stream_socket.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/io_result.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost::corosio {
+
+namespace detail {
+struct shm_ring;
+} // namespace detail
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/** A full-duplex IPC channel over shared memory.
+
+    Each direction is a single-producer/single-consumer byte ring in
+    a shared `memfd` mapping, so a message is copied once into the
+    ring and once out of it with no kernel socket buffers involved.
+    A pair of connected Unix stream sockets acts as the doorbell:
+    a side that finds its ring empty (or full) parks on a read of
+    its doorbell socket, and the peer writes one byte to it only
+    when the shared state says that side is actually parked. While
+    both sides keep up, `send` and `recv` make no system calls.
+
+    The channel is established over an already connected
+    @ref local_stream_socket (from @ref connect_pair, or an accepted
+    connection): one side calls @ref create, which passes the
+    mapping and a second doorbell socket to the peer with
+    `send_with_fds`, and the other side calls @ref accept.
+
+    @par Thread Safety
+    Distinct objects: Safe.@n
+    Shared objects: Unsafe. At most one `send` and one `recv` may be
+    in flight at a time, as with a socket.
+
+    @par Example
+    @code
+    local_stream_socket a(ioc), b(ioc);
+    connect_pair(a, b);
+    shm_channel producer(ioc), consumer(ioc);
+
+    // in one coroutine (or process)
+    co_await producer.create(std::move(a), 64 * 1024);
+    co_await producer.send(capy::const_buffer("hello", 5));
+
+    // in the other
+    co_await consumer.accept(std::move(b));
+    char buf[64];
+    auto [ec, n] = co_await consumer.recv(
+        capy::mutable_buffer(buf, sizeof(buf)));
+    @endcode
+
+    @note Linux only; elsewhere @ref create and @ref accept complete
+        with `std::errc::operation_not_supported`.
+*/
+class BOOST_COROSIO_DECL shm_channel
+{
+    local_stream_socket data_bell_;
+    local_stream_socket space_bell_;
+    void* map_                = nullptr;
+    std::size_t map_size_     = 0;
+    std::size_t capacity_     = 0;
+    detail::shm_ring* out_    = nullptr;
+    detail::shm_ring* in_     = nullptr;
+    unsigned char* out_data_  = nullptr;
+    unsigned char* in_data_   = nullptr;
+
+public:
+    /** Construct a closed channel.
+
+        @param ctx The execution context that will own the doorbell
+            sockets.
+    */
+    explicit shm_channel(capy::execution_context& ctx);
+
+    /** Construct a closed channel from an executor.
+
+        @param ex The executor whose context will own the doorbell
+            sockets.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, shm_channel>) &&
+        capy::Executor<Ex>
+    explicit shm_channel(Ex const& ex) : shm_channel(ex.context())
+    {
+    }
+
+    /// Destroy the channel, unmapping the rings and closing the doorbells.
+    ~shm_channel();
+
+    shm_channel(shm_channel const&)            = delete;
+    shm_channel& operator=(shm_channel const&) = delete;
+
+    /** Create the shared rings and hand them to the peer.
+
+        Allocates a `memfd` holding one ring per direction, each of
+        @p capacity bytes rounded up to a power of two, and sends it
+        with a fresh doorbell socket over @p sock. The `memfd` is
+        sealed against resizing so the peer cannot shrink the mapping
+        out from under either side. The peer must call @ref accept on
+        its end of the connection.
+
+        @param sock A connected Unix stream socket. It becomes one
+            of the channel's doorbells and must not be used directly
+            afterwards.
+        @param capacity The ring size in bytes per direction.
+
+        @return An awaitable completing with `io_result<>`.
+    */
+    capy::task<capy::io_result<>>
+    create(local_stream_socket sock, std::size_t capacity);
+
+    /** Join a channel created by the peer.
+
+        @param sock A connected Unix stream socket whose peer calls
+            @ref create. It becomes one of the channel's doorbells.
+
+        @return An awaitable completing with `io_result<>`.
+            `std::errc::protocol_error` if the peer did not send a
+            valid channel or its `memfd` is not sealed against
+            resizing.
+    */
+    capy::task<capy::io_result<>> accept(local_stream_socket sock);
+
+    /** Write data to the peer.
+
+        Copies as many bytes as fit into the outbound ring and
+        completes. Suspends only while the ring is full.
+
+        @param buffers The data to send.
+
+        @return An awaitable completing with
+            `io_result<std::size_t>`. When the peer closes, completes
+            with the doorbell's error (typically end of file).
+            `std::errc::protocol_error` if the peer corrupted the
+            ring indices.
+
+        @throws std::logic_error if the channel is not open.
+    */
+    template<capy::ConstBufferSequence Buffers>
+    capy::task<capy::io_result<std::size_t>> send(Buffers buffers)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send: channel not open");
+        for (;;)
+        {
+            std::size_t n = 0;
+            std::error_code ec;
+            if (try_send(buffer_param(buffers), n, ec))
+                co_return {ec, n};
+            if (!park_send())
+                continue;
+            char drain[64];
+            auto [ec, m] = co_await space_bell_.read_some(
+                capy::mutable_buffer(drain, sizeof(drain)));
+            if (ec)
+                co_return {ec, 0};
+        }
+    }
+
+    /** Read data from the peer.
+
+        Copies whatever the inbound ring holds, up to the size of
+        @p buffers, and completes. Suspends only while the ring is
+        empty.
+
+        @param buffers The buffers to fill.
+
+        @return An awaitable completing with
+            `io_result<std::size_t>`. Once the peer closes and the
+            ring is drained, completes with the doorbell's error
+            (typically end of file). `std::errc::protocol_error` if
+            the peer corrupted the ring indices.
+
+        @throws std::logic_error if the channel is not open.
+    */
+    template<capy::MutableBufferSequence Buffers>
+    capy::task<capy::io_result<std::size_t>> recv(Buffers buffers)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv: channel not open");
+        for (;;)
+        {
+            std::size_t n = 0;
+            std::error_code ec;
+            if (try_recv(buffer_param(buffers), n, ec))
+                co_return {ec, n};
+            if (!park_recv())
+                continue;
+            char drain[64];
+            auto [ec, m] = co_await data_bell_.read_some(
+                capy::mutable_buffer(drain, sizeof(drain)));
+            if (ec)
+                co_return {ec, 0};
+        }
+    }
+
+    /// Return true if the channel is established.
+    bool is_open() const noexcept
+    {
+        return map_ != nullptr;
+    }
+
+    /// Return the ring size in bytes per direction.
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    /// Cancel a parked `send` or `recv`.
+    void cancel();
+
+    /** Close the channel.
+
+        Unmaps the rings and closes the doorbells, which wakes a
+        parked peer with end of file.
+    */
+    void close();
+
+private:
+    // Non-suspending halves of send/recv. try_* return false when
+    // the ring is full (empty), and true with ec set when the peer
+    // left the ring indices inconsistent; park_* then announce that
+    // this side is about to sleep and return false if the peer got
+    // in first.
+    bool try_send(
+        buffer_param buffers, std::size_t& n, std::error_code& ec) noexcept;
+    bool try_recv(
+        buffer_param buffers, std::size_t& n, std::error_code& ec) noexcept;
+    bool park_send() noexcept;
+    bool park_recv() noexcept;
+
+    void attach(
+        void* map,
+        std::size_t size,
+        std::size_t capacity,
+        bool creator) noexcept;
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_SHM_CHANNEL_HPP
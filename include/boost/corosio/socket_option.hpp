@@ -660,6 +660,200 @@ public:
     static int name() noexcept;
 };
 
+/** Set the default UDP segmentation offload size (UDP_SEGMENT).
+
+    When non-zero, every send on the socket is split by the kernel
+    into datagrams of this size. Per-send sizes can instead be given
+    through `const_datagram_slot::segment_size`. Linux only; on
+    other platforms `set_option` will return an error.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::udp_segment( 1200 ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL udp_segment : public integer_option
+{
+public:
+    using integer_option::integer_option;
+    using integer_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Enable UDP generic receive offload (UDP_GRO).
+
+    Lets the kernel coalesce consecutive datagrams of one flow into
+    a single receive. Use `udp_socket::recv_batch`, whose slots
+    report the original datagram size in `segment_size`. Linux only;
+    on other platforms `set_option` will return an error.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::udp_gro( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL udp_gro : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Report the local address of received IPv4 datagrams (IP_PKTINFO).
+
+    Fills `datagram_info::local_address` and `interface_index` for
+    datagrams received with `udp_socket::recv_msg` or
+    `udp_socket::recv_batch`.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_packet_info_v4( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_packet_info_v4 : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Report the local address of received IPv6 datagrams (IPV6_RECVPKTINFO).
+
+    Fills `datagram_info::local_address` and `interface_index` for
+    datagrams received with `udp_socket::recv_msg` or
+    `udp_socket::recv_batch`.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_packet_info_v6( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_packet_info_v6 : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Timestamp received datagrams (SO_TIMESTAMPNS).
+
+    Fills `datagram_info::timestamp` for datagrams received with
+    `udp_socket::recv_msg` or `recv_batch`. Uses microsecond `SO_TIMESTAMP` where
+    the nanosecond form is unavailable.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_timestamp( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_timestamp : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Report the TOS byte of received IPv4 datagrams (IP_RECVTOS).
+
+    Fills `datagram_info::tos`, including the ECN bits, for
+    datagrams received with `udp_socket::recv_msg` or
+    `udp_socket::recv_batch`.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_tos_v4( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_tos_v4 : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Report the traffic class of received IPv6 datagrams (IPV6_RECVTCLASS).
+
+    Fills `datagram_info::tos`, including the ECN bits, for
+    datagrams received with `udp_socket::recv_msg` or
+    `udp_socket::recv_batch`.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_tclass_v6( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_tclass_v6 : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
+/** Report the socket's receive-queue drop counter (SO_RXQ_OVFL).
+
+    Fills `datagram_info::drops` for datagrams received with
+    `udp_socket::recv_msg` or `recv_batch`. Linux only; on other platforms
+    `set_option` will return an error.
+
+    @par Example
+    @code
+    sock.set_option( socket_option::receive_drop_count( true ) );
+    @endcode
+*/
+class BOOST_COROSIO_DECL receive_drop_count : public boolean_option
+{
+public:
+    using boolean_option::boolean_option;
+    using boolean_option::operator=;
+
+    /// Return the protocol level.
+    static int level() noexcept;
+
+    /// Return the option name.
+    static int name() noexcept;
+};
+
 /** Join an IPv4 multicast group (IP_ADD_MEMBERSHIP).
 
     @par Example
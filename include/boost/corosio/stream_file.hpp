@@ -56,6 +56,9 @@ namespace boost::corosio {
     if (ec == capy::cond::eof)
         // end of file
     @endcode
+
+    @see read_ahead_file for sequential reads with several
+        requests in flight.
 */
 class BOOST_COROSIO_DECL stream_file : public io_stream
 {
@@ -396,6 +396,10 @@ public:
         stop token is triggered, the operation completes
         immediately with `errc::operation_canceled`.
 
+        A write wait completes at once while the send buffer has
+        space and otherwise parks until the peer drains it; see
+        @ref wait_type::write.
+
         @param w The wait direction (read, write, or error).
 
         @return An awaitable that completes with `io_result<>`.
@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_THREAD_POOL_STATS_HPP
+#define BOOST_COROSIO_THREAD_POOL_STATS_HPP
+
+#include <boost/corosio/detail/config.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost::corosio {
+
+/** A lane of the blocking-work thread pool.
+
+    Work that has no asynchronous kernel interface runs on worker
+    threads. Each kind of work has its own lane, with its own
+    queue and threads, so a slow `getaddrinfo` never delays a
+    queued file read.
+*/
+enum class thread_pool_lane : unsigned char
+{
+    /// POSIX file I/O (`stream_file`, `random_access_file`).
+    file,
+
+    /// Blocking DNS resolution (`resolver`).
+    resolver
+};
+
+/** Counters for one lane of the blocking-work thread pool.
+
+    A snapshot returned by @ref io_context::pool_stats. Counters
+    accumulate from the context's construction.
+*/
+struct thread_pool_stats
+{
+    /// Worker threads currently alive.
+    unsigned threads = 0;
+
+    /// Worker threads waiting for work.
+    unsigned idle = 0;
+
+    /// Items queued and not yet picked up by a worker.
+    std::size_t queue_depth = 0;
+
+    /// Largest @ref queue_depth observed.
+    std::size_t peak_queue_depth = 0;
+
+    /// Items executed.
+    std::uint64_t completed = 0;
+
+    /// Sum of the time items spent queued before a worker took them.
+    std::chrono::nanoseconds total_wait{0};
+
+    /// Longest time any item spent queued.
+    std::chrono::nanoseconds max_wait{0};
+
+    /// Threads started, including growth beyond the minimum.
+    std::uint64_t threads_started = 0;
+
+    /// Threads retired after sitting idle.
+    std::uint64_t threads_retired = 0;
+};
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_THREAD_POOL_STATS_HPP
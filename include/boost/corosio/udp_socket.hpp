@@ -18,6 +18,8 @@
 #include <boost/corosio/io/io_object.hpp>
 #include <boost/capy/io_result.hpp>
 #include <boost/corosio/detail/buffer_param.hpp>
+#include <boost/corosio/datagram_info.hpp>
+#include <boost/corosio/datagram_slot.hpp>
 #include <boost/corosio/endpoint.hpp>
 #include <boost/corosio/message_flags.hpp>
 #include <boost/corosio/udp.hpp>
@@ -32,6 +34,7 @@
 #include <concepts>
 #include <coroutine>
 #include <cstddef>
+#include <span>
 #include <stop_token>
 #include <type_traits>
 
@@ -264,6 +267,116 @@ public:
             wait_type w,
             std::stop_token token,
             std::error_code* ec) = 0;
+
+        /** Initiate an asynchronous batched receive.
+
+            Receives up to `count` datagrams (capped at
+            @ref max_datagram_batch) in as few syscalls as the
+            platform allows. Completes once at least one datagram
+            has been received.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param slots The receive slots. On success the first
+                `*count_out` slots hold size and source endpoint.
+            @param count Number of entries in @p slots.
+            @param flags Platform message flags (e.g. `MSG_PEEK`).
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param count_out Output number of datagrams received.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> recv_batch(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            datagram_slot* slots,
+            std::size_t count,
+            int flags,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* count_out) = 0;
+
+        /** Initiate an asynchronous batched send.
+
+            Sends up to `count` datagrams (capped at
+            @ref max_datagram_batch) in as few syscalls as the
+            platform allows. Completes once at least one datagram
+            has been sent.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param slots The datagrams to send. On success the first
+                `*count_out` slots hold the sent size.
+            @param count Number of entries in @p slots.
+            @param flags Platform message flags (e.g. `MSG_DONTWAIT`).
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param count_out Output number of datagrams sent.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> send_batch(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            const_datagram_slot* slots,
+            std::size_t count,
+            int flags,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* count_out) = 0;
+
+        /** Initiate an asynchronous send_to with ancillary data.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer data to send.
+            @param dest The destination endpoint.
+            @param info Source address, interface, and traffic
+                class to apply to the datagram.
+            @param flags Platform message flags (e.g. `MSG_DONTWAIT`).
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> send_msg(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            endpoint dest,
+            datagram_info const* info,
+            int flags,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
+
+        /** Initiate an asynchronous recv_from with ancillary data.
+
+            @param h Coroutine handle to resume on completion.
+            @param ex Executor for dispatching the completion.
+            @param buf The buffer to receive into.
+            @param source Output endpoint for the sender's address.
+            @param info Output ancillary data decoded from the
+                datagram's control messages.
+            @param flags Platform message flags (e.g. `MSG_PEEK`).
+            @param token Stop token for cancellation.
+            @param ec Output error code.
+            @param bytes_out Output bytes transferred.
+
+            @return Coroutine handle to resume immediately.
+        */
+        virtual std::coroutine_handle<> recv_msg(
+            std::coroutine_handle<> h,
+            capy::executor_ref ex,
+            buffer_param buf,
+            endpoint* source,
+            datagram_info* info,
+            int flags,
+            std::stop_token token,
+            std::error_code* ec,
+            std::size_t* bytes_out) = 0;
     };
 
     /** Represent the awaitable returned by @ref send_to.
@@ -394,6 +507,124 @@ public:
         }
     };
 
+    /// Represent the awaitable returned by @ref send_msg.
+    struct send_msg_awaitable
+        : detail::bytes_op_base<send_msg_awaitable>
+    {
+        udp_socket& s_;
+        buffer_param buf_;
+        endpoint dest_;
+        datagram_info const& info_;
+        int flags_;
+
+        send_msg_awaitable(
+            udp_socket& s, buffer_param buf, endpoint dest,
+            datagram_info const& info, int flags = 0) noexcept
+            : s_(s), buf_(buf), dest_(dest), info_(info), flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().send_msg(
+                h, ex, buf_, dest_, &info_, flags_, token_, &ec_, &bytes_);
+        }
+    };
+
+    /// Represent the awaitable returned by @ref recv_msg.
+    struct recv_msg_awaitable
+        : detail::bytes_op_base<recv_msg_awaitable>
+    {
+        udp_socket& s_;
+        buffer_param buf_;
+        endpoint& source_;
+        datagram_info& info_;
+        int flags_;
+
+        recv_msg_awaitable(
+            udp_socket& s, buffer_param buf, endpoint& source,
+            datagram_info& info, int flags = 0) noexcept
+            : s_(s), buf_(buf), source_(source), info_(info), flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv_msg(
+                h, ex, buf_, &source_, &info_, flags_, token_, &ec_, &bytes_);
+        }
+    };
+
+    /** Represent the awaitable returned by @ref recv_batch.
+
+        The result value is the number of slots filled, not a
+        byte count.
+    */
+    struct recv_batch_awaitable
+        : detail::bytes_op_base<recv_batch_awaitable>
+    {
+        udp_socket& s_;
+        datagram_slot* slots_;
+        std::size_t count_;
+        int flags_;
+
+        recv_batch_awaitable(
+            udp_socket& s, std::span<datagram_slot> slots,
+            int flags = 0) noexcept
+            : s_(s), slots_(slots.data()), count_(slots.size())
+            , flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().recv_batch(
+                h, ex, slots_, count_, flags_, token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            if (ec_)
+                return {ec_, 0};
+            return {ec_, bytes_};
+        }
+    };
+
+    /** Represent the awaitable returned by @ref send_batch.
+
+        The result value is the number of slots sent, not a
+        byte count.
+    */
+    struct send_batch_awaitable
+        : detail::bytes_op_base<send_batch_awaitable>
+    {
+        udp_socket& s_;
+        const_datagram_slot* slots_;
+        std::size_t count_;
+        int flags_;
+
+        send_batch_awaitable(
+            udp_socket& s, std::span<const_datagram_slot> slots,
+            int flags = 0) noexcept
+            : s_(s), slots_(slots.data()), count_(slots.size())
+            , flags_(flags) {}
+
+        std::coroutine_handle<> dispatch(
+            std::coroutine_handle<> h, capy::executor_ref ex) const
+        {
+            return s_.get().send_batch(
+                h, ex, slots_, count_, flags_, token_, &ec_, &bytes_);
+        }
+
+        capy::io_result<std::size_t> await_resume() const noexcept
+        {
+            if (token_.stop_requested())
+                return {make_error_code(std::errc::operation_canceled), 0};
+            if (ec_)
+                return {ec_, 0};
+            return {ec_, bytes_};
+        }
+    };
+
 public:
     /** Destructor.
 
@@ -614,6 +845,90 @@ public:
         return recv_from(buf, source, corosio::message_flags::none);
     }
 
+    /** Receive a datagram together with its ancillary data.
+
+        Like @ref recv_from, and additionally decodes the control
+        messages the kernel attached to the datagram into @p info:
+        the local address and interface it arrived on, the kernel
+        receive timestamp, the TOS / traffic class byte (including
+        ECN), and the socket's drop counter. Each group is only
+        reported when the matching `socket_option::receive_*`
+        option is enabled; see @ref datagram_info.
+
+        @param buf The buffer to receive data into.
+        @param source Reference to an endpoint that will be set to
+            the sender's address on successful completion.
+        @param info Reference to the ancillary data, overwritten
+            on successful completion.
+        @param flags Message flags (e.g. message_flags::peek).
+
+        @return An awaitable that completes with
+            `io_result<std::size_t>`.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    template<capy::MutableBufferSequence Buffers>
+    auto recv_msg(
+        Buffers const& buf,
+        endpoint& source,
+        datagram_info& info,
+        corosio::message_flags flags)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv_msg: socket not open");
+        return recv_msg_awaitable(
+            *this, buf, source, info, static_cast<int>(flags));
+    }
+
+    /// @overload
+    template<capy::MutableBufferSequence Buffers>
+    auto recv_msg(Buffers const& buf, endpoint& source, datagram_info& info)
+    {
+        return recv_msg(buf, source, info, corosio::message_flags::none);
+    }
+
+    /** Send a datagram with a chosen source address or traffic class.
+
+        Like @ref send_to, and additionally applies the fields of
+        @p info: when `has_local_address` is set the datagram leaves
+        from `local_address` (and `interface_index`, if non-zero);
+        when `has_tos` is set it carries `tos` as its TOS / traffic
+        class byte. Passing the @ref datagram_info filled by
+        @ref recv_msg replies from the address the request arrived
+        on, which a multi-homed server bound to a wildcard address
+        needs.
+
+        @param buf The buffer containing data to send.
+        @param dest The destination endpoint.
+        @param info The ancillary data to apply. Must remain valid
+            until the operation completes.
+        @param flags Message flags.
+
+        @return An awaitable that completes with
+            `io_result<std::size_t>`.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    template<capy::ConstBufferSequence Buffers>
+    auto send_msg(
+        Buffers const& buf,
+        endpoint dest,
+        datagram_info const& info,
+        corosio::message_flags flags)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send_msg: socket not open");
+        return send_msg_awaitable(
+            *this, buf, dest, info, static_cast<int>(flags));
+    }
+
+    /// @overload
+    template<capy::ConstBufferSequence Buffers>
+    auto send_msg(Buffers const& buf, endpoint dest, datagram_info const& info)
+    {
+        return send_msg(buf, dest, info, corosio::message_flags::none);
+    }
+
     /** Initiate an asynchronous connect to set the default peer.
 
         If the socket is not already open, it is opened automatically
@@ -706,6 +1021,73 @@ public:
         return recv(buf, corosio::message_flags::none);
     }
 
+    /** Receive several datagrams with one operation.
+
+        Fills up to @ref max_datagram_batch slots per call. The
+        operation completes as soon as at least one datagram is
+        available; it then drains whatever else is already queued
+        in the kernel, up to the slot count, without suspending
+        again. On Linux this is a single `recvmmsg` call.
+
+        Each slot's `buffer` must be set by the caller. On success
+        the first `n` slots hold the datagram size and the source
+        endpoint; the remaining slots are left untouched. With
+        `socket_option::udp_gro` enabled a slot may hold several
+        coalesced datagrams, reported through `segment_size`.
+
+        @param slots The receive slots. Must remain valid until
+            the operation completes.
+        @param flags Message flags (e.g. message_flags::peek).
+
+        @return An awaitable that completes with
+            `io_result<std::size_t>` holding the number of
+            datagrams received.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    auto recv_batch(
+        std::span<datagram_slot> slots,
+        corosio::message_flags flags = corosio::message_flags::none)
+    {
+        if (!is_open())
+            detail::throw_logic_error("recv_batch: socket not open");
+        return recv_batch_awaitable(
+            *this, slots, static_cast<int>(flags));
+    }
+
+    /** Send several datagrams with one operation.
+
+        Sends up to @ref max_datagram_batch slots per call. Each
+        slot carries its own destination; a default-constructed
+        `peer` sends to the connected peer. On Linux this is a
+        single `sendmmsg` call, and a slot with a non-zero
+        `segment_size` is split by the kernel into datagrams of
+        that size (UDP generic segmentation offload).
+
+        The operation may complete after sending only a prefix of
+        the slots (for example when the socket send buffer fills).
+        Resubmit the remaining slots to send them.
+
+        @param slots The datagrams to send. Must remain valid until
+            the operation completes.
+        @param flags Message flags.
+
+        @return An awaitable that completes with
+            `io_result<std::size_t>` holding the number of
+            datagrams sent.
+
+        @throws std::logic_error if the socket is not open.
+    */
+    auto send_batch(
+        std::span<const_datagram_slot> slots,
+        corosio::message_flags flags = corosio::message_flags::none)
+    {
+        if (!is_open())
+            detail::throw_logic_error("send_batch: socket not open");
+        return send_batch_awaitable(
+            *this, slots, static_cast<int>(flags));
+    }
+
     /** Get the remote endpoint of the socket.
 
         Returns the address and port of the connected peer.
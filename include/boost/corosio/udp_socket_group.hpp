@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef BOOST_COROSIO_UDP_SOCKET_GROUP_HPP
+#define BOOST_COROSIO_UDP_SOCKET_GROUP_HPP
+
+#include <boost/corosio/detail/config.hpp>
+#include <boost/corosio/endpoint.hpp>
+#include <boost/corosio/udp_socket.hpp>
+#include <boost/capy/task.hpp>
+#include <boost/capy/concept/executor.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/ex/run_async.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost::corosio {
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251) // class needs to have dll-interface
+#endif
+
+/** A set of UDP sockets sharing one endpoint via SO_REUSEPORT.
+
+    A single socket read by many coroutines on a multi-threaded
+    `io_context` serializes every completion on that socket's
+    descriptor state. A group instead opens one socket per `run()`
+    thread, all bound to the same address and port with
+    `SO_REUSEPORT`, and the kernel spreads incoming datagrams across
+    them by flow hash. Each socket is driven by its own receive loop,
+    so receive work no longer contends on a shared descriptor.
+
+    On Linux, @ref steer_by_cpu replaces the flow hash with the
+    number of the CPU that processed the packet, so the kernel picks
+    the member socket by receive CPU. It does not move the receive
+    loops: all of them run on the executor passed to @ref start.
+
+    @par Thread Safety
+    Distinct objects: Safe.
+    Shared objects: Unsafe. Each member socket follows the rules of
+    @ref udp_socket.
+
+    @par Example
+    @code
+    io_context ioc(4);
+    udp_socket_group group(ioc);
+    if (auto ec = group.open(endpoint(ipv4_address::any(), 5353), 4))
+        throw std::system_error(ec);
+
+    group.start(ioc.get_executor(),
+        [](udp_socket& sock, std::size_t) -> capy::task<>
+        {
+            char buf[1500];
+            endpoint peer;
+            for (;;)
+            {
+                auto [ec, n] = co_await sock.recv_from(
+                    capy::mutable_buffer(buf, sizeof(buf)), peer);
+                if (ec)
+                    co_return;
+                // handle datagram
+            }
+        });
+
+    // one run() per socket
+    std::vector<std::jthread> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.emplace_back([&] { ioc.run(); });
+    @endcode
+
+    @see udp_socket, socket_option::reuse_port
+*/
+class BOOST_COROSIO_DECL udp_socket_group
+{
+    using socket_list = std::vector<udp_socket>;
+
+    capy::execution_context* ctx_;
+    std::shared_ptr<socket_list> sockets_;
+
+    // Keeps the shared f, and so a lambda's captures, alive for as
+    // long as the loop it returned runs, and the sockets alive past
+    // a close() or the group's destruction
+    template<class F>
+    static capy::task<> run_loop(
+        std::shared_ptr<F> f,
+        std::shared_ptr<socket_list> sockets,
+        std::size_t index)
+    {
+        co_await (*f)((*sockets)[index], index);
+    }
+
+public:
+    /** Construct an empty group.
+
+        @param ctx The execution context that will own the sockets.
+    */
+    explicit udp_socket_group(capy::execution_context& ctx) noexcept
+        : ctx_(&ctx)
+    {
+    }
+
+    /** Construct an empty group from an executor.
+
+        @param ex The executor whose context will own the sockets.
+    */
+    template<class Ex>
+        requires(!std::same_as<std::remove_cvref_t<Ex>, udp_socket_group>) &&
+        capy::Executor<Ex>
+    explicit udp_socket_group(Ex const& ex) : udp_socket_group(ex.context())
+    {
+    }
+
+    /// Destroy the group, closing every socket.
+    ~udp_socket_group();
+
+    udp_socket_group(udp_socket_group&&) noexcept            = default;
+    udp_socket_group& operator=(udp_socket_group&&) noexcept = default;
+
+    udp_socket_group(udp_socket_group const&)            = delete;
+    udp_socket_group& operator=(udp_socket_group const&) = delete;
+
+    /** Open and bind the member sockets.
+
+        Opens @p count sockets with `SO_REUSEPORT` and binds each to
+        @p ep. When the port of @p ep is zero, the first socket picks
+        an ephemeral port and the rest bind to that same port.
+
+        Any sockets from a previous call are closed first. On failure
+        every socket is closed and the group is left empty.
+
+        @param ep The local endpoint shared by all sockets.
+        @param count The number of sockets, typically the number of
+            threads calling `run()`.
+
+        @return Error code on failure, empty on success. Platforms
+            without `SO_REUSEPORT` fail here.
+    */
+    [[nodiscard]] std::error_code open(endpoint ep, std::size_t count);
+
+    /** Steer each datagram to the socket matching its receive CPU.
+
+        Attaches a classic BPF program (`SO_ATTACH_REUSEPORT_CBPF`)
+        that selects socket `cpu % size()`. This only changes which
+        socket the kernel queues each datagram on; no shard or
+        receive loop is pinned to a CPU, and the loops still run on
+        the executor passed to @ref start.
+
+        @return Error code on failure, empty on success.
+            `std::errc::operation_not_supported` where the kernel
+            facility does not exist.
+
+        @throws std::logic_error if the group is empty.
+    */
+    [[nodiscard]] std::error_code steer_by_cpu();
+
+    /** Launch one receive loop per socket.
+
+        Calls `f(socket, index)` for each member socket and runs the
+        returned task on @p ex. Loops end when their socket is
+        cancelled or closed.
+
+        The loops share one copy of @p f, destroyed when the last of
+        them ends, so a lambda coroutine may use its captures. They
+        also share ownership of the sockets: after @ref close, or
+        the group's destruction, a loop's socket stays valid (but
+        closed) until the loop returns.
+
+        @param ex The executor to run the loops on.
+        @param f Invocable as `capy::task<>(udp_socket&, std::size_t)`.
+    */
+    template<capy::Executor Ex, class F>
+        requires std::invocable<F&, udp_socket&, std::size_t>
+    void start(Ex const& ex, F f)
+    {
+        auto shared = std::make_shared<F>(std::move(f));
+        for (std::size_t i = 0; i < size(); ++i)
+            capy::run_async(ex)(run_loop(shared, sockets_, i));
+    }
+
+    /// Return the number of member sockets.
+    std::size_t size() const noexcept
+    {
+        return sockets_ ? sockets_->size() : 0;
+    }
+
+    /// Return true if the group has no sockets.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /// Return the member socket at @p index.
+    udp_socket& operator[](std::size_t index) noexcept
+    {
+        return (*sockets_)[index];
+    }
+
+    /// Return the member sockets.
+    std::span<udp_socket> sockets() noexcept
+    {
+        if (!sockets_)
+            return {};
+        return *sockets_;
+    }
+
+    /** Return the endpoint shared by the group.
+
+        @return The local endpoint, or a default endpoint if empty.
+    */
+    endpoint local_endpoint() const noexcept;
+
+    /// Cancel pending operations on every socket.
+    void cancel();
+
+    /** Close every socket and empty the group.
+
+        Running loops complete with an error; the group releases
+        its sockets and each is destroyed once its loop returns.
+    */
+    void close();
+};
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_UDP_SOCKET_GROUP_HPP
@@ -23,6 +23,10 @@ enum class wait_type
     read,
 
     /// Wait until the descriptor is ready for a non-blocking write.
+    /// A stream socket with send-buffer space completes at once; a
+    /// full one waits until the peer drains it (on Windows the wait
+    /// always completes at once). The wait may complete spuriously,
+    /// so a write that then would block should wait again.
     write,
 
     /// Wait until an error condition has been reported by the kernel
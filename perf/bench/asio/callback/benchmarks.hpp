@@ -41,6 +41,9 @@ bench::benchmark_suite make_local_socket_throughput_suite();
 /// Create the Unix socket latency benchmark suite.
 bench::benchmark_suite make_local_socket_latency_suite();
 
+/// Create the datagram (UDP and Unix datagram) benchmark suite.
+bench::benchmark_suite make_datagram_suite();
+
 } // namespace asio_callback_bench
 
 #endif
@@ -0,0 +1,341 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+#include "../datagram_utils.hpp"
+
+#include <boost/asio/buffer.hpp>
+
+#if !defined(_WIN32)
+#include <boost/corosio/test/temp_path.hpp>
+#endif
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace asio = boost::asio;
+using asio_bench::udp_socket;
+
+namespace asio_callback_bench {
+namespace {
+
+constexpr std::size_t oneway_size = 64;
+
+template<class Socket>
+struct dgram_pingpong_op
+{
+    enum phase
+    {
+        send_client,
+        recv_server,
+        send_server,
+        recv_client
+    };
+
+    Socket& client;
+    Socket& server;
+    std::vector<char> send_buf;
+    std::vector<char> recv_buf;
+    std::size_t echoed = 0;
+    bench::state& state;
+    perf::stopwatch sw;
+    phase phase_;
+
+    dgram_pingpong_op(
+        Socket& c, Socket& s, std::size_t message_size, bench::state& st)
+        : client(c)
+        , server(s)
+        , send_buf(message_size, 'P')
+        , recv_buf(message_size)
+        , state(st)
+        , phase_(send_client)
+    {
+    }
+
+    void start()
+    {
+        if (!state.running())
+            return;
+        sw.reset();
+        phase_ = send_client;
+        do_step();
+    }
+
+    void do_step()
+    {
+        switch (phase_)
+        {
+        case send_client:
+            client.async_send(
+                asio::buffer(send_buf),
+                [this](boost::system::error_code ec, std::size_t) {
+                    if (ec)
+                        return;
+                    phase_ = recv_server;
+                    do_step();
+                });
+            break;
+
+        case recv_server:
+            server.async_receive(
+                asio::buffer(recv_buf),
+                [this](boost::system::error_code ec, std::size_t n) {
+                    if (ec)
+                        return;
+                    echoed = n;
+                    phase_ = send_server;
+                    do_step();
+                });
+            break;
+
+        case send_server:
+            server.async_send(
+                asio::buffer(recv_buf.data(), echoed),
+                [this](boost::system::error_code ec, std::size_t) {
+                    if (ec)
+                        return;
+                    phase_ = recv_client;
+                    do_step();
+                });
+            break;
+
+        case recv_client:
+            client.async_receive(
+                asio::buffer(recv_buf),
+                [this](boost::system::error_code ec, std::size_t) {
+                    if (ec)
+                        return;
+                    state.latency().add(sw.elapsed_ns());
+                    state.ops().fetch_add(1, std::memory_order_relaxed);
+                    start();
+                });
+            break;
+        }
+    }
+};
+
+// The last sender to stop cancels the receiver
+template<class Socket>
+struct dgram_sender_op
+{
+    Socket& sender;
+    Socket& receiver;
+    int& live_senders;
+    bench::state& state;
+    std::array<char, oneway_size> buf{};
+
+    void start()
+    {
+        if (!state.running())
+        {
+            if (--live_senders == 0)
+                receiver.cancel();
+            return;
+        }
+        sender.async_send(
+            asio::buffer(buf),
+            [this](boost::system::error_code ec, std::size_t) {
+                if (ec)
+                {
+                    if (--live_senders == 0)
+                        receiver.cancel();
+                    return;
+                }
+                start();
+            });
+    }
+};
+
+template<class Socket>
+struct dgram_receiver_op
+{
+    Socket& receiver;
+    bench::state& state;
+    std::array<char, 2048> buf;
+    std::int64_t datagrams = 0;
+    std::int64_t bytes     = 0;
+
+    void start()
+    {
+        receiver.async_receive(
+            asio::buffer(buf),
+            [this](boost::system::error_code ec, std::size_t n) {
+                if (ec)
+                {
+                    state.add_items(datagrams);
+                    state.add_bytes(bytes);
+                    return;
+                }
+                ++datagrams;
+                bytes += static_cast<std::int64_t>(n);
+                start();
+            });
+    }
+};
+
+void
+run_with_timer(asio::io_context& ioc, bench::state& state)
+{
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        state.stop();
+    });
+
+    perf::stopwatch sw;
+    ioc.run();
+    timer.join();
+
+    state.set_elapsed(sw.elapsed_seconds());
+}
+
+template<class Socket>
+void
+run_fan_in(
+    asio::io_context& ioc,
+    std::deque<Socket>& senders,
+    Socket& receiver,
+    bench::state& state)
+{
+    int live = static_cast<int>(senders.size());
+
+    dgram_receiver_op<Socket> rx{receiver, state};
+    rx.start();
+
+    std::vector<std::unique_ptr<dgram_sender_op<Socket>>> ops;
+    ops.reserve(senders.size());
+    for (auto& s : senders)
+    {
+        ops.push_back(std::make_unique<dgram_sender_op<Socket>>(
+            dgram_sender_op<Socket>{s, receiver, live, state}));
+        ops.back()->start();
+    }
+
+    run_with_timer(ioc, state);
+}
+
+void
+bench_udp_pingpong(bench::state& state)
+{
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    asio::io_context ioc;
+    auto [client, server] = asio_bench::make_udp_pair(ioc);
+
+    dgram_pingpong_op<udp_socket> op(client, server, message_size, state);
+    op.start();
+
+    run_with_timer(ioc, state);
+    client.close();
+    server.close();
+}
+
+void
+bench_udp_fan_in(bench::state& state)
+{
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    asio::io_context ioc;
+    auto receiver = asio_bench::make_udp_socket(ioc);
+
+    std::deque<udp_socket> senders;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(asio_bench::make_udp_socket(ioc));
+        s.connect(receiver.local_endpoint());
+    }
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+
+#if !defined(_WIN32)
+using asio_bench::local_dgram_protocol;
+using asio_bench::local_dgram_socket;
+
+void
+bench_local_pingpong(bench::state& state)
+{
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    asio::io_context ioc;
+    auto [client, server] = asio_bench::make_local_dgram_pair(ioc);
+
+    dgram_pingpong_op<local_dgram_socket> op(
+        client, server, message_size, state);
+    op.start();
+
+    run_with_timer(ioc, state);
+    client.close();
+    server.close();
+}
+
+void
+bench_local_fan_in(bench::state& state)
+{
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    boost::corosio::test::temp_socket_dir tmp;
+    local_dgram_protocol::endpoint ep(tmp.path());
+
+    asio::io_context ioc;
+    local_dgram_socket receiver(ioc.get_executor(), ep);
+
+    std::deque<local_dgram_socket> senders;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(ioc.get_executor());
+        s.open();
+        s.connect(ep);
+    }
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+#endif
+
+} // anonymous namespace
+
+bench::benchmark_suite
+make_datagram_suite()
+{
+    auto suite = bench::benchmark_suite("datagram");
+    suite.add("udp_pingpong", bench_udp_pingpong)
+            .args({1, 64, 1024})
+        .add("udp_oneway", bench_udp_fan_in)
+            .args({1})
+        .add("udp_fan_in", bench_udp_fan_in)
+            .args({4, 16});
+#if !defined(_WIN32)
+    suite.add("local_pingpong", bench_local_pingpong)
+            .args({1, 64, 1024})
+        .add("local_oneway", bench_local_fan_in)
+            .args({1})
+        .add("local_fan_in", bench_local_fan_in)
+            .args({4, 16});
+#endif
+    return suite;
+}
+
+} // namespace asio_callback_bench
@@ -0,0 +1,270 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+#include "../datagram_utils.hpp"
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/buffer.hpp>
+
+#if !defined(_WIN32)
+#include <boost/corosio/test/temp_path.hpp>
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <vector>
+
+namespace asio_bench {
+namespace {
+
+constexpr std::size_t oneway_size = 64;
+
+template<class Socket>
+asio::awaitable<void, executor_type>
+dgram_pingpong_task(
+    Socket& client,
+    Socket& server,
+    std::size_t message_size,
+    std::atomic<bool>& running,
+    bench::state& state)
+{
+    std::vector<char> send_buf(message_size, 'P');
+    std::vector<char> recv_buf(message_size);
+
+    try
+    {
+        while (running.load(std::memory_order_relaxed))
+        {
+            auto lp = state.lap();
+
+            co_await client.async_send(
+                asio::buffer(send_buf), asio::deferred);
+
+            auto n = co_await server.async_receive(
+                asio::buffer(recv_buf), asio::deferred);
+
+            co_await server.async_send(
+                asio::buffer(recv_buf.data(), n), asio::deferred);
+
+            co_await client.async_receive(
+                asio::buffer(recv_buf), asio::deferred);
+        }
+    }
+    catch (std::exception const&)
+    {
+    }
+}
+
+template<class Socket>
+asio::awaitable<void, executor_type>
+dgram_sender_task(
+    Socket& sender,
+    Socket& receiver,
+    int& live_senders,
+    std::atomic<bool>& running)
+{
+    std::array<char, oneway_size> buf{};
+    try
+    {
+        while (running.load(std::memory_order_relaxed))
+            co_await sender.async_send(asio::buffer(buf), asio::deferred);
+    }
+    catch (std::exception const&)
+    {
+    }
+    if (--live_senders == 0)
+        receiver.cancel();
+}
+
+template<class Socket>
+asio::awaitable<void, executor_type>
+dgram_receiver_task(Socket& receiver, bench::state& state)
+{
+    std::array<char, 2048> buf;
+    std::int64_t datagrams = 0;
+    std::int64_t bytes     = 0;
+    try
+    {
+        for (;;)
+        {
+            auto n = co_await receiver.async_receive(
+                asio::buffer(buf), asio::deferred);
+            ++datagrams;
+            bytes += static_cast<std::int64_t>(n);
+        }
+    }
+    catch (std::exception const&)
+    {
+    }
+    state.add_items(datagrams);
+    state.add_bytes(bytes);
+}
+
+void
+run_with_timer(
+    asio::io_context& ioc, std::atomic<bool>& running, bench::state& state)
+{
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        running.store(false, std::memory_order_relaxed);
+    });
+
+    perf::stopwatch sw;
+    ioc.run();
+    timer.join();
+
+    state.set_elapsed(sw.elapsed_seconds());
+}
+
+template<class Socket>
+void
+run_fan_in(
+    asio::io_context& ioc,
+    std::deque<Socket>& senders,
+    Socket& receiver,
+    bench::state& state)
+{
+    std::atomic<bool> running{true};
+    int live = static_cast<int>(senders.size());
+
+    asio::co_spawn(
+        ioc, dgram_receiver_task(receiver, state), asio::detached);
+    for (auto& s : senders)
+        asio::co_spawn(
+            ioc, dgram_sender_task(s, receiver, live, running),
+            asio::detached);
+
+    run_with_timer(ioc, running, state);
+}
+
+void
+bench_udp_pingpong(bench::state& state)
+{
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    asio::io_context ioc;
+    auto [client, server] = make_udp_pair(ioc);
+
+    std::atomic<bool> running{true};
+    asio::co_spawn(
+        ioc,
+        dgram_pingpong_task(client, server, message_size, running, state),
+        asio::detached);
+
+    run_with_timer(ioc, running, state);
+    client.close();
+    server.close();
+}
+
+void
+bench_udp_fan_in(bench::state& state)
+{
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    asio::io_context ioc;
+    auto receiver = make_udp_socket(ioc);
+
+    std::deque<udp_socket> senders;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(make_udp_socket(ioc));
+        s.connect(receiver.local_endpoint());
+    }
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+
+#if !defined(_WIN32)
+void
+bench_local_pingpong(bench::state& state)
+{
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    asio::io_context ioc;
+    auto [client, server] = make_local_dgram_pair(ioc);
+
+    std::atomic<bool> running{true};
+    asio::co_spawn(
+        ioc,
+        dgram_pingpong_task(client, server, message_size, running, state),
+        asio::detached);
+
+    run_with_timer(ioc, running, state);
+    client.close();
+    server.close();
+}
+
+void
+bench_local_fan_in(bench::state& state)
+{
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    boost::corosio::test::temp_socket_dir tmp;
+    local_dgram_protocol::endpoint ep(tmp.path());
+
+    asio::io_context ioc;
+    local_dgram_socket receiver(ioc.get_executor(), ep);
+
+    std::deque<local_dgram_socket> senders;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(ioc.get_executor());
+        s.open();
+        s.connect(ep);
+    }
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+#endif
+
+} // anonymous namespace
+
+bench::benchmark_suite
+make_datagram_suite()
+{
+    auto suite = bench::benchmark_suite("datagram");
+    suite.add("udp_pingpong", bench_udp_pingpong)
+            .args({1, 64, 1024})
+        .add("udp_oneway", bench_udp_fan_in)
+            .args({1})
+        .add("udp_fan_in", bench_udp_fan_in)
+            .args({4, 16});
+#if !defined(_WIN32)
+    suite.add("local_pingpong", bench_local_pingpong)
+            .args({1, 64, 1024})
+        .add("local_oneway", bench_local_fan_in)
+            .args({1})
+        .add("local_fan_in", bench_local_fan_in)
+            .args({4, 16});
+#endif
+    return suite;
+}
+
+} // namespace asio_bench
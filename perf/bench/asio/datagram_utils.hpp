@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef ASIO_BENCH_DATAGRAM_UTILS_HPP
+#define ASIO_BENCH_DATAGRAM_UTILS_HPP
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#if !defined(_WIN32)
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/datagram_protocol.hpp>
+#endif
+
+#include <utility>
+
+namespace asio_bench {
+
+namespace asio = boost::asio;
+using udp      = asio::ip::udp;
+
+using executor_type = asio::io_context::executor_type;
+using udp_socket    = asio::basic_datagram_socket<udp, executor_type>;
+
+/** Open a UDP socket bound to an ephemeral loopback port with a
+    large receive queue, matching the corosio datagram benchmarks.
+*/
+inline udp_socket
+make_udp_socket(asio::io_context& ioc)
+{
+    udp_socket s(ioc.get_executor(), udp::endpoint(
+        asio::ip::address_v4::loopback(), 0));
+    s.set_option(asio::socket_base::receive_buffer_size(8 << 20));
+    return s;
+}
+
+/** Create a pair of UDP sockets connected to each other. */
+inline std::pair<udp_socket, udp_socket>
+make_udp_pair(asio::io_context& ioc)
+{
+    auto a = make_udp_socket(ioc);
+    auto b = make_udp_socket(ioc);
+    a.connect(b.local_endpoint());
+    b.connect(a.local_endpoint());
+    return {std::move(a), std::move(b)};
+}
+
+#if !defined(_WIN32)
+using local_dgram_protocol = asio::local::datagram_protocol;
+using local_dgram_socket =
+    asio::basic_datagram_socket<local_dgram_protocol, executor_type>;
+
+/** Create a connected pair of Unix datagram sockets. */
+inline std::pair<local_dgram_socket, local_dgram_socket>
+make_local_dgram_pair(asio::io_context& ioc)
+{
+    local_dgram_socket s1(ioc.get_executor());
+    local_dgram_socket s2(ioc.get_executor());
+    asio::local::connect_pair(s1, s2);
+    return {std::move(s1), std::move(s2)};
+}
+#endif
+
+} // namespace asio_bench
+
+#endif
@@ -78,6 +78,34 @@ bench::benchmark_suite make_local_socket_throughput_suite();
 template<auto Backend>
 bench::benchmark_suite make_local_socket_latency_suite();
 
+/** Create the UDP throughput benchmark suite.
+
+    @tparam Backend A backend tag value (e.g., `epoll`).
+*/
+template<auto Backend>
+bench::benchmark_suite make_udp_throughput_suite();
+
+/** Create the socket relay (splice vs. copy) benchmark suite.
+
+    @tparam Backend A backend tag value (e.g., `epoll`).
+*/
+template<auto Backend>
+bench::benchmark_suite make_relay_suite();
+
+/** Create the datagram (UDP and Unix datagram) benchmark suite.
+
+    @tparam Backend A backend tag value (e.g., `epoll`).
+*/
+template<auto Backend>
+bench::benchmark_suite make_datagram_suite();
+
+/** Create the file I/O benchmark suite.
+
+    @tparam Backend A backend tag value (e.g., `epoll`).
+*/
+template<auto Backend>
+bench::benchmark_suite make_file_io_suite();
+
 } // namespace corosio_bench
 
 #endif
@@ -0,0 +1,342 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+#include <boost/corosio/detail/platform.hpp>
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/native/native_socket_option.hpp>
+#include <boost/corosio/native/native_udp_socket.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#if BOOST_COROSIO_POSIX
+#include <boost/corosio/local_connect_pair.hpp>
+#include <boost/corosio/local_endpoint.hpp>
+#include <boost/corosio/native/native_local_datagram_socket.hpp>
+#include <boost/corosio/test/temp_path.hpp>
+#endif
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "../../common/native_includes.hpp"
+
+namespace corosio = boost::corosio;
+namespace capy    = boost::capy;
+
+namespace corosio_bench {
+namespace {
+
+constexpr std::size_t oneway_size = 64;
+
+/* Both sockets are connected, so one round trip is
+   send, recv, send, recv with no per-datagram addressing. */
+template<class Socket>
+capy::task<>
+dgram_pingpong_task(
+    Socket& client,
+    Socket& server,
+    std::size_t message_size,
+    bench::state& state)
+{
+    std::vector<char> send_buf(message_size, 'P');
+    std::vector<char> recv_buf(message_size);
+
+    while (state.running())
+    {
+        auto lp = state.lap();
+
+        auto [ec1, n1] = co_await client.send(
+            capy::const_buffer(send_buf.data(), send_buf.size()));
+        if (ec1)
+            co_return;
+
+        auto [ec2, n2] = co_await server.recv(
+            capy::mutable_buffer(recv_buf.data(), recv_buf.size()));
+        if (ec2)
+            co_return;
+
+        auto [ec3, n3] = co_await server.send(
+            capy::const_buffer(recv_buf.data(), n2));
+        if (ec3)
+            co_return;
+
+        auto [ec4, n4] = co_await client.recv(
+            capy::mutable_buffer(recv_buf.data(), recv_buf.size()));
+        if (ec4)
+            co_return;
+    }
+}
+
+/* The last sender to stop cancels the receiver, so the receiver
+   counts everything delivered while any sender was running. */
+template<class Socket>
+capy::task<>
+dgram_sender_task(
+    Socket& sender,
+    Socket& receiver,
+    int& live_senders,
+    bench::state& state)
+{
+    std::array<char, oneway_size> buf{};
+    while (state.running())
+    {
+        auto [ec, n] =
+            co_await sender.send(capy::const_buffer(buf.data(), buf.size()));
+        if (ec)
+            break;
+    }
+    if (--live_senders == 0)
+        receiver.cancel();
+}
+
+template<class Socket>
+capy::task<>
+dgram_receiver_task(Socket& receiver, bench::state& state)
+{
+    std::array<char, 2048> buf;
+    std::int64_t datagrams = 0;
+    std::int64_t bytes     = 0;
+    for (;;)
+    {
+        auto [ec, n] = co_await receiver.recv(
+            capy::mutable_buffer(buf.data(), buf.size()));
+        if (ec)
+            break;
+        ++datagrams;
+        bytes += static_cast<std::int64_t>(n);
+    }
+    state.add_items(datagrams);
+    state.add_bytes(bytes);
+}
+
+template<class Socket, class Endpoint>
+capy::task<>
+dgram_connect_task(Socket& s, Endpoint ep, std::error_code& ec_out)
+{
+    auto [ec] = co_await s.connect(ep);
+    if (ec)
+        ec_out = ec;
+}
+
+template<auto Backend>
+void
+run_with_timer(corosio::native_io_context<Backend>& ioc, bench::state& state)
+{
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        state.stop();
+    });
+
+    perf::stopwatch sw;
+    ioc.run();
+    timer.join();
+
+    state.set_elapsed(sw.elapsed_seconds());
+}
+
+/* Run `senders` connected senders against one receiver for the
+   configured duration. */
+template<auto Backend, class Socket>
+void
+run_fan_in(
+    corosio::native_io_context<Backend>& ioc,
+    std::deque<Socket>& senders,
+    Socket& receiver,
+    bench::state& state)
+{
+    int live = static_cast<int>(senders.size());
+    capy::run_async(ioc.get_executor())(
+        dgram_receiver_task(receiver, state));
+    for (auto& s : senders)
+        capy::run_async(ioc.get_executor())(
+            dgram_sender_task(s, receiver, live, state));
+
+    run_with_timer(ioc, state);
+}
+
+template<auto Backend>
+void
+open_udp(corosio::native_udp_socket<Backend>& s)
+{
+    s.open();
+    s.set_option(corosio::native_socket_option::receive_buffer_size(8 << 20));
+    if (auto ec = s.bind(
+            corosio::endpoint(corosio::ipv4_address::loopback(), 0)))
+        throw std::system_error(ec, "bind");
+}
+
+template<auto Backend>
+void
+bench_udp_pingpong(bench::state& state)
+{
+    using socket_type = corosio::native_udp_socket<Backend>;
+
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    corosio::native_io_context<Backend> ioc;
+    socket_type client(ioc), server(ioc);
+    open_udp(client);
+    open_udp(server);
+
+    std::error_code ec;
+    capy::run_async(ioc.get_executor())(
+        dgram_connect_task(client, server.local_endpoint(), ec));
+    capy::run_async(ioc.get_executor())(
+        dgram_connect_task(server, client.local_endpoint(), ec));
+    ioc.run();
+    ioc.restart();
+    if (ec)
+        throw std::system_error(ec, "connect");
+
+    capy::run_async(ioc.get_executor())(
+        dgram_pingpong_task(client, server, message_size, state));
+
+    run_with_timer(ioc, state);
+    client.close();
+    server.close();
+}
+
+/* Loopback UDP drops silently when the receive queue is full, so
+   the reported rate is datagrams received, not datagrams sent. */
+template<auto Backend>
+void
+bench_udp_fan_in(bench::state& state)
+{
+    using socket_type = corosio::native_udp_socket<Backend>;
+
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    corosio::native_io_context<Backend> ioc;
+    socket_type receiver(ioc);
+    open_udp(receiver);
+
+    std::deque<socket_type> senders;
+    std::error_code ec;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(ioc);
+        open_udp(s);
+        capy::run_async(ioc.get_executor())(
+            dgram_connect_task(s, receiver.local_endpoint(), ec));
+    }
+    ioc.run();
+    ioc.restart();
+    if (ec)
+        throw std::system_error(ec, "connect");
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+
+#if BOOST_COROSIO_POSIX
+template<auto Backend>
+void
+bench_local_pingpong(bench::state& state)
+{
+    using socket_type = corosio::native_local_datagram_socket<Backend>;
+
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    corosio::native_io_context<Backend> ioc;
+    socket_type client(ioc), server(ioc);
+    if (auto ec = corosio::connect_pair(client, server))
+        throw std::system_error(ec, "connect_pair");
+
+    capy::run_async(ioc.get_executor())(
+        dgram_pingpong_task(client, server, message_size, state));
+
+    run_with_timer(ioc, state);
+    client.close();
+    server.close();
+}
+
+/* Unix datagram sockets apply backpressure instead of dropping, so
+   senders park on a full receive queue and nothing is lost. */
+template<auto Backend>
+void
+bench_local_fan_in(bench::state& state)
+{
+    using socket_type = corosio::native_local_datagram_socket<Backend>;
+
+    int num_senders = static_cast<int>(state.range(0));
+    state.counters["senders"] = num_senders;
+
+    corosio::test::temp_socket_dir tmp;
+    corosio::local_endpoint ep(tmp.path());
+
+    corosio::native_io_context<Backend> ioc;
+    socket_type receiver(ioc);
+    receiver.open();
+    if (auto ec = receiver.bind(ep))
+        throw std::system_error(ec, "bind");
+
+    std::deque<socket_type> senders;
+    std::error_code ec;
+    for (int i = 0; i < num_senders; ++i)
+    {
+        auto& s = senders.emplace_back(ioc);
+        capy::run_async(ioc.get_executor())(dgram_connect_task(s, ep, ec));
+    }
+    ioc.run();
+    ioc.restart();
+    if (ec)
+        throw std::system_error(ec, "connect");
+
+    run_fan_in(ioc, senders, receiver, state);
+
+    for (auto& s : senders)
+        s.close();
+    receiver.close();
+}
+#endif
+
+} // anonymous namespace
+
+template<auto Backend>
+bench::benchmark_suite
+make_datagram_suite()
+{
+    // oneway is fan_in with a single sender: packets per second
+    auto suite = bench::benchmark_suite("datagram");
+    suite.add("udp_pingpong", bench_udp_pingpong<Backend>)
+            .args({1, 64, 1024})
+        .add("udp_oneway", bench_udp_fan_in<Backend>)
+            .args({1})
+        .add("udp_fan_in", bench_udp_fan_in<Backend>)
+            .args({4, 16});
+#if BOOST_COROSIO_POSIX
+    suite.add("local_pingpong", bench_local_pingpong<Backend>)
+            .args({1, 64, 1024})
+        .add("local_oneway", bench_local_fan_in<Backend>)
+            .args({1})
+        .add("local_fan_in", bench_local_fan_in<Backend>)
+            .args({4, 16});
+#endif
+    return suite;
+}
+
+} // namespace corosio_bench
+
+COROSIO_SUITE_INSTANTIATE(corosio_bench::make_datagram_suite)
@@ -0,0 +1,411 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+
+#include <boost/corosio/aligned_allocator.hpp>
+#include <boost/corosio/file_base.hpp>
+#include <boost/corosio/group_commit_file.hpp>
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/native/native_random_access_file.hpp>
+#include <boost/corosio/native/native_stream_file.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../../common/native_includes.hpp"
+
+namespace corosio = boost::corosio;
+namespace capy    = boost::capy;
+
+namespace corosio_bench {
+namespace {
+
+/* Files go in COROSIO_BENCH_FILE_DIR when set, else the system temp
+   directory. Point it at a real disk: on tmpfs there is no device
+   behind the page cache, so the cold and fsync numbers mean nothing.
+
+   Every benchmark runs once per backend; compare `--backend epoll`
+   (blocking calls on the thread pool) against `--backend io_uring`. */
+
+constexpr std::uint64_t data_file_size  = 64 * 1024 * 1024;
+constexpr std::uint64_t write_file_size = 256 * 1024 * 1024;
+constexpr std::size_t block_size        = 4096;
+
+using aligned_buffer = std::vector<char, corosio::aligned_allocator<char>>;
+
+std::filesystem::path
+bench_dir()
+{
+    if (char const* dir = std::getenv("COROSIO_BENCH_FILE_DIR"))
+        return dir;
+    return std::filesystem::temp_directory_path();
+}
+
+// Uniquely named file, removed on destruction.
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file()
+    {
+        static std::atomic<int> counter{0};
+        path = bench_dir() /
+            ("corosio_file_bench_" + std::to_string(counter++) + ".bin");
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+// Fill the file with size bytes of non-zero data.
+void
+fill(std::filesystem::path const& path, std::uint64_t size)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    std::vector<char> chunk(1024 * 1024);
+    for (std::size_t i = 0; i < chunk.size(); ++i)
+        chunk[i] = static_cast<char>('a' + i % 26);
+    for (std::uint64_t left = size; left > 0;)
+    {
+        auto n = static_cast<std::size_t>(
+            (std::min<std::uint64_t>)(left, chunk.size()));
+        out.write(chunk.data(), static_cast<std::streamsize>(n));
+        left -= n;
+    }
+    if (!out)
+        throw std::system_error(
+            std::make_error_code(std::errc::io_error), "fill");
+}
+
+/* Evict the file from the page cache. Dirty pages are written back
+   first, since DONTNEED skips them. Returns false where this is not
+   possible, in which case the "cold" runs are hot. */
+bool
+drop_cache(corosio::file_base::native_handle_type fd)
+{
+#if defined(__linux__)
+    ::fdatasync(fd);
+    return ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+
+// Read the whole file front to back in chunks of range(0) bytes,
+// starting over at the end. Cold evicts the file before every pass.
+template<auto Backend, bool Cold>
+void
+bench_sequential_read(bench::state& state)
+{
+    using file_type = corosio::native_stream_file<Backend>;
+
+    auto chunk_size = static_cast<std::size_t>(state.range(0));
+    state.counters["chunk_size"] = static_cast<double>(chunk_size);
+
+    temp_file tmp;
+    fill(tmp.path, data_file_size);
+
+    corosio::native_io_context<Backend> ioc;
+    file_type f(ioc);
+    f.open(tmp.path, corosio::file_base::read_only);
+
+    aligned_buffer buf(chunk_size);
+    int64_t passes = 0;
+    bool evicted   = false;
+
+    auto task = [&]() -> capy::task<> {
+        while (state.running())
+        {
+            if (Cold)
+                evicted = drop_cache(f.native_handle());
+            for (;;)
+            {
+                auto [ec, n] = co_await f.read_some(
+                    capy::mutable_buffer(buf.data(), buf.size()));
+                state.add_bytes(static_cast<int64_t>(n));
+                if (ec == capy::cond::eof)
+                    break;
+                if (ec)
+                    co_return;
+                if (!state.running())
+                    co_return;
+            }
+            f.seek(0);
+            ++passes;
+        }
+    };
+
+    capy::run_async(ioc.get_executor())(task());
+    auto sw = state.start_timer_thread();
+    ioc.run();
+
+    state.set_elapsed(sw.elapsed_seconds());
+    state.counters["passes"] = static_cast<double>(passes);
+    if (Cold)
+        state.counters["evicted"] = evicted ? 1.0 : 0.0;
+}
+
+// Write chunks of range(0) bytes, wrapping at write_file_size. No
+// flush, so this measures the path into the page cache.
+template<auto Backend>
+void
+bench_sequential_write(bench::state& state)
+{
+    using file_type = corosio::native_stream_file<Backend>;
+
+    auto chunk_size = static_cast<std::size_t>(state.range(0));
+    state.counters["chunk_size"] = static_cast<double>(chunk_size);
+
+    temp_file tmp;
+    corosio::native_io_context<Backend> ioc;
+    file_type f(ioc);
+    f.open(
+        tmp.path,
+        corosio::file_base::write_only | corosio::file_base::create |
+            corosio::file_base::truncate);
+
+    aligned_buffer buf(chunk_size, 'x');
+    std::uint64_t pos = 0;
+
+    auto task = [&]() -> capy::task<> {
+        while (state.running())
+        {
+            auto [ec, n] = co_await f.write_some(
+                capy::const_buffer(buf.data(), buf.size()));
+            if (ec)
+                co_return;
+            state.add_bytes(static_cast<int64_t>(n));
+            pos += n;
+            if (pos >= write_file_size)
+            {
+                f.seek(0);
+                pos = 0;
+            }
+        }
+    };
+
+    capy::run_async(ioc.get_executor())(task());
+    auto sw = state.start_timer_thread();
+    ioc.run();
+
+    state.set_elapsed(sw.elapsed_seconds());
+}
+
+/* range(0) coroutines each keep one 4K read in flight at a random
+   aligned offset, so the queue depth is the coroutine count. Cold
+   opens the file with file_base::direct so every read reaches the
+   device; where direct I/O is refused it evicts the file once
+   instead, which only holds until the file is read back in. */
+template<auto Backend, bool Cold>
+void
+bench_random_read(bench::state& state)
+{
+    using file_type = corosio::native_random_access_file<Backend>;
+
+    int depth = static_cast<int>(state.range(0));
+    state.counters["queue_depth"] = depth;
+
+    temp_file tmp;
+    fill(tmp.path, data_file_size);
+
+    corosio::native_io_context<Backend> ioc;
+    file_type f(ioc);
+    bool direct = false;
+    if (Cold)
+    {
+        try
+        {
+            f.open(
+                tmp.path,
+                corosio::file_base::read_only | corosio::file_base::direct);
+            direct = true;
+        }
+        catch (std::system_error const&)
+        {
+        }
+    }
+    if (!direct)
+        f.open(tmp.path, corosio::file_base::read_only);
+    if (Cold)
+    {
+        state.counters["direct"] = direct ? 1.0 : 0.0;
+        if (!direct)
+            state.counters["evicted"] =
+                drop_cache(f.native_handle()) ? 1.0 : 0.0;
+    }
+
+    constexpr std::uint64_t blocks = data_file_size / block_size;
+
+    auto reader = [&](unsigned seed) -> capy::task<> {
+        std::minstd_rand rng(seed);
+        std::uniform_int_distribution<std::uint64_t> pick(0, blocks - 1);
+        aligned_buffer buf(block_size);
+        while (state.running())
+        {
+            auto lap     = state.lap();
+            auto [ec, n] = co_await f.read_some_at(
+                pick(rng) * block_size,
+                capy::mutable_buffer(buf.data(), buf.size()));
+            if (ec)
+                co_return;
+            state.add_bytes(static_cast<int64_t>(n));
+        }
+    };
+
+    for (int i = 0; i < depth; ++i)
+        capy::run_async(ioc.get_executor())(
+            reader(static_cast<unsigned>(i + 1)));
+    auto sw = state.start_timer_thread();
+    ioc.run();
+
+    state.set_elapsed(sw.elapsed_seconds());
+    state.add_items(state.total_ops());
+}
+
+// Append a range(0)-byte record, then sync_data, one at a time:
+// the per-record durability cost a write-ahead log pays.
+template<auto Backend>
+void
+bench_append_fsync(bench::state& state)
+{
+    using file_type = corosio::native_stream_file<Backend>;
+
+    auto record_size = static_cast<std::size_t>(state.range(0));
+    state.counters["record_size"] = static_cast<double>(record_size);
+
+    temp_file tmp;
+    corosio::native_io_context<Backend> ioc;
+    file_type f(ioc);
+    f.open(
+        tmp.path,
+        corosio::file_base::write_only | corosio::file_base::create |
+            corosio::file_base::truncate | corosio::file_base::append);
+
+    std::vector<char> rec(record_size, 'r');
+
+    auto task = [&]() -> capy::task<> {
+        while (state.running())
+        {
+            auto lap     = state.lap();
+            auto [ec, n] = co_await f.write_some(
+                capy::const_buffer(rec.data(), rec.size()));
+            if (ec)
+                co_return;
+            f.sync_data();
+            state.add_bytes(static_cast<int64_t>(n));
+        }
+    };
+
+    capy::run_async(ioc.get_executor())(task());
+    auto sw = state.start_timer_thread();
+    ioc.run();
+
+    state.set_elapsed(sw.elapsed_seconds());
+    state.add_items(state.total_ops());
+}
+
+// range(0) coroutines appending 128-byte records through a
+// group_commit_file, which shares one flush per batch.
+template<auto Backend>
+void
+bench_group_commit(bench::state& state)
+{
+    int appenders = static_cast<int>(state.range(0));
+    state.counters["appenders"] = appenders;
+
+    temp_file tmp;
+    corosio::native_io_context<Backend> ioc;
+    corosio::group_commit_file f(ioc);
+    f.open(
+        tmp.path,
+        corosio::file_base::write_only | corosio::file_base::create |
+            corosio::file_base::truncate);
+
+    std::vector<char> rec(128, 'r');
+
+    auto appender = [&]() -> capy::task<> {
+        while (state.running())
+        {
+            auto lap     = state.lap();
+            auto [ec, n] = co_await f.append(
+                capy::const_buffer(rec.data(), rec.size()));
+            if (ec)
+                co_return;
+            state.add_bytes(static_cast<int64_t>(rec.size()));
+        }
+    };
+
+    for (int i = 0; i < appenders; ++i)
+        capy::run_async(ioc.get_executor())(appender());
+    auto sw = state.start_timer_thread();
+    ioc.run();
+
+    state.set_elapsed(sw.elapsed_seconds());
+    state.add_items(state.total_ops());
+
+    auto stats = f.stats();
+    if (stats.batches > 0)
+        state.counters["records_per_batch"] =
+            static_cast<double>(stats.records) /
+            static_cast<double>(stats.batches);
+}
+
+} // anonymous namespace
+
+template<auto Backend>
+bench::benchmark_suite
+make_file_io_suite()
+{
+    using F = bench::bench_flags;
+
+    return bench::benchmark_suite("file_io", F::none)
+        .add("seq_read_hot", bench_sequential_read<Backend, false>)
+            .range(4096, 1048576, 16)
+        .add("seq_read_cold", bench_sequential_read<Backend, true>)
+            .range(4096, 1048576, 16)
+        .add("seq_write", bench_sequential_write<Backend>)
+            .range(4096, 1048576, 16)
+        .add("rand_read_4k_hot", bench_random_read<Backend, false>)
+            .args({1, 4, 16, 64})
+        .add("rand_read_4k_cold", bench_random_read<Backend, true>)
+            .args({1, 4, 16, 64})
+        .add("append_fsync", bench_append_fsync<Backend>)
+            .args({64, 512, 4096})
+        .add("group_commit", bench_group_commit<Backend>)
+            .args({1, 16, 64});
+}
+
+} // namespace corosio_bench
+
+COROSIO_SUITE_INSTANTIATE(corosio_bench::make_file_io_suite)
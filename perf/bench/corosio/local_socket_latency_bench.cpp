@@ -18,6 +18,7 @@
 #include <boost/corosio/local_stream_socket.hpp>
 #include <boost/corosio/native/native_local_stream_acceptor.hpp>
 #include <boost/corosio/native/native_local_stream_socket.hpp>
+#include <boost/corosio/shm_channel.hpp>
 #include <boost/capy/buffers.hpp>
 #include <boost/capy/ex/run_async.hpp>
 #include <boost/capy/read.hpp>
@@ -243,6 +244,140 @@ bench_unix_concurrent_latency_lockless(bench::state& state)
         s.close();
 }
 
+#if defined(__linux__)
+capy::task<capy::io_result<std::size_t>>
+shm_read_exact(corosio::shm_channel& ch, char* data, std::size_t size)
+{
+    std::size_t got = 0;
+    while (got < size)
+    {
+        auto [ec, n] = co_await ch.recv(
+            capy::mutable_buffer(data + got, size - got));
+        if (ec)
+            co_return {ec, got};
+        got += n;
+    }
+    co_return {{}, got};
+}
+
+capy::task<capy::io_result<std::size_t>>
+shm_write_exact(corosio::shm_channel& ch, char const* data, std::size_t size)
+{
+    std::size_t put = 0;
+    while (put < size)
+    {
+        auto [ec, n] = co_await ch.send(
+            capy::const_buffer(data + put, size - put));
+        if (ec)
+            co_return {ec, put};
+        put += n;
+    }
+    co_return {{}, put};
+}
+
+// Same four-step round trip as unix_pingpong_client_task, over
+// shared-memory rings instead of socket buffers.
+capy::task<>
+shm_pingpong_client_task(
+    corosio::shm_channel& client,
+    corosio::shm_channel& server,
+    std::size_t message_size,
+    bench::state& state)
+{
+    std::vector<char> send_buf(message_size, 'P');
+    std::vector<char> recv_buf(message_size);
+
+    while (state.running())
+    {
+        auto lp = state.lap();
+
+        auto [ec1, n1] = co_await shm_write_exact(
+            client, send_buf.data(), send_buf.size());
+        if (ec1)
+            co_return;
+
+        auto [ec2, n2] = co_await shm_read_exact(
+            server, recv_buf.data(), recv_buf.size());
+        if (ec2)
+            co_return;
+
+        auto [ec3, n3] = co_await shm_write_exact(
+            server, recv_buf.data(), n2);
+        if (ec3)
+            co_return;
+
+        auto [ec4, n4] = co_await shm_read_exact(
+            client, recv_buf.data(), recv_buf.size());
+        if (ec4)
+            co_return;
+    }
+}
+
+capy::task<>
+shm_create_task(
+    corosio::shm_channel& ch,
+    corosio::local_stream_socket s,
+    std::error_code& ec_out)
+{
+    auto [ec] = co_await ch.create(std::move(s), 64 * 1024);
+    ec_out    = ec;
+}
+
+capy::task<>
+shm_accept_task(
+    corosio::shm_channel& ch,
+    corosio::local_stream_socket s,
+    std::error_code& ec_out)
+{
+    auto [ec] = co_await ch.accept(std::move(s));
+    ec_out    = ec;
+}
+
+template<auto Backend>
+void
+bench_shm_pingpong_latency(bench::state& state)
+{
+    auto message_size = static_cast<std::size_t>(state.range(0));
+    state.counters["message_size"] = static_cast<double>(message_size);
+
+    // The channel doorbells are plain sockets; only the context is native
+    corosio::native_io_context<Backend> ioc;
+    corosio::local_stream_socket a(ioc), b(ioc);
+    if (auto ec = corosio::connect_pair(a, b))
+        throw std::system_error(ec, "connect_pair");
+
+    corosio::shm_channel client(ioc), server(ioc);
+    std::error_code create_ec, accept_ec;
+    capy::run_async(ioc.get_executor())(
+        shm_create_task(client, std::move(a), create_ec));
+    capy::run_async(ioc.get_executor())(
+        shm_accept_task(server, std::move(b), accept_ec));
+    ioc.run();
+    ioc.restart();
+    if (create_ec)
+        throw std::system_error(create_ec, "shm_channel::create");
+    if (accept_ec)
+        throw std::system_error(accept_ec, "shm_channel::accept");
+
+    capy::run_async(ioc.get_executor())(
+        shm_pingpong_client_task(client, server, message_size, state));
+
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        state.stop();
+    });
+
+    perf::stopwatch sw;
+    ioc.run();
+    timer.join();
+
+    state.set_elapsed(sw.elapsed_seconds());
+    client.close();
+    server.close();
+}
+#endif
+
 } // anonymous namespace
 
 template<auto Backend>
@@ -259,7 +394,12 @@ make_local_socket_latency_suite()
         .add("concurrent", bench_unix_concurrent_latency<Backend>)
             .args({1, 4, 16})
         .add("concurrent_lockless", bench_unix_concurrent_latency_lockless<Backend>)
-            .args({1, 4, 16});
+            .args({1, 4, 16})
+#if defined(__linux__)
+        .add("shm_pingpong", bench_shm_pingpong_latency<Backend>)
+            .args({1, 64, 1024})
+#endif
+        ;
 }
 
 } // namespace corosio_bench
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+#include <boost/corosio/detail/platform.hpp>
+#include "../../common/native_includes.hpp"
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/local_connect_pair.hpp>
+#include <boost/corosio/local_stream_socket.hpp>
+#include <boost/corosio/native/native_local_stream_acceptor.hpp>
+#include <boost/corosio/native/native_local_stream_socket.hpp>
+#include <boost/corosio/relay.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace corosio = boost::corosio;
+namespace capy    = boost::capy;
+
+namespace corosio_bench {
+namespace {
+
+/* writer -> [in | relay | out] -> reader, one direction.
+
+   Splice moves the payload through a kernel pipe; copy reads it into
+   a user buffer and writes it back out. Both run on the same loop,
+   so the cpu_ms_per_gib counter shows the CPU saved per gigabyte. */
+template<auto Backend, bool Splice>
+void
+bench_relay(bench::state& state)
+{
+    using socket_type = corosio::native_local_stream_socket<Backend>;
+
+    auto chunk_size = static_cast<std::size_t>(state.range(0));
+    state.counters["chunk_size"] = static_cast<double>(chunk_size);
+
+    corosio::native_io_context<Backend> ioc;
+    socket_type writer(ioc), in(ioc), out(ioc), reader(ioc);
+    if (auto ec = corosio::connect_pair(writer, in))
+        throw std::system_error(ec, "connect_pair");
+    if (auto ec = corosio::connect_pair(out, reader))
+        throw std::system_error(ec, "connect_pair");
+
+    std::vector<char> write_buf(chunk_size, 'x');
+    std::vector<char> read_buf(chunk_size);
+
+    std::atomic<bool> running{true};
+    int64_t total_bytes = 0;
+    std::size_t relayed = 0;
+
+    auto write_task = [&]() -> capy::task<> {
+        while (running.load(std::memory_order_relaxed))
+        {
+            auto [ec, n] = co_await writer.write_some(
+                capy::const_buffer(write_buf.data(), chunk_size));
+            if (ec)
+                break;
+        }
+        writer.shutdown(corosio::local_stream_socket::shutdown_send);
+    };
+
+    auto relay_task = [&]() -> capy::task<> {
+        if constexpr (Splice)
+            (void)co_await corosio::detail::relay_one(in, out, relayed);
+        else
+            (void)co_await corosio::detail::relay_copy(in, out, relayed);
+    };
+
+    auto read_task = [&]() -> capy::task<> {
+        for (;;)
+        {
+            auto [ec, n] = co_await reader.read_some(
+                capy::mutable_buffer(read_buf.data(), read_buf.size()));
+            if (ec || n == 0)
+                break;
+            total_bytes += static_cast<int64_t>(n);
+        }
+    };
+
+    perf::stopwatch sw;
+    std::clock_t cpu0 = std::clock();
+
+    capy::run_async(ioc.get_executor())(write_task());
+    capy::run_async(ioc.get_executor())(relay_task());
+    capy::run_async(ioc.get_executor())(read_task());
+
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        running.store(false, std::memory_order_relaxed);
+    });
+
+    ioc.run();
+    timer.join();
+
+    double cpu_ms = 1000.0 * static_cast<double>(std::clock() - cpu0) /
+        CLOCKS_PER_SEC;
+    double gib = static_cast<double>(total_bytes) / (1024.0 * 1024 * 1024);
+
+    state.set_elapsed(sw.elapsed_seconds());
+    state.add_bytes(total_bytes);
+    if (gib > 0)
+        state.counters["cpu_ms_per_gib"] = cpu_ms / gib;
+
+    writer.close();
+    in.close();
+    out.close();
+    reader.close();
+}
+
+} // anonymous namespace
+
+template<auto Backend>
+bench::benchmark_suite
+make_relay_suite()
+{
+    using F = bench::bench_flags;
+
+    return bench::benchmark_suite("relay", F::none)
+        .add("splice", bench_relay<Backend, true>)
+            .range(1024, 1048576, 4)
+        .add("copy", bench_relay<Backend, false>)
+            .range(1024, 1048576, 4);
+}
+
+} // namespace corosio_bench
+
+COROSIO_SUITE_INSTANTIATE_POSIX(corosio_bench::make_relay_suite)
+
+#endif // BOOST_COROSIO_POSIX
@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include "benchmarks.hpp"
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/datagram_slot.hpp>
+#include <boost/corosio/native/native_udp_socket.hpp>
+#include <boost/corosio/native/native_socket_option.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "../../common/native_includes.hpp"
+
+namespace corosio = boost::corosio;
+namespace capy    = boost::capy;
+
+namespace corosio_bench {
+namespace {
+
+constexpr std::size_t datagram_size = 64;
+
+/* Open a receiver bound to an ephemeral loopback port with a large
+   receive queue, and a sender bound likewise. Loopback UDP drops
+   silently when the receive queue is full, so the reported rate is
+   datagrams actually received, not datagrams sent. */
+template<auto Backend>
+void
+open_pair(
+    corosio::native_udp_socket<Backend>& sender,
+    corosio::native_udp_socket<Backend>& receiver)
+{
+    receiver.open();
+    receiver.set_option(
+        corosio::native_socket_option::receive_buffer_size(8 << 20));
+    (void)receiver.bind(
+        corosio::endpoint(corosio::ipv4_address::loopback(), 0));
+
+    sender.open();
+    (void)sender.bind(
+        corosio::endpoint(corosio::ipv4_address::loopback(), 0));
+}
+
+template<auto Backend>
+capy::task<>
+single_sender(
+    corosio::native_udp_socket<Backend>& sender,
+    corosio::native_udp_socket<Backend>& receiver,
+    corosio::endpoint dest,
+    bench::state& state)
+{
+    std::array<char, datagram_size> buf{};
+    while (state.running())
+    {
+        auto [ec, n] = co_await sender.send_to(
+            capy::const_buffer(buf.data(), buf.size()), dest);
+        if (ec)
+            break;
+    }
+    receiver.cancel();
+}
+
+template<auto Backend>
+capy::task<>
+single_receiver(
+    corosio::native_udp_socket<Backend>& receiver,
+    bench::state& state)
+{
+    std::array<char, 2048> buf;
+    corosio::endpoint source;
+    std::int64_t datagrams = 0;
+    std::int64_t bytes     = 0;
+    for (;;)
+    {
+        auto [ec, n] = co_await receiver.recv_from(
+            capy::mutable_buffer(buf.data(), buf.size()), source);
+        if (ec)
+            break;
+        ++datagrams;
+        bytes += static_cast<std::int64_t>(n);
+    }
+    state.add_items(datagrams);
+    state.add_bytes(bytes);
+}
+
+template<auto Backend>
+capy::task<>
+batch_sender(
+    corosio::native_udp_socket<Backend>& sender,
+    corosio::native_udp_socket<Backend>& receiver,
+    corosio::endpoint dest,
+    std::size_t batch,
+    bench::state& state)
+{
+    std::array<char, datagram_size> buf{};
+    std::vector<corosio::const_datagram_slot> slots(batch);
+    for (auto& s : slots)
+    {
+        s.buffer = capy::const_buffer(buf.data(), buf.size());
+        s.peer   = dest;
+    }
+
+    while (state.running())
+    {
+        auto [ec, n] = co_await sender.send_batch(slots);
+        if (ec)
+            break;
+    }
+    receiver.cancel();
+}
+
+template<auto Backend>
+capy::task<>
+batch_receiver(
+    corosio::native_udp_socket<Backend>& receiver,
+    std::size_t batch,
+    bench::state& state)
+{
+    std::vector<std::array<char, 2048>> bufs(batch);
+    std::vector<corosio::datagram_slot> slots(batch);
+    for (std::size_t i = 0; i < batch; ++i)
+        slots[i].buffer = capy::mutable_buffer(bufs[i].data(), bufs[i].size());
+
+    std::int64_t datagrams = 0;
+    std::int64_t bytes     = 0;
+    for (;;)
+    {
+        auto [ec, n] = co_await receiver.recv_batch(slots);
+        if (ec)
+            break;
+        datagrams += static_cast<std::int64_t>(n);
+        for (std::size_t i = 0; i < n; ++i)
+            bytes += static_cast<std::int64_t>(slots[i].size);
+    }
+    state.add_items(datagrams);
+    state.add_bytes(bytes);
+}
+
+#if defined(__linux__)
+/* One send carries `segments` datagrams through UDP_SEGMENT; the
+   kernel does the split, so the receiver sees ordinary datagrams. */
+template<auto Backend>
+capy::task<>
+gso_sender(
+    corosio::native_udp_socket<Backend>& sender,
+    corosio::native_udp_socket<Backend>& receiver,
+    corosio::endpoint dest,
+    std::size_t segments,
+    bench::state& state)
+{
+    std::vector<char> buf(datagram_size * segments);
+    corosio::const_datagram_slot slot;
+    slot.buffer       = capy::const_buffer(buf.data(), buf.size());
+    slot.peer         = dest;
+    slot.segment_size = datagram_size;
+
+    while (state.running())
+    {
+        auto [ec, n] = co_await sender.send_batch(std::span(&slot, 1));
+        if (ec)
+            break;
+    }
+    receiver.cancel();
+}
+#endif
+
+template<auto Backend>
+void
+run_with_timer(corosio::native_io_context<Backend>& ioc, bench::state& state)
+{
+    std::thread timer([&]() {
+        std::this_thread::sleep_for(
+            std::chrono::duration<double>(state.duration()));
+        state.stop();
+    });
+
+    perf::stopwatch sw;
+    ioc.run();
+    timer.join();
+
+    state.set_elapsed(sw.elapsed_seconds());
+}
+
+template<auto Backend>
+void
+bench_oneway_single(bench::state& state)
+{
+    state.counters["batch"] = 1;
+
+    corosio::native_io_context<Backend> ioc;
+    corosio::native_udp_socket<Backend> sender(ioc);
+    corosio::native_udp_socket<Backend> receiver(ioc);
+    open_pair(sender, receiver);
+
+    capy::run_async(ioc.get_executor())(
+        single_receiver<Backend>(receiver, state));
+    capy::run_async(ioc.get_executor())(single_sender<Backend>(
+        sender, receiver, receiver.local_endpoint(), state));
+
+    run_with_timer(ioc, state);
+    sender.close();
+    receiver.close();
+}
+
+template<auto Backend>
+void
+bench_oneway_batch(bench::state& state)
+{
+    auto batch = static_cast<std::size_t>(state.range(0));
+    state.counters["batch"] = static_cast<double>(batch);
+
+    corosio::native_io_context<Backend> ioc;
+    corosio::native_udp_socket<Backend> sender(ioc);
+    corosio::native_udp_socket<Backend> receiver(ioc);
+    open_pair(sender, receiver);
+
+    capy::run_async(ioc.get_executor())(
+        batch_receiver<Backend>(receiver, batch, state));
+    capy::run_async(ioc.get_executor())(batch_sender<Backend>(
+        sender, receiver, receiver.local_endpoint(), batch, state));
+
+    run_with_timer(ioc, state);
+    sender.close();
+    receiver.close();
+}
+
+#if defined(__linux__)
+template<auto Backend>
+void
+bench_oneway_gso(bench::state& state)
+{
+    auto segments = static_cast<std::size_t>(state.range(0));
+    state.counters["segments"] = static_cast<double>(segments);
+
+    corosio::native_io_context<Backend> ioc;
+    corosio::native_udp_socket<Backend> sender(ioc);
+    corosio::native_udp_socket<Backend> receiver(ioc);
+    open_pair(sender, receiver);
+
+    capy::run_async(ioc.get_executor())(
+        batch_receiver<Backend>(receiver, corosio::max_datagram_batch, state));
+    capy::run_async(ioc.get_executor())(gso_sender<Backend>(
+        sender, receiver, receiver.local_endpoint(), segments, state));
+
+    run_with_timer(ioc, state);
+    sender.close();
+    receiver.close();
+}
+#endif
+
+} // anonymous namespace
+
+template<auto Backend>
+bench::benchmark_suite
+make_udp_throughput_suite()
+{
+    auto suite = bench::benchmark_suite("udp_throughput");
+    suite.add("oneway_single", bench_oneway_single<Backend>)
+        .add("oneway_batch", bench_oneway_batch<Backend>)
+            .args({4, 16});
+#if defined(__linux__)
+    suite.add("oneway_gso", bench_oneway_gso<Backend>)
+        .args({16, 64});
+#endif
+    return suite;
+}
+
+} // namespace corosio_bench
+
+COROSIO_SUITE_INSTANTIATE(corosio_bench::make_udp_throughput_suite)
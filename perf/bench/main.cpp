@@ -80,9 +80,13 @@ add_corosio_suites(bench::benchmark_runner& runner, BackendTag)
     runner.add_suite("corosio", corosio_bench::make_timer_suite<BackendTag{}>());
     runner.add_suite("corosio", corosio_bench::make_accept_churn_suite<BackendTag{}>());
     runner.add_suite("corosio", corosio_bench::make_fan_out_suite<BackendTag{}>());
+    runner.add_suite("corosio", corosio_bench::make_udp_throughput_suite<BackendTag{}>());
+    runner.add_suite("corosio", corosio_bench::make_datagram_suite<BackendTag{}>());
+    runner.add_suite("corosio", corosio_bench::make_file_io_suite<BackendTag{}>());
 #if BOOST_COROSIO_POSIX
     runner.add_suite("corosio", corosio_bench::make_local_socket_throughput_suite<BackendTag{}>());
     runner.add_suite("corosio", corosio_bench::make_local_socket_latency_suite<BackendTag{}>());
+    runner.add_suite("corosio", corosio_bench::make_relay_suite<BackendTag{}>());
 #endif
 }
 
@@ -99,6 +103,7 @@ add_asio_suites(bench::benchmark_runner& runner)
     runner.add_suite("asio", asio_bench::make_fan_out_suite());
     runner.add_suite("asio", asio_bench::make_local_socket_throughput_suite());
     runner.add_suite("asio", asio_bench::make_local_socket_latency_suite());
+    runner.add_suite("asio", asio_bench::make_datagram_suite());
 }
 
 void
@@ -113,6 +118,7 @@ add_asio_callback_suites(bench::benchmark_runner& runner)
     runner.add_suite("asio_callback", asio_callback_bench::make_fan_out_suite());
     runner.add_suite("asio_callback", asio_callback_bench::make_local_socket_throughput_suite());
     runner.add_suite("asio_callback", asio_callback_bench::make_local_socket_latency_suite());
+    runner.add_suite("asio_callback", asio_callback_bench::make_datagram_suite());
 }
 #endif
 
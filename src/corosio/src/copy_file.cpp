@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/copy_file.hpp>
+#include <boost/corosio/aligned_allocator.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/error.hpp>
+
+#include "src/detail/pool_call.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+#include <boost/corosio/native/detail/make_err.hpp>
+
+#include <errno.h>
+#include <limits>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+/*
+    File copy
+    =========
+
+    Each chunk is one blocking copy_file_range call on the thread
+    pool, so there is one pool round trip per chunk and a stop
+    request is seen between chunks. The kernel copies in place, or
+    shares extents on filesystems with reflinks.
+
+    copy_file_range refuses some pairs of files: across filesystems
+    before Linux 5.3, special files, and some filesystems. Its first
+    refusal switches the rest of the copy to a buffered loop over
+    read_some_at and write_some_at, which also serves platforms
+    without the call (and io_uring, where IORING_OP_SPLICE needs a
+    pipe on one side and cannot reflink).
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+#if defined(__linux__)
+
+// Pool thread: copy up to len bytes, stopping early at end of file.
+std::error_code
+kernel_copy(
+    int in,
+    std::uint64_t in_off,
+    int out,
+    std::uint64_t out_off,
+    std::size_t len,
+    std::size_t& done,
+    bool& unsupported) noexcept
+{
+    constexpr auto max_off =
+        static_cast<std::uint64_t>((std::numeric_limits<off_t>::max)());
+    done        = 0;
+    unsupported = false;
+    if (in_off > max_off || out_off > max_off)
+        return detail::make_err(EOVERFLOW);
+
+    auto ioff = static_cast<off_t>(in_off);
+    auto ooff = static_cast<off_t>(out_off);
+    while (done < len)
+    {
+        ssize_t n = ::copy_file_range(in, &ioff, out, &ooff, len - done, 0);
+        if (n > 0)
+        {
+            done += static_cast<std::size_t>(n);
+            continue;
+        }
+        if (n == 0)
+            break;
+        int const err = errno;
+        if (err == EINTR)
+            continue;
+        if (done == 0 &&
+            (err == EXDEV || err == ENOSYS || err == EOPNOTSUPP ||
+             err == EINVAL))
+        {
+            unsupported = true;
+            return {};
+        }
+        return detail::make_err(err);
+    }
+    return {};
+}
+
+#endif
+
+// Buffered fallback for one chunk.
+capy::task<capy::io_result<std::size_t>>
+buffered_copy(
+    random_access_file& src,
+    random_access_file& dst,
+    std::uint64_t in_off,
+    std::uint64_t out_off,
+    std::size_t len,
+    std::vector<char, aligned_allocator<char>>& buf)
+{
+    if (buf.size() < len)
+        buf.resize(len);
+
+    std::size_t got = 0;
+    while (got < len)
+    {
+        auto [ec, n] = co_await src.read_some_at(
+            in_off + got, capy::mutable_buffer(buf.data() + got, len - got));
+        got += n;
+        if (ec == capy::error::eof)
+            break;
+        if (ec)
+            co_return {ec, 0};
+    }
+
+    std::size_t put = 0;
+    while (put < got)
+    {
+        auto [ec, n] = co_await dst.write_some_at(
+            out_off + put, capy::const_buffer(buf.data() + put, got - put));
+        put += n;
+        if (ec)
+            co_return {ec, put};
+    }
+    co_return {std::error_code{}, got};
+}
+
+capy::task<capy::io_result<std::uint64_t>>
+do_copy(
+    random_access_file& src,
+    random_access_file& dst,
+    std::span<copy_range const> ranges,
+    std::size_t chunk_size)
+{
+#if defined(__linux__)
+    auto& pool  = detail::find_or_make_pool(src.context());
+    bool kernel = true;
+#endif
+    std::vector<char, aligned_allocator<char>> buf;
+    std::uint64_t total = 0;
+
+    for (auto const& r : ranges)
+    {
+        std::uint64_t done = 0;
+        while (done < r.length)
+        {
+            auto const want = static_cast<std::size_t>(
+                (std::min<std::uint64_t>)(r.length - done, chunk_size));
+            std::size_t n = 0;
+            std::error_code ec;
+            bool copied = false;
+
+#if defined(__linux__)
+            if (kernel)
+            {
+                bool unsupported = false;
+                ec = co_await detail::pool_call(pool, [&]() noexcept {
+                    return kernel_copy(
+                        src.native_handle(), r.src_offset + done,
+                        dst.native_handle(), r.dst_offset + done, want, n,
+                        unsupported);
+                });
+                if (unsupported)
+                    kernel = false;
+                else
+                    copied = true;
+            }
+#endif
+            if (!copied)
+            {
+                auto [bec, bn] = co_await buffered_copy(
+                    src, dst, r.src_offset + done, r.dst_offset + done, want,
+                    buf);
+                ec = bec;
+                n  = bn;
+            }
+
+            done += n;
+            total += n;
+            if (ec)
+                co_return {ec, total};
+            if (n < want)
+                co_return {make_error_code(capy::error::eof), total};
+        }
+    }
+    co_return {std::error_code{}, total};
+}
+
+} // namespace
+
+capy::task<capy::io_result<std::uint64_t>>
+copy_file(
+    random_access_file& src,
+    random_access_file& dst,
+    std::span<copy_range const> ranges,
+    std::size_t chunk_size)
+{
+    if (!src.is_open() || !dst.is_open())
+        detail::throw_logic_error("copy_file: file not open");
+    if (chunk_size == 0)
+        throw std::invalid_argument("copy_file requires a nonzero chunk_size");
+    return do_copy(src, dst, ranges, chunk_size);
+}
+
+} // namespace boost::corosio
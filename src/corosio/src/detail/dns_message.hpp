@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef SRC_DETAIL_DNS_MESSAGE_HPP
+#define SRC_DETAIL_DNS_MESSAGE_HPP
+
+#include <boost/corosio/ipv4_address.hpp>
+#include <boost/corosio/ipv6_address.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+    DNS wire format
+    ===============
+
+    Just enough of RFC 1035 (and RFC 3596 for AAAA) for a stub
+    resolver: encode a recursive query for one name and type, and
+    pull the addresses for that name out of a reply. CNAME records
+    in the answer section extend the set of owner names whose A and
+    AAAA records are accepted, so a recursive server's chained
+    answer resolves in one round trip. Compressed names are
+    followed with a hop limit so a malicious reply cannot loop.
+*/
+
+namespace boost::corosio::detail::dns {
+
+inline constexpr std::uint16_t type_a     = 1;
+inline constexpr std::uint16_t type_cname = 5;
+inline constexpr std::uint16_t type_aaaa  = 28;
+inline constexpr std::uint16_t class_in   = 1;
+
+inline constexpr unsigned rcode_noerror  = 0;
+inline constexpr unsigned rcode_nxdomain = 3;
+
+/// Largest reply accepted over UDP; no EDNS is advertised.
+inline constexpr std::size_t max_udp_size = 512;
+
+/// The parts of a reply the resolver acts on.
+struct reply
+{
+    std::uint16_t id = 0;
+    unsigned rcode   = 0;
+    bool truncated   = false;
+    std::vector<ipv4_address> v4;
+    std::vector<ipv6_address> v6;
+};
+
+/// Compare two names ignoring ASCII case and a trailing dot.
+inline bool
+names_equal(std::string_view a, std::string_view b) noexcept
+{
+    if (!a.empty() && a.back() == '.')
+        a.remove_suffix(1);
+    if (!b.empty() && b.back() == '.')
+        b.remove_suffix(1);
+    if (a.size() != b.size())
+        return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        char x = a[i], y = b[i];
+        if (x >= 'A' && x <= 'Z')
+            x = static_cast<char>(x - 'A' + 'a');
+        if (y >= 'A' && y <= 'Z')
+            y = static_cast<char>(y - 'A' + 'a');
+        if (x != y)
+            return false;
+    }
+    return true;
+}
+
+inline void
+put16(std::vector<unsigned char>& out, std::uint16_t v)
+{
+    out.push_back(static_cast<unsigned char>(v >> 8));
+    out.push_back(static_cast<unsigned char>(v & 0xff));
+}
+
+inline std::uint16_t
+get16(std::span<unsigned char const> m, std::size_t pos) noexcept
+{
+    return static_cast<std::uint16_t>((m[pos] << 8) | m[pos + 1]);
+}
+
+/** Encode a recursive query.
+
+    @return `false` if @p name is not a valid DNS name.
+*/
+inline bool
+build_query(
+    std::vector<unsigned char>& out,
+    std::uint16_t id,
+    std::string_view name,
+    std::uint16_t type)
+{
+    if (!name.empty() && name.back() == '.')
+        name.remove_suffix(1);
+    if (name.empty() || name.size() > 253)
+        return false;
+
+    out.clear();
+    put16(out, id);
+    put16(out, 0x0100); // RD
+    put16(out, 1);      // QDCOUNT
+    put16(out, 0);
+    put16(out, 0);
+    put16(out, 0);
+    while (!name.empty())
+    {
+        auto dot   = name.find('.');
+        auto label = name.substr(0, dot);
+        if (label.empty() || label.size() > 63)
+            return false;
+        out.push_back(static_cast<unsigned char>(label.size()));
+        out.insert(out.end(), label.begin(), label.end());
+        name = dot == std::string_view::npos ? std::string_view{}
+                                             : name.substr(dot + 1);
+    }
+    out.push_back(0);
+    put16(out, type);
+    put16(out, class_in);
+    return true;
+}
+
+/** Read a possibly compressed name.
+
+    @param pos On entry the offset of the name; on success the
+        offset just past it in the record.
+*/
+inline bool
+read_name(
+    std::span<unsigned char const> m, std::size_t& pos, std::string& out)
+{
+    out.clear();
+    std::size_t p = pos;
+    bool jumped   = false;
+    for (int hops = 0; hops < 64; ++hops)
+    {
+        if (p >= m.size())
+            return false;
+        unsigned len = m[p];
+        if ((len & 0xc0) == 0xc0)
+        {
+            if (p + 1 >= m.size())
+                return false;
+            if (!jumped)
+                pos = p + 2;
+            jumped = true;
+            p      = ((len & 0x3f) << 8) | m[p + 1];
+            continue;
+        }
+        if (len & 0xc0)
+            return false;
+        if (len == 0)
+        {
+            if (!jumped)
+                pos = p + 1;
+            return true;
+        }
+        if (p + 1 + len > m.size())
+            return false;
+        if (!out.empty())
+            out.push_back('.');
+        out.append(reinterpret_cast<char const*>(&m[p + 1]), len);
+        p += 1 + len;
+    }
+    return false;
+}
+
+/** Parse a reply to a query for @p name and @p type.
+
+    The answers of a truncated reply are not parsed.
+
+    @return `false` if the message is malformed or is not a
+        reply to that question.
+*/
+inline bool
+parse_reply(
+    std::span<unsigned char const> m,
+    std::string_view name,
+    std::uint16_t type,
+    reply& r)
+{
+    if (m.size() < 12)
+        return false;
+    auto flags = get16(m, 2);
+    if (!(flags & 0x8000) || get16(m, 4) != 1)
+        return false;
+    r.id        = get16(m, 0);
+    r.truncated = (flags & 0x0200) != 0;
+    r.rcode     = flags & 0x000f;
+    r.v4.clear();
+    r.v6.clear();
+
+    std::size_t pos = 12;
+    std::string owner;
+    if (!read_name(m, pos, owner) || !names_equal(owner, name))
+        return false;
+    if (pos + 4 > m.size() || get16(m, pos) != type ||
+        get16(m, pos + 2) != class_in)
+        return false;
+    pos += 4;
+
+    // A truncated answer section may end mid-record; the caller
+    // retries over TCP, so the partial answers are not needed
+    if (r.truncated)
+        return true;
+
+    std::vector<std::string> names{std::string(name)};
+    auto known = [&](std::string_view n) {
+        for (auto const& k : names)
+            if (names_equal(k, n))
+                return true;
+        return false;
+    };
+
+    unsigned ancount = get16(m, 6);
+    for (unsigned i = 0; i < ancount; ++i)
+    {
+        if (!read_name(m, pos, owner) || pos + 10 > m.size())
+            return false;
+        auto rtype  = get16(m, pos);
+        auto rclass = get16(m, pos + 2);
+        std::size_t rdlen = get16(m, pos + 8);
+        pos += 10;
+        if (pos + rdlen > m.size())
+            return false;
+
+        if (rclass == class_in && known(owner))
+        {
+            if (rtype == type_a && rdlen == 4)
+            {
+                ipv4_address::bytes_type b;
+                for (std::size_t j = 0; j < 4; ++j)
+                    b[j] = m[pos + j];
+                r.v4.emplace_back(b);
+            }
+            else if (rtype == type_aaaa && rdlen == 16)
+            {
+                ipv6_address::bytes_type b;
+                for (std::size_t j = 0; j < 16; ++j)
+                    b[j] = m[pos + j];
+                r.v6.emplace_back(b);
+            }
+            else if (rtype == type_cname)
+            {
+                std::size_t p = pos;
+                std::string target;
+                if (!read_name(m, p, target))
+                    return false;
+                names.push_back(std::move(target));
+            }
+        }
+        pos += rdlen;
+    }
+    return true;
+}
+
+} // namespace boost::corosio::detail::dns
+
+#endif // SRC_DETAIL_DNS_MESSAGE_HPP
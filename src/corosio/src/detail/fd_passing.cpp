@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/detail/fd_passing.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace boost::corosio::detail {
+
+static_assert(
+    CMSG_SPACE(max_passed_fds * sizeof(int)) <= sizeof(fd_control_buffer::data),
+    "fd_control_buffer too small for max_passed_fds");
+
+std::size_t
+encode_passed_fds(
+    fd_control_buffer& buf,
+    native_handle_type const* fds,
+    std::size_t n) noexcept
+{
+    if (n == 0 || n > max_passed_fds)
+        return 0;
+
+    std::size_t bytes = n * sizeof(int);
+    std::memset(buf.data, 0, CMSG_SPACE(bytes));
+    auto* cm       = reinterpret_cast<cmsghdr*>(buf.data);
+    cm->cmsg_level = SOL_SOCKET;
+    cm->cmsg_type  = SCM_RIGHTS;
+    cm->cmsg_len   = CMSG_LEN(bytes);
+    std::memcpy(CMSG_DATA(cm), fds, bytes);
+    return CMSG_SPACE(bytes);
+}
+
+std::size_t
+decode_passed_fds(
+    fd_control_buffer const& buf,
+    std::size_t len,
+    native_handle_type* out,
+    std::size_t cap) noexcept
+{
+    if (len == 0)
+        return 0;
+
+    msghdr msg{};
+    msg.msg_control    = const_cast<unsigned char*>(buf.data);
+    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(len);
+
+    std::size_t count = 0;
+    for (cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+    {
+        if (cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS)
+            continue;
+
+        auto const* data = CMSG_DATA(cm);
+        std::size_t n    = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            int fd;
+            std::memcpy(&fd, data + i * sizeof(int), sizeof(int));
+            if (count < cap)
+            {
+#ifndef MSG_CMSG_CLOEXEC
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+#endif
+                out[count++] = fd;
+            }
+            else
+            {
+                ::close(fd);
+            }
+        }
+    }
+    return count;
+}
+
+} // namespace boost::corosio::detail
+
+#else
+
+namespace boost::corosio::detail {
+
+std::size_t
+encode_passed_fds(
+    fd_control_buffer&, native_handle_type const*, std::size_t) noexcept
+{
+    return 0;
+}
+
+std::size_t
+decode_passed_fds(
+    fd_control_buffer const&,
+    std::size_t,
+    native_handle_type*,
+    std::size_t) noexcept
+{
+    return 0;
+}
+
+} // namespace boost::corosio::detail
+
+#endif
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#ifndef SRC_DETAIL_POOL_CALL_HPP
+#define SRC_DETAIL_POOL_CALL_HPP
+
+#include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/corosio/detail/thread_pool.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/execution_context.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+#include <boost/capy/ex/io_env.hpp>
+
+#include <coroutine>
+#include <system_error>
+#include <utility>
+
+/*
+    Blocking calls from coroutines
+    ==============================
+
+    pool_call runs a blocking function on the file lane of the
+    thread pool and resumes the awaiting coroutine by posting to its
+    executor. The work item lives in the awaitable, inside the
+    caller's frame, which stays suspended until the post. The
+    executor's work count is held from submission until
+    await_resume so run() cannot return while the pool is busy.
+
+    A stop requested before submission completes with canceled
+    without running the function; once running it is not
+    interrupted, so callers keep each call short.
+*/
+
+namespace boost::corosio::detail {
+
+/// Return the context's thread pool, creating it on first use.
+inline thread_pool&
+find_or_make_pool(capy::execution_context& ctx)
+{
+    if (auto* p = ctx.find_service<thread_pool>())
+        return *p;
+    return ctx.make_service<thread_pool>();
+}
+
+/** Awaitable running `f()` on the thread pool.
+
+    @tparam F A callable `std::error_code() noexcept`.
+*/
+template<class F>
+class pool_call
+{
+    struct op : pool_work_item
+    {
+        F f;
+        std::error_code ec;
+        std::coroutine_handle<> h;
+        capy::executor_ref ex;
+        continuation_op cont_op;
+
+        explicit op(F f_) : f(std::move(f_)) {}
+
+        static void do_work(pool_work_item* w) noexcept
+        {
+            auto* self      = static_cast<op*>(w);
+            self->ec        = self->f();
+            self->cont_op.cont.h = self->h;
+            self->ex.post(self->cont_op.cont);
+        }
+    };
+
+    thread_pool& pool_;
+    op op_;
+    bool started_ = false;
+
+public:
+    pool_call(thread_pool& pool, F f) : pool_(pool), op_(std::move(f)) {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+    {
+        if (env->stop_token.stop_requested())
+        {
+            op_.ec = capy::error::canceled;
+            return false;
+        }
+        op_.h     = h;
+        op_.ex    = env->executor;
+        op_.func_ = &op::do_work;
+        op_.ex.on_work_started();
+        if (!pool_.post(&op_))
+        {
+            op_.ex.on_work_finished();
+            op_.ec = capy::error::canceled;
+            return false;
+        }
+        started_ = true;
+        return true;
+    }
+
+    std::error_code await_resume() noexcept
+    {
+        if (started_)
+            op_.ex.on_work_finished();
+        return op_.ec;
+    }
+};
+
+} // namespace boost::corosio::detail
+
+#endif // SRC_DETAIL_POOL_CALL_HPP
@@ -0,0 +1,507 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/dns_resolver.hpp>
+#include <boost/corosio/cancel.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/corosio/tcp.hpp>
+#include <boost/corosio/tcp_socket.hpp>
+#include <boost/corosio/timer.hpp>
+#include <boost/corosio/udp.hpp>
+#include <boost/corosio/udp_socket.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/io_env.hpp>
+
+#include "src/detail/dns_message.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <system_error>
+#include <unordered_map>
+
+#if BOOST_COROSIO_POSIX
+#include <arpa/inet.h>
+#include <netdb.h>
+#endif
+
+/*
+    Native DNS resolution
+    =====================
+
+    Each lookup is a coroutine that owns its sockets, so the stop
+    token of the awaiting coroutine reaches whichever send, receive
+    or connect is pending and a cancelled lookup stops at once.
+
+    Per server, the A and AAAA queries go out back to back on one
+    connected UDP socket (a fresh ephemeral port per exchange) and
+    replies are matched by ID and question until both are in or
+    the deadline passes. Each reply with TC set is retried over
+    TCP, one connection per truncated question with a deadline of
+    its own, whether or not the other question was answered. An
+    answer to one question is enough if the other times out: the
+    addresses found are returned.
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+struct question
+{
+    std::uint16_t type = 0;
+    std::uint16_t id   = 0;
+    std::vector<unsigned char> query;
+    bool done = false;
+    detail::dns::reply answer;
+};
+
+// Every ID is drawn from the OS entropy source: an off-path
+// attacker must not be able to predict the next query's ID from
+// ones it has observed, as it could from a seeded generator.
+std::uint16_t
+next_id()
+{
+    thread_local std::random_device rd;
+    return static_cast<std::uint16_t>(rd());
+}
+
+bool
+parse_address(std::string_view s, std::vector<endpoint>& out)
+{
+    // Drop an IPv6 zone, which endpoints cannot carry
+    if (auto pct = s.find('%'); pct != std::string_view::npos)
+        s = s.substr(0, pct);
+    ipv4_address v4;
+    if (!parse_ipv4_address(s, v4))
+    {
+        out.emplace_back(v4, 0);
+        return true;
+    }
+    ipv6_address v6;
+    if (!parse_ipv6_address(s, v6))
+    {
+        out.emplace_back(v6, 0);
+        return true;
+    }
+    return false;
+}
+
+unsigned
+parse_option(std::string_view opt, std::string_view name)
+{
+    if (opt.substr(0, name.size()) != name)
+        return 0;
+    unsigned v = 0;
+    auto rest  = opt.substr(name.size());
+    std::from_chars(rest.data(), rest.data() + rest.size(), v);
+    return v;
+}
+
+std::string
+lower(std::string_view s)
+{
+    std::string r(s);
+    for (auto& c : r)
+        if (c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+    if (!r.empty() && r.back() == '.')
+        r.pop_back();
+    return r;
+}
+
+std::error_code
+not_found() noexcept
+{
+    return std::make_error_code(std::errc::no_such_device_or_address);
+}
+
+// Map a service name or number to a port
+std::error_code
+parse_service(std::string const& service, resolve_flags flags, unsigned& port)
+{
+    port = 0;
+    if (service.empty())
+        return {};
+    auto [p, ec] = std::from_chars(
+        service.data(), service.data() + service.size(), port);
+    if (ec == std::errc{} && p == service.data() + service.size())
+    {
+        if (port > 65535)
+            return std::make_error_code(std::errc::invalid_argument);
+        return {};
+    }
+    if ((flags & resolve_flags::numeric_service) != resolve_flags::none)
+        return not_found();
+#if BOOST_COROSIO_POSIX
+    // getservbyname reads a local file and returns static storage
+    static std::mutex m;
+    std::lock_guard<std::mutex> lock(m);
+    if (auto* se = ::getservbyname(service.c_str(), "tcp"))
+    {
+        port = ntohs(static_cast<std::uint16_t>(se->s_port));
+        return {};
+    }
+#endif
+    return std::make_error_code(std::errc::invalid_argument);
+}
+
+} // namespace
+
+struct dns_resolver::state
+{
+    std::vector<endpoint> servers;
+    std::chrono::milliseconds timeout{5000};
+    unsigned attempts = 2;
+    std::unordered_map<std::string, std::vector<endpoint>> hosts;
+
+    void read_resolv_conf(std::filesystem::path const& path)
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream ls(line);
+            std::string key;
+            if (!(ls >> key) || key[0] == '#' || key[0] == ';')
+                continue;
+            if (key == "nameserver")
+            {
+                std::string addr;
+                if (ls >> addr)
+                    parse_address(addr, servers);
+            }
+            else if (key == "options")
+            {
+                std::string opt;
+                while (ls >> opt)
+                {
+                    if (auto v = parse_option(opt, "timeout:"))
+                        timeout = std::chrono::seconds(v);
+                    if (auto v = parse_option(opt, "attempts:"))
+                        attempts = v;
+                }
+            }
+        }
+    }
+
+    void read_hosts(std::filesystem::path const& path)
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (auto hash = line.find('#'); hash != std::string::npos)
+                line.erase(hash);
+            std::istringstream ls(line);
+            std::string addr, name;
+            std::vector<endpoint> ep;
+            if (!(ls >> addr) || !parse_address(addr, ep))
+                continue;
+            while (ls >> name)
+                hosts[lower(name)].push_back(ep.front());
+        }
+    }
+};
+
+dns_resolver::dns_resolver(
+    capy::execution_context& ctx, dns_resolver_options const& opts)
+    : ctx_(&ctx)
+    , st_(std::make_unique<state>())
+{
+    if (!opts.resolv_conf.empty())
+        st_->read_resolv_conf(opts.resolv_conf);
+    if (!opts.hosts.empty())
+        st_->read_hosts(opts.hosts);
+
+    if (!opts.servers.empty())
+        st_->servers = opts.servers;
+    if (st_->servers.empty())
+        st_->servers.emplace_back(ipv4_address::loopback(), 0);
+    for (auto& s : st_->servers)
+        if (s.port() == 0)
+            s = endpoint(s, 53);
+
+    if (opts.timeout.count() != 0)
+        st_->timeout = opts.timeout;
+    if (opts.attempts != 0)
+        st_->attempts = opts.attempts;
+}
+
+dns_resolver::~dns_resolver() = default;
+
+dns_resolver::dns_resolver(dns_resolver&&) noexcept            = default;
+dns_resolver& dns_resolver::operator=(dns_resolver&&) noexcept = default;
+
+std::vector<endpoint> const&
+dns_resolver::servers() const noexcept
+{
+    return st_->servers;
+}
+
+namespace {
+
+// Send the pending questions to one server over UDP and collect
+// replies until all are answered or the deadline passes.
+capy::task<capy::io_result<>>
+exchange_udp(
+    capy::execution_context& ctx,
+    endpoint server,
+    std::string_view name,
+    std::span<question> qs,
+    timer::time_point deadline)
+{
+    udp_socket sock(ctx);
+    try
+    {
+        sock.open(server.is_v4() ? udp::v4() : udp::v6());
+    }
+    catch (std::system_error const& e)
+    {
+        co_return {e.code()};
+    }
+    if (auto [ec] = co_await sock.connect(server); ec)
+        co_return {ec};
+    for (auto& q : qs)
+    {
+        if (q.done)
+            continue;
+        auto [ec, n] = co_await sock.send(
+            capy::const_buffer(q.query.data(), q.query.size()));
+        if (ec)
+            co_return {ec};
+    }
+
+    timer t(ctx);
+    std::array<unsigned char, detail::dns::max_udp_size> buf;
+    for (;;)
+    {
+        bool pending = false;
+        for (auto const& q : qs)
+            pending = pending || !q.done;
+        if (!pending)
+            co_return {};
+
+        auto [ec, n] = co_await cancel_at(
+            sock.recv(capy::mutable_buffer(buf.data(), buf.size())), t,
+            deadline);
+        if (ec)
+            co_return {ec};
+        std::span<unsigned char const> msg(buf.data(), n);
+        for (auto& q : qs)
+        {
+            detail::dns::reply r;
+            if (!q.done && detail::dns::parse_reply(msg, name, q.type, r) &&
+                r.id == q.id)
+            {
+                q.answer = std::move(r);
+                q.done   = true;
+            }
+        }
+    }
+}
+
+// Read exactly `buf.size()` bytes, or fail.
+capy::task<capy::io_result<>>
+read_full(
+    tcp_socket& sock,
+    std::span<unsigned char> buf,
+    timer& t,
+    timer::time_point deadline)
+{
+    std::size_t got = 0;
+    while (got < buf.size())
+    {
+        auto [ec, n] = co_await cancel_at(
+            sock.read_some(
+                capy::mutable_buffer(buf.data() + got, buf.size() - got)),
+            t, deadline);
+        if (ec)
+            co_return {ec};
+        got += n;
+    }
+    co_return {};
+}
+
+// Repeat one question over TCP after a truncated UDP reply.
+capy::task<capy::io_result<>>
+exchange_tcp(
+    capy::execution_context& ctx,
+    endpoint server,
+    std::string_view name,
+    question& q,
+    timer::time_point deadline)
+{
+    tcp_socket sock(ctx);
+    try
+    {
+        sock.open(server.is_v4() ? tcp::v4() : tcp::v6());
+    }
+    catch (std::system_error const& e)
+    {
+        co_return {e.code()};
+    }
+    timer t(ctx);
+    if (auto [ec] = co_await cancel_at(sock.connect(server), t, deadline); ec)
+        co_return {ec};
+
+    std::vector<unsigned char> out;
+    out.reserve(q.query.size() + 2);
+    detail::dns::put16(out, static_cast<std::uint16_t>(q.query.size()));
+    out.insert(out.end(), q.query.begin(), q.query.end());
+    std::size_t sent = 0;
+    while (sent < out.size())
+    {
+        auto [ec, n] = co_await cancel_at(
+            sock.write_some(
+                capy::const_buffer(out.data() + sent, out.size() - sent)),
+            t, deadline);
+        if (ec)
+            co_return {ec};
+        sent += n;
+    }
+
+    std::array<unsigned char, 2> len;
+    if (auto [ec] = co_await read_full(sock, len, t, deadline); ec)
+        co_return {ec};
+    std::vector<unsigned char> msg(detail::dns::get16(len, 0));
+    if (auto [ec] = co_await read_full(sock, msg, t, deadline); ec)
+        co_return {ec};
+
+    detail::dns::reply r;
+    if (!detail::dns::parse_reply(msg, name, q.type, r) || r.id != q.id)
+        co_return {std::make_error_code(std::errc::protocol_error)};
+    q.answer = std::move(r);
+    q.done   = true;
+    co_return {};
+}
+
+} // namespace
+
+capy::task<capy::io_result<resolver_results>>
+dns_resolver::resolve(
+    std::string host, std::string service, resolve_flags flags)
+{
+    unsigned port = 0;
+    if (auto ec = parse_service(service, flags, port))
+        co_return {ec, {}};
+    auto p = static_cast<std::uint16_t>(port);
+
+    std::vector<resolver_entry> entries;
+    auto add = [&](endpoint ep) {
+        entries.emplace_back(endpoint(ep, p), host, service);
+    };
+
+    if (host.empty())
+    {
+        if ((flags & resolve_flags::passive) != resolve_flags::none)
+        {
+            add(endpoint(ipv4_address::any(), 0));
+            add(endpoint(ipv6_address::any(), 0));
+        }
+        else
+        {
+            add(endpoint(ipv4_address::loopback(), 0));
+            add(endpoint(ipv6_address::loopback(), 0));
+        }
+        co_return {{}, std::move(entries)};
+    }
+
+    std::vector<endpoint> numeric;
+    if (parse_address(host, numeric))
+    {
+        add(numeric.front());
+        co_return {{}, std::move(entries)};
+    }
+    if ((flags & resolve_flags::numeric_host) != resolve_flags::none)
+        co_return {not_found(), {}};
+
+    if (auto it = st_->hosts.find(lower(host)); it != st_->hosts.end())
+    {
+        for (auto const& ep : it->second)
+            add(ep);
+        co_return {{}, std::move(entries)};
+    }
+
+    std::array<question, 2> qs;
+    qs[0].type = detail::dns::type_a;
+    qs[1].type = detail::dns::type_aaaa;
+
+    auto env             = co_await capy::this_coro::environment;
+    std::error_code last = std::make_error_code(
+        std::errc::resource_unavailable_try_again);
+    for (unsigned round = 0; round < st_->attempts; ++round)
+    {
+        for (auto const& server : st_->servers)
+        {
+            for (auto& q : qs)
+            {
+                q.done = false;
+                q.id   = next_id();
+                if (!detail::dns::build_query(q.query, q.id, host, q.type))
+                    co_return {not_found(), {}};
+            }
+
+            auto deadline = timer::clock_type::now() + st_->timeout;
+            auto [ec] =
+                co_await exchange_udp(*ctx_, server, host, qs, deadline);
+
+            // The UDP exchange may have used up its deadline waiting
+            // for the other question, so TCP gets a fresh one
+            for (auto& q : qs)
+            {
+                if (!q.done || !q.answer.truncated)
+                    continue;
+                if (env->stop_token.stop_requested())
+                    break;
+                q.done     = false;
+                auto [tec] = co_await exchange_tcp(
+                    *ctx_, server, host, q,
+                    timer::clock_type::now() + st_->timeout);
+                if (tec && !ec)
+                    ec = tec;
+            }
+            if (env->stop_token.stop_requested())
+                co_return {capy::error::canceled, {}};
+
+            // A name that does not exist is final
+            for (auto const& q : qs)
+                if (q.done && q.answer.rcode == detail::dns::rcode_nxdomain)
+                    co_return {not_found(), {}};
+
+            bool answered = false;
+            for (auto const& q : qs)
+            {
+                if (!q.done || q.answer.rcode != detail::dns::rcode_noerror)
+                    continue;
+                answered = true;
+                for (auto const& a : q.answer.v4)
+                    add(endpoint(a, 0));
+                for (auto const& a : q.answer.v6)
+                    add(endpoint(a, 0));
+            }
+            if (!entries.empty())
+                co_return {{}, std::move(entries)};
+            // Both questions answered with no addresses
+            if (answered && qs[0].done && qs[1].done)
+                co_return {not_found(), {}};
+            if (ec && ec != capy::cond::canceled)
+                last = ec;
+        }
+    }
+    co_return {last, {}};
+}
+
+} // namespace boost::corosio
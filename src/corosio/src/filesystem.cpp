@@ -0,0 +1,520 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/filesystem.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/filesystem_service.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/io_env.hpp>
+
+#include "src/detail/pool_call.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if BOOST_COROSIO_POSIX
+#include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/posix/posix_file_status.hpp>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+    Filesystem operations
+    =====================
+
+    A path operation first offers itself to the context's
+    filesystem_service, which io_uring registers to run it on the
+    ring. Without the service, or for an opcode the kernel lacks, it
+    is one blocking syscall on the thread pool through pool_call.
+
+    Listing a directory has no ring opcode on any kernel, so
+    directory_reader always uses the pool. Each trip reads a whole
+    batch of entries (and stats them when asked), which keeps the
+    pool round trip off the per-entry cost.
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+// Pool thread: run one request.
+std::error_code
+run_blocking(detail::fs_request const& r) noexcept
+{
+#if BOOST_COROSIO_POSIX
+    int rc = 0;
+    switch (r.op)
+    {
+    case detail::fs_request::kind::stat:
+    {
+        struct ::stat s;
+        rc = ::stat(r.path->c_str(), &s);
+        if (rc == 0)
+            *r.status = detail::make_file_status(s);
+        break;
+    }
+    case detail::fs_request::kind::unlink:
+        rc = ::unlink(r.path->c_str());
+        break;
+    case detail::fs_request::kind::rename:
+        rc = ::rename(r.path->c_str(), r.new_path->c_str());
+        break;
+    case detail::fs_request::kind::mkdir:
+        rc = ::mkdir(r.path->c_str(), static_cast<mode_t>(r.perms) & 07777);
+        break;
+    }
+    if (rc < 0)
+        return detail::make_err(errno);
+    return {};
+#else
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    switch (r.op)
+    {
+    case detail::fs_request::kind::stat:
+    {
+        auto s = fs::status(*r.path, ec);
+        if (ec)
+            break;
+        if (!fs::exists(s))
+            return std::make_error_code(std::errc::no_such_file_or_directory);
+        file_status st;
+        st.type        = s.type();
+        st.permissions = s.permissions();
+        if (st.type == fs::file_type::regular)
+            st.size = fs::file_size(*r.path, ec);
+        if (!ec)
+            st.last_write_time = std::chrono::clock_cast<
+                std::chrono::system_clock>(fs::last_write_time(*r.path, ec));
+        if (!ec)
+            *r.status = st;
+        break;
+    }
+    case detail::fs_request::kind::unlink:
+        if (fs::is_directory(fs::symlink_status(*r.path, ec)))
+            return std::make_error_code(std::errc::is_a_directory);
+        if (!ec && !fs::remove(*r.path, ec) && !ec)
+            return std::make_error_code(std::errc::no_such_file_or_directory);
+        break;
+    case detail::fs_request::kind::rename:
+        fs::rename(*r.path, *r.new_path, ec);
+        break;
+    case detail::fs_request::kind::mkdir:
+        if (!fs::create_directory(*r.path, ec) && !ec)
+            return std::make_error_code(std::errc::file_exists);
+        break;
+    }
+    return ec;
+#endif
+}
+
+struct blocking_fs
+{
+    detail::fs_request const* req;
+
+    std::error_code operator()() const noexcept
+    {
+        return run_blocking(*req);
+    }
+};
+
+// Awaitable: the ring when the backend offers it, else the pool.
+class fs_call
+{
+    detail::fs_request& req_;
+    std::error_code ec_;
+    std::optional<detail::pool_call<blocking_fs>> pool_;
+
+public:
+    explicit fs_call(detail::fs_request& req) noexcept : req_(req) {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+    {
+        auto& ctx = env->executor.context();
+        if (auto* svc = ctx.find_service<detail::filesystem_service>())
+        {
+            req_.ec = &ec_;
+            if (svc->submit(req_, h, env->executor, env->stop_token))
+                return true;
+        }
+        pool_.emplace(detail::find_or_make_pool(ctx), blocking_fs{&req_});
+        return pool_->await_suspend(h, env);
+    }
+
+    std::error_code await_resume() noexcept
+    {
+        if (pool_)
+            return pool_->await_resume();
+        return ec_;
+    }
+};
+
+capy::task<capy::io_result<>>
+run_request(detail::fs_request req)
+{
+    auto ec = co_await fs_call(req);
+    co_return {ec};
+}
+
+} // namespace
+
+capy::task<capy::io_result<file_status>>
+async_stat(std::filesystem::path path)
+{
+    file_status st;
+    detail::fs_request req;
+    req.op     = detail::fs_request::kind::stat;
+    req.path   = &path;
+    req.status = &st;
+    auto ec    = co_await fs_call(req);
+    if (ec)
+        co_return {ec, file_status{}};
+    co_return {std::error_code{}, st};
+}
+
+capy::task<capy::io_result<>>
+async_unlink(std::filesystem::path path)
+{
+    detail::fs_request req;
+    req.op   = detail::fs_request::kind::unlink;
+    req.path = &path;
+    co_return co_await run_request(req);
+}
+
+capy::task<capy::io_result<>>
+async_rename(std::filesystem::path from, std::filesystem::path to)
+{
+    detail::fs_request req;
+    req.op       = detail::fs_request::kind::rename;
+    req.path     = &from;
+    req.new_path = &to;
+    co_return co_await run_request(req);
+}
+
+capy::task<capy::io_result<>>
+async_mkdir(std::filesystem::path path, std::filesystem::perms perms)
+{
+    detail::fs_request req;
+    req.op    = detail::fs_request::kind::mkdir;
+    req.path  = &path;
+    req.perms = perms;
+    co_return co_await run_request(req);
+}
+
+//------------------------------------------------------------------------------
+
+struct directory_reader::state
+{
+    std::filesystem::path path;
+#if BOOST_COROSIO_POSIX
+    DIR* dir = nullptr;
+#else
+    std::filesystem::directory_iterator it;
+#endif
+    std::vector<directory_entry> batch;
+    std::size_t pos = 0;
+    bool at_end     = false;
+
+    state() = default;
+
+#if BOOST_COROSIO_POSIX
+    ~state()
+    {
+        if (dir)
+            ::closedir(dir);
+    }
+#endif
+
+    state(state const&)            = delete;
+    state& operator=(state const&) = delete;
+
+    std::error_code open() noexcept;
+    std::error_code read(directory_options const& opts) noexcept;
+};
+
+#if BOOST_COROSIO_POSIX
+
+namespace {
+
+std::filesystem::file_type
+file_type_from_dirent(dirent const* d) noexcept
+{
+    using ft = std::filesystem::file_type;
+#ifdef DT_UNKNOWN
+    switch (d->d_type)
+    {
+    case DT_REG:
+        return ft::regular;
+    case DT_DIR:
+        return ft::directory;
+    case DT_LNK:
+        return ft::symlink;
+    case DT_BLK:
+        return ft::block;
+    case DT_CHR:
+        return ft::character;
+    case DT_FIFO:
+        return ft::fifo;
+    case DT_SOCK:
+        return ft::socket;
+    default:
+        break;
+    }
+#else
+    (void)d;
+#endif
+    return ft::unknown;
+}
+
+} // namespace
+
+// Pool thread.
+std::error_code
+directory_reader::state::open() noexcept
+{
+    dir = ::opendir(path.c_str());
+    if (!dir)
+        return detail::make_err(errno);
+    return {};
+}
+
+// Pool thread: read up to batch_size entries.
+std::error_code
+directory_reader::state::read(directory_options const& opts) noexcept
+{
+    try
+    {
+        batch.clear();
+        pos = 0;
+        while (batch.size() < opts.batch_size)
+        {
+            errno     = 0;
+            dirent* d = ::readdir(dir);
+            if (!d)
+            {
+                if (errno != 0)
+                    return detail::make_err(errno);
+                at_end = true;
+                break;
+            }
+            char const* name = d->d_name;
+            if (std::strcmp(name, ".") == 0 || std::strcmp(name, "..") == 0)
+                continue;
+
+            directory_entry e;
+            e.status.type = file_type_from_dirent(d);
+            if (opts.stat_entries ||
+                e.status.type == std::filesystem::file_type::unknown)
+            {
+                struct ::stat s;
+                if (::fstatat(::dirfd(dir), name, &s, AT_SYMLINK_NOFOLLOW) < 0)
+                {
+                    // Removed since readdir saw it
+                    if (errno == ENOENT)
+                        continue;
+                    return detail::make_err(errno);
+                }
+                if (opts.stat_entries)
+                    e.status = detail::make_file_status(s);
+                else
+                    e.status.type = detail::file_type_from_mode(
+                        static_cast<unsigned>(s.st_mode));
+            }
+            e.path = path / name;
+            batch.push_back(std::move(e));
+        }
+    }
+    catch (std::bad_alloc const&)
+    {
+        return std::make_error_code(std::errc::not_enough_memory);
+    }
+    return {};
+}
+
+#else
+
+// Pool thread.
+std::error_code
+directory_reader::state::open() noexcept
+{
+    std::error_code ec;
+    it = std::filesystem::directory_iterator(path, ec);
+    return ec;
+}
+
+// Pool thread: read up to batch_size entries.
+std::error_code
+directory_reader::state::read(directory_options const& opts) noexcept
+{
+    namespace fs = std::filesystem;
+    try
+    {
+        batch.clear();
+        pos = 0;
+        std::error_code ec;
+        while (batch.size() < opts.batch_size)
+        {
+            if (it == fs::directory_iterator())
+            {
+                at_end = true;
+                break;
+            }
+            auto const& de = *it;
+            directory_entry e;
+            e.path = de.path();
+            auto s = de.symlink_status(ec);
+            if (ec)
+                return ec;
+            e.status.type = s.type();
+            if (opts.stat_entries)
+            {
+                e.status.permissions = s.permissions();
+                if (s.type() == fs::file_type::regular)
+                    e.status.size = de.file_size(ec);
+                if (!ec)
+                    e.status.last_write_time = std::chrono::clock_cast<
+                        std::chrono::system_clock>(de.last_write_time(ec));
+                if (ec)
+                    return ec;
+            }
+            batch.push_back(std::move(e));
+            it.increment(ec);
+            if (ec)
+                return ec;
+        }
+    }
+    catch (std::bad_alloc const&)
+    {
+        return std::make_error_code(std::errc::not_enough_memory);
+    }
+    return {};
+}
+
+#endif
+
+directory_reader::directory_reader(
+    capy::execution_context& ctx, directory_options const& opts)
+    : ctx_(&ctx)
+    , opts_(opts)
+{
+    if (opts_.batch_size == 0)
+        throw std::invalid_argument(
+            "directory_reader requires a nonzero batch_size");
+}
+
+directory_reader::~directory_reader() = default;
+
+directory_reader::directory_reader(directory_reader&&) noexcept = default;
+
+directory_reader&
+directory_reader::operator=(directory_reader&&) noexcept = default;
+
+capy::task<capy::io_result<>>
+directory_reader::open(std::filesystem::path path)
+{
+    close();
+    auto st  = std::make_unique<state>();
+    st->path = std::move(path);
+    st->batch.reserve(opts_.batch_size);
+
+    auto* p = st.get();
+    auto ec = co_await detail::pool_call(
+        detail::find_or_make_pool(*ctx_),
+        [p]() noexcept { return p->open(); });
+    if (ec)
+        co_return {ec};
+    st_ = std::move(st);
+    co_return {};
+}
+
+void
+directory_reader::close() noexcept
+{
+    st_.reset();
+}
+
+bool
+directory_reader::is_open() const noexcept
+{
+    return st_ != nullptr;
+}
+
+capy::task<capy::io_result<std::span<directory_entry const>>>
+directory_reader::next_batch()
+{
+    if (!is_open())
+        detail::throw_logic_error("next_batch: directory not open");
+    return do_next_batch();
+}
+
+capy::task<capy::io_result<std::span<directory_entry const>>>
+directory_reader::do_next_batch()
+{
+    auto* st = st_.get();
+    if (st->pos == st->batch.size())
+    {
+        if (st->at_end)
+            co_return {make_error_code(capy::error::eof), {}};
+        auto const& opts = opts_;
+        auto ec          = co_await detail::pool_call(
+            detail::find_or_make_pool(*ctx_),
+            [st, &opts]() noexcept { return st->read(opts); });
+        if (ec)
+            co_return {ec, {}};
+        if (st->batch.empty())
+            co_return {make_error_code(capy::error::eof), {}};
+    }
+    std::span<directory_entry const> rest(
+        st->batch.data() + st->pos, st->batch.size() - st->pos);
+    st->pos = st->batch.size();
+    co_return {std::error_code{}, rest};
+}
+
+capy::task<capy::io_result<directory_entry>>
+directory_reader::next()
+{
+    if (!is_open())
+        detail::throw_logic_error("next: directory not open");
+    return do_next();
+}
+
+capy::task<capy::io_result<directory_entry>>
+directory_reader::do_next()
+{
+    auto* st = st_.get();
+    if (st->pos == st->batch.size())
+    {
+        auto [ec, rest] = co_await do_next_batch();
+        if (ec)
+            co_return {ec, directory_entry{}};
+        // Hand the batch back out one entry at a time
+        st->pos = st->batch.size() - rest.size();
+    }
+    co_return {std::error_code{}, std::move(st->batch[st->pos++])};
+}
+
+} // namespace boost::corosio
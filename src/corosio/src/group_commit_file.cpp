@@ -0,0 +1,409 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/group_commit_file.hpp>
+#include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+#include <boost/capy/ex/io_env.hpp>
+#include <boost/capy/ex/run_async.hpp>
+
+#include "src/detail/pool_call.hpp"
+
+#include <algorithm>
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if BOOST_COROSIO_POSIX
+#include <boost/corosio/native/detail/make_err.hpp>
+
+#include <errno.h>
+#include <limits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+/*
+    Group commit
+    ============
+
+    append assigns the record its offset and queues it under the
+    mutex. If no batch is in flight, the appender starts the flush
+    coroutine on the file's executor. The flush loop takes every
+    queued record (up to max_batch_bytes), writes and flushes them
+    together, resumes their appenders by posting to each one's
+    executor, and repeats until the queue is empty. Records queued
+    while a batch is in flight wait for the next one, which is
+    where the amortization comes from.
+
+    On POSIX the write and the flush are one pool item: pwritev
+    straight from the appenders' buffers, then fdatasync. Elsewhere
+    the batch is gathered into a staging buffer, written with
+    write_some_at, and flushed with sync_data on the pool.
+
+    A record lives in its appender's coroutine frame, which stays
+    suspended until the record is posted back; the queue holds
+    plain pointers.
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+struct record
+{
+    capy::const_buffer const* bufs = nullptr;
+    std::size_t nbufs              = 0;
+    std::size_t size               = 0;
+    std::uint64_t end              = 0;
+    std::error_code ec;
+
+    std::coroutine_handle<> h;
+    capy::executor_ref ex;
+    detail::continuation_op cont_op;
+};
+
+#if BOOST_COROSIO_POSIX
+
+// Pool thread: write the gathered batch at off, then flush.
+std::error_code
+write_gather(
+    int fd, std::uint64_t off, std::vector<iovec>& iovs, bool sync) noexcept
+{
+    constexpr std::size_t max_iov = 1024; // IOV_MAX on Linux and the BSDs
+    constexpr auto max_off =
+        static_cast<std::uint64_t>((std::numeric_limits<off_t>::max)());
+
+    iovec* iov      = iovs.data();
+    std::size_t cnt = iovs.size();
+    for (;;)
+    {
+        while (cnt > 0 && iov->iov_len == 0)
+        {
+            ++iov;
+            --cnt;
+        }
+        if (cnt == 0)
+            break;
+        if (off > max_off)
+            return detail::make_err(EOVERFLOW);
+
+        ssize_t n = ::pwritev(
+            fd, iov, static_cast<int>((std::min)(cnt, max_iov)),
+            static_cast<off_t>(off));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return detail::make_err(errno);
+        }
+        off += static_cast<std::uint64_t>(n);
+
+        // Short write: resume mid-buffer
+        auto left = static_cast<std::size_t>(n);
+        while (left > 0)
+        {
+            if (left >= iov->iov_len)
+            {
+                left -= iov->iov_len;
+                ++iov;
+                --cnt;
+            }
+            else
+            {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+                left = 0;
+            }
+        }
+    }
+
+    if (sync)
+    {
+#if BOOST_COROSIO_HAS_POSIX_SYNCHRONIZED_IO
+        if (::fdatasync(fd) < 0)
+#else
+        if (::fsync(fd) < 0)
+#endif
+            return detail::make_err(errno);
+    }
+    return {};
+}
+
+#endif
+
+} // namespace
+
+struct group_commit_file::state
+{
+    capy::any_executor ex;
+    random_access_file file;
+    group_commit_options opts;
+
+    std::mutex mutex;
+    std::deque<record*> queue;
+    std::uint64_t next_offset = 0; // where the next record goes
+    bool flushing             = false;
+    std::error_code failed; // sticky; set by the first failed batch
+    group_commit_stats stats;
+
+    state(
+        capy::any_executor ex_,
+        random_access_file file_,
+        group_commit_options const& opts_)
+        : ex(std::move(ex_))
+        , file(std::move(file_))
+        , opts(opts_)
+    {
+    }
+
+    static capy::task<> flush(std::shared_ptr<state> self);
+    capy::task<std::error_code>
+    write_batch(std::uint64_t offset, std::vector<record*> const& batch);
+
+    struct enqueue_awaitable
+    {
+        std::shared_ptr<state> const& s_;
+        record& r_;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+        {
+            bool start = false;
+            {
+                std::lock_guard<std::mutex> lock(s_->mutex);
+                if (s_->failed)
+                {
+                    r_.ec = s_->failed;
+                    return false;
+                }
+                r_.h  = h;
+                r_.ex = env->executor;
+                s_->next_offset += r_.size;
+                r_.end = s_->next_offset;
+                s_->queue.push_back(&r_);
+                if (!s_->flushing)
+                    start = s_->flushing = true;
+            }
+            // Outside the lock: the flush runs inline up to its
+            // first suspension
+            if (start)
+                capy::run_async(s_->ex)(flush(s_));
+            return true;
+        }
+
+        void await_resume() const noexcept {}
+    };
+};
+
+capy::task<std::error_code>
+group_commit_file::state::write_batch(
+    std::uint64_t offset, std::vector<record*> const& batch)
+{
+    auto& pool = detail::find_or_make_pool(file.context());
+
+#if BOOST_COROSIO_POSIX
+    std::vector<iovec> iovs;
+    for (auto* r : batch)
+        for (std::size_t i = 0; i < r->nbufs; ++i)
+            iovs.push_back(
+                {const_cast<void*>(r->bufs[i].data()), r->bufs[i].size()});
+
+    int const fd    = file.native_handle();
+    bool const sync = opts.sync;
+    co_return co_await detail::pool_call(pool, [&]() noexcept {
+        return write_gather(fd, offset, iovs, sync);
+    });
+#else
+    std::vector<char> staging;
+    for (auto* r : batch)
+    {
+        for (std::size_t i = 0; i < r->nbufs; ++i)
+        {
+            auto const* p = static_cast<char const*>(r->bufs[i].data());
+            staging.insert(staging.end(), p, p + r->bufs[i].size());
+        }
+    }
+
+    std::size_t put = 0;
+    while (put < staging.size())
+    {
+        auto [ec, n] = co_await file.write_some_at(
+            offset + put,
+            capy::const_buffer(staging.data() + put, staging.size() - put));
+        if (ec)
+            co_return ec;
+        put += n;
+    }
+
+    if (!opts.sync)
+        co_return std::error_code{};
+    co_return co_await detail::pool_call(pool, [this]() noexcept {
+        try
+        {
+            file.sync_data();
+        }
+        catch (std::system_error const& e)
+        {
+            return e.code();
+        }
+        return std::error_code{};
+    });
+#endif
+}
+
+capy::task<>
+group_commit_file::state::flush(std::shared_ptr<state> self)
+{
+    std::vector<record*> batch;
+    for (;;)
+    {
+        batch.clear();
+        std::uint64_t offset = 0;
+        std::size_t bytes    = 0;
+        std::error_code ec;
+        {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            if (self->queue.empty())
+            {
+                self->flushing = false;
+                co_return;
+            }
+            offset = self->queue.front()->end - self->queue.front()->size;
+            while (!self->queue.empty())
+            {
+                record* r = self->queue.front();
+                if (!batch.empty() &&
+                    bytes + r->size > self->opts.max_batch_bytes)
+                    break;
+                bytes += r->size;
+                batch.push_back(r);
+                self->queue.pop_front();
+            }
+            // Queued behind a failed batch: the tail is unknown
+            ec = self->failed;
+        }
+
+        if (!ec)
+            ec = co_await self->write_batch(offset, batch);
+
+        {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            if (ec && !self->failed)
+                self->failed = ec;
+            if (!ec)
+            {
+                ++self->stats.batches;
+                self->stats.records += batch.size();
+                self->stats.bytes += bytes;
+                self->stats.max_batch_records = (std::max)(
+                    self->stats.max_batch_records,
+                    static_cast<std::uint64_t>(batch.size()));
+            }
+        }
+
+        for (auto* r : batch)
+        {
+            r->ec            = ec;
+            r->cont_op.cont.h = r->h;
+            r->ex.post(r->cont_op.cont);
+        }
+    }
+}
+
+void
+group_commit_file::init(
+    capy::any_executor ex,
+    random_access_file file,
+    group_commit_options const& opts)
+{
+    if (opts.max_batch_bytes == 0)
+        throw std::invalid_argument(
+            "group_commit_file requires a nonzero max_batch_bytes");
+    st_ = std::make_shared<state>(std::move(ex), std::move(file), opts);
+}
+
+group_commit_file::~group_commit_file()
+{
+    close();
+}
+
+void
+group_commit_file::open(
+    std::filesystem::path const& path, file_base::flags mode)
+{
+    close();
+    st_->file.open(path, mode);
+
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    st_->next_offset = st_->file.size();
+    st_->failed      = {};
+}
+
+void
+group_commit_file::close()
+{
+    if (st_)
+        st_->file.close();
+}
+
+bool
+group_commit_file::is_open() const noexcept
+{
+    return st_ && st_->file.is_open();
+}
+
+capy::task<capy::io_result<std::uint64_t>>
+group_commit_file::do_append(std::vector<capy::const_buffer> bufs)
+{
+    // Keeps the state alive should the object be moved from
+    auto s = st_;
+
+    record r;
+    r.bufs  = bufs.data();
+    r.nbufs = bufs.size();
+    for (auto const& b : bufs)
+        r.size += b.size();
+
+    co_await state::enqueue_awaitable{s, r};
+    if (r.ec)
+        co_return {r.ec, 0};
+    co_return {std::error_code{}, r.end};
+}
+
+std::uint64_t
+group_commit_file::size() const noexcept
+{
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    return st_->next_offset;
+}
+
+group_commit_options const&
+group_commit_file::options() const noexcept
+{
+    return st_->opts;
+}
+
+group_commit_stats
+group_commit_file::stats() const noexcept
+{
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    return st_->stats;
+}
+
+} // namespace boost::corosio
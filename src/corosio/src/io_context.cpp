@@ -12,6 +12,10 @@
 #include <boost/corosio/backend.hpp>
 #include <boost/corosio/detail/thread_pool.hpp>
 
+#if BOOST_COROSIO_POSIX
+#include <boost/corosio/native/detail/posix/posix_resolver_cache.hpp>
+#endif
+
 #include <algorithm>
 #include <stdexcept>
 #include <thread>
@@ -32,6 +36,7 @@
 #include <boost/corosio/native/detail/io_uring/io_uring_acceptor_ops.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_buffer.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_dgram_ops.hpp>
+#include <boost/corosio/native/detail/io_uring/io_uring_filesystem_service.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_multishot_acceptor.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_random_access_file.hpp>
 #include <boost/corosio/native/detail/io_uring/io_uring_scheduler.hpp>
@@ -141,6 +146,7 @@ io_uring_t::construct(capy::execution_context& ctx, unsigned concurrency_hint)
     ctx.make_service<detail::io_uring_local_datagram_service>();
     ctx.make_service<detail::io_uring_stream_file_service>(sched);
     ctx.make_service<detail::io_uring_random_access_file_service>(sched);
+    ctx.make_service<detail::io_uring_filesystem_service>(sched);
 
     return sched;
 }
@@ -158,12 +164,54 @@ pre_create_services(
     if (opts.thread_pool_size < 1)
         throw std::invalid_argument(
             "thread_pool_size must be at least 1");
-    // Pre-create the shared thread pool with the configured size.
+    if (opts.resolver_pool_size < 1)
+        throw std::invalid_argument(
+            "resolver_pool_size must be at least 1");
+
+    // The cache goes first so it outlives the pool threads that
+    // publish into it: services shut down in reverse order.
+    if (opts.resolver_cache_ttl_ms != 0 ||
+        opts.resolver_cache_negative_ttl_ms != 0)
+    {
+        if (opts.resolver_cache_max_entries < 1)
+            throw std::invalid_argument(
+                "resolver_cache_max_entries must be at least 1");
+        detail::posix_resolver_cache_config c;
+        c.ttl = std::chrono::milliseconds(opts.resolver_cache_ttl_ms);
+        c.negative_ttl =
+            std::chrono::milliseconds(opts.resolver_cache_negative_ttl_ms);
+        c.max_entries  = opts.resolver_cache_max_entries;
+        ctx.make_service<detail::posix_resolver_cache>(c);
+    }
+
+    auto lane = [&](unsigned size, unsigned max_size) {
+        detail::thread_pool_lane_config c;
+        c.min_threads  = size;
+        c.max_threads  = (std::max)(size, max_size);
+        c.grow_after   =
+            std::chrono::microseconds(opts.thread_pool_grow_after_us);
+        c.idle_timeout = std::chrono::milliseconds(opts.thread_pool_idle_ms);
+        return c;
+    };
+
+    // Pre-create the shared thread pool with the configured lanes.
     // This must happen before construct() because the scheduler
     // constructor creates file and resolver services that call
-    // get_or_create_pool(), which would create a 1-thread pool.
-    if (opts.thread_pool_size != 1)
-        ctx.make_service<detail::thread_pool>(opts.thread_pool_size);
+    // get_or_create_pool(), which would create a default pool.
+    // Threads start lazily, so an unused lane costs nothing.
+    io_context_options defaults;
+    if (opts.thread_pool_size != defaults.thread_pool_size ||
+        opts.thread_pool_max_size != defaults.thread_pool_max_size ||
+        opts.resolver_pool_size != defaults.resolver_pool_size ||
+        opts.resolver_pool_max_size != defaults.resolver_pool_max_size ||
+        opts.thread_pool_grow_after_us !=
+            defaults.thread_pool_grow_after_us ||
+        opts.thread_pool_idle_ms != defaults.thread_pool_idle_ms)
+    {
+        ctx.make_service<detail::thread_pool>(
+            lane(opts.thread_pool_size, opts.thread_pool_max_size),
+            lane(opts.resolver_pool_size, opts.resolver_pool_max_size));
+    }
 #endif
 
     (void)ctx;
@@ -221,6 +269,13 @@ apply_scheduler_options(
     }
 #endif
 
+#if BOOST_COROSIO_HAS_EPOLL
+    if (opts.signal_fd)
+        if (auto* epoll_sched =
+                dynamic_cast<detail::epoll_scheduler*>(&sched))
+            epoll_sched->enable_signal_fd();
+#endif
+
 #if BOOST_COROSIO_HAS_IO_URING
     if (auto* uring_sched =
             dynamic_cast<detail::io_uring_scheduler*>(&sched))
@@ -230,6 +285,8 @@ apply_scheduler_options(
         if (opts.enable_sqpoll)
             uring_sched->configure_sqpoll(
                 true, opts.sq_thread_idle_ms, opts.sq_thread_cpu);
+        if (opts.signal_fd)
+            uring_sched->enable_signal_fd();
     }
 #endif
 
@@ -319,6 +376,14 @@ io_context::configure_single_threaded_()
     sched_->configure_single_threaded(true);
 }
 
+thread_pool_stats
+io_context::pool_stats(thread_pool_lane lane) const
+{
+    auto* pool = const_cast<io_context&>(*this)
+                     .find_service<detail::thread_pool>();
+    return pool ? pool->stats(lane) : thread_pool_stats{};
+}
+
 io_context::~io_context()
 {
     shutdown();
@@ -317,6 +317,18 @@ connect_pair(local_datagram_socket& a, local_datagram_socket& b) noexcept
     return assign_pair(a, b, a_fd, b_fd);
 }
 
+std::error_code
+connect_pair(local_seqpacket_socket& a, local_seqpacket_socket& b) noexcept
+{
+    if (a.is_open() || b.is_open())
+        return detail::make_err(EISCONN);
+
+    int a_fd = -1, b_fd = -1;
+    if (auto ec = make_pair_fds(SOCK_SEQPACKET, a_fd, b_fd))
+        return ec;
+    return assign_pair(a, b, a_fd, b_fd);
+}
+
 #endif
 
 } // namespace boost::corosio
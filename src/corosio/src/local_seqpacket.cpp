@@ -0,0 +1,40 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/local_seqpacket.hpp>
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+namespace boost::corosio {
+
+int
+local_seqpacket::family() noexcept
+{
+    return AF_UNIX;
+}
+
+int
+local_seqpacket::type() noexcept
+{
+    return SOCK_SEQPACKET;
+}
+
+int
+local_seqpacket::protocol() noexcept
+{
+    return 0;
+}
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
@@ -0,0 +1,74 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/local_seqpacket_acceptor.hpp>
+#include <boost/corosio/detail/except.hpp>
+
+#include <utility>
+
+#include <unistd.h>
+
+namespace boost::corosio {
+
+local_seqpacket_acceptor::local_seqpacket_acceptor(
+    capy::execution_context& ctx)
+    : acc_(ctx)
+    , ctx_(&ctx)
+{
+}
+
+void
+local_seqpacket_acceptor::open(local_seqpacket proto)
+{
+    if (is_open())
+        return;
+    acc_.open_for_family(proto.family(), proto.type(), proto.protocol());
+}
+
+capy::task<capy::io_result<>>
+local_seqpacket_acceptor::accept(local_seqpacket_socket& peer)
+{
+    if (!is_open())
+        detail::throw_logic_error("accept: acceptor not listening");
+
+    // The stream acceptor hands back its own socket type; move the
+    // descriptor over to the sequenced-packet implementation.
+    auto [ec, sock] = co_await acc_.accept();
+    if (ec)
+        co_return {ec};
+
+    native_handle_type fd = sock.release();
+    peer.close();
+    try
+    {
+        peer.assign(fd);
+    }
+    catch (std::system_error const& e)
+    {
+        ::close(fd);
+        co_return {e.code()};
+    }
+    co_return {};
+}
+
+capy::task<capy::io_result<local_seqpacket_socket>>
+local_seqpacket_acceptor::accept()
+{
+    local_seqpacket_socket peer(*ctx_);
+    auto [ec] = co_await accept(peer);
+    co_return {ec, std::move(peer)};
+}
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/detail/platform.hpp>
+
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/local_seqpacket_socket.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/local_datagram_service.hpp>
+
+namespace boost::corosio {
+
+// The sequenced-packet socket is a connected local datagram socket
+// with a different socket type, so it borrows local_datagram_service
+// and its per-backend implementations unchanged.
+
+local_seqpacket_socket::~local_seqpacket_socket()
+{
+    close();
+}
+
+local_seqpacket_socket::local_seqpacket_socket(capy::execution_context& ctx)
+    : io_object(create_handle<detail::local_datagram_service>(ctx))
+{
+}
+
+void
+local_seqpacket_socket::open(local_seqpacket proto)
+{
+    if (is_open())
+        return;
+    auto& svc = static_cast<detail::local_datagram_service&>(h_.service());
+    std::error_code ec = svc.open_socket(
+        static_cast<implementation&>(*h_.get()),
+        proto.family(), proto.type(), proto.protocol());
+    if (ec)
+        detail::throw_system_error(ec, "local_seqpacket_socket::open");
+}
+
+void
+local_seqpacket_socket::close()
+{
+    if (!is_open())
+        return;
+    h_.service().close(h_);
+}
+
+void
+local_seqpacket_socket::cancel()
+{
+    if (!is_open())
+        return;
+    get().cancel();
+}
+
+void
+local_seqpacket_socket::shutdown(shutdown_type what)
+{
+    if (is_open())
+    {
+        // Best-effort: errors like ENOTCONN are expected and unhelpful
+        [[maybe_unused]] auto ec = get().shutdown(what);
+    }
+}
+
+void
+local_seqpacket_socket::shutdown(
+    shutdown_type what, std::error_code& ec) noexcept
+{
+    ec = {};
+    if (is_open())
+        ec = get().shutdown(what);
+}
+
+void
+local_seqpacket_socket::assign(native_handle_type fd)
+{
+    if (is_open())
+        detail::throw_logic_error("assign: socket already open");
+    auto& svc = static_cast<detail::local_datagram_service&>(h_.service());
+    std::error_code ec = svc.assign_socket(
+        static_cast<implementation&>(*h_.get()), fd);
+    if (ec)
+        detail::throw_system_error(ec, "local_seqpacket_socket::assign");
+}
+
+native_handle_type
+local_seqpacket_socket::native_handle() const noexcept
+{
+    if (!is_open())
+        return -1;
+    return get().native_handle();
+}
+
+native_handle_type
+local_seqpacket_socket::release()
+{
+    if (!is_open())
+        detail::throw_logic_error("release: socket not open");
+    return get().release_socket();
+}
+
+local_endpoint
+local_seqpacket_socket::local_endpoint() const noexcept
+{
+    if (!is_open())
+        return corosio::local_endpoint{};
+    return get().local_endpoint();
+}
+
+local_endpoint
+local_seqpacket_socket::remote_endpoint() const noexcept
+{
+    if (!is_open())
+        return corosio::local_endpoint{};
+    return get().remote_endpoint();
+}
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
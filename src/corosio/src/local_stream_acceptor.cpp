@@ -44,11 +44,17 @@ local_stream_acceptor::open(local_stream proto)
 {
     if (is_open())
         return;
+    open_for_family(proto.family(), proto.type(), proto.protocol());
+}
+
+void
+local_stream_acceptor::open_for_family(int family, int type, int protocol)
+{
     auto& svc =
         static_cast<detail::local_stream_acceptor_service&>(h_.service());
     auto ec = svc.open_acceptor_socket(
         static_cast<local_stream_acceptor::implementation&>(*h_.get()),
-        proto.family(), proto.type(), proto.protocol());
+        family, type, protocol);
     if (ec)
         detail::throw_system_error(ec, "local_stream_acceptor::open");
 }
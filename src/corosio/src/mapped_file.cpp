@@ -0,0 +1,205 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/mapped_file.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/corosio/native/detail/make_err.hpp>
+
+#include "src/detail/pool_call.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if BOOST_COROSIO_HAS_IOCP
+#include <boost/corosio/native/detail/iocp/win_windows.hpp>
+#else
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace boost::corosio {
+
+namespace {
+
+std::size_t
+page_size() noexcept
+{
+#if BOOST_COROSIO_HAS_IOCP
+    SYSTEM_INFO si;
+    ::GetSystemInfo(&si);
+    return si.dwPageSize;
+#else
+    return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Pool thread: bring [p, p + n) into memory.
+std::error_code
+populate(unsigned char const* p, std::size_t n) noexcept
+{
+    std::size_t const page = page_size();
+    auto const addr        = reinterpret_cast<std::uintptr_t>(p);
+    auto const start       = addr & ~(std::uintptr_t(page) - 1);
+    std::size_t const len  = n + static_cast<std::size_t>(addr - start);
+
+#if !BOOST_COROSIO_HAS_IOCP
+    void* base = reinterpret_cast<void*>(start);
+#ifdef MADV_POPULATE_READ
+    // Linux 5.14+; reports I/O errors instead of raising SIGBUS
+    int r;
+    do
+    {
+        r = ::madvise(base, len, MADV_POPULATE_READ);
+    }
+    while (r < 0 && errno == EINTR);
+    if (r == 0)
+        return {};
+    if (errno != EINVAL)
+        return detail::make_err(errno);
+#endif
+#ifdef MADV_WILLNEED
+    // Starts readahead for the whole range before we touch it
+    ::madvise(base, len, MADV_WILLNEED);
+#endif
+#endif
+
+    auto const* q = reinterpret_cast<unsigned char const volatile*>(start);
+    for (std::size_t off = 0; off < len; off += page)
+        (void)q[off];
+    return {};
+}
+
+capy::task<capy::io_result<>>
+populate_range(
+    detail::thread_pool& pool, unsigned char const* addr, std::size_t len)
+{
+    if (len == 0)
+        co_return {};
+    auto ec = co_await detail::pool_call(
+        pool, [addr, len]() noexcept { return populate(addr, len); });
+    co_return {ec};
+}
+
+} // namespace
+
+mapped_file::mapped_file(random_access_file const& file)
+{
+    if (!file.is_open())
+        detail::throw_logic_error("mapped_file: file not open");
+
+    std::uint64_t const n = file.size();
+    if (n > (std::numeric_limits<std::size_t>::max)())
+        detail::throw_system_error(
+            std::make_error_code(std::errc::value_too_large), "mapped_file");
+
+    if (n != 0)
+    {
+#if BOOST_COROSIO_HAS_IOCP
+        auto fh = reinterpret_cast<HANDLE>(file.native_handle());
+        HANDLE sec =
+            ::CreateFileMappingW(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!sec)
+            detail::throw_system_error(
+                detail::make_err(::GetLastError()), "mapped_file");
+        void* p = ::MapViewOfFile(sec, FILE_MAP_READ, 0, 0, 0);
+        if (!p)
+        {
+            DWORD const err = ::GetLastError();
+            ::CloseHandle(sec);
+            detail::throw_system_error(detail::make_err(err), "mapped_file");
+        }
+        mapping_ = sec;
+#else
+        void* p = ::mmap(
+            nullptr, static_cast<std::size_t>(n), PROT_READ, MAP_SHARED,
+            file.native_handle(), 0);
+        if (p == MAP_FAILED)
+            detail::throw_system_error(detail::make_err(errno), "mapped_file");
+#endif
+        data_ = static_cast<unsigned char const*>(p);
+        size_ = static_cast<std::size_t>(n);
+    }
+    ctx_ = &file.context();
+}
+
+mapped_file::~mapped_file()
+{
+    reset();
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept
+    : ctx_(std::exchange(other.ctx_, nullptr))
+    , data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , mapping_(std::exchange(other.mapping_, nullptr))
+{
+}
+
+mapped_file&
+mapped_file::operator=(mapped_file&& other) noexcept
+{
+    if (this != &other)
+    {
+        reset();
+        ctx_     = std::exchange(other.ctx_, nullptr);
+        data_    = std::exchange(other.data_, nullptr);
+        size_    = std::exchange(other.size_, 0);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+    }
+    return *this;
+}
+
+void
+mapped_file::reset() noexcept
+{
+    if (data_)
+    {
+#if BOOST_COROSIO_HAS_IOCP
+        ::UnmapViewOfFile(data_);
+        ::CloseHandle(static_cast<HANDLE>(mapping_));
+#else
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+    }
+    ctx_     = nullptr;
+    data_    = nullptr;
+    size_    = 0;
+    mapping_ = nullptr;
+}
+
+capy::const_buffer
+mapped_file::view(std::uint64_t offset, std::size_t len) const
+{
+    if (offset > size_)
+        throw std::out_of_range("mapped_file::view: offset past end");
+    auto const off = static_cast<std::size_t>(offset);
+    if (len > size_ - off)
+        len = size_ - off;
+    return capy::const_buffer(data_ + off, len);
+}
+
+capy::task<capy::io_result<>>
+mapped_file::ensure_resident(std::uint64_t offset, std::size_t len)
+{
+    if (!is_open())
+        detail::throw_logic_error("ensure_resident: file not mapped");
+    if (offset >= size_)
+        len = 0;
+    auto const off = static_cast<std::size_t>(len ? offset : 0);
+    if (len > size_ - off)
+        len = size_ - off;
+    return populate_range(detail::find_or_make_pool(*ctx_), data_ + off, len);
+}
+
+} // namespace boost::corosio
@@ -0,0 +1,353 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/multicast_receiver.hpp>
+#include <boost/corosio/socket_option.hpp>
+#include <boost/corosio/detail/except.hpp>
+#include <boost/capy/error.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace boost::corosio {
+
+multicast_receiver::multicast_receiver(capy::execution_context& ctx)
+    : sock_(ctx)
+{
+}
+
+multicast_receiver::~multicast_receiver()
+{
+    close();
+}
+
+std::error_code
+multicast_receiver::open(endpoint ep, std::size_t max_datagram_size)
+{
+    close();
+
+    try
+    {
+        sock_.open(ep.is_v6() ? udp::v6() : udp::v4());
+        sock_.set_option(socket_option::reuse_address(true));
+        if (ep.is_v6())
+            sock_.set_option(socket_option::receive_packet_info_v6(true));
+        else
+            sock_.set_option(socket_option::receive_packet_info_v4(true));
+    }
+    catch (std::system_error const& e)
+    {
+        close();
+        return e.code();
+    }
+
+    // Linux only; elsewhere kernel_drops() stays zero
+    try
+    {
+        sock_.set_option(socket_option::receive_drop_count(true));
+    }
+    catch (std::system_error const&)
+    {
+    }
+
+    if (auto ec = sock_.bind(ep))
+    {
+        close();
+        return ec;
+    }
+
+    // One contiguous block carved into max_datagram_batch slots
+    storage_.resize(max_datagram_size * max_datagram_batch);
+    slots_.resize(max_datagram_batch);
+    for (std::size_t i = 0; i < slots_.size(); ++i)
+        slots_[i].buffer = capy::mutable_buffer(
+            storage_.data() + i * max_datagram_size, max_datagram_size);
+    return {};
+}
+
+multicast_receiver::group_state*
+multicast_receiver::find(endpoint const& addr) const noexcept
+{
+    // Linear: a few dozen groups fit in a handful of cache lines
+    for (auto const& g : groups_)
+        if (!g->left && g->addr == addr)
+            return g.get();
+    return nullptr;
+}
+
+void
+multicast_receiver::add_group(
+    endpoint addr, handler_type handler, sequence_type sequence)
+{
+    auto g      = std::make_unique<group_state>();
+    g->addr     = addr;
+    g->handler  = std::move(handler);
+    g->sequence = std::move(sequence);
+    groups_.push_back(std::move(g));
+}
+
+void
+multicast_receiver::drop(endpoint const& addr)
+{
+    // The running handler may be this group's; keep its state alive
+    if (dispatching_)
+    {
+        if (auto* g = find(addr))
+        {
+            g->left = true;
+            ++left_;
+        }
+        return;
+    }
+    std::erase_if(groups_, [&](auto const& g) { return g->addr == addr; });
+}
+
+void
+multicast_receiver::end_dispatch() noexcept
+{
+    dispatching_ = false;
+    if (left_ == 0)
+        return;
+    std::erase_if(groups_, [](auto const& g) { return g->left; });
+    left_ = 0;
+}
+
+std::error_code
+multicast_receiver::join(
+    ipv4_address group,
+    handler_type handler,
+    sequence_type sequence,
+    ipv4_address iface)
+{
+    if (!is_open())
+        detail::throw_logic_error("join: receiver not open");
+
+    endpoint addr(group, 0);
+    if (!handler)
+        return std::make_error_code(std::errc::invalid_argument);
+    if (find(addr))
+        return std::make_error_code(std::errc::address_in_use);
+
+    try
+    {
+        sock_.set_option(socket_option::join_group_v4(group, iface));
+    }
+    catch (std::system_error const& e)
+    {
+        return e.code();
+    }
+    add_group(addr, std::move(handler), std::move(sequence));
+    return {};
+}
+
+std::error_code
+multicast_receiver::join(
+    ipv6_address group,
+    handler_type handler,
+    sequence_type sequence,
+    unsigned if_index)
+{
+    if (!is_open())
+        detail::throw_logic_error("join: receiver not open");
+
+    endpoint addr(group, 0);
+    if (!handler)
+        return std::make_error_code(std::errc::invalid_argument);
+    if (find(addr))
+        return std::make_error_code(std::errc::address_in_use);
+
+    try
+    {
+        sock_.set_option(socket_option::join_group_v6(group, if_index));
+    }
+    catch (std::system_error const& e)
+    {
+        return e.code();
+    }
+    add_group(addr, std::move(handler), std::move(sequence));
+    return {};
+}
+
+std::error_code
+multicast_receiver::leave(ipv4_address group, ipv4_address iface)
+{
+    drop(endpoint(group, 0));
+    if (!is_open())
+        return {};
+    try
+    {
+        sock_.set_option(socket_option::leave_group_v4(group, iface));
+    }
+    catch (std::system_error const& e)
+    {
+        return e.code();
+    }
+    return {};
+}
+
+std::error_code
+multicast_receiver::leave(ipv6_address group, unsigned if_index)
+{
+    drop(endpoint(group, 0));
+    if (!is_open())
+        return {};
+    try
+    {
+        sock_.set_option(socket_option::leave_group_v6(group, if_index));
+    }
+    catch (std::system_error const& e)
+    {
+        return e.code();
+    }
+    return {};
+}
+
+multicast_receiver::group_state*
+multicast_receiver::route(datagram_slot const& slot, capy::const_buffer data)
+{
+    if (slot.info.has_drops)
+        kernel_drops_ = slot.info.drops;
+
+    group_state* g =
+        slot.info.has_local_address ? find(slot.info.local_address) : nullptr;
+    if (!g)
+    {
+        ++unrouted_;
+        return nullptr;
+    }
+
+    ++g->stats.packets;
+    g->stats.bytes += data.size();
+
+    if (g->sequence)
+    {
+        if (auto seq = g->sequence(data))
+        {
+            if (!g->have_seq)
+            {
+                g->have_seq = true;
+                g->next_seq = *seq + 1;
+            }
+            else if (*seq >= g->next_seq)
+            {
+                g->stats.gaps += *seq - g->next_seq;
+                g->next_seq = *seq + 1;
+            }
+            else
+            {
+                ++g->stats.reordered;
+            }
+        }
+    }
+    return g;
+}
+
+capy::task<capy::io_result<>>
+multicast_receiver::run()
+{
+    // Checked here so the throw happens at the call, not the first resume
+    if (!is_open())
+        detail::throw_logic_error("run: receiver not open");
+    return do_run();
+}
+
+capy::task<capy::io_result<>>
+multicast_receiver::do_run()
+{
+    for (;;)
+    {
+        auto [ec, n] = co_await sock_.recv_batch(slots_);
+        if (ec)
+            co_return {ec};
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            auto const& slot = slots_[i];
+            auto const* base = static_cast<char const*>(slot.buffer.data());
+
+            // A GRO-coalesced slot holds several datagrams of one flow
+            std::size_t step = slot.segment_size ? slot.segment_size
+                                                 : slot.size;
+            std::size_t off = 0;
+            do
+            {
+                capy::const_buffer data(
+                    base + off, (std::min)(step, slot.size - off));
+                off += step;
+
+                group_state* g = route(slot, data);
+                if (!g)
+                    continue;
+
+                multicast_packet p;
+                p.data            = data;
+                p.source          = slot.peer;
+                p.group           = g->addr;
+                p.interface_index = slot.info.interface_index;
+                dispatching_ = true;
+                try
+                {
+                    co_await g->handler(p);
+                }
+                catch (...)
+                {
+                    end_dispatch();
+                    throw;
+                }
+                end_dispatch();
+
+                // Closed by the handler
+                if (!sock_.is_open())
+                    co_return {capy::error::canceled};
+            }
+            while (step != 0 && off < slot.size);
+        }
+    }
+}
+
+multicast_group_stats
+multicast_receiver::stats(ipv4_address group) const noexcept
+{
+    auto* g = find(endpoint(group, 0));
+    return g ? g->stats : multicast_group_stats{};
+}
+
+multicast_group_stats
+multicast_receiver::stats(ipv6_address group) const noexcept
+{
+    auto* g = find(endpoint(group, 0));
+    return g ? g->stats : multicast_group_stats{};
+}
+
+void
+multicast_receiver::cancel()
+{
+    if (sock_.is_open())
+        sock_.cancel();
+}
+
+void
+multicast_receiver::close()
+{
+    if (dispatching_)
+    {
+        for (auto& g : groups_)
+            g->left = true;
+        left_ = groups_.size();
+    }
+    else
+    {
+        groups_.clear();
+    }
+    sock_.close();
+    unrouted_     = 0;
+    kernel_drops_ = 0;
+}
+
+} // namespace boost::corosio
@@ -0,0 +1,594 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/process.hpp>
+
+#if BOOST_COROSIO_HAS_EPOLL
+
+#include <boost/corosio/detail/except.hpp>
+#include <boost/corosio/native/detail/make_err.hpp>
+#include <boost/corosio/native/detail/posix/posix_process_service.hpp>
+#include <boost/capy/ex/io_env.hpp>
+
+#include <coroutine>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// glibc 2.39 spawns straight into a pidfd; older libraries use clone3
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 39))
+#define BOOST_COROSIO_PIDFD_SPAWN 1
+#include <sys/pidfd.h>
+#else
+#define BOOST_COROSIO_PIDFD_SPAWN 0
+#endif
+
+#ifndef SYS_clone3
+#define SYS_clone3 435
+#endif
+
+#ifndef SYS_pidfd_send_signal
+#define SYS_pidfd_send_signal 424
+#endif
+
+#ifndef CLONE_PIDFD
+#define CLONE_PIDFD 0x00001000
+#endif
+
+extern "C" char** environ;
+
+/*
+    Child processes
+    ===============
+
+    spawn() obtains the child's pidfd from the spawn itself, through
+    pidfd_spawnp or clone3(CLONE_PIDFD). A pidfd opened from the pid
+    afterwards could name an unrelated process: the application may
+    reap children with waitpid(-1), or ignore SIGCHLD, and the pid
+    can be reused before the open. Nothing here ever signals or waits
+    on a raw pid.
+
+    The clone3 child runs with fork semantics in a copy of a possibly
+    multithreaded parent, so it only makes async-signal-safe calls.
+    Everything it needs, including each PATH candidate, is built
+    beforehand, and it reports a failure before exec through a
+    close-on-exec pipe.
+
+    A piped stream is a socketpair rather than a pipe: the parent's end
+    is adopted by a local_stream_socket, which gives it the reactor's
+    read and write paths, and sends use MSG_NOSIGNAL, so a write to a
+    child that has exited reports EPIPE instead of raising SIGPIPE.
+    The child's end is dup2'd onto 0, 1 or 2 and keeps blocking mode.
+
+    wait() hands the pidfd to the context's posix_process_service,
+    which reaps the child with waitid(P_PIDFD) when it polls readable.
+    A process destroyed while its child runs hands the pidfd over for
+    good, and the service reaps the child whenever it exits.
+*/
+
+namespace boost::corosio {
+
+struct process::state
+{
+    capy::execution_context* ctx;
+    local_stream_socket in;
+    local_stream_socket out;
+    local_stream_socket err;
+    int pid       = -1;
+    int pidfd     = -1;
+    int exit_code = 0;
+
+    explicit state(capy::execution_context& c)
+        : ctx(&c)
+        , in(c)
+        , out(c)
+        , err(c)
+    {
+    }
+
+    ~state()
+    {
+        if (pidfd < 0)
+            return;
+
+        // Reap the child if it is already gone
+        siginfo_t info{};
+        if (::waitid(
+                detail::p_pidfd, static_cast<id_t>(pidfd), &info,
+                WEXITED | WNOHANG) == 0 &&
+            info.si_pid != 0)
+        {
+            ::close(pidfd);
+            return;
+        }
+
+        // Still running: the service reaps it when it exits
+        auto* svc = ctx->find_service<detail::posix_process_service>();
+        if (svc && svc->reap_later(pidfd))
+            return;
+        ::close(pidfd);
+    }
+};
+
+namespace {
+
+// Descriptors created by spawn(), closed unless released
+struct spawn_fds
+{
+    int parent[3] = {-1, -1, -1};
+    int child[3]  = {-1, -1, -1};
+
+    ~spawn_fds()
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            if (parent[i] >= 0)
+                ::close(parent[i]);
+            if (child[i] >= 0)
+                ::close(child[i]);
+        }
+    }
+};
+
+[[noreturn]] void
+throw_errno(int err, char const* what)
+{
+    detail::throw_system_error(detail::make_err(err), what);
+}
+
+// What the child does between the spawn and exec
+struct child_plan
+{
+    int stdio[3]      = {-1, -1, -1}; // dup2'd onto 0, 1, 2; -1 inherits
+    char const* dir   = nullptr;
+    char const* path  = nullptr;
+    char* const* argv = nullptr;
+    char* const* envp = nullptr;
+};
+
+#if BOOST_COROSIO_PIDFD_SPAWN
+
+struct file_actions
+{
+    posix_spawn_file_actions_t a;
+
+    file_actions()
+    {
+        ::posix_spawn_file_actions_init(&a);
+    }
+
+    ~file_actions()
+    {
+        ::posix_spawn_file_actions_destroy(&a);
+    }
+};
+
+// Returns the error, or 0 with pidfd and pid set
+int
+spawn_child(child_plan const& plan, int& pidfd, pid_t& pid)
+{
+    file_actions actions;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (plan.stdio[i] < 0)
+            continue;
+        if (int rc = ::posix_spawn_file_actions_adddup2(
+                &actions.a, plan.stdio[i], i))
+            return rc;
+    }
+    if (plan.dir)
+    {
+        if (int rc =
+                ::posix_spawn_file_actions_addchdir_np(&actions.a, plan.dir))
+            return rc;
+    }
+
+    if (int rc = ::pidfd_spawnp(
+            &pidfd, plan.path, &actions.a, nullptr, plan.argv, plan.envp))
+        return rc;
+    pid = ::pidfd_getpid(pidfd);
+    return 0;
+}
+
+#else
+
+// Leading fields of the kernel's struct clone_args
+struct clone3_args
+{
+    std::uint64_t flags;
+    std::uint64_t pidfd;
+    std::uint64_t child_tid;
+    std::uint64_t parent_tid;
+    std::uint64_t exit_signal;
+    std::uint64_t stack;
+    std::uint64_t stack_size;
+    std::uint64_t tls;
+};
+
+// The executables to try, in PATH order, as execvp would
+std::vector<std::string>
+exec_candidates(char const* name)
+{
+    std::vector<std::string> out;
+    std::string_view const sv(name);
+    if (sv.find('/') != std::string_view::npos)
+    {
+        out.emplace_back(sv);
+        return out;
+    }
+
+    char const* env = std::getenv("PATH");
+    std::string_view rest(env ? env : "/bin:/usr/bin");
+    for (;;)
+    {
+        auto colon = rest.find(':');
+        auto dir   = rest.substr(0, colon);
+        std::string c(dir.empty() ? std::string_view(".") : dir);
+        c.push_back('/');
+        c.append(sv);
+        out.push_back(std::move(c));
+        if (colon == std::string_view::npos)
+            break;
+        rest.remove_prefix(colon + 1);
+    }
+    return out;
+}
+
+// Runs in the clone3 child; async-signal-safe calls only
+[[noreturn]] void
+run_child(
+    child_plan const& plan,
+    std::vector<std::string> const& candidates,
+    sigset_t const& mask,
+    int err_fd) noexcept
+{
+    // A handler inherited from the parent must not run in the
+    // child before exec
+    for (int sig = 1; sig < NSIG; ++sig)
+    {
+        struct sigaction sa{};
+        if (::sigaction(sig, nullptr, &sa) == 0 && sa.sa_handler != SIG_DFL &&
+            sa.sa_handler != SIG_IGN)
+        {
+            sa.sa_handler = SIG_DFL;
+            sa.sa_flags   = 0;
+            ::sigaction(sig, &sa, nullptr);
+        }
+    }
+
+    int err = 0;
+    for (int i = 0; i < 3 && err == 0; ++i)
+    {
+        int fd = plan.stdio[i];
+        if (fd < 0)
+            continue;
+        // dup2 onto itself would keep close-on-exec set
+        if (fd == i ? ::fcntl(fd, F_SETFD, 0) < 0 : ::dup2(fd, i) < 0)
+            err = errno;
+    }
+    if (err == 0 && plan.dir && ::chdir(plan.dir) < 0)
+        err = errno;
+
+    if (err == 0)
+    {
+        ::pthread_sigmask(SIG_SETMASK, &mask, nullptr);
+        err = ENOENT;
+        for (auto const& c : candidates)
+        {
+            ::execve(c.c_str(), plan.argv, plan.envp);
+            if (err != EACCES)
+                err = errno;
+        }
+    }
+
+    while (::write(err_fd, &err, sizeof(err)) < 0 && errno == EINTR)
+    {
+    }
+    ::_exit(127);
+}
+
+// Returns the error, or 0 with pidfd and pid set
+int
+spawn_child(child_plan const& plan, int& pidfd, pid_t& pid)
+{
+    auto const candidates = exec_candidates(plan.path);
+
+    int err_pipe[2];
+    if (::pipe2(err_pipe, O_CLOEXEC) < 0)
+        return errno;
+
+    // Keep the parent's handlers from running in the child
+    sigset_t all, old;
+    ::sigfillset(&all);
+    ::pthread_sigmask(SIG_SETMASK, &all, &old);
+
+    int fd = -1;
+    clone3_args args{};
+    args.flags       = CLONE_PIDFD;
+    args.pidfd       = reinterpret_cast<std::uintptr_t>(&fd);
+    args.exit_signal = SIGCHLD;
+    long r           = ::syscall(SYS_clone3, &args, sizeof(args));
+    if (r == 0)
+        run_child(plan, candidates, old, err_pipe[1]);
+    int const clone_err = errno;
+
+    ::pthread_sigmask(SIG_SETMASK, &old, nullptr);
+    ::close(err_pipe[1]);
+    if (r < 0)
+    {
+        ::close(err_pipe[0]);
+        return clone_err;
+    }
+
+    // The pipe closes on exec; data means the child failed first
+    int child_err = 0;
+    ssize_t n;
+    while ((n = ::read(err_pipe[0], &child_err, sizeof(child_err))) < 0 &&
+           errno == EINTR)
+    {
+    }
+    ::close(err_pipe[0]);
+    if (n == static_cast<ssize_t>(sizeof(child_err)))
+    {
+        siginfo_t info{};
+        ::waitid(detail::p_pidfd, static_cast<id_t>(fd), &info, WEXITED);
+        ::close(fd);
+        return child_err;
+    }
+
+    pidfd = fd;
+    pid   = static_cast<pid_t>(r);
+    return 0;
+}
+
+#endif
+
+struct exit_awaitable
+{
+    detail::posix_process_service& svc_;
+    detail::process_wait_op& op_;
+
+    struct canceller
+    {
+        detail::posix_process_service* svc;
+        detail::process_wait_op* op;
+
+        void operator()() const
+        {
+            svc->cancel_wait(op);
+        }
+    };
+
+    std::optional<std::stop_callback<canceller>> stop_cb_;
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+    {
+        op_.h  = h;
+        op_.ex = env->executor;
+
+        // Installed first: a stop request that lands before the op
+        // is queued is caught by start_wait, one after it by this.
+        stop_cb_.emplace(env->stop_token, canceller{&svc_, &op_});
+        if (auto ec = svc_.start_wait(&op_, env->stop_token))
+        {
+            op_.ec = ec;
+            return false;
+        }
+        return true;
+    }
+
+    void await_resume() noexcept
+    {
+        stop_cb_.reset();
+    }
+};
+
+} // namespace
+
+process::process(capy::execution_context& ctx)
+    : ctx_(&ctx)
+    , st_(std::make_unique<state>(ctx))
+{
+}
+
+process::~process() = default;
+
+process::process(process&&) noexcept            = default;
+process& process::operator=(process&&) noexcept = default;
+
+void
+process::spawn(
+    std::string const& path,
+    std::vector<std::string> const& args,
+    process_options const& opts)
+{
+    if (st_->pidfd >= 0)
+        detail::throw_logic_error("spawn: child not waited for");
+
+    st_->in.close();
+    st_->out.close();
+    st_->err.close();
+
+    spawn_fds fds;
+    child_plan plan;
+
+    process_stdio const modes[3] = {
+        opts.stdin_mode, opts.stdout_mode, opts.stderr_mode};
+    for (int i = 0; i < 3; ++i)
+    {
+        if (modes[i] == process_stdio::pipe)
+        {
+            int sv[2];
+            if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) < 0)
+                throw_errno(errno, "socketpair");
+            fds.parent[i] = sv[0];
+            fds.child[i]  = sv[1];
+
+            int flags = ::fcntl(sv[0], F_GETFL, 0);
+            if (flags < 0 || ::fcntl(sv[0], F_SETFL, flags | O_NONBLOCK) < 0)
+                throw_errno(errno, "fcntl");
+        }
+        else if (modes[i] == process_stdio::null)
+        {
+            int fd = ::open(
+                "/dev/null", (i == 0 ? O_RDONLY : O_WRONLY) | O_CLOEXEC);
+            if (fd < 0)
+                throw_errno(errno, "open");
+            fds.child[i] = fd;
+        }
+        plan.stdio[i] = fds.child[i];
+    }
+
+    if (!opts.working_directory.empty())
+        plan.dir = opts.working_directory.c_str();
+
+    std::vector<char*> argv;
+    argv.reserve(args.size() + 2);
+    argv.push_back(const_cast<char*>(path.c_str()));
+    for (auto const& a : args)
+        argv.push_back(const_cast<char*>(a.c_str()));
+    argv.push_back(nullptr);
+
+    std::vector<char*> envp;
+    char** env = environ;
+    if (!opts.environment.empty())
+    {
+        envp.reserve(opts.environment.size() + 1);
+        for (auto const& e : opts.environment)
+            envp.push_back(const_cast<char*>(e.c_str()));
+        envp.push_back(nullptr);
+        env = envp.data();
+    }
+
+    plan.path = path.c_str();
+    plan.argv = argv.data();
+    plan.envp = env;
+
+    int pidfd = -1;
+    pid_t pid = -1;
+    if (int rc = spawn_child(plan, pidfd, pid))
+        throw_errno(rc, "spawn");
+
+    // The child holds its ends now
+    for (int i = 0; i < 3; ++i)
+    {
+        if (fds.child[i] >= 0)
+            ::close(fds.child[i]);
+        fds.child[i] = -1;
+    }
+
+    st_->pid       = pid;
+    st_->pidfd     = pidfd;
+    st_->exit_code = 0;
+
+    // From here the child is ours to wait for, even if adopting a
+    // pipe fails
+    local_stream_socket* pipes[3] = {&st_->in, &st_->out, &st_->err};
+    for (int i = 0; i < 3; ++i)
+    {
+        if (fds.parent[i] < 0)
+            continue;
+        pipes[i]->assign(fds.parent[i]);
+        fds.parent[i] = -1;
+    }
+}
+
+int
+process::id() const noexcept
+{
+    return st_->pid;
+}
+
+int
+process::native_handle() const noexcept
+{
+    return st_->pidfd;
+}
+
+local_stream_socket&
+process::stdin_pipe() noexcept
+{
+    return st_->in;
+}
+
+local_stream_socket&
+process::stdout_pipe() noexcept
+{
+    return st_->out;
+}
+
+local_stream_socket&
+process::stderr_pipe() noexcept
+{
+    return st_->err;
+}
+
+std::error_code
+process::send_signal(int signal_number)
+{
+    if (st_->pidfd < 0)
+        return make_error_code(std::errc::no_such_process);
+    if (::syscall(
+            SYS_pidfd_send_signal, st_->pidfd, signal_number, nullptr, 0) < 0)
+        return detail::make_err(errno);
+    return {};
+}
+
+capy::task<capy::io_result<int>>
+process::wait()
+{
+    if (st_->pid < 0)
+        detail::throw_logic_error("wait: no child spawned");
+    return do_wait();
+}
+
+capy::task<capy::io_result<int>>
+process::do_wait()
+{
+    if (st_->pidfd < 0)
+        co_return {{}, st_->exit_code};
+
+    auto* svc = ctx_->find_service<detail::posix_process_service>();
+    if (!svc)
+        co_return {make_error_code(std::errc::operation_not_supported), 0};
+
+    detail::process_wait_op op;
+    op.pidfd = st_->pidfd;
+    co_await exit_awaitable{*svc, op};
+    if (op.ec)
+        co_return {op.ec, 0};
+
+    ::close(st_->pidfd);
+    st_->pidfd     = -1;
+    st_->exit_code = op.exit_code;
+    co_return {{}, op.exit_code};
+}
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_HAS_EPOLL
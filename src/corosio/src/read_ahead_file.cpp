@@ -0,0 +1,439 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/read_ahead_file.hpp>
+#include <boost/corosio/aligned_allocator.hpp>
+#include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+#include <boost/capy/ex/io_env.hpp>
+#include <boost/capy/ex/run_async.hpp>
+
+#include <algorithm>
+#include <coroutine>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+/*
+    Read-ahead window
+    =================
+
+    The window is a deque of chunks at consecutive offsets, the
+    head holding the current position. Each chunk is filled by its
+    own coroutine spawned on the reader's executor, which loops on
+    read_some_at until the chunk is full, the file ends, or a read
+    fails, then marks the chunk done under the mutex. Fills complete
+    in any order; read_some only ever looks at the head, so the
+    reordering falls out of the deque.
+
+    A chunk and its buffer are owned jointly by the window and the
+    fill coroutine. Emptying the window (seek, end of file, error,
+    close) just drops the window's references; fills still in
+    flight finish into their orphaned chunk and free it.
+
+    At most one read_some waits at a time, on the head chunk. The
+    fill that completes it posts the waiter to the waiter's own
+    executor.
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+struct chunk
+{
+    std::vector<char, aligned_allocator<char>> data;
+    std::uint64_t offset = 0;
+    std::size_t size     = 0;
+    std::error_code ec;
+    bool done     = false;
+    bool orphaned = false;
+};
+
+struct waiter
+{
+    std::coroutine_handle<> h;
+    capy::executor_ref ex;
+    detail::continuation_op cont_op;
+    chunk const* c = nullptr;
+};
+
+} // namespace
+
+struct read_ahead_file::state
+{
+    capy::any_executor ex;
+    random_access_file file;
+    read_ahead_options opts;
+
+    std::mutex mutex;
+    std::deque<std::shared_ptr<chunk>> window;
+    std::vector<std::shared_ptr<chunk>> spare;
+    std::uint64_t pos         = 0; // offset of the next byte returned
+    std::uint64_t next_offset = 0; // offset of the next chunk issued
+    std::size_t head_used     = 0; // bytes of the head already returned
+    bool at_eof               = false;
+    waiter* wait              = nullptr;
+    read_ahead_stats stats;
+
+    state(
+        capy::any_executor ex_,
+        random_access_file file_,
+        read_ahead_options const& opts_)
+        : ex(std::move(ex_))
+        , file(std::move(file_))
+        , opts(opts_)
+    {
+    }
+
+    static void top_up(std::shared_ptr<state> const& self);
+    static capy::task<>
+    fill(std::shared_ptr<state> self, std::shared_ptr<chunk> c);
+
+    // Called with mutex held.
+    void reset() noexcept
+    {
+        for (auto& c : window)
+        {
+            if (!c->done)
+                c->orphaned = true;
+            else if (c == window.front())
+                stats.bytes_discarded += c->size - head_used;
+            else
+                stats.bytes_discarded += c->size;
+        }
+        window.clear();
+        head_used   = 0;
+        next_offset = pos;
+        at_eof      = false;
+    }
+
+    // Empty the window, then cancel the fills still in flight.
+    void cancel_window()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            reset();
+        }
+        file.cancel();
+    }
+
+    // Called with mutex held.
+    void recycle(std::shared_ptr<chunk> c)
+    {
+        // A fill that has just finished may still hold a reference
+        if (c.use_count() == 1 && spare.size() < opts.depth)
+            spare.push_back(std::move(c));
+    }
+
+    struct wait_awaitable
+    {
+        struct canceller
+        {
+            state* s;
+            void operator()() const
+            {
+                s->cancel_window();
+            }
+        };
+
+        state& s_;
+        chunk const* c_;
+        waiter w_;
+        std::optional<std::stop_callback<canceller>> stop_cb_;
+
+        wait_awaitable(state& s, chunk const* c) noexcept : s_(s), c_(c) {}
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+        {
+            // Registered before the waiter so the fill cannot resume
+            // us while the callback is still being constructed
+            if (env->stop_token.stop_possible())
+                stop_cb_.emplace(env->stop_token, canceller{&s_});
+
+            std::lock_guard<std::mutex> lock(s_.mutex);
+            if (c_->done)
+                return false;
+            w_.h  = h;
+            w_.ex = env->executor;
+            w_.c  = c_;
+            s_.wait = &w_;
+            ++s_.stats.stalls;
+            return true;
+        }
+
+        void await_resume() noexcept
+        {
+            stop_cb_.reset();
+        }
+    };
+};
+
+void
+read_ahead_file::state::top_up(std::shared_ptr<state> const& self)
+{
+    for (;;)
+    {
+        std::shared_ptr<chunk> c;
+        {
+            std::lock_guard<std::mutex> lock(self->mutex);
+            if (self->at_eof || self->window.size() >= self->opts.depth ||
+                !self->file.is_open())
+                return;
+            if (!self->spare.empty())
+            {
+                c = std::move(self->spare.back());
+                self->spare.pop_back();
+            }
+            else
+            {
+                c = std::make_shared<chunk>();
+                c->data.resize(self->opts.chunk_size);
+            }
+            c->offset   = self->next_offset;
+            c->size     = 0;
+            c->ec       = {};
+            c->done     = false;
+            c->orphaned = false;
+            self->next_offset += self->opts.chunk_size;
+            self->window.push_back(c);
+            ++self->stats.chunks;
+        }
+        // Outside the lock: the fill may run inline up to its
+        // first suspension
+        capy::run_async(self->ex)(fill(self, std::move(c)));
+    }
+}
+
+capy::task<>
+read_ahead_file::state::fill(
+    std::shared_ptr<state> self, std::shared_ptr<chunk> c)
+{
+    std::size_t const want = c->data.size();
+    std::size_t n          = 0;
+    std::error_code ec;
+    while (n < want)
+    {
+        if (!self->file.is_open())
+        {
+            ec = capy::error::canceled;
+            break;
+        }
+        auto [rec, k] = co_await self->file.read_some_at(
+            c->offset + n, capy::mutable_buffer(c->data.data() + n, want - n));
+        n += k;
+        if (rec)
+        {
+            if (rec != capy::cond::eof)
+                ec = rec;
+            break;
+        }
+    }
+
+    waiter* w = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(self->mutex);
+        c->size = n;
+        c->ec   = ec;
+        c->done = true;
+        self->stats.bytes_fetched += n;
+        if (c->orphaned)
+            self->stats.bytes_discarded += n;
+        else if (!ec && n < want)
+            self->at_eof = true;
+        if (self->wait && self->wait->c == c.get())
+            w = std::exchange(self->wait, nullptr);
+    }
+    if (w)
+    {
+        w->cont_op.cont.h = w->h;
+        w->ex.post(w->cont_op.cont);
+    }
+}
+
+void
+read_ahead_file::init(
+    capy::any_executor ex,
+    random_access_file file,
+    read_ahead_options const& opts)
+{
+    if (opts.chunk_size == 0 || opts.depth == 0)
+        throw std::invalid_argument(
+            "read_ahead_file requires a nonzero chunk_size and depth");
+    st_ = std::make_shared<state>(std::move(ex), std::move(file), opts);
+}
+
+read_ahead_file::~read_ahead_file()
+{
+    close();
+}
+
+void
+read_ahead_file::open(std::filesystem::path const& path, file_base::flags mode)
+{
+    close();
+    st_->file.open(path, mode);
+
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    st_->pos         = 0;
+    st_->next_offset = 0;
+    st_->at_eof      = false;
+}
+
+void
+read_ahead_file::close()
+{
+    if (!st_)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(st_->mutex);
+        st_->reset();
+        st_->spare.clear();
+    }
+    // Cancels the fills still in flight
+    st_->file.close();
+}
+
+bool
+read_ahead_file::is_open() const noexcept
+{
+    return st_ && st_->file.is_open();
+}
+
+capy::task<capy::io_result<std::size_t>>
+read_ahead_file::do_read_some(buffer_array bufs)
+{
+    // Keeps the state alive should the reader be moved from
+    auto s = st_;
+
+    std::size_t want = 0;
+    for (std::size_t i = 0; i < bufs.n; ++i)
+        want += bufs.b[i].size();
+    if (want == 0)
+        co_return {std::error_code{}, 0};
+
+    state::top_up(s);
+
+    std::shared_ptr<chunk> head;
+    {
+        std::lock_guard<std::mutex> lock(s->mutex);
+        if (s->window.empty())
+            co_return {make_error_code(capy::error::canceled), 0};
+        head = s->window.front();
+    }
+
+    co_await state::wait_awaitable(*s, head.get());
+
+    std::size_t n = 0;
+    {
+        std::lock_guard<std::mutex> lock(s->mutex);
+
+        // Closed or cancelled while waiting
+        if (s->window.empty() || s->window.front() != head)
+            co_return {make_error_code(capy::error::canceled), 0};
+
+        // Data read before a failure is still returned; the error
+        // surfaces once the chunk is drained
+        std::size_t const avail = head->size - s->head_used;
+        if (avail == 0)
+        {
+            std::error_code ec = head->ec;
+            if (!ec)
+                ec = capy::error::eof;
+            s->reset();
+            co_return {ec, 0};
+        }
+
+        char const* src = head->data.data() + s->head_used;
+        std::size_t left = (std::min)(avail, want);
+        for (std::size_t i = 0; i < bufs.n && left > 0; ++i)
+        {
+            std::size_t const k = (std::min)(bufs.b[i].size(), left);
+            std::memcpy(bufs.b[i].data(), src, k);
+            src += k;
+            left -= k;
+            n += k;
+        }
+        s->head_used += n;
+        s->pos += n;
+
+        // A short head stays until the next read reports the end
+        if (s->head_used == head->data.size())
+        {
+            s->window.pop_front();
+            s->head_used = 0;
+            s->recycle(std::move(head));
+        }
+    }
+
+    state::top_up(s);
+    co_return {std::error_code{}, n};
+}
+
+void
+read_ahead_file::seek(std::uint64_t offset)
+{
+    if (!st_)
+        detail::throw_logic_error("seek: moved-from read_ahead_file");
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    st_->reset();
+    st_->pos         = offset;
+    st_->next_offset = offset;
+}
+
+std::uint64_t
+read_ahead_file::position() const noexcept
+{
+    if (!st_)
+        return 0;
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    return st_->pos;
+}
+
+read_ahead_options const&
+read_ahead_file::options() const noexcept
+{
+    return st_->opts;
+}
+
+read_ahead_stats
+read_ahead_file::stats() const noexcept
+{
+    if (!st_)
+        return {};
+    std::lock_guard<std::mutex> lock(st_->mutex);
+    return st_->stats;
+}
+
+void
+read_ahead_file::cancel()
+{
+    if (st_)
+        st_->cancel_window();
+}
+
+random_access_file&
+read_ahead_file::file() noexcept
+{
+    return st_->file;
+}
+
+} // namespace boost::corosio
@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/relay.hpp>
+
+#include <system_error>
+
+#if defined(__linux__)
+#include <boost/corosio/native/detail/make_err.hpp>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace boost::corosio::detail {
+
+#if defined(__linux__)
+
+namespace {
+
+// Default Linux pipe size; used when F_GETPIPE_SZ is unavailable.
+constexpr std::size_t default_pipe_size = 65536;
+
+} // namespace
+
+std::error_code
+open_relay_pipe(relay_pipe& p) noexcept
+{
+    int fds[2];
+    if (::pipe2(fds, O_NONBLOCK | O_CLOEXEC) < 0)
+        return make_err(errno);
+    p.rd       = fds[0];
+    p.wr       = fds[1];
+    p.buffered = 0;
+
+    int sz     = ::fcntl(p.wr, F_GETPIPE_SZ);
+    p.capacity = sz > 0 ? static_cast<std::size_t>(sz) : default_pipe_size;
+    return {};
+}
+
+void
+close_relay_pipe(relay_pipe& p) noexcept
+{
+    if (p.rd >= 0)
+        ::close(p.rd);
+    if (p.wr >= 0)
+        ::close(p.wr);
+    p.rd = p.wr = -1;
+    p.buffered  = 0;
+}
+
+std::error_code
+splice_in(relay_pipe& p, native_handle_type src, std::size_t& n) noexcept
+{
+    n = 0;
+    for (;;)
+    {
+        ssize_t r = ::splice(
+            src, nullptr, p.wr, nullptr, p.capacity - p.buffered,
+            SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (r >= 0)
+        {
+            n = static_cast<std::size_t>(r);
+            p.buffered += n;
+            return {};
+        }
+        if (errno != EINTR)
+            return make_err(errno);
+    }
+}
+
+std::error_code
+splice_out(relay_pipe& p, native_handle_type dst, std::size_t& n) noexcept
+{
+    n = 0;
+    for (;;)
+    {
+        ssize_t r = ::splice(
+            p.rd, nullptr, dst, nullptr, p.buffered,
+            SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (r >= 0)
+        {
+            n = static_cast<std::size_t>(r);
+            p.buffered -= n;
+            return {};
+        }
+        if (errno != EINTR)
+            return make_err(errno);
+    }
+}
+
+#else
+
+std::error_code
+open_relay_pipe(relay_pipe&) noexcept
+{
+    return std::make_error_code(std::errc::operation_not_supported);
+}
+
+void
+close_relay_pipe(relay_pipe&) noexcept
+{
+}
+
+std::error_code
+splice_in(relay_pipe&, native_handle_type, std::size_t& n) noexcept
+{
+    n = 0;
+    return std::make_error_code(std::errc::operation_not_supported);
+}
+
+std::error_code
+splice_out(relay_pipe&, native_handle_type, std::size_t& n) noexcept
+{
+    n = 0;
+    return std::make_error_code(std::errc::operation_not_supported);
+}
+
+#endif
+
+} // namespace boost::corosio::detail
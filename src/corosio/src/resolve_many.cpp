@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/resolve_many.hpp>
+#include <boost/corosio/detail/continuation_op.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/executor_ref.hpp>
+#include <boost/capy/ex/io_env.hpp>
+#include <boost/capy/ex/run_async.hpp>
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+
+/*
+    Batched resolution
+    ==================
+
+    resolve_many launches max_in_flight worker coroutines on the
+    caller's executor, each owning one resolver. A worker takes the
+    next unstarted index under the batch mutex, resolves it, hands
+    the result to the callback under a second mutex (so calls never
+    overlap on a multi-threaded context) and loops. Workers inherit
+    the caller's stop token, so a stop request cancels the lookups
+    in flight, and a stopped worker takes no new index. A callback
+    that throws stops the batch the same way: its worker records the
+    first exception and leaves, the others finish their lookups, and
+    do_resolve_many rethrows once all have left.
+
+    The batch state lives in the frame of the awaiting coroutine,
+    which stays suspended in join_awaitable until the last worker
+    leaves and posts it, as read_ahead_file's fills post their
+    waiter.
+*/
+
+namespace boost::corosio {
+
+namespace {
+
+struct batch
+{
+    std::span<host_service const> queries;
+    resolve_many_handler const* on_result = nullptr;
+    std::stop_token stop;
+
+    std::mutex mutex;
+    std::size_t next   = 0;
+    std::size_t active = 0;
+    std::coroutine_handle<> h;
+    capy::executor_ref ex;
+    detail::continuation_op cont_op;
+
+    std::mutex deliver_mutex;
+
+    // First exception thrown by on_result
+    std::exception_ptr error;
+
+    // Return the next index to resolve, or `queries.size()`.
+    std::size_t take()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error || stop.stop_requested())
+            return queries.size();
+        return next < queries.size() ? next++ : queries.size();
+    }
+
+    void fail(std::exception_ptr ep) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error)
+            error = std::move(ep);
+    }
+
+    void leave()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--active != 0 || !h)
+                return;
+        }
+        cont_op.cont.h = h;
+        ex.post(cont_op.cont);
+    }
+};
+
+struct join_awaitable
+{
+    batch& b_;
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> h, capy::io_env const* env)
+    {
+        std::lock_guard<std::mutex> lock(b_.mutex);
+        if (b_.active == 0)
+            return false;
+        b_.h  = h;
+        b_.ex = env->executor;
+        return true;
+    }
+
+    void await_resume() const noexcept {}
+};
+
+capy::task<>
+worker(batch& b, capy::execution_context& ctx)
+{
+    resolver r(ctx);
+    for (;;)
+    {
+        auto i = b.take();
+        if (i == b.queries.size())
+            break;
+        auto const& q  = b.queries[i];
+        auto [ec, res] = co_await r.resolve(q.host, q.service, q.flags);
+        try
+        {
+            std::lock_guard<std::mutex> lock(b.deliver_mutex);
+            (*b.on_result)(i, ec, std::move(res));
+        }
+        catch (...)
+        {
+            b.fail(std::current_exception());
+            break;
+        }
+    }
+    b.leave();
+}
+
+capy::task<capy::io_result<>>
+do_resolve_many(
+    std::span<host_service const> queries,
+    resolve_many_handler on_result,
+    std::size_t max_in_flight)
+{
+    auto env = co_await capy::this_coro::environment;
+
+    batch b;
+    b.queries   = queries;
+    b.on_result = &on_result;
+    b.stop      = env->stop_token;
+
+    auto n   = (std::min)(max_in_flight, queries.size());
+    b.active = n;
+    for (std::size_t i = 0; i < n; ++i)
+        capy::run_async(env->executor, env->stop_token)(
+            worker(b, env->executor.context()));
+    co_await join_awaitable{b};
+
+    if (b.error)
+        std::rethrow_exception(b.error);
+    if (b.next < queries.size() || env->stop_token.stop_requested())
+        co_return {capy::error::canceled};
+    co_return {};
+}
+
+} // namespace
+
+capy::task<capy::io_result<>>
+resolve_many(
+    std::span<host_service const> queries,
+    resolve_many_handler on_result,
+    resolve_many_options const& opts)
+{
+    if (opts.max_in_flight == 0)
+        throw std::invalid_argument(
+            "resolve_many: max_in_flight must be at least 1");
+    return do_resolve_many(queries, std::move(on_result), opts.max_in_flight);
+}
+
+} // namespace boost::corosio
@@ -0,0 +1,439 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/shm_channel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <system_error>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace boost::corosio {
+
+namespace detail {
+
+/* One direction of the channel.
+
+   head is advanced only by the producer and tail only by the
+   consumer; both are free-running and wrap through the power-of-two
+   mask. The *_waiting flags implement the "ring only when parked"
+   handshake: a side stores its flag, then re-reads the peer's index,
+   while the peer publishes its index, then exchanges the flag. With
+   both sides sequentially consistent, at least one of them sees the
+   other, so a wakeup is never lost.
+*/
+struct shm_ring
+{
+    alignas(64) std::atomic<std::uint64_t> head{0};
+    alignas(64) std::atomic<std::uint32_t> reader_waiting{0};
+    alignas(64) std::atomic<std::uint64_t> tail{0};
+    alignas(64) std::atomic<std::uint32_t> writer_waiting{0};
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+} // namespace detail
+
+namespace {
+
+constexpr std::uint32_t shm_magic   = 0x434f5348; // "COSH"
+constexpr std::uint32_t shm_version = 1;
+
+struct alignas(64) shm_layout
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t capacity;
+};
+
+constexpr std::size_t min_capacity = 64;
+constexpr std::size_t max_capacity = std::size_t(1) << 30;
+
+// [layout][ring 0][ring 1][data 0][data 1]
+constexpr std::size_t
+layout_size(std::size_t capacity) noexcept
+{
+    return sizeof(shm_layout) + 2 * sizeof(detail::shm_ring) + 2 * capacity;
+}
+
+std::size_t
+round_capacity(std::size_t n) noexcept
+{
+    std::size_t cap = min_capacity;
+    while (cap < n && cap < max_capacity)
+        cap <<= 1;
+    return cap;
+}
+
+#if defined(__linux__)
+// Stops the peer resizing the mapping under us
+constexpr int shm_seals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+
+void
+ring_bell(local_stream_socket const& bell) noexcept
+{
+    // A full doorbell already holds a pending wakeup
+    char b = 0;
+    (void)::send(bell.native_handle(), &b, 1, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+std::error_code
+last_error() noexcept
+{
+    return std::error_code(errno, std::system_category());
+}
+#endif
+
+} // namespace
+
+shm_channel::shm_channel(capy::execution_context& ctx)
+    : data_bell_(ctx)
+    , space_bell_(ctx)
+{
+}
+
+shm_channel::~shm_channel()
+{
+    close();
+}
+
+void
+shm_channel::attach(
+    void* map, std::size_t size, std::size_t c, bool creator) noexcept
+{
+    // c is the validated capacity, never re-read from shared memory
+    auto* base  = static_cast<unsigned char*>(map);
+    auto* rings = reinterpret_cast<detail::shm_ring*>(base + sizeof(shm_layout));
+    auto* data  = base + sizeof(shm_layout) + 2 * sizeof(detail::shm_ring);
+
+    map_      = map;
+    map_size_ = size;
+    capacity_ = c;
+    // The creator produces into ring 0 and consumes ring 1
+    out_      = &rings[creator ? 0 : 1];
+    in_       = &rings[creator ? 1 : 0];
+    out_data_ = data + (creator ? 0 : c);
+    in_data_  = data + (creator ? c : 0);
+}
+
+capy::task<capy::io_result<>>
+shm_channel::create(local_stream_socket sock, std::size_t capacity)
+{
+    close();
+#if defined(__linux__)
+    std::size_t cap  = round_capacity(capacity);
+    std::size_t size = layout_size(cap);
+
+    int mfd =
+        ::memfd_create("corosio-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (mfd < 0)
+        co_return {last_error()};
+    if (::ftruncate(mfd, static_cast<off_t>(size)) != 0 ||
+        ::fcntl(mfd, F_ADD_SEALS, shm_seals) != 0)
+    {
+        auto ec = last_error();
+        ::close(mfd);
+        co_return {ec};
+    }
+    void* map =
+        ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mfd, 0);
+    if (map == MAP_FAILED)
+    {
+        auto ec = last_error();
+        ::close(mfd);
+        co_return {ec};
+    }
+
+    int pair[2];
+    if (::socketpair(
+            AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, pair) != 0)
+    {
+        auto ec = last_error();
+        ::munmap(map, size);
+        ::close(mfd);
+        co_return {ec};
+    }
+
+    auto* base   = static_cast<unsigned char*>(map);
+    new (base) shm_layout{shm_magic, shm_version, cap};
+    new (base + sizeof(shm_layout)) detail::shm_ring[2];
+
+    native_handle_type fds[] = {mfd, pair[1]};
+    auto [ec, n] = co_await sock.send_with_fds(capy::const_buffer("S", 1), fds);
+    ::close(mfd);
+    ::close(pair[1]);
+    if (ec)
+    {
+        ::munmap(map, size);
+        ::close(pair[0]);
+        co_return {ec};
+    }
+
+    try
+    {
+        space_bell_.assign(pair[0]);
+    }
+    catch (std::system_error const& e)
+    {
+        ::munmap(map, size);
+        ::close(pair[0]);
+        co_return {e.code()};
+    }
+    data_bell_ = std::move(sock);
+    attach(map, size, cap, true);
+    co_return {};
+#else
+    (void)sock;
+    (void)capacity;
+    co_return {std::make_error_code(std::errc::operation_not_supported)};
+#endif
+}
+
+capy::task<capy::io_result<>>
+shm_channel::accept(local_stream_socket sock)
+{
+    close();
+#if defined(__linux__)
+    char tag = 0;
+    native_handle_type fds[2];
+    std::size_t count = 0;
+    auto [ec, n] = co_await sock.recv_with_fds(
+        capy::mutable_buffer(&tag, 1), fds, count);
+    if (ec)
+        co_return {ec};
+    if (count != 2 || n != 1 || tag != 'S')
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            ::close(fds[i]);
+        co_return {std::make_error_code(std::errc::protocol_error)};
+    }
+
+    int mfd = fds[0];
+    struct stat st{};
+    void* map = MAP_FAILED;
+    std::size_t size = 0;
+    int seals = ::fcntl(mfd, F_GET_SEALS);
+    if (seals >= 0 && (seals & shm_seals) == shm_seals &&
+        ::fstat(mfd, &st) == 0 &&
+        static_cast<std::size_t>(st.st_size) >= sizeof(shm_layout))
+    {
+        size = static_cast<std::size_t>(st.st_size);
+        map  = ::mmap(
+            nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mfd, 0);
+    }
+    ::close(mfd);
+
+    // Each field is read once; the peer can rewrite the header
+    // at any time, so only the local copies are trusted
+    bool valid = false;
+    std::uint64_t cap = 0;
+    if (map != MAP_FAILED)
+    {
+        auto const* layout = static_cast<shm_layout const volatile*>(map);
+        std::uint32_t magic   = layout->magic;
+        std::uint32_t version = layout->version;
+        cap                   = layout->capacity;
+        valid = magic == shm_magic && version == shm_version &&
+            cap >= min_capacity && cap <= max_capacity &&
+            (cap & (cap - 1)) == 0 &&
+            layout_size(static_cast<std::size_t>(cap)) == size;
+    }
+    if (!valid)
+    {
+        if (map != MAP_FAILED)
+            ::munmap(map, size);
+        ::close(fds[1]);
+        co_return {std::make_error_code(std::errc::protocol_error)};
+    }
+
+    try
+    {
+        space_bell_.assign(fds[1]);
+    }
+    catch (std::system_error const& e)
+    {
+        ::munmap(map, size);
+        ::close(fds[1]);
+        co_return {e.code()};
+    }
+    data_bell_ = std::move(sock);
+    attach(map, size, static_cast<std::size_t>(cap), false);
+    co_return {};
+#else
+    (void)sock;
+    co_return {std::make_error_code(std::errc::operation_not_supported)};
+#endif
+}
+
+bool
+shm_channel::try_send(
+    buffer_param buffers, std::size_t& n, std::error_code& ec) noexcept
+{
+    capy::mutable_buffer bufs[16];
+    std::size_t count = buffers.copy_to(bufs, 16);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        total += bufs[i].size();
+    n = 0;
+    if (total == 0)
+        return true;
+
+    std::uint64_t head = out_->head.load(std::memory_order_relaxed);
+    std::uint64_t tail = out_->tail.load(std::memory_order_acquire);
+    std::uint64_t used = head - tail;
+    // The indices live in memory the peer can write
+    if (used > capacity_)
+    {
+        ec = std::make_error_code(std::errc::protocol_error);
+        return true;
+    }
+    std::size_t space = capacity_ - static_cast<std::size_t>(used);
+    if (space == 0)
+        return false;
+
+    std::size_t mask = capacity_ - 1;
+    std::size_t want = (std::min)(total, space);
+    std::size_t pos  = static_cast<std::size_t>(head) & mask;
+    for (std::size_t i = 0; i < count && n < want; ++i)
+    {
+        auto const* src = static_cast<unsigned char const*>(bufs[i].data());
+        std::size_t len = (std::min)(bufs[i].size(), want - n);
+        std::size_t first = (std::min)(len, capacity_ - pos);
+        std::memcpy(out_data_ + pos, src, first);
+        std::memcpy(out_data_, src + first, len - first);
+        pos = (pos + len) & mask;
+        n += len;
+    }
+
+    out_->head.store(head + n, std::memory_order_seq_cst);
+#if defined(__linux__)
+    if (out_->reader_waiting.load(std::memory_order_seq_cst) &&
+        out_->reader_waiting.exchange(0, std::memory_order_seq_cst))
+        ring_bell(data_bell_);
+#endif
+    return true;
+}
+
+bool
+shm_channel::try_recv(
+    buffer_param buffers, std::size_t& n, std::error_code& ec) noexcept
+{
+    capy::mutable_buffer bufs[16];
+    std::size_t count = buffers.copy_to(bufs, 16);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        total += bufs[i].size();
+    n = 0;
+    if (total == 0)
+        return true;
+
+    std::uint64_t tail = in_->tail.load(std::memory_order_relaxed);
+    std::uint64_t head = in_->head.load(std::memory_order_acquire);
+    std::uint64_t used = head - tail;
+    // The indices live in memory the peer can write
+    if (used > capacity_)
+    {
+        ec = std::make_error_code(std::errc::protocol_error);
+        return true;
+    }
+    std::size_t avail = static_cast<std::size_t>(used);
+    if (avail == 0)
+        return false;
+
+    std::size_t mask = capacity_ - 1;
+    std::size_t want = (std::min)(total, avail);
+    std::size_t pos  = static_cast<std::size_t>(tail) & mask;
+    for (std::size_t i = 0; i < count && n < want; ++i)
+    {
+        auto* dst = static_cast<unsigned char*>(bufs[i].data());
+        std::size_t len = (std::min)(bufs[i].size(), want - n);
+        std::size_t first = (std::min)(len, capacity_ - pos);
+        std::memcpy(dst, in_data_ + pos, first);
+        std::memcpy(dst + first, in_data_, len - first);
+        pos = (pos + len) & mask;
+        n += len;
+    }
+
+    in_->tail.store(tail + n, std::memory_order_seq_cst);
+#if defined(__linux__)
+    if (in_->writer_waiting.load(std::memory_order_seq_cst) &&
+        in_->writer_waiting.exchange(0, std::memory_order_seq_cst))
+        ring_bell(space_bell_);
+#endif
+    return true;
+}
+
+bool
+shm_channel::park_send() noexcept
+{
+    out_->writer_waiting.store(1, std::memory_order_seq_cst);
+    std::uint64_t head = out_->head.load(std::memory_order_relaxed);
+    std::uint64_t tail = out_->tail.load(std::memory_order_seq_cst);
+    if (static_cast<std::size_t>(head - tail) < capacity_)
+    {
+        // The consumer freed space meanwhile; a doorbell byte it may
+        // still send is drained as a spurious wakeup later.
+        out_->writer_waiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool
+shm_channel::park_recv() noexcept
+{
+    in_->reader_waiting.store(1, std::memory_order_seq_cst);
+    std::uint64_t tail = in_->tail.load(std::memory_order_relaxed);
+    std::uint64_t head = in_->head.load(std::memory_order_seq_cst);
+    if (head != tail)
+    {
+        in_->reader_waiting.store(0, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void
+shm_channel::cancel()
+{
+    data_bell_.cancel();
+    space_bell_.cancel();
+}
+
+void
+shm_channel::close()
+{
+    data_bell_.close();
+    space_bell_.close();
+#if defined(__linux__)
+    if (map_)
+        ::munmap(map_, map_size_);
+#endif
+    map_      = nullptr;
+    map_size_ = 0;
+    capacity_ = 0;
+    out_      = nullptr;
+    in_       = nullptr;
+    out_data_ = nullptr;
+    in_data_  = nullptr;
+}
+
+} // namespace boost::corosio
@@ -258,6 +258,214 @@ multicast_interface_v6::name() noexcept
     return native_socket_option::multicast_interface_v6::name();
 }
 
+// udp_segment
+
+#ifdef UDP_SEGMENT
+int
+udp_segment::level() noexcept
+{
+    return native_socket_option::udp_segment::level();
+}
+int
+udp_segment::name() noexcept
+{
+    return native_socket_option::udp_segment::name();
+}
+#else
+int
+udp_segment::level() noexcept
+{
+    return IPPROTO_UDP;
+}
+int
+udp_segment::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// udp_gro
+
+#ifdef UDP_GRO
+int
+udp_gro::level() noexcept
+{
+    return native_socket_option::udp_gro::level();
+}
+int
+udp_gro::name() noexcept
+{
+    return native_socket_option::udp_gro::name();
+}
+#else
+int
+udp_gro::level() noexcept
+{
+    return IPPROTO_UDP;
+}
+int
+udp_gro::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_packet_info_v4
+
+#if defined(IP_PKTINFO) || defined(IP_RECVDSTADDR)
+int
+receive_packet_info_v4::level() noexcept
+{
+    return native_socket_option::receive_packet_info_v4::level();
+}
+int
+receive_packet_info_v4::name() noexcept
+{
+    return native_socket_option::receive_packet_info_v4::name();
+}
+#else
+int
+receive_packet_info_v4::level() noexcept
+{
+    return IPPROTO_IP;
+}
+int
+receive_packet_info_v4::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_packet_info_v6
+
+#if defined(IPV6_RECVPKTINFO)
+int
+receive_packet_info_v6::level() noexcept
+{
+    return native_socket_option::receive_packet_info_v6::level();
+}
+int
+receive_packet_info_v6::name() noexcept
+{
+    return native_socket_option::receive_packet_info_v6::name();
+}
+#else
+int
+receive_packet_info_v6::level() noexcept
+{
+    return IPPROTO_IPV6;
+}
+int
+receive_packet_info_v6::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_timestamp
+
+#if defined(SO_TIMESTAMPNS) || defined(SO_TIMESTAMP)
+int
+receive_timestamp::level() noexcept
+{
+    return native_socket_option::receive_timestamp::level();
+}
+int
+receive_timestamp::name() noexcept
+{
+    return native_socket_option::receive_timestamp::name();
+}
+#else
+int
+receive_timestamp::level() noexcept
+{
+    return SOL_SOCKET;
+}
+int
+receive_timestamp::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_tos_v4
+
+#if defined(IP_RECVTOS)
+int
+receive_tos_v4::level() noexcept
+{
+    return native_socket_option::receive_tos_v4::level();
+}
+int
+receive_tos_v4::name() noexcept
+{
+    return native_socket_option::receive_tos_v4::name();
+}
+#else
+int
+receive_tos_v4::level() noexcept
+{
+    return IPPROTO_IP;
+}
+int
+receive_tos_v4::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_tclass_v6
+
+#if defined(IPV6_RECVTCLASS)
+int
+receive_tclass_v6::level() noexcept
+{
+    return native_socket_option::receive_tclass_v6::level();
+}
+int
+receive_tclass_v6::name() noexcept
+{
+    return native_socket_option::receive_tclass_v6::name();
+}
+#else
+int
+receive_tclass_v6::level() noexcept
+{
+    return IPPROTO_IPV6;
+}
+int
+receive_tclass_v6::name() noexcept
+{
+    return -1;
+}
+#endif
+
+// receive_drop_count
+
+#if defined(SO_RXQ_OVFL)
+int
+receive_drop_count::level() noexcept
+{
+    return native_socket_option::receive_drop_count::level();
+}
+int
+receive_drop_count::name() noexcept
+{
+    return native_socket_option::receive_drop_count::name();
+}
+#else
+int
+receive_drop_count::level() noexcept
+{
+    return SOL_SOCKET;
+}
+int
+receive_drop_count::name() noexcept
+{
+    return -1;
+}
+#endif
+
 // join_group_v4
 
 join_group_v4::join_group_v4(ipv4_address group, ipv4_address iface) noexcept
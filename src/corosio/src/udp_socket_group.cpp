@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+#include <boost/corosio/udp_socket_group.hpp>
+#include <boost/corosio/socket_option.hpp>
+#include <boost/corosio/detail/except.hpp>
+
+#include <cstdint>
+#include <iterator>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif
+
+namespace boost::corosio {
+
+udp_socket_group::~udp_socket_group()
+{
+    close();
+}
+
+std::error_code
+udp_socket_group::open(endpoint ep, std::size_t count)
+{
+    close();
+    // A fresh list: loops from an earlier start() still own the old one
+    sockets_ = std::make_shared<socket_list>();
+    sockets_->reserve(count);
+
+    try
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto& s = sockets_->emplace_back(*ctx_);
+            s.open(ep.is_v6() ? udp::v6() : udp::v4());
+            s.set_option(socket_option::reuse_port(true));
+            if (auto ec = s.bind(ep))
+            {
+                close();
+                return ec;
+            }
+            // Later members join the port the first one was given
+            if (i == 0)
+                ep = s.local_endpoint();
+        }
+    }
+    catch (std::system_error const& e)
+    {
+        close();
+        return e.code();
+    }
+    return {};
+}
+
+std::error_code
+udp_socket_group::steer_by_cpu()
+{
+    if (empty())
+        detail::throw_logic_error("steer_by_cpu: group is empty");
+
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    // A = cpu; A %= n; return A
+    sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+         static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0,
+         static_cast<std::uint32_t>(size())},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    sock_fprog prog{};
+    prog.len    = static_cast<unsigned short>(std::size(code));
+    prog.filter = code;
+
+    // The program is shared by the whole reuseport group
+    if (::setsockopt(
+            sockets_->front().native_handle(), SOL_SOCKET,
+            SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) != 0)
+        return std::error_code(errno, std::system_category());
+    return {};
+#else
+    return std::make_error_code(std::errc::operation_not_supported);
+#endif
+}
+
+endpoint
+udp_socket_group::local_endpoint() const noexcept
+{
+    if (empty())
+        return endpoint{};
+    return sockets_->front().local_endpoint();
+}
+
+void
+udp_socket_group::cancel()
+{
+    for (auto& s : sockets())
+        s.cancel();
+}
+
+void
+udp_socket_group::close()
+{
+    for (auto& s : sockets())
+        s.close();
+    sockets_.reset();
+}
+
+} // namespace boost::corosio
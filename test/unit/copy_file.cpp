@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/copy_file.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <system_error>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file(std::string_view prefix, std::string_view contents)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    std::string contents() const
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        return std::string(
+            (std::istreambuf_iterator<char>(ifs)),
+            std::istreambuf_iterator<char>());
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+std::string
+make_pattern(std::size_t n)
+{
+    std::string s(n, '\0');
+    for (std::size_t i = 0; i < n; ++i)
+        s[i] = static_cast<char>('a' + (i * 7 + i / 251) % 26);
+    return s;
+}
+
+} // namespace
+
+template<auto Backend>
+struct copy_file_test
+{
+    void testWholeFile()
+    {
+        auto const data = make_pattern(300000);
+        temp_file src_tmp("copy_src_", data);
+        temp_file dst_tmp("copy_dst_", "");
+        io_context ioc(Backend);
+        random_access_file src(ioc);
+        random_access_file dst(ioc);
+        src.open(src_tmp.path, file_base::read_only);
+        dst.open(dst_tmp.path, file_base::write_only);
+
+        copy_range r{0, 0, data.size()};
+        std::error_code ec;
+        std::uint64_t n = 0;
+        auto task = [&]() -> capy::task<> {
+            // Small chunks exercise the chunk loop
+            auto [e, k] = co_await copy_file(src, dst, {&r, 1}, 64 * 1024);
+            ec = e;
+            n  = k;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        dst.close();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(n, data.size());
+        BOOST_TEST(dst_tmp.contents() == data);
+    }
+
+    void testRanges()
+    {
+        auto const data = make_pattern(10000);
+        temp_file src_tmp("copy_rsrc_", data);
+        temp_file dst_tmp("copy_rdst_", "");
+        io_context ioc(Backend);
+        random_access_file src(ioc);
+        random_access_file dst(ioc);
+        src.open(src_tmp.path, file_base::read_only);
+        dst.open(dst_tmp.path, file_base::write_only);
+
+        // Gather three records back to back, out of source order
+        copy_range ranges[] = {
+            {8000, 0, 1000},
+            {100, 1000, 50},
+            {4000, 1050, 3000},
+        };
+        std::error_code ec;
+        std::uint64_t n = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, k] = co_await copy_file(src, dst, ranges, 1024);
+            ec = e;
+            n  = k;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        dst.close();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(n, 4050u);
+        BOOST_TEST(
+            dst_tmp.contents() ==
+            data.substr(8000, 1000) + data.substr(100, 50) +
+                data.substr(4000, 3000));
+    }
+
+    void testPastEnd()
+    {
+        temp_file src_tmp("copy_esrc_", "0123456789");
+        temp_file dst_tmp("copy_edst_", "");
+        io_context ioc(Backend);
+        random_access_file src(ioc);
+        random_access_file dst(ioc);
+        src.open(src_tmp.path, file_base::read_only);
+        dst.open(dst_tmp.path, file_base::write_only);
+
+        copy_range ranges[] = {{0, 0, 4}, {6, 4, 100}, {0, 50, 4}};
+        std::error_code ec;
+        std::uint64_t n = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, k] = co_await copy_file(src, dst, ranges);
+            ec = e;
+            n  = k;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        dst.close();
+
+        // The short range stops the copy
+        BOOST_TEST(ec == capy::cond::eof);
+        BOOST_TEST_EQ(n, 8u);
+        BOOST_TEST(dst_tmp.contents() == "01236789");
+    }
+
+    void testStoppedToken()
+    {
+        temp_file src_tmp("copy_csrc_", make_pattern(5000));
+        temp_file dst_tmp("copy_cdst_", "");
+        io_context ioc(Backend);
+        random_access_file src(ioc);
+        random_access_file dst(ioc);
+        src.open(src_tmp.path, file_base::read_only);
+        dst.open(dst_tmp.path, file_base::write_only);
+
+        std::stop_source stop_src;
+        stop_src.request_stop();
+
+        copy_range r{0, 0, 5000};
+        std::error_code ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e, k] = co_await copy_file(src, dst, {&r, 1});
+            ec = e;
+            BOOST_TEST_EQ(k, 0u);
+        };
+        capy::run_async(ioc.get_executor(), stop_src.get_token())(task());
+        ioc.run();
+
+        BOOST_TEST(ec == capy::cond::canceled);
+    }
+
+    void testPreconditions()
+    {
+        temp_file src_tmp("copy_psrc_", "x");
+        io_context ioc(Backend);
+        random_access_file src(ioc);
+        random_access_file dst(ioc);
+        copy_range r{0, 0, 1};
+
+        BOOST_TEST_THROWS(
+            (void)copy_file(src, dst, {&r, 1}), std::logic_error);
+
+        src.open(src_tmp.path, file_base::read_only);
+        dst.open(src_tmp.path, file_base::read_only);
+        BOOST_TEST_THROWS(
+            (void)copy_file(src, dst, {&r, 1}, 0), std::invalid_argument);
+    }
+
+    void run()
+    {
+        testWholeFile();
+        testRanges();
+        testPastEnd();
+        testStoppedToken();
+        testPreconditions();
+    }
+};
+
+COROSIO_BACKEND_TESTS(copy_file_test, "boost.corosio.copy_file")
+
+} // namespace boost::corosio
@@ -0,0 +1,575 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/dns_resolver.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/socket_option.hpp>
+#include <boost/corosio/tcp_acceptor.hpp>
+#include <boost/corosio/tcp_socket.hpp>
+#include <boost/corosio/timer.hpp>
+#include <boost/corosio/udp_socket.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file(std::string_view prefix, std::string_view contents)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+// What the stub server answers for one question
+struct stub_answer
+{
+    unsigned rcode   = 0;
+    bool truncate    = false;
+    bool ignore_aaaa = false; // UDP leaves AAAA queries unanswered
+    bool cut_off     = false; // UDP truncates mid-record
+    std::vector<unsigned char> v4; // 4 bytes per address
+    std::vector<unsigned char> v6; // 16 bytes per address
+};
+
+// Decode the dotted name of a query
+std::string
+query_name(unsigned char const* p, std::size_t n, std::size_t& pos)
+{
+    std::string name;
+    pos = 12;
+    while (pos < n && p[pos] != 0)
+    {
+        if (!name.empty())
+            name.push_back('.');
+        name.append(reinterpret_cast<char const*>(p + pos + 1), p[pos]);
+        pos += 1 + p[pos];
+    }
+    ++pos;
+    return name;
+}
+
+// Build the reply to a query. Over UDP a truncating answer
+// carries only the TC bit, or with cut_off an ANCOUNT of 3 and
+// the first bytes of one record.
+std::vector<unsigned char>
+make_reply(
+    unsigned char const* q,
+    std::size_t n,
+    stub_answer const& a,
+    bool over_udp)
+{
+    std::size_t pos = 0;
+    (void)query_name(q, n, pos);
+    std::uint16_t type = static_cast<std::uint16_t>((q[pos] << 8) | q[pos + 1]);
+
+    std::vector<unsigned char> r(q, q + pos + 4);
+    r[2] = static_cast<unsigned char>(0x81 | (r[2] & 0x01));
+    r[3] = static_cast<unsigned char>(0x80 | a.rcode);
+    if (over_udp && a.truncate)
+    {
+        r[2] |= 0x02;
+        if (a.cut_off)
+        {
+            unsigned char partial[] = {0xc0, 0x0c, 0, 1, 0, 1};
+            r[7] = 3;
+            r.insert(r.end(), partial, partial + sizeof(partial));
+        }
+        return r;
+    }
+
+    auto const& data = type == 1 ? a.v4 : a.v6;
+    std::size_t len   = type == 1 ? 4 : 16;
+    std::size_t count = data.size() / len;
+    r[7]              = static_cast<unsigned char>(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        unsigned char rr[] = {
+            0xc0, 0x0c, 0, static_cast<unsigned char>(type), 0, 1,
+            0,    0,    0, 60, 0, static_cast<unsigned char>(len)};
+        r.insert(r.end(), rr, rr + sizeof(rr));
+        r.insert(
+            r.end(), data.begin() + static_cast<std::ptrdiff_t>(i * len),
+            data.begin() + static_cast<std::ptrdiff_t>((i + 1) * len));
+    }
+    return r;
+}
+
+} // namespace
+
+template<auto Backend>
+struct dns_resolver_test
+{
+    // Answer queries on a UDP socket until it is closed
+    static capy::task<> serve_udp(udp_socket& sock, stub_answer a, int& queries)
+    {
+        std::array<unsigned char, 512> buf;
+        for (;;)
+        {
+            endpoint from;
+            auto [ec, n] = co_await sock.recv_from(
+                capy::mutable_buffer(buf.data(), buf.size()), from);
+            if (ec)
+                co_return;
+            ++queries;
+            std::size_t pos = 0;
+            (void)query_name(buf.data(), n, pos);
+            if (a.ignore_aaaa && pos + 1 < n && buf[pos + 1] == 28)
+                continue;
+            auto r = make_reply(buf.data(), n, a, true);
+            (void)co_await sock.send_to(
+                capy::const_buffer(r.data(), r.size()), from);
+        }
+    }
+
+    // Answer length-prefixed queries on accepted TCP connections
+    static capy::task<> serve_tcp(
+        io_context& ioc, tcp_acceptor& acc, stub_answer a, int& queries)
+    {
+        for (;;)
+        {
+            tcp_socket peer(ioc);
+            if (auto [ec] = co_await acc.accept(peer); ec)
+                co_return;
+            std::array<unsigned char, 514> buf;
+            std::size_t got = 0;
+            while (got < 2 || got < 2u + ((buf[0] << 8) | buf[1]))
+            {
+                auto [ec, n] = co_await peer.read_some(
+                    capy::mutable_buffer(buf.data() + got, buf.size() - got));
+                if (ec)
+                    co_return;
+                got += n;
+            }
+            ++queries;
+            auto r = make_reply(buf.data() + 2, got - 2, a, false);
+            std::array<unsigned char, 2> len = {
+                static_cast<unsigned char>(r.size() >> 8),
+                static_cast<unsigned char>(r.size() & 0xff)};
+            r.insert(r.begin(), len.begin(), len.end());
+            (void)co_await peer.write_some(
+                capy::const_buffer(r.data(), r.size()));
+        }
+    }
+
+    static endpoint bind_loopback(udp_socket& sock)
+    {
+        sock.open();
+        auto ec = sock.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST(!ec);
+        return sock.local_endpoint();
+    }
+
+    static dns_resolver_options stub_options(endpoint server)
+    {
+        dns_resolver_options opts;
+        opts.servers     = {server};
+        opts.resolv_conf = {};
+        opts.hosts       = {};
+        opts.timeout     = std::chrono::seconds(5);
+        opts.attempts    = 1;
+        return opts;
+    }
+
+    void testResolveBothFamilies()
+    {
+        io_context ioc(Backend);
+        udp_socket server(ioc);
+        auto ep = bind_loopback(server);
+
+        stub_answer a;
+        a.v4 = {10, 0, 0, 1, 10, 0, 0, 2};
+        a.v6.assign(16, 0);
+        a.v6[15] = 5;
+        int queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, queries));
+
+        dns_resolver r(ioc, stub_options(ep));
+        std::error_code ec;
+        resolver_results results;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("svc.test", "8080");
+            ec            = e;
+            results       = std::move(res);
+            server.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(queries, 2);
+        BOOST_TEST_EQ(results.size(), 3u);
+        int v4 = 0, v6 = 0;
+        for (auto const& entry : results)
+        {
+            auto e = entry.get_endpoint();
+            BOOST_TEST_EQ(e.port(), 8080);
+            BOOST_TEST_EQ(entry.host_name(), "svc.test");
+            (e.is_v4() ? v4 : v6)++;
+        }
+        BOOST_TEST_EQ(v4, 2);
+        BOOST_TEST_EQ(v6, 1);
+    }
+
+    void testNxdomain()
+    {
+        io_context ioc(Backend);
+        udp_socket server(ioc);
+        auto ep = bind_loopback(server);
+
+        stub_answer a;
+        a.rcode     = 3;
+        int queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, queries));
+
+        dns_resolver r(ioc, stub_options(ep));
+        std::error_code ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("missing.test", "80");
+            ec            = e;
+            server.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(ec == std::errc::no_such_device_or_address);
+    }
+
+    void testFailover()
+    {
+        io_context ioc(Backend);
+        udp_socket silent(ioc);
+        auto silent_ep = bind_loopback(silent);
+        udp_socket server(ioc);
+        auto ep = bind_loopback(server);
+
+        stub_answer a;
+        a.v4        = {192, 0, 2, 1};
+        int queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, queries));
+
+        auto opts    = stub_options(ep);
+        opts.servers = {silent_ep, ep};
+        opts.timeout = std::chrono::milliseconds(100);
+        dns_resolver r(ioc, opts);
+
+        std::error_code ec;
+        std::size_t count = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("svc.test", "80");
+            ec            = e;
+            count         = res.size();
+            server.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(count, 1u);
+    }
+
+    void testTruncatedRetriesTcp()
+    {
+        io_context ioc(Backend);
+        tcp_acceptor acc(ioc);
+        acc.open();
+        acc.set_option(socket_option::reuse_address(true));
+        BOOST_TEST(!acc.bind(endpoint(ipv4_address::loopback(), 0)));
+        BOOST_TEST(!acc.listen());
+        auto ep = acc.local_endpoint();
+
+        udp_socket server(ioc);
+        server.open();
+        if (server.bind(ep))
+            return; // UDP port taken; nothing to test against
+
+        stub_answer a;
+        a.truncate = true;
+        a.v4       = {198, 51, 100, 7};
+        a.v6.assign(16, 0xfe);
+        int udp_queries = 0, tcp_queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, udp_queries));
+        capy::run_async(ioc.get_executor())(
+            serve_tcp(ioc, acc, a, tcp_queries));
+
+        dns_resolver r(ioc, stub_options(ep));
+        std::error_code ec;
+        std::size_t count = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("big.test", "53");
+            ec            = e;
+            count         = res.size();
+            server.close();
+            acc.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(count, 2u);
+        BOOST_TEST_EQ(udp_queries, 2);
+        BOOST_TEST_EQ(tcp_queries, 2);
+    }
+
+    // A truncated reply cut off inside its answer section, with
+    // an ANCOUNT it cannot hold, is still retried over TCP
+    void testTruncatedMidRecord()
+    {
+        io_context ioc(Backend);
+        tcp_acceptor acc(ioc);
+        acc.open();
+        acc.set_option(socket_option::reuse_address(true));
+        BOOST_TEST(!acc.bind(endpoint(ipv4_address::loopback(), 0)));
+        BOOST_TEST(!acc.listen());
+        auto ep = acc.local_endpoint();
+
+        udp_socket server(ioc);
+        server.open();
+        if (server.bind(ep))
+            return; // UDP port taken; nothing to test against
+
+        stub_answer a;
+        a.truncate = true;
+        a.cut_off  = true;
+        a.v4       = {198, 51, 100, 8};
+        a.v6.assign(16, 0xfd);
+        int udp_queries = 0, tcp_queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, udp_queries));
+        capy::run_async(ioc.get_executor())(
+            serve_tcp(ioc, acc, a, tcp_queries));
+
+        dns_resolver r(ioc, stub_options(ep));
+        std::error_code ec;
+        std::size_t count = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("big.test", "53");
+            ec            = e;
+            count         = res.size();
+            server.close();
+            acc.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(count, 2u);
+        BOOST_TEST_EQ(udp_queries, 2);
+        BOOST_TEST_EQ(tcp_queries, 2);
+    }
+
+    // A truncated answer is retried over TCP even when the other
+    // question times out
+    void testTruncatedBesideTimeout()
+    {
+        io_context ioc(Backend);
+        tcp_acceptor acc(ioc);
+        acc.open();
+        acc.set_option(socket_option::reuse_address(true));
+        BOOST_TEST(!acc.bind(endpoint(ipv4_address::loopback(), 0)));
+        BOOST_TEST(!acc.listen());
+        auto ep = acc.local_endpoint();
+
+        udp_socket server(ioc);
+        server.open();
+        if (server.bind(ep))
+            return; // UDP port taken; nothing to test against
+
+        stub_answer a;
+        a.truncate    = true;
+        a.ignore_aaaa = true;
+        a.v4          = {198, 51, 100, 9};
+
+        int udp_queries = 0, tcp_queries = 0;
+        capy::run_async(ioc.get_executor())(serve_udp(server, a, udp_queries));
+        capy::run_async(ioc.get_executor())(
+            serve_tcp(ioc, acc, a, tcp_queries));
+
+        auto opts    = stub_options(ep);
+        opts.timeout = std::chrono::milliseconds(100);
+        dns_resolver r(ioc, opts);
+        std::error_code ec;
+        std::size_t count = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("big.test", "53");
+            ec            = e;
+            count         = res.size();
+            server.close();
+            acc.close();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!ec);
+        BOOST_TEST_EQ(count, 1u);
+        BOOST_TEST_EQ(tcp_queries, 1);
+    }
+
+    void testCancel()
+    {
+        io_context ioc(Backend);
+        udp_socket silent(ioc);
+        auto ep = bind_loopback(silent);
+
+        auto opts    = stub_options(ep);
+        opts.timeout = std::chrono::seconds(30);
+        dns_resolver r(ioc, opts);
+
+        std::stop_source stop;
+        std::error_code ec;
+        auto lookup = [&]() -> capy::task<> {
+            auto [e, res] = co_await r.resolve("slow.test", "80");
+            ec            = e;
+        };
+        auto stopper = [&]() -> capy::task<> {
+            timer t(ioc);
+            t.expires_after(std::chrono::milliseconds(20));
+            (void)co_await t.wait();
+            stop.request_stop();
+        };
+        auto start = std::chrono::steady_clock::now();
+        capy::run_async(ioc.get_executor(), stop.get_token())(lookup());
+        capy::run_async(ioc.get_executor())(stopper());
+        ioc.run();
+
+        BOOST_TEST(ec == capy::cond::canceled);
+        BOOST_TEST(
+            std::chrono::steady_clock::now() - start < std::chrono::seconds(5));
+    }
+
+    void testHostsAndNumeric()
+    {
+        temp_file hosts(
+            "dns_hosts_",
+            "# comment\n10.1.2.3  alias.test other  # trailing\n"
+            "::7 alias.test\n");
+        io_context ioc(Backend);
+        udp_socket silent(ioc);
+        auto ep = bind_loopback(silent);
+
+        auto opts  = stub_options(ep);
+        opts.hosts = hosts.path;
+        dns_resolver r(ioc, opts);
+
+        std::error_code hosts_ec, numeric_ec, forbidden_ec, empty_ec;
+        std::size_t hosts_n = 0, numeric_n = 0, empty_n = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [e1, r1] = co_await r.resolve("ALIAS.test.", "80");
+            hosts_ec      = e1;
+            hosts_n       = r1.size();
+            auto [e2, r2] = co_await r.resolve("::1", "80");
+            numeric_ec    = e2;
+            numeric_n     = r2.size();
+            auto [e3, r3] = co_await r.resolve(
+                "svc.test", "80", resolve_flags::numeric_host);
+            forbidden_ec  = e3;
+            auto [e4, r4] = co_await r.resolve("", "80");
+            empty_ec      = e4;
+            empty_n       = r4.size();
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!hosts_ec);
+        BOOST_TEST_EQ(hosts_n, 2u);
+        BOOST_TEST(!numeric_ec);
+        BOOST_TEST_EQ(numeric_n, 1u);
+        BOOST_TEST(forbidden_ec == std::errc::no_such_device_or_address);
+        BOOST_TEST(!empty_ec);
+        BOOST_TEST_EQ(empty_n, 2u);
+    }
+
+    void testResolvConf()
+    {
+        temp_file conf(
+            "dns_conf_",
+            "; comment\nsearch example.com\nnameserver 10.9.8.7\n"
+            "nameserver fe80::1%eth0\noptions timeout:1 attempts:3\n");
+        io_context ioc(Backend);
+
+        dns_resolver_options opts;
+        opts.resolv_conf = conf.path;
+        opts.hosts       = {};
+        dns_resolver r(ioc, opts);
+
+        auto const& servers = r.servers();
+        BOOST_TEST_EQ(servers.size(), 2u);
+        BOOST_TEST(
+            servers[0] == endpoint(ipv4_address({10, 9, 8, 7}), 53));
+        BOOST_TEST(servers[1].is_v6());
+        BOOST_TEST_EQ(servers[1].port(), 53);
+
+        opts.resolv_conf = {};
+        dns_resolver fallback(ioc, opts);
+        BOOST_TEST_EQ(fallback.servers().size(), 1u);
+        BOOST_TEST(
+            fallback.servers()[0] == endpoint(ipv4_address::loopback(), 53));
+    }
+
+    void run()
+    {
+        testResolveBothFamilies();
+        testNxdomain();
+        testFailover();
+        testTruncatedRetriesTcp();
+        testTruncatedMidRecord();
+        testTruncatedBesideTimeout();
+        testCancel();
+        testHostsAndNumeric();
+        testResolvConf();
+    }
+};
+
+COROSIO_BACKEND_TESTS(dns_resolver_test, "boost.corosio.dns_resolver")
+
+} // namespace boost::corosio
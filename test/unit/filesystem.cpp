@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/filesystem.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <system_error>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_dir
+{
+    std::filesystem::path path;
+
+    explicit temp_dir(std::string_view prefix)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        std::filesystem::create_directory(path);
+    }
+
+    void write(std::string const& name, std::string_view contents) const
+    {
+        std::ofstream ofs(path / name, std::ios::binary);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    ~temp_dir()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    temp_dir(temp_dir const&)            = delete;
+    temp_dir& operator=(temp_dir const&) = delete;
+};
+
+} // namespace
+
+template<auto Backend>
+struct filesystem_test
+{
+    void testStat()
+    {
+        temp_dir dir("fs_stat_");
+        dir.write("a.txt", "hello world");
+        io_context ioc(Backend);
+
+        std::error_code file_ec, dir_ec, missing_ec;
+        file_status file_st, dir_st;
+        auto task = [&]() -> capy::task<> {
+            auto [e1, s1] = co_await async_stat(dir.path / "a.txt");
+            file_ec       = e1;
+            file_st       = s1;
+            auto [e2, s2] = co_await async_stat(dir.path);
+            dir_ec        = e2;
+            dir_st        = s2;
+            auto [e3, s3] = co_await async_stat(dir.path / "missing");
+            missing_ec    = e3;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!file_ec);
+        BOOST_TEST(file_st.type == std::filesystem::file_type::regular);
+        BOOST_TEST_EQ(file_st.size, 11u);
+        BOOST_TEST(file_st.last_write_time.time_since_epoch().count() != 0);
+        BOOST_TEST(!dir_ec);
+        BOOST_TEST(dir_st.type == std::filesystem::file_type::directory);
+        BOOST_TEST(missing_ec == std::errc::no_such_file_or_directory);
+    }
+
+    void testMkdirRenameUnlink()
+    {
+        temp_dir dir("fs_ops_");
+        dir.write("old.txt", "x");
+        io_context ioc(Backend);
+
+        std::error_code mkdir_ec, again_ec, rename_ec, unlink_ec, gone_ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e1] = co_await async_mkdir(dir.path / "sub");
+            mkdir_ec  = e1;
+            auto [e2] = co_await async_mkdir(dir.path / "sub");
+            again_ec  = e2;
+            auto [e3] = co_await async_rename(
+                dir.path / "old.txt", dir.path / "sub" / "new.txt");
+            rename_ec = e3;
+            auto [e4] = co_await async_unlink(dir.path / "sub" / "new.txt");
+            unlink_ec = e4;
+            auto [e5] = co_await async_unlink(dir.path / "sub" / "new.txt");
+            gone_ec   = e5;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!mkdir_ec);
+        BOOST_TEST(again_ec == std::errc::file_exists);
+        BOOST_TEST(!rename_ec);
+        BOOST_TEST(!unlink_ec);
+        BOOST_TEST(gone_ec == std::errc::no_such_file_or_directory);
+        BOOST_TEST(std::filesystem::is_directory(dir.path / "sub"));
+        BOOST_TEST(!std::filesystem::exists(dir.path / "old.txt"));
+        BOOST_TEST(std::filesystem::is_empty(dir.path / "sub"));
+    }
+
+    void testStoppedToken()
+    {
+        temp_dir dir("fs_stop_");
+        io_context ioc(Backend);
+
+        std::stop_source stop_src;
+        stop_src.request_stop();
+
+        std::error_code ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e] = co_await async_mkdir(dir.path / "sub");
+            ec       = e;
+        };
+        capy::run_async(ioc.get_executor(), stop_src.get_token())(task());
+        ioc.run();
+
+        BOOST_TEST(ec == capy::cond::canceled);
+        BOOST_TEST(!std::filesystem::exists(dir.path / "sub"));
+    }
+
+    void testListBatches()
+    {
+        temp_dir dir("fs_list_");
+        for (int i = 0; i < 150; ++i)
+            dir.write("f" + std::to_string(i), std::string(i, 'x'));
+        std::filesystem::create_directory(dir.path / "sub");
+        io_context ioc(Backend);
+
+        directory_options opts;
+        opts.batch_size   = 64;
+        opts.stat_entries = true;
+        directory_reader reader(ioc, opts);
+
+        std::error_code open_ec, end_ec;
+        std::set<std::string> names;
+        std::size_t batches = 0;
+        bool sizes_ok       = true;
+        auto task = [&]() -> capy::task<> {
+            auto [e] = co_await reader.open(dir.path);
+            open_ec  = e;
+            if (e)
+                co_return;
+            for (;;)
+            {
+                auto [ec, batch] = co_await reader.next_batch();
+                if (ec)
+                {
+                    end_ec = ec;
+                    break;
+                }
+                ++batches;
+                for (auto const& entry : batch)
+                {
+                    auto name = entry.path.filename().string();
+                    names.insert(name);
+                    if (entry.status.type ==
+                            std::filesystem::file_type::regular &&
+                        entry.status.size != std::stoul(name.substr(1)))
+                        sizes_ok = false;
+                }
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!open_ec);
+        BOOST_TEST(end_ec == capy::cond::eof);
+        BOOST_TEST_EQ(names.size(), 151u);
+        BOOST_TEST_EQ(batches, 3u);
+        BOOST_TEST(names.count("sub") == 1);
+        BOOST_TEST(names.count(".") == 0);
+        BOOST_TEST(sizes_ok);
+    }
+
+    void testListEntries()
+    {
+        temp_dir dir("fs_next_");
+        dir.write("a", "");
+        dir.write("b", "");
+        std::filesystem::create_directory(dir.path / "c");
+        io_context ioc(Backend);
+
+        directory_options opts;
+        opts.batch_size = 2;
+        directory_reader reader(ioc, opts);
+
+        std::set<std::string> files, dirs;
+        std::error_code end_ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e] = co_await reader.open(dir.path);
+            if (e)
+                co_return;
+            for (;;)
+            {
+                auto [ec, entry] = co_await reader.next();
+                if (ec)
+                {
+                    end_ec = ec;
+                    break;
+                }
+                auto name = entry.path.filename().string();
+                if (entry.status.type == std::filesystem::file_type::directory)
+                    dirs.insert(name);
+                else
+                    files.insert(name);
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(end_ec == capy::cond::eof);
+        BOOST_TEST(files == (std::set<std::string>{"a", "b"}));
+        BOOST_TEST(dirs == (std::set<std::string>{"c"}));
+    }
+
+    void testListErrors()
+    {
+        temp_dir dir("fs_lerr_");
+        io_context ioc(Backend);
+        directory_reader reader(ioc);
+
+        BOOST_TEST_THROWS((void)reader.next(), std::logic_error);
+        BOOST_TEST_THROWS(
+            (void)directory_reader(ioc, directory_options{0, false}),
+            std::invalid_argument);
+
+        std::error_code ec;
+        auto task = [&]() -> capy::task<> {
+            auto [e] = co_await reader.open(dir.path / "missing");
+            ec       = e;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(ec == std::errc::no_such_file_or_directory);
+        BOOST_TEST(!reader.is_open());
+    }
+
+    void run()
+    {
+        testStat();
+        testMkdirRenameUnlink();
+        testStoppedToken();
+        testListBatches();
+        testListEntries();
+        testListErrors();
+    }
+};
+
+COROSIO_BACKEND_TESTS(filesystem_test, "boost.corosio.filesystem")
+
+} // namespace boost::corosio
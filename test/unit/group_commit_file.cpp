@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/group_commit_file.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file(std::string_view prefix, std::string_view contents)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    std::string contents() const
+    {
+        std::ifstream ifs(path, std::ios::binary);
+        return std::string(
+            (std::istreambuf_iterator<char>(ifs)),
+            std::istreambuf_iterator<char>());
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+} // namespace
+
+template<auto Backend>
+struct group_commit_file_test
+{
+    void testConstruction()
+    {
+        io_context ioc(Backend);
+        group_commit_file f(ioc);
+        BOOST_TEST(!f.is_open());
+        BOOST_TEST(f.options().sync);
+
+        group_commit_file g(ioc.get_executor(), {.sync = false});
+        BOOST_TEST(!g.options().sync);
+
+        BOOST_TEST_THROWS(
+            group_commit_file(ioc, {.max_batch_bytes = 0}),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(
+            (void)f.append(capy::const_buffer("x", 1)), std::logic_error);
+    }
+
+    void testConcurrentAppends()
+    {
+        temp_file tmp("gc_many_", "HEADER");
+        io_context ioc(Backend);
+        group_commit_file f(ioc);
+        f.open(tmp.path);
+        BOOST_TEST_EQ(f.size(), 6u);
+
+        constexpr int count = 100;
+        std::vector<std::string> recs(count);
+        std::vector<std::uint64_t> ends(count);
+        int ok = 0;
+
+        auto appender = [&](int i) -> capy::task<> {
+            recs[i] = "[rec " + std::to_string(i) + "]";
+            auto [ec, end] = co_await f.append(
+                capy::const_buffer(recs[i].data(), recs[i].size()));
+            BOOST_TEST(!ec);
+            ends[i] = end;
+            ++ok;
+        };
+        for (int i = 0; i < count; ++i)
+            capy::run_async(ioc.get_executor())(appender(i));
+        ioc.run();
+        f.close();
+
+        BOOST_TEST_EQ(ok, count);
+        auto const data = tmp.contents();
+        std::size_t total = 6;
+        for (int i = 0; i < count; ++i)
+        {
+            total += recs[i].size();
+            auto const start = ends[i] - recs[i].size();
+            BOOST_TEST(data.compare(start, recs[i].size(), recs[i]) == 0);
+        }
+        BOOST_TEST_EQ(data.size(), total);
+        BOOST_TEST(data.compare(0, 6, "HEADER") == 0);
+
+        // Appends arriving during a flush were coalesced
+        auto st = f.stats();
+        BOOST_TEST_EQ(st.records, static_cast<std::uint64_t>(count));
+        BOOST_TEST(st.batches < st.records);
+        BOOST_TEST(st.max_batch_records > 1);
+    }
+
+    void testSequentialAppends()
+    {
+        temp_file tmp("gc_seq_", "");
+        io_context ioc(Backend);
+        group_commit_file f(ioc, {.max_batch_bytes = 8, .sync = false});
+        f.open(tmp.path);
+
+        auto task = [&]() -> capy::task<> {
+            std::string const head = "key=";
+            std::string const body = "value;";
+            capy::const_buffer bufs[2] = {
+                capy::const_buffer(head.data(), head.size()),
+                capy::const_buffer(body.data(), body.size())};
+            for (int i = 0; i < 3; ++i)
+            {
+                auto [ec, end] = co_await f.append(bufs);
+                BOOST_TEST(!ec);
+                BOOST_TEST_EQ(end, static_cast<std::uint64_t>((i + 1) * 10));
+            }
+            // Empty record
+            auto [ec, end] = co_await f.append(capy::const_buffer());
+            BOOST_TEST(!ec);
+            BOOST_TEST_EQ(end, 30u);
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        f.close();
+
+        BOOST_TEST(tmp.contents() == "key=value;key=value;key=value;");
+    }
+
+    // A record of more buffers than fit inline is written whole
+    void testManyBuffers()
+    {
+        temp_file tmp("gc_bufs_", "");
+        io_context ioc(Backend);
+        group_commit_file f(ioc, {.sync = false});
+        f.open(tmp.path);
+
+        std::string expect;
+        std::vector<std::string> parts(40);
+        std::vector<capy::const_buffer> bufs;
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            parts[i] = std::to_string(i) + ",";
+            expect += parts[i];
+            bufs.emplace_back(parts[i].data(), parts[i].size());
+        }
+
+        std::uint64_t end = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [ec, n] = co_await f.append(bufs);
+            BOOST_TEST(!ec);
+            end = n;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        f.close();
+
+        BOOST_TEST_EQ(end, expect.size());
+        BOOST_TEST(tmp.contents() == expect);
+    }
+
+    void run()
+    {
+        testConstruction();
+        testConcurrentAppends();
+        testSequentialAppends();
+        testManyBuffers();
+    }
+};
+
+COROSIO_BACKEND_TESTS(
+    group_commit_file_test, "boost.corosio.group_commit_file")
+
+} // namespace boost::corosio
@@ -29,6 +29,7 @@
 
 #include <chrono>
 #include <cstring>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <system_error>
@@ -795,6 +796,62 @@ struct local_datagram_socket_test
         BOOST_TEST(recv_ec == capy::cond::canceled);
     }
 
+    void testPassFds()
+    {
+        io_context ioc(Backend);
+        local_datagram_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        int pipe_fds[2];
+        BOOST_TEST_EQ(::pipe(pipe_fds), 0);
+
+        auto ex = ioc.get_executor();
+        std::error_code send_ec, recv_ec;
+        std::size_t recvd = 0, fd_count = 0;
+        native_handle_type received[1] = {-1};
+        char buf[16] = {};
+
+        // Two descriptors sent, room for one: the extra is closed
+        capy::run_async(ex)(
+            [](local_datagram_socket& s, int* fds_in,
+               std::error_code& ec_out) -> capy::task<> {
+                native_handle_type fds[] = {fds_in[1], fds_in[0]};
+                auto [ec, n] = co_await s.send_with_fds(
+                    capy::const_buffer("fd", 2), fds);
+                ec_out = ec;
+            }(s1, pipe_fds, send_ec));
+
+        capy::run_async(ex)(
+            [](local_datagram_socket& s, char* data, std::size_t len,
+               std::span<native_handle_type> fds, std::size_t& count,
+               std::error_code& ec_out,
+               std::size_t& n_out) -> capy::task<> {
+                auto [ec, n] = co_await s.recv_with_fds(
+                    capy::mutable_buffer(data, len), fds, count);
+                ec_out = ec;
+                n_out  = n;
+            }(s2, buf, sizeof(buf), received, fd_count, recv_ec, recvd));
+
+        ioc.run();
+
+        BOOST_TEST_EQ(!send_ec, true);
+        BOOST_TEST_EQ(!recv_ec, true);
+        BOOST_TEST_EQ(recvd, 2u);
+        BOOST_TEST_EQ(fd_count, 1u);
+        if (fd_count != 1)
+            return;
+
+        // received[0] duplicates the write end
+        ::close(pipe_fds[1]);
+        BOOST_TEST_EQ(::write(received[0], "ok", 2), 2);
+        char out[2] = {};
+        BOOST_TEST_EQ(::read(pipe_fds[0], out, 2), 2);
+        BOOST_TEST_EQ(std::string(out, 2), std::string("ok"));
+        ::close(received[0]);
+        ::close(pipe_fds[0]);
+    }
+
     void run()
     {
         testConstruction();
@@ -821,6 +878,7 @@ struct local_datagram_socket_test
         testDatagramBoundary();
         testRecvPeek();
         testRecvFromPeek();
+        testPassFds();
 #ifdef __linux__
         testAbstractSocket();
 #endif
@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/local_seqpacket_socket.hpp>
+
+#include <boost/corosio/detail/platform.hpp>
+
+// AF_UNIX SOCK_SEQPACKET does not exist on Windows.
+#if BOOST_COROSIO_POSIX
+
+#include <boost/corosio/local_connect_pair.hpp>
+#include <boost/corosio/local_endpoint.hpp>
+#include <boost/corosio/local_seqpacket_acceptor.hpp>
+#include <boost/corosio/test/temp_path.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+namespace boost::corosio {
+
+template<auto Backend>
+struct local_seqpacket_socket_test
+{
+    void testOpenClose()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket sock(ioc);
+        BOOST_TEST_EQ(sock.is_open(), false);
+
+        sock.open();
+        BOOST_TEST_EQ(sock.is_open(), true);
+
+        sock.close();
+        BOOST_TEST_EQ(sock.is_open(), false);
+    }
+
+    void testRecvClosedThrows()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket sock(ioc);
+        char buf[4];
+        BOOST_TEST_THROWS(
+            (void)sock.recv(capy::mutable_buffer(buf, sizeof(buf))),
+            std::logic_error);
+    }
+
+    void testConnectAccept()
+    {
+        io_context ioc(Backend);
+        auto ex   = ioc.get_executor();
+        test::temp_socket_dir tmp;
+        auto path = tmp.path();
+
+        local_seqpacket_acceptor acc(ioc);
+        acc.open();
+        auto ec = acc.bind(local_endpoint(path));
+        BOOST_TEST_EQ(!ec, true);
+        ec = acc.listen();
+        BOOST_TEST_EQ(!ec, true);
+
+        local_seqpacket_socket client(ioc);
+        std::error_code accept_ec, connect_ec;
+        std::string got;
+
+        capy::run_async(ex)(
+            [](local_seqpacket_acceptor& a, std::error_code& ec_out,
+               std::string& out) -> capy::task<> {
+                auto [ec, peer] = co_await a.accept();
+                ec_out = ec;
+                if (ec)
+                    co_return;
+                char buf[64];
+                auto [rec, n] = co_await peer.recv(
+                    capy::mutable_buffer(buf, sizeof(buf)));
+                if (!rec)
+                    out.assign(buf, n);
+            }(acc, accept_ec, got));
+
+        capy::run_async(ex)(
+            [](local_seqpacket_socket& s, local_endpoint ep,
+               std::error_code& ec_out) -> capy::task<> {
+                auto [ec] = co_await s.connect(ep);
+                ec_out    = ec;
+                if (!ec)
+                    (void)co_await s.send(capy::const_buffer("hello", 5));
+            }(client, local_endpoint(path), connect_ec));
+
+        ioc.run();
+
+        BOOST_TEST_EQ(!accept_ec, true);
+        BOOST_TEST_EQ(!connect_ec, true);
+        BOOST_TEST_EQ(got, std::string("hello"));
+    }
+
+    void testMessageBoundaries()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        auto send = [](local_seqpacket_socket& s) -> capy::task<> {
+            (void)co_await s.send(capy::const_buffer("a", 1));
+            (void)co_await s.send(capy::const_buffer("bbbb", 4));
+            (void)co_await s.send(capy::const_buffer("cc", 2));
+        };
+        capy::run_async(ioc.get_executor())(send(s1));
+        ioc.run();
+        ioc.restart();
+
+        // Each recv yields exactly one message, never a merge
+        std::array<std::size_t, 3> sizes{};
+        auto recv = [](local_seqpacket_socket& s,
+                       std::array<std::size_t, 3>& out) -> capy::task<> {
+            char buf[64];
+            for (auto& n_out : out)
+            {
+                auto [ec, n] = co_await s.recv(
+                    capy::mutable_buffer(buf, sizeof(buf)));
+                BOOST_TEST(!ec);
+                n_out = n;
+            }
+        };
+        capy::run_async(ioc.get_executor())(recv(s2, sizes));
+        ioc.run();
+
+        BOOST_TEST_EQ(sizes[0], 1u);
+        BOOST_TEST_EQ(sizes[1], 4u);
+        BOOST_TEST_EQ(sizes[2], 2u);
+    }
+
+#if defined(__linux__)
+    void testTruncation()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        std::error_code recv_ec;
+        std::size_t recvd = 0;
+        std::string next;
+
+        auto task = [](local_seqpacket_socket& tx, local_seqpacket_socket& rx,
+                       std::error_code& ec_out, std::size_t& n_out,
+                       std::string& next_out) -> capy::task<> {
+            (void)co_await tx.send(capy::const_buffer("0123456789", 10));
+            (void)co_await tx.send(capy::const_buffer("xy", 2));
+            char buf[4];
+            auto [ec, n] = co_await rx.recv(
+                capy::mutable_buffer(buf, sizeof(buf)));
+            ec_out = ec;
+            n_out  = n;
+            // The rest of the oversized message is gone
+            auto [ec2, n2] = co_await rx.recv(
+                capy::mutable_buffer(buf, sizeof(buf)));
+            if (!ec2)
+                next_out.assign(buf, n2);
+        };
+        capy::run_async(ioc.get_executor())(
+            task(s1, s2, recv_ec, recvd, next));
+        ioc.run();
+
+        BOOST_TEST(recv_ec == std::errc::message_size);
+        BOOST_TEST_EQ(recvd, 4u);
+        BOOST_TEST_EQ(next, std::string("xy"));
+    }
+#endif
+
+    void testRecvBatch()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        auto send = [](local_seqpacket_socket& s) -> capy::task<> {
+            for (int i = 1; i <= 5; ++i)
+            {
+                char msg[8];
+                std::memset(msg, '0' + i, sizeof(msg));
+                (void)co_await s.send(
+                    capy::const_buffer(msg, static_cast<std::size_t>(i)));
+            }
+        };
+        capy::run_async(ioc.get_executor())(send(s1));
+        ioc.run();
+        ioc.restart();
+
+        std::array<std::array<char, 16>, 8> storage{};
+        std::array<datagram_slot, 8> slots{};
+        for (std::size_t i = 0; i < slots.size(); ++i)
+            slots[i].buffer =
+                capy::mutable_buffer(storage[i].data(), storage[i].size());
+
+        std::error_code batch_ec;
+        std::size_t count = 0;
+        auto recv = [](local_seqpacket_socket& s,
+                       std::array<datagram_slot, 8>& sl,
+                       std::error_code& ec_out,
+                       std::size_t& n_out) -> capy::task<> {
+            auto [ec, n] = co_await s.recv_batch(sl);
+            ec_out = ec;
+            n_out  = n;
+        };
+        capy::run_async(ioc.get_executor())(
+            recv(s2, slots, batch_ec, count));
+        ioc.run();
+
+        BOOST_TEST(!batch_ec);
+        BOOST_TEST_GE(count, 1u);
+        BOOST_TEST_LE(count, 5u);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            BOOST_TEST_EQ(slots[i].size, i + 1);
+            BOOST_TEST_EQ(storage[i][0], static_cast<char>('1' + i));
+        }
+    }
+
+    void testEof()
+    {
+        io_context ioc(Backend);
+        local_seqpacket_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        s1.close();
+
+        std::error_code recv_ec, batch_ec;
+        auto task = [](local_seqpacket_socket& s, std::error_code& ec_out,
+                       std::error_code& batch_out) -> capy::task<> {
+            char buf[16];
+            auto [ec, n] = co_await s.recv(
+                capy::mutable_buffer(buf, sizeof(buf)));
+            ec_out = ec;
+
+            datagram_slot slot;
+            slot.buffer = capy::mutable_buffer(buf, sizeof(buf));
+            auto [bec, bn] = co_await s.recv_batch(
+                std::span<datagram_slot>(&slot, 1));
+            batch_out = bec;
+        };
+        capy::run_async(ioc.get_executor())(task(s2, recv_ec, batch_ec));
+        ioc.run();
+
+        BOOST_TEST(recv_ec == capy::error::eof);
+        BOOST_TEST(batch_ec == capy::error::eof);
+    }
+
+    void run()
+    {
+        testOpenClose();
+        testRecvClosedThrows();
+        testConnectAccept();
+        testMessageBoundaries();
+#if defined(__linux__)
+        testTruncation();
+#endif
+        testRecvBatch();
+        testEof();
+    }
+};
+
+COROSIO_BACKEND_TESTS(
+    local_seqpacket_socket_test, "boost.corosio.local_seqpacket_socket")
+
+} // namespace boost::corosio
+
+#endif // BOOST_COROSIO_POSIX
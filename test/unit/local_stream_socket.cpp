@@ -40,6 +40,7 @@
 #include <chrono>
 #include <compare>
 #include <cstring>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -943,6 +944,9 @@ struct local_stream_socket_test
 #if BOOST_COROSIO_POSIX
         testAvailable();
         testRelease();
+        testPassFds();
+        testPassFdsClosedThrows();
+        testPassFdsEmptyBuffer();
 #endif
     }
 
@@ -1007,6 +1011,126 @@ struct local_stream_socket_test
         ::close(handle);
 #endif
     }
+
+    void testPassFds()
+    {
+        io_context ioc(Backend);
+        local_stream_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        int pipe_fds[2];
+        BOOST_TEST_EQ(::pipe(pipe_fds), 0);
+
+        auto ex = ioc.get_executor();
+        std::error_code send_ec, recv_ec;
+        std::size_t recv_n = 0, fd_count = 0;
+        native_handle_type received[2] = {-1, -1};
+        char buf[16] = {};
+
+        capy::run_async(ex)(
+            [](local_stream_socket& s, int fd,
+               std::error_code& ec_out) -> capy::task<> {
+                native_handle_type fds[] = {fd};
+                auto [ec, n] = co_await s.send_with_fds(
+                    capy::const_buffer("x", 1), fds);
+                ec_out = ec;
+            }(s1, pipe_fds[0], send_ec));
+
+        capy::run_async(ex)(
+            [](local_stream_socket& s, char* data, std::size_t len,
+               std::span<native_handle_type> fds, std::size_t& count,
+               std::error_code& ec_out,
+               std::size_t& n_out) -> capy::task<> {
+                auto [ec, n] = co_await s.recv_with_fds(
+                    capy::mutable_buffer(data, len), fds, count);
+                ec_out = ec;
+                n_out  = n;
+            }(s2, buf, sizeof(buf), received, fd_count, recv_ec, recv_n));
+
+        ioc.run();
+
+        BOOST_TEST_EQ(!send_ec, true);
+        BOOST_TEST_EQ(!recv_ec, true);
+        BOOST_TEST_EQ(recv_n, 1u);
+        BOOST_TEST_EQ(fd_count, 1u);
+        if (fd_count != 1)
+            return;
+
+        // The received descriptor is a working duplicate of the read end
+        BOOST_TEST(received[0] != pipe_fds[0]);
+        ::close(pipe_fds[0]);
+        BOOST_TEST_EQ(::write(pipe_fds[1], "ok", 2), 2);
+        char out[2] = {};
+        BOOST_TEST_EQ(::read(received[0], out, 2), 2);
+        BOOST_TEST_EQ(std::string(out, 2), std::string("ok"));
+        ::close(received[0]);
+        ::close(pipe_fds[1]);
+    }
+
+    void testPassFdsClosedThrows()
+    {
+        io_context ioc(Backend);
+        local_stream_socket s(ioc);
+        char buf[1];
+        std::size_t fd_count = 0;
+        native_handle_type fds[1];
+
+        bool caught = false;
+        try
+        {
+            (void)s.send_with_fds(
+                capy::const_buffer(buf, 1),
+                std::span<native_handle_type const>());
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+
+        caught = false;
+        try
+        {
+            (void)s.recv_with_fds(capy::mutable_buffer(buf, 1), fds, fd_count);
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+    }
+
+    // Descriptors need a byte to travel with
+    void testPassFdsEmptyBuffer()
+    {
+        io_context ioc(Backend);
+        local_stream_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+
+        int pipe_fds[2];
+        BOOST_TEST_EQ(::pipe(pipe_fds), 0);
+
+        std::error_code send_ec;
+        std::size_t sent = 1;
+        capy::run_async(ioc.get_executor())(
+            [](local_stream_socket& s, int fd, std::error_code& ec_out,
+               std::size_t& n_out) -> capy::task<> {
+                native_handle_type fds[] = {fd};
+                auto [ec, n] =
+                    co_await s.send_with_fds(capy::const_buffer(), fds);
+                ec_out = ec;
+                n_out  = n;
+            }(s1, pipe_fds[0], send_ec, sent));
+        ioc.run();
+
+        BOOST_TEST(send_ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(sent, 0u);
+
+        ::close(pipe_fds[0]);
+        ::close(pipe_fds[1]);
+    }
 #endif
 
     void testEndpointStreamOutput()
@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/mapped_file.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/stream_file.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file(std::string_view prefix, std::string_view contents)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+std::string
+make_pattern(std::size_t n)
+{
+    std::string s(n, '\0');
+    for (std::size_t i = 0; i < n; ++i)
+        s[i] = static_cast<char>('a' + (i * 7 + i / 251) % 26);
+    return s;
+}
+
+} // namespace
+
+template<auto Backend>
+struct mapped_file_test
+{
+    void testEmpty()
+    {
+        mapped_file m;
+        BOOST_TEST(!m.is_open());
+        BOOST_TEST_EQ(m.size(), 0u);
+        BOOST_TEST_THROWS((void)m.ensure_resident(0, 1), std::logic_error);
+
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        BOOST_TEST_THROWS(mapped_file{f}, std::logic_error);
+    }
+
+    void testView()
+    {
+        auto const data = make_pattern(100000);
+        temp_file tmp("mapped_view_", data);
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+        mapped_file m(f);
+
+        // The mapping outlives the file
+        f.close();
+
+        BOOST_TEST(m.is_open());
+        BOOST_TEST_EQ(m.size(), data.size());
+        BOOST_TEST(std::memcmp(m.data(), data.data(), data.size()) == 0);
+
+        auto b = m.view(5000, 100);
+        BOOST_TEST_EQ(b.size(), 100u);
+        BOOST_TEST(std::memcmp(b.data(), data.data() + 5000, 100) == 0);
+
+        // Clamped to the end
+        BOOST_TEST_EQ(m.view(99990).size(), 10u);
+        BOOST_TEST_EQ(m.view(data.size()).size(), 0u);
+        BOOST_TEST_THROWS(m.view(data.size() + 1), std::out_of_range);
+
+        mapped_file m2(std::move(m));
+        BOOST_TEST(!m.is_open());
+        BOOST_TEST_EQ(m2.size(), data.size());
+    }
+
+    void testEmptyFile()
+    {
+        temp_file tmp("mapped_empty_", "");
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+        mapped_file m(f);
+
+        BOOST_TEST(m.is_open());
+        BOOST_TEST_EQ(m.size(), 0u);
+        BOOST_TEST_EQ(m.view(0).size(), 0u);
+    }
+
+    void testEnsureResident()
+    {
+        auto const data = make_pattern(256 * 1024 + 17);
+        temp_file tmp("mapped_res_", data);
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+        mapped_file m(f);
+
+        int done = 0;
+        auto task = [&]() -> capy::task<> {
+            auto [ec1] = co_await m.ensure_resident(0, m.size());
+            BOOST_TEST(!ec1);
+            ++done;
+
+            // Unaligned, and clamped past the end
+            auto [ec2] = co_await m.ensure_resident(4097, 1 << 30);
+            BOOST_TEST(!ec2);
+            ++done;
+
+            auto [ec3] = co_await m.ensure_resident(m.size() + 10, 10);
+            BOOST_TEST(!ec3);
+            ++done;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST_EQ(done, 3);
+    }
+
+    void testViewAsWriteBuffer()
+    {
+        auto const data = make_pattern(20000);
+        temp_file src("mapped_src_", data);
+        temp_file dst("mapped_dst_", "");
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(src.path, file_base::read_only);
+        mapped_file m(f);
+
+        stream_file out(ioc);
+        out.open(dst.path, file_base::write_only);
+
+        auto task = [&]() -> capy::task<> {
+            auto [ec] = co_await m.ensure_resident(1000, 8000);
+            BOOST_TEST(!ec);
+            std::size_t off = 1000;
+            while (off < 9000)
+            {
+                auto [wec, n] =
+                    co_await out.write_some(m.view(off, 9000 - off));
+                BOOST_TEST(!wec);
+                if (wec)
+                    co_return;
+                off += n;
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+        out.close();
+
+        std::ifstream ifs(dst.path, std::ios::binary);
+        std::string got(
+            (std::istreambuf_iterator<char>(ifs)),
+            std::istreambuf_iterator<char>());
+        BOOST_TEST(got == data.substr(1000, 8000));
+    }
+
+    void run()
+    {
+        testEmpty();
+        testView();
+        testEmptyFile();
+        testEnsureResident();
+        testViewAsWriteBuffer();
+    }
+};
+
+COROSIO_BACKEND_TESTS(mapped_file_test, "boost.corosio.mapped_file")
+
+} // namespace boost::corosio
@@ -0,0 +1,463 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/multicast_receiver.hpp>
+
+#include <boost/corosio/socket_option.hpp>
+#include <boost/corosio/timer.hpp>
+#include <boost/corosio/udp_socket.hpp>
+
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+namespace boost::corosio {
+namespace {
+
+capy::task<>
+ignore(multicast_packet const&)
+{
+    co_return;
+}
+
+// Payloads start with a native-endian u64 sequence number.
+std::optional<std::uint64_t>
+read_seq(capy::const_buffer b)
+{
+    if (b.size() < sizeof(std::uint64_t))
+        return std::nullopt;
+    std::uint64_t v;
+    std::memcpy(&v, b.data(), sizeof(v));
+    return v;
+}
+
+} // namespace
+
+template<auto Backend>
+struct multicast_receiver_test
+{
+    void testOpenClose()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        BOOST_TEST(!rx.is_open());
+
+        auto ec = rx.open(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        BOOST_TEST(rx.is_open());
+        BOOST_TEST(rx.local_endpoint().port() != 0);
+        BOOST_TEST_EQ(rx.size(), 0u);
+
+        rx.close();
+        BOOST_TEST(!rx.is_open());
+        rx.close();
+    }
+
+    void testClosedThrows()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+
+        BOOST_TEST_THROWS(
+            (void)rx.join(ipv4_address("239.255.0.10"), ignore),
+            std::logic_error);
+        BOOST_TEST_THROWS((void)rx.run(), std::logic_error);
+    }
+
+    void testJoinErrors()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        ipv4_address group("239.255.0.10");
+
+        ec = rx.join(group, {});
+        BOOST_TEST(ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(rx.size(), 0u);
+
+        // Environment without multicast routing; nothing more to check
+        if (rx.join(group, ignore))
+            return;
+        BOOST_TEST_EQ(rx.size(), 1u);
+
+        ec = rx.join(group, ignore);
+        BOOST_TEST(ec == std::errc::address_in_use);
+        BOOST_TEST_EQ(rx.size(), 1u);
+
+        (void)rx.leave(group);
+        BOOST_TEST_EQ(rx.size(), 0u);
+        BOOST_TEST_EQ(rx.stats(group).packets, 0u);
+    }
+
+    void testCancelRun()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        bool done = false;
+        std::error_code run_ec;
+        capy::run_async(ioc.get_executor())(
+            [](multicast_receiver& r, std::error_code& ec_out,
+               bool& done_out) -> capy::task<> {
+                auto [ec] = co_await r.run();
+                ec_out    = ec;
+                done_out  = true;
+            }(rx, run_ec, done));
+
+        ioc.poll();
+        BOOST_TEST(!done);
+
+        rx.cancel();
+        ioc.run();
+
+        BOOST_TEST(done);
+        BOOST_TEST(run_ec == capy::cond::canceled);
+    }
+
+#if BOOST_COROSIO_POSIX
+    void testDispatchByGroup()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        ipv4_address group_a("239.255.0.11");
+        ipv4_address group_b("239.255.0.12");
+
+        int got_a = 0;
+        int got_b = 0;
+        auto on_a = [&](multicast_packet const& p) -> capy::task<> {
+            BOOST_TEST(p.group == endpoint(group_a, 0));
+            ++got_a;
+            co_return;
+        };
+        auto on_b = [&](multicast_packet const& p) -> capy::task<> {
+            BOOST_TEST(p.group == endpoint(group_b, 0));
+            ++got_b;
+            co_return;
+        };
+
+        // Join may fail in CI without multicast routing; skip
+        if (rx.join(group_a, on_a, read_seq) || rx.join(group_b, on_b))
+            return;
+
+        udp_socket sender(ioc);
+        sender.open();
+        sender.set_option(socket_option::multicast_loop_v4(true));
+
+        bool skipped = false;
+        auto port    = rx.local_endpoint().port();
+
+        auto send_task = [&]() -> capy::task<> {
+            // Sequence 2 is missing on group A
+            std::uint64_t const seqs[] = {0, 1, 3};
+            for (auto seq : seqs)
+            {
+                auto [ec1, n1] = co_await sender.send_to(
+                    capy::const_buffer(&seq, sizeof(seq)),
+                    endpoint(group_a, port));
+                // CI runners may lack a multicast route (EHOSTUNREACH)
+                if (ec1)
+                {
+                    skipped = true;
+                    co_return;
+                }
+            }
+            std::uint64_t seq = 0;
+            (void)co_await sender.send_to(
+                capy::const_buffer(&seq, sizeof(seq)),
+                endpoint(group_b, port));
+        };
+
+        // Stop the receiver once everything arrived, or give up
+        auto watchdog = [&]() -> capy::task<> {
+            timer t(ioc);
+            for (int i = 0; i < 100; ++i)
+            {
+                if (skipped || got_a + got_b == 4)
+                    break;
+                t.expires_after(std::chrono::milliseconds(10));
+                (void)co_await t.wait();
+            }
+            rx.cancel();
+        };
+
+        auto run_task = [&]() -> capy::task<> {
+            auto [ec2] = co_await rx.run();
+            BOOST_TEST(ec2 == capy::cond::canceled);
+        };
+
+        auto ex = ioc.get_executor();
+        capy::run_async(ex)(run_task());
+        capy::run_async(ex)(send_task());
+        capy::run_async(ex)(watchdog());
+        ioc.run();
+
+        if (skipped)
+            return;
+
+        BOOST_TEST_EQ(got_a, 3);
+        BOOST_TEST_EQ(got_b, 1);
+
+        auto sa = rx.stats(group_a);
+        BOOST_TEST_EQ(sa.packets, 3u);
+        BOOST_TEST_EQ(sa.bytes, 3 * sizeof(std::uint64_t));
+        BOOST_TEST_EQ(sa.gaps, 1u);
+        BOOST_TEST_EQ(sa.reordered, 0u);
+
+        auto sb = rx.stats(group_b);
+        BOOST_TEST_EQ(sb.packets, 1u);
+        BOOST_TEST_EQ(sb.gaps, 0u);
+        BOOST_TEST_EQ(rx.unrouted(), 0u);
+    }
+
+    void testUnrouted()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        // Unicast to the receiver matches no group
+        udp_socket sender(ioc);
+        sender.open();
+
+        bool delivered = false;
+        auto task = [&]() -> capy::task<> {
+            char const msg[] = "x";
+            (void)co_await sender.send_to(
+                capy::const_buffer(msg, sizeof(msg)), rx.local_endpoint());
+
+            timer t(ioc);
+            for (int i = 0; i < 100 && rx.unrouted() == 0; ++i)
+            {
+                t.expires_after(std::chrono::milliseconds(10));
+                (void)co_await t.wait();
+            }
+            rx.cancel();
+        };
+
+        auto run_task = [&]() -> capy::task<> {
+            (void)co_await rx.run();
+            delivered = true;
+        };
+
+        auto ex = ioc.get_executor();
+        capy::run_async(ex)(run_task());
+        capy::run_async(ex)(task());
+        ioc.run();
+
+        BOOST_TEST(delivered);
+        BOOST_TEST_EQ(rx.unrouted(), 1u);
+    }
+
+    // A handler may leave its own group while it is running
+    void testLeaveFromHandler()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        ipv4_address group("239.255.0.13");
+
+        int got = 0;
+        auto on_packet = [&](multicast_packet const& p) -> capy::task<> {
+            ++got;
+            (void)rx.leave(group);
+            BOOST_TEST_EQ(rx.size(), 0u);
+            BOOST_TEST_EQ(rx.stats(group).packets, 0u);
+
+            // The handler's state outlives leave(); suspend to prove it
+            timer t(ioc);
+            t.expires_after(std::chrono::milliseconds(1));
+            (void)co_await t.wait();
+            BOOST_TEST(p.group == endpoint(group, 0));
+        };
+
+        // Join may fail in CI without multicast routing; skip
+        if (rx.join(group, on_packet))
+            return;
+
+        udp_socket sender(ioc);
+        sender.open();
+        sender.set_option(socket_option::multicast_loop_v4(true));
+
+        bool skipped = false;
+        auto port    = rx.local_endpoint().port();
+
+        auto send_task = [&]() -> capy::task<> {
+            std::uint64_t seq = 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                auto [ec1, n1] = co_await sender.send_to(
+                    capy::const_buffer(&seq, sizeof(seq)),
+                    endpoint(group, port));
+                if (ec1)
+                {
+                    skipped = true;
+                    co_return;
+                }
+            }
+        };
+
+        auto watchdog = [&]() -> capy::task<> {
+            timer t(ioc);
+            for (int i = 0; i < 100; ++i)
+            {
+                if (skipped || (got == 1 && rx.size() == 0))
+                    break;
+                t.expires_after(std::chrono::milliseconds(10));
+                (void)co_await t.wait();
+            }
+            // Let any datagrams still queued be read and not delivered
+            t.expires_after(std::chrono::milliseconds(20));
+            (void)co_await t.wait();
+            rx.cancel();
+        };
+
+        auto run_task = [&]() -> capy::task<> {
+            auto [ec2] = co_await rx.run();
+            BOOST_TEST(ec2 == capy::cond::canceled);
+        };
+
+        auto ex = ioc.get_executor();
+        capy::run_async(ex)(run_task());
+        capy::run_async(ex)(send_task());
+        capy::run_async(ex)(watchdog());
+        ioc.run();
+
+        if (skipped)
+            return;
+
+        BOOST_TEST_EQ(got, 1);
+        BOOST_TEST_EQ(rx.size(), 0u);
+
+        // The group may be joined again afterwards
+        BOOST_TEST_EQ(rx.join(group, ignore), std::error_code{});
+        BOOST_TEST_EQ(rx.size(), 1u);
+    }
+
+    // close() from a handler ends the run after that handler
+    void testCloseFromHandler()
+    {
+        io_context ioc(Backend);
+        multicast_receiver rx(ioc);
+        auto ec = rx.open(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        ipv4_address group("239.255.0.14");
+
+        int got = 0;
+        auto on_packet = [&](multicast_packet const&) -> capy::task<> {
+            ++got;
+            rx.close();
+            BOOST_TEST_EQ(rx.size(), 0u);
+            co_return;
+        };
+
+        if (rx.join(group, on_packet))
+            return;
+
+        udp_socket sender(ioc);
+        sender.open();
+        sender.set_option(socket_option::multicast_loop_v4(true));
+
+        bool skipped = false;
+        bool done    = false;
+        auto port    = rx.local_endpoint().port();
+
+        auto send_task = [&]() -> capy::task<> {
+            std::uint64_t seq = 0;
+            for (int i = 0; i < 3; ++i)
+            {
+                auto [ec1, n1] = co_await sender.send_to(
+                    capy::const_buffer(&seq, sizeof(seq)),
+                    endpoint(group, port));
+                if (ec1)
+                {
+                    skipped = true;
+                    co_return;
+                }
+            }
+        };
+
+        auto watchdog = [&]() -> capy::task<> {
+            timer t(ioc);
+            for (int i = 0; i < 100 && !done; ++i)
+            {
+                if (skipped)
+                {
+                    rx.cancel();
+                    co_return;
+                }
+                t.expires_after(std::chrono::milliseconds(10));
+                (void)co_await t.wait();
+            }
+            if (!done)
+                rx.cancel();
+        };
+
+        auto run_task = [&]() -> capy::task<> {
+            auto [ec2] = co_await rx.run();
+            BOOST_TEST(ec2 == capy::cond::canceled);
+            done = true;
+        };
+
+        auto ex = ioc.get_executor();
+        capy::run_async(ex)(run_task());
+        capy::run_async(ex)(send_task());
+        capy::run_async(ex)(watchdog());
+        ioc.run();
+
+        if (skipped)
+            return;
+
+        BOOST_TEST(done);
+        BOOST_TEST_EQ(got, 1);
+        BOOST_TEST(!rx.is_open());
+        BOOST_TEST_EQ(rx.size(), 0u);
+    }
+#endif
+
+    void run()
+    {
+        testOpenClose();
+        testClosedThrows();
+        testJoinErrors();
+        testCancelRun();
+#if BOOST_COROSIO_POSIX
+        testDispatchByGroup();
+        testUnrouted();
+        testLeaveFromHandler();
+        testCloseFromHandler();
+#endif
+    }
+};
+
+COROSIO_BACKEND_TESTS(multicast_receiver_test, "boost.corosio.multicast_receiver")
+
+} // namespace boost::corosio
@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/process.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/timer.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <errno.h>
+#include <sys/wait.h>
+
+namespace boost::corosio {
+
+#if BOOST_COROSIO_HAS_EPOLL
+
+template<auto Backend>
+struct process_test
+{
+    // Backends whose reactor watches the process service
+    static constexpr bool uses_pidfd =
+#if BOOST_COROSIO_HAS_IO_URING
+        std::is_same_v<std::remove_const_t<decltype(Backend)>, io_uring_t> ||
+#endif
+        std::is_same_v<std::remove_const_t<decltype(Backend)>, epoll_t>;
+
+    static capy::task<>
+    read_all(local_stream_socket& s, std::string& out)
+    {
+        char buf[256];
+        for (;;)
+        {
+            auto [ec, n] =
+                co_await s.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+            out.append(buf, n);
+            if (ec)
+                co_return;
+        }
+    }
+
+    void testExitCode()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        p.spawn("/bin/sh", {"-c", "exit 3"});
+        BOOST_TEST(p.id() > 0);
+        BOOST_TEST(p.native_handle() >= 0);
+
+        std::error_code wait_ec;
+        int status = -1;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec, code] = co_await p.wait();
+            wait_ec         = ec;
+            status          = code;
+        }());
+        ioc.run();
+
+        BOOST_TEST(!wait_ec);
+        BOOST_TEST_EQ(status, 3);
+        BOOST_TEST_EQ(p.native_handle(), -1);
+    }
+
+    void testWaitAgain()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        p.spawn("/bin/sh", {"-c", "exit 5"});
+
+        int first = -1, second = -1;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec1, c1] = co_await p.wait();
+            first          = c1;
+            auto [ec2, c2] = co_await p.wait();
+            second         = c2;
+        }());
+        ioc.run();
+
+        BOOST_TEST_EQ(first, 5);
+        BOOST_TEST_EQ(second, 5);
+        BOOST_TEST(p.send_signal(SIGTERM) == std::errc::no_such_process);
+    }
+
+    void testKilledBySignal()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        p.spawn("sleep", {"10"});
+        BOOST_TEST(!p.send_signal(SIGKILL));
+
+        int status = 0;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec, code] = co_await p.wait();
+            status          = code;
+        }());
+        ioc.run();
+
+        BOOST_TEST_EQ(status, -SIGKILL);
+    }
+
+    void testStdoutPipe()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        process_options opts;
+        opts.stdout_mode = process_stdio::pipe;
+        p.spawn("/bin/sh", {"-c", "echo hello; echo oops >&2"}, opts);
+        BOOST_TEST(p.stdout_pipe().is_open());
+        BOOST_TEST(!p.stderr_pipe().is_open());
+
+        std::string out;
+        int status = -1;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            co_await read_all(p.stdout_pipe(), out);
+            auto [ec, code] = co_await p.wait();
+            status          = code;
+        }());
+        ioc.run();
+
+        BOOST_TEST_EQ(out, "hello\n");
+        BOOST_TEST_EQ(status, 0);
+    }
+
+    void testStdinRoundTrip()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        process_options opts;
+        opts.stdin_mode  = process_stdio::pipe;
+        opts.stdout_mode = process_stdio::pipe;
+        opts.stderr_mode = process_stdio::null;
+        p.spawn("cat", {}, opts);
+
+        std::string const msg = "round trip";
+        std::string out;
+        std::error_code write_ec;
+        int status = -1;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec, n] = co_await p.stdin_pipe().write_some(
+                capy::const_buffer(msg.data(), msg.size()));
+            write_ec = ec;
+            p.stdin_pipe().close();
+            co_await read_all(p.stdout_pipe(), out);
+            auto [wec, code] = co_await p.wait();
+            status           = code;
+        }());
+        ioc.run();
+
+        BOOST_TEST(!write_ec);
+        BOOST_TEST_EQ(out, msg);
+        BOOST_TEST_EQ(status, 0);
+    }
+
+    void testEnvironmentAndDirectory()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        process_options opts;
+        opts.environment       = {"COROSIO_TEST=42"};
+        opts.working_directory = "/";
+        opts.stdout_mode       = process_stdio::pipe;
+        p.spawn("/bin/sh", {"-c", "echo $COROSIO_TEST; pwd"}, opts);
+
+        std::string out;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            co_await read_all(p.stdout_pipe(), out);
+            (void)co_await p.wait();
+        }());
+        ioc.run();
+
+        BOOST_TEST_EQ(out, "42\n/\n");
+    }
+
+    void testManyChildren()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        constexpr int count = 16;
+
+        io_context ioc(Backend);
+        std::vector<process> procs;
+        for (int i = 0; i < count; ++i)
+        {
+            procs.emplace_back(ioc);
+            procs.back().spawn(
+                "/bin/sh", {"-c", "exit " + std::to_string(i)});
+        }
+
+        std::vector<int> status(count, -1);
+        for (int i = 0; i < count; ++i)
+        {
+            capy::run_async(ioc.get_executor())(
+                [](process& p, int& out) -> capy::task<> {
+                    auto [ec, code] = co_await p.wait();
+                    if (!ec)
+                        out = code;
+                }(procs[i], status[i]));
+        }
+        ioc.run();
+
+        for (int i = 0; i < count; ++i)
+            BOOST_TEST_EQ(status[i], i);
+    }
+
+    void testCancelWait()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        p.spawn("sleep", {"10"});
+
+        std::stop_source ss;
+        std::error_code wait_ec;
+        capy::run_async(ioc.get_executor(), ss.get_token())(
+            [&]() -> capy::task<> {
+                auto [ec, code] = co_await p.wait();
+                wait_ec         = ec;
+            }());
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            timer t(ioc);
+            t.expires_after(std::chrono::milliseconds(20));
+            (void)co_await t.wait();
+            ss.request_stop();
+        }());
+        ioc.run();
+        ioc.restart();
+
+        BOOST_TEST(wait_ec == capy::cond::canceled);
+        BOOST_TEST(p.native_handle() >= 0);
+
+        // The child survives the cancellation and can be waited again
+        BOOST_TEST(!p.send_signal(SIGKILL));
+        int status = 0;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec, code] = co_await p.wait();
+            status          = code;
+        }());
+        ioc.run();
+
+        BOOST_TEST_EQ(status, -SIGKILL);
+    }
+
+    // A child outliving its process object is reaped by the context,
+    // and does not keep run() from returning
+    void testDestroyRunningChild()
+    {
+        if constexpr (!uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        int pid = -1;
+        {
+            process p(ioc);
+            p.spawn("sleep", {"0.1"});
+            pid = p.id();
+        }
+
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            timer t(ioc);
+            t.expires_after(std::chrono::milliseconds(500));
+            (void)co_await t.wait();
+        }());
+        ioc.run();
+
+        // ECHILD: no such unreaped child remains
+        siginfo_t info{};
+        BOOST_TEST(
+            ::waitid(
+                P_PID, static_cast<id_t>(pid), &info,
+                WEXITED | WNOHANG | WNOWAIT) < 0);
+        BOOST_TEST_EQ(errno, ECHILD);
+    }
+
+    void testSpawnFailure()
+    {
+        io_context ioc(Backend);
+        process p(ioc);
+        BOOST_TEST_THROWS(
+            p.spawn("/nonexistent/corosio-no-such-program"),
+            std::system_error);
+        BOOST_TEST_EQ(p.id(), -1);
+    }
+
+    void testWaitWithoutChild()
+    {
+        io_context ioc(Backend);
+        process p(ioc);
+        BOOST_TEST_THROWS((void)p.wait(), std::logic_error);
+    }
+
+    void testUnsupportedBackend()
+    {
+        if constexpr (uses_pidfd)
+            return;
+
+        io_context ioc(Backend);
+        process p(ioc);
+        p.spawn("/bin/sh", {"-c", "exit 0"});
+
+        std::error_code wait_ec;
+        capy::run_async(ioc.get_executor())([&]() -> capy::task<> {
+            auto [ec, code] = co_await p.wait();
+            wait_ec         = ec;
+        }());
+        ioc.run();
+
+        BOOST_TEST(wait_ec == std::errc::operation_not_supported);
+    }
+
+    void run()
+    {
+        testExitCode();
+        testWaitAgain();
+        testKilledBySignal();
+        testStdoutPipe();
+        testStdinRoundTrip();
+        testEnvironmentAndDirectory();
+        testManyChildren();
+        testCancelWait();
+        testDestroyRunningChild();
+        testSpawnFailure();
+        testWaitWithoutChild();
+        testUnsupportedBackend();
+    }
+};
+
+COROSIO_BACKEND_TESTS(process_test, "boost.corosio.process")
+
+#endif // BOOST_COROSIO_HAS_EPOLL
+
+} // namespace boost::corosio
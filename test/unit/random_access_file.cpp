@@ -16,6 +16,7 @@
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
 
+#include <boost/corosio/aligned_allocator.hpp>
 #include <boost/corosio/io_context.hpp>
 #include <boost/capy/buffers.hpp>
 #include <boost/capy/cond.hpp>
@@ -30,11 +31,14 @@
 #include <filesystem>
 #include <fstream>
 #include <random>
+#include <span>
+#include <stdexcept>
 #include <atomic>
 #include <limits>
 #include <stop_token>
 #include <string>
 #include <system_error>
+#include <vector>
 
 #include <boost/corosio/detail/platform.hpp>
 
@@ -70,6 +74,12 @@ struct temp_file
              / (std::string(prefix) + unique_path_suffix());
     }
 
+    // In a given directory, e.g. to avoid a tmpfs temp directory
+    temp_file(std::string_view prefix, std::filesystem::path const& dir)
+    {
+        path = dir / (std::string(prefix) + unique_path_suffix());
+    }
+
     temp_file(std::string_view prefix, std::string_view contents)
         : temp_file(prefix)
     {
@@ -402,6 +412,41 @@ struct random_access_file_test
         BOOST_TEST_EQ(read_count, 4);
     }
 
+    void testHotFileReads()
+    {
+        // A freshly written file sits in the page cache. Enough reads
+        // to outrun the inline budget cover both completion paths.
+        std::string data;
+        for (int i = 0; i < 1024; ++i)
+            data += static_cast<char>('a' + i % 26);
+        temp_file tmp("raf_hot_", data);
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+
+        std::string got;
+        std::error_code last;
+        auto task = [&]() -> capy::task<> {
+            char buf[8];
+            for (;;)
+            {
+                auto [ec, n] = co_await f.read_some_at(
+                    got.size(), capy::mutable_buffer(buf, sizeof(buf)));
+                got.append(buf, n);
+                if (ec)
+                {
+                    last = ec;
+                    co_return;
+                }
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(last == capy::cond::eof);
+        BOOST_TEST(got == data);
+    }
+
     // Cancel
 
     void testCancelNoOperation()
@@ -668,6 +713,7 @@ struct random_access_file_test
         testWriteAndReadAtDifferentOffsets();
 
         testSequentialReads();
+        testHotFileReads();
 
         testCancelNoOperation();
         testCancelOnClosedFile();
@@ -691,6 +737,10 @@ struct random_access_file_test
         testReadAtPastEofErrorPath();
         testCancelInflightOperation();
         testCancelWithStoppedToken();
+        testDirectReadWrite();
+        testDirectMisaligned();
+        testReadBatch();
+        testReadBatchPartialFailure();
     }
 
     // Operations on closed file
@@ -1022,6 +1072,191 @@ struct random_access_file_test
 
         BOOST_TEST(completed);
     }
+
+    // Direct I/O
+
+    // Open for direct I/O on a disk-backed scratch file. Returns
+    // false where the filesystem refuses O_DIRECT.
+    static bool open_direct(random_access_file& f, temp_file const& tmp)
+    {
+        try
+        {
+            f.open(tmp.path,
+                file_base::read_write | file_base::create |
+                    file_base::truncate | file_base::direct);
+            return true;
+        }
+        catch (std::system_error const&)
+        {
+            return false;
+        }
+    }
+
+    void testDirectReadWrite()
+    {
+        // The working directory, unlike /tmp, is rarely tmpfs
+        temp_file tmp("raf_direct_", std::filesystem::current_path());
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        if (!open_direct(f, tmp))
+            return;
+
+        constexpr std::size_t block = 4096;
+        std::vector<char, aligned_allocator<char>> out(2 * block);
+        std::vector<char, aligned_allocator<char>> in(2 * block);
+        for (std::size_t i = 0; i < out.size(); ++i)
+            out[i] = static_cast<char>('a' + i % 26);
+
+        bool completed = false;
+        auto task = [&]() -> capy::task<> {
+            auto [ec, n] = co_await f.write_some_at(
+                block, capy::const_buffer(out.data(), out.size()));
+            BOOST_TEST(!ec);
+            BOOST_TEST_EQ(n, out.size());
+
+            auto [ec2, n2] = co_await f.read_some_at(
+                block, capy::mutable_buffer(in.data(), in.size()));
+            BOOST_TEST(!ec2);
+            BOOST_TEST_EQ(n2, in.size());
+            BOOST_TEST(in == out);
+            completed = true;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(completed);
+        BOOST_TEST_EQ(f.size(), 3 * block);
+    }
+
+    void testDirectMisaligned()
+    {
+        temp_file tmp("raf_direct_bad_", std::filesystem::current_path());
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        if (!open_direct(f, tmp))
+            return;
+
+        constexpr std::size_t block = 4096;
+        std::vector<char, aligned_allocator<char>> buf(2 * block);
+
+        bool completed = false;
+        auto task = [&]() -> capy::task<> {
+            // Misaligned address
+            auto [ec1, n1] = co_await f.write_some_at(
+                0, capy::const_buffer(buf.data() + 1, block));
+            BOOST_TEST(ec1 == std::errc::invalid_argument);
+            BOOST_TEST_EQ(n1, 0u);
+
+            // Misaligned length
+            auto [ec2, n2] = co_await f.read_some_at(
+                0, capy::mutable_buffer(buf.data(), block - 1));
+            BOOST_TEST(ec2 == std::errc::invalid_argument);
+            BOOST_TEST_EQ(n2, 0u);
+
+            // Misaligned offset
+            auto [ec3, n3] = co_await f.write_some_at(
+                1, capy::const_buffer(buf.data(), block));
+            BOOST_TEST(ec3 == std::errc::invalid_argument);
+            BOOST_TEST_EQ(n3, 0u);
+            completed = true;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(completed);
+    }
+
+    // Batched reads
+
+    void testReadBatch()
+    {
+        // 64 scattered 4-byte records, as an index lookup would issue
+        std::string data;
+        for (int i = 0; i < 256; ++i)
+            data += std::string(4, static_cast<char>('!' + i % 90));
+        temp_file tmp("raf_batch_", data);
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+
+        constexpr std::size_t count = 64;
+        char bufs[count][4] = {};
+        random_access_file::read_request reqs[count];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            reqs[i].offset = ((i * 37) % 256) * 4;
+            reqs[i].buffer = capy::mutable_buffer(bufs[i], 4);
+        }
+
+        bool done = false;
+        auto task = [&]() -> capy::task<> {
+            auto [ec, n] = co_await f.read_batch(reqs);
+            BOOST_TEST(!ec);
+            BOOST_TEST_EQ(n, count * 4);
+            done = true;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(done);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            BOOST_TEST(!reqs[i].ec);
+            BOOST_TEST_EQ(reqs[i].bytes_transferred, 4u);
+            BOOST_TEST(
+                std::string(bufs[i], 4) ==
+                data.substr(static_cast<std::size_t>(reqs[i].offset), 4));
+        }
+    }
+
+    void testReadBatchPartialFailure()
+    {
+        temp_file tmp("raf_batch_eof_", "0123456789");
+        io_context ioc(Backend);
+        random_access_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+
+        char a[4] = {};
+        char b[4] = {};
+        char c[4] = {};
+        random_access_file::read_request reqs[4];
+        reqs[0].offset = 2;
+        reqs[0].buffer = capy::mutable_buffer(a, 4);
+        reqs[1].offset = 100; // past the end
+        reqs[1].buffer = capy::mutable_buffer(b, 4);
+        reqs[2].offset = 8; // short
+        reqs[2].buffer = capy::mutable_buffer(c, 4);
+        reqs[3].offset = 0; // empty buffer
+
+        bool done = false;
+        auto task = [&]() -> capy::task<> {
+            auto [ec, n] = co_await f.read_batch(reqs);
+            BOOST_TEST(ec == capy::cond::eof);
+            BOOST_TEST_EQ(n, 6u);
+
+            // An empty batch completes at once
+            std::span<random_access_file::read_request> none;
+            auto [ec2, n2] = co_await f.read_batch(none);
+            BOOST_TEST(!ec2);
+            BOOST_TEST_EQ(n2, 0u);
+            done = true;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(done);
+        BOOST_TEST(!reqs[0].ec);
+        BOOST_TEST_EQ(std::string(a, 4), "2345");
+        BOOST_TEST(reqs[1].ec == capy::cond::eof);
+        BOOST_TEST_EQ(reqs[1].bytes_transferred, 0u);
+        BOOST_TEST(!reqs[2].ec);
+        BOOST_TEST_EQ(reqs[2].bytes_transferred, 2u);
+        BOOST_TEST(!reqs[3].ec);
+        BOOST_TEST_EQ(reqs[3].bytes_transferred, 0u);
+
+        f.close();
+        BOOST_TEST_THROWS((void)f.read_batch(reqs), std::logic_error);
+    }
 };
 
 COROSIO_BACKEND_TESTS(random_access_file_test, "boost.corosio.random_access_file")
@@ -0,0 +1,357 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/read_ahead_file.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace boost::corosio {
+
+namespace {
+
+struct temp_file
+{
+    std::filesystem::path path;
+
+    temp_file(std::string_view prefix, std::string_view contents)
+    {
+        static unsigned const seed = std::random_device{}();
+        static std::atomic<unsigned> counter{0};
+        path = std::filesystem::temp_directory_path() /
+            (std::string(prefix) + std::to_string(seed) + "_" +
+             std::to_string(counter.fetch_add(1)));
+        append(contents);
+    }
+
+    void append(std::string_view contents) const
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::app);
+        ofs.write(
+            contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    ~temp_file()
+    {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    temp_file(temp_file const&)            = delete;
+    temp_file& operator=(temp_file const&) = delete;
+};
+
+std::string
+make_pattern(std::size_t n)
+{
+    std::string s(n, '\0');
+    for (std::size_t i = 0; i < n; ++i)
+        s[i] = static_cast<char>('a' + (i * 7 + i / 251) % 26);
+    return s;
+}
+
+// Read until end of file with an odd-sized buffer.
+capy::task<>
+read_all(read_ahead_file& f, std::string& out, std::error_code& last)
+{
+    char buf[1000];
+    for (;;)
+    {
+        auto [ec, n] =
+            co_await f.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+        out.append(buf, n);
+        if (ec)
+        {
+            last = ec;
+            co_return;
+        }
+    }
+}
+
+} // namespace
+
+template<auto Backend>
+struct read_ahead_file_test
+{
+    void testConstruction()
+    {
+        io_context ioc(Backend);
+        read_ahead_file f(ioc);
+        BOOST_TEST(!f.is_open());
+        BOOST_TEST_EQ(f.options().depth, 4u);
+
+        read_ahead_file g(
+            ioc.get_executor(), {.chunk_size = 8192, .depth = 2});
+        BOOST_TEST_EQ(g.options().chunk_size, 8192u);
+
+        BOOST_TEST_THROWS(
+            read_ahead_file(ioc, {.chunk_size = 0}), std::invalid_argument);
+        BOOST_TEST_THROWS(
+            read_ahead_file(ioc, {.depth = 0}), std::invalid_argument);
+    }
+
+    void testClosedThrows()
+    {
+        io_context ioc(Backend);
+        read_ahead_file f(ioc);
+        char buf[16];
+        BOOST_TEST_THROWS(
+            (void)f.read_some(capy::mutable_buffer(buf, sizeof(buf))),
+            std::logic_error);
+    }
+
+    void testSequentialRead()
+    {
+        auto const data = make_pattern(100 * 1024 + 123);
+        temp_file tmp("raf_ahead_seq_", data);
+        io_context ioc(Backend);
+        read_ahead_file f(ioc, {.chunk_size = 4096, .depth = 3});
+        f.open(tmp.path);
+
+        std::string got;
+        std::error_code last;
+        capy::run_async(ioc.get_executor())(read_all(f, got, last));
+        ioc.run();
+
+        BOOST_TEST(last == capy::cond::eof);
+        BOOST_TEST(got == data);
+        BOOST_TEST_EQ(f.position(), data.size());
+
+        auto st = f.stats();
+        BOOST_TEST(st.chunks >= data.size() / 4096);
+        BOOST_TEST(st.bytes_fetched >= data.size());
+    }
+
+    void testBufferSequence()
+    {
+        auto const data = make_pattern(10000);
+        temp_file tmp("raf_ahead_seqbuf_", data);
+        io_context ioc(Backend);
+        read_ahead_file f(ioc, {.chunk_size = 4096, .depth = 2});
+        f.open(tmp.path);
+
+        std::string got;
+        auto task = [&]() -> capy::task<> {
+            char a[3000];
+            char b[3000];
+            for (;;)
+            {
+                capy::mutable_buffer bufs[2] = {
+                    capy::mutable_buffer(a, sizeof(a)),
+                    capy::mutable_buffer(b, sizeof(b))};
+                auto [ec, n] = co_await f.read_some(bufs);
+                if (ec)
+                {
+                    BOOST_TEST(ec == capy::cond::eof);
+                    co_return;
+                }
+                got.append(a, (std::min)(n, sizeof(a)));
+                if (n > sizeof(a))
+                    got.append(b, n - sizeof(a));
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(got == data);
+    }
+
+    void testEmptyFile()
+    {
+        temp_file tmp("raf_ahead_empty_", "");
+        io_context ioc(Backend);
+        read_ahead_file f(ioc);
+        f.open(tmp.path);
+
+        std::string got;
+        std::error_code last;
+        capy::run_async(ioc.get_executor())(read_all(f, got, last));
+        ioc.run();
+
+        BOOST_TEST(last == capy::cond::eof);
+        BOOST_TEST(got.empty());
+    }
+
+    void testSeek()
+    {
+        auto const data = make_pattern(50000);
+        temp_file tmp("raf_ahead_seek_", data);
+        io_context ioc(Backend);
+        read_ahead_file f(ioc, {.chunk_size = 4096, .depth = 4});
+        f.open(tmp.path);
+
+        std::string head;
+        std::string tail;
+        std::error_code last;
+        auto task = [&]() -> capy::task<> {
+            char buf[100];
+            auto [ec, n] =
+                co_await f.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+            BOOST_TEST(!ec);
+            head.assign(buf, n);
+
+            // Jump backwards over data already prefetched
+            f.seek(30000);
+            BOOST_TEST_EQ(f.position(), 30000u);
+            co_await read_all(f, tail, last);
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(head == data.substr(0, head.size()));
+        BOOST_TEST(tail == data.substr(30000));
+        BOOST_TEST(last == capy::cond::eof);
+        BOOST_TEST(f.stats().bytes_discarded > 0);
+    }
+
+    void testCancelEmptiesWindow()
+    {
+        auto const data = make_pattern(50000);
+        temp_file tmp("raf_ahead_cancel_", data);
+        io_context ioc(Backend);
+        read_ahead_file f(ioc, {.chunk_size = 4096, .depth = 4});
+        f.open(tmp.path);
+
+        std::string head;
+        std::string tail;
+        std::error_code last;
+        auto task = [&]() -> capy::task<> {
+            char buf[100];
+            auto [ec, n] =
+                co_await f.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+            BOOST_TEST(!ec);
+            head.assign(buf, n);
+
+            // The rest of the filled head chunk is thrown away
+            auto const before = f.stats().bytes_discarded;
+            f.cancel();
+            BOOST_TEST(f.stats().bytes_discarded > before);
+            BOOST_TEST_EQ(f.position(), head.size());
+            co_await read_all(f, tail, last);
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(head == data.substr(0, head.size()));
+        BOOST_TEST(tail == data.substr(head.size()));
+        BOOST_TEST(last == capy::cond::eof);
+    }
+
+    void testMovedFrom()
+    {
+        temp_file tmp("raf_ahead_move_", "moved");
+        io_context ioc(Backend);
+        read_ahead_file f(ioc);
+        f.open(tmp.path);
+
+        read_ahead_file g(std::move(f));
+        BOOST_TEST(g.is_open());
+        BOOST_TEST(!f.is_open());
+        BOOST_TEST_EQ(f.position(), 0u);
+        BOOST_TEST_EQ(f.stats().chunks, 0u);
+        BOOST_TEST_THROWS(f.seek(0), std::logic_error);
+        f.cancel();
+        f.close();
+    }
+
+    void testReadAfterGrowth()
+    {
+        auto const first  = make_pattern(5000);
+        auto const second = std::string(3000, 'z');
+        temp_file tmp("raf_ahead_grow_", first);
+        io_context ioc(Backend);
+        read_ahead_file f(ioc, {.chunk_size = 4096, .depth = 2});
+        f.open(tmp.path);
+
+        std::string got;
+        std::error_code last1;
+        std::error_code last2;
+        auto task = [&]() -> capy::task<> {
+            co_await read_all(f, got, last1);
+
+            // A log tailer picks up appended data after end of file
+            tmp.append(second);
+            co_await read_all(f, got, last2);
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(last1 == capy::cond::eof);
+        BOOST_TEST(last2 == capy::cond::eof);
+        BOOST_TEST(got == first + second);
+    }
+
+    void testReopen()
+    {
+        temp_file tmp1("raf_ahead_re1_", "first file");
+        temp_file tmp2("raf_ahead_re2_", "second");
+        io_context ioc(Backend);
+        read_ahead_file f(ioc);
+
+        std::string got1;
+        std::string got2;
+        std::error_code last;
+        auto task = [&]() -> capy::task<> {
+            f.open(tmp1.path);
+            co_await read_all(f, got1, last);
+            f.open(tmp2.path);
+            BOOST_TEST_EQ(f.position(), 0u);
+            co_await read_all(f, got2, last);
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(got1 == "first file");
+        BOOST_TEST(got2 == "second");
+
+        f.close();
+        BOOST_TEST(!f.is_open());
+    }
+
+    void run()
+    {
+        testConstruction();
+        testClosedThrows();
+        testSequentialRead();
+        testBufferSequence();
+        testEmptyFile();
+        testSeek();
+        testCancelEmptiesWindow();
+        testMovedFrom();
+        testReadAfterGrowth();
+        testReopen();
+    }
+};
+
+COROSIO_BACKEND_TESTS(read_ahead_file_test, "boost.corosio.read_ahead_file")
+
+} // namespace boost::corosio
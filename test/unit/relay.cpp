@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/relay.hpp>
+
+#include <boost/corosio/local_connect_pair.hpp>
+#include <boost/corosio/local_stream_socket.hpp>
+#include <boost/corosio/socket_option.hpp>
+#include <boost/corosio/tcp_socket.hpp>
+#include <boost/corosio/timer.hpp>
+#include <boost/corosio/test/socket_pair.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <system_error>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+namespace boost::corosio {
+
+namespace {
+
+// Write all of s, then half-close.
+template<class Socket>
+capy::task<>
+send_all_and_shutdown(Socket& sock, std::string s)
+{
+    std::size_t off = 0;
+    while (off < s.size())
+    {
+        auto [ec, n] = co_await sock.write_some(
+            capy::const_buffer(s.data() + off, s.size() - off));
+        if (ec)
+            co_return;
+        off += n;
+    }
+    sock.shutdown(shutdown_send);
+}
+
+// Read until end-of-stream.
+template<class Socket>
+capy::task<>
+recv_to_eof(Socket& sock, std::string& out)
+{
+    char buf[4096];
+    for (;;)
+    {
+        auto [ec, n] =
+            co_await sock.read_some(capy::mutable_buffer(buf, sizeof(buf)));
+        if (ec)
+            co_return;
+        out.append(buf, n);
+    }
+}
+
+// Bytes that differ from their neighbours, so reordering shows.
+std::string
+make_payload(std::size_t n)
+{
+    std::string s(n, '\0');
+    for (std::size_t i = 0; i < n; ++i)
+        s[i] = static_cast<char>(i % 251);
+    return s;
+}
+
+} // namespace
+
+template<auto Backend>
+struct relay_test
+{
+    // client <-> (a | relay | b) <-> server
+    struct topology
+    {
+        local_stream_socket client, a, b, server;
+
+        explicit topology(io_context& ioc)
+            : client(ioc)
+            , a(ioc)
+            , b(ioc)
+            , server(ioc)
+        {
+            if (auto ec = connect_pair(client, a))
+                throw std::system_error(ec, "connect_pair");
+            if (auto ec = connect_pair(b, server))
+                throw std::system_error(ec, "connect_pair");
+        }
+    };
+
+    void testBidirectional()
+    {
+        io_context ioc(Backend);
+        topology t(ioc);
+        auto ex = ioc.get_executor();
+
+        std::string const request(200000, 'q');
+        std::string const response("pong");
+        std::string at_server, at_client;
+        std::error_code relay_ec;
+        std::size_t up = 0, down = 0;
+
+        capy::run_async(ex)(
+            [](topology& t, std::error_code& ec_out, std::size_t& up_out,
+               std::size_t& down_out) -> capy::task<> {
+                auto [ec, n1, n2] = co_await corosio::relay(t.a, t.b);
+                ec_out   = ec;
+                up_out   = n1;
+                down_out = n2;
+            }(t, relay_ec, up, down));
+
+        capy::run_async(ex)(send_all_and_shutdown(t.client, request));
+        capy::run_async(ex)(recv_to_eof(t.client, at_client));
+        capy::run_async(ex)(
+            [](local_stream_socket& s, std::string& in,
+               std::string const& reply) -> capy::task<> {
+                co_await recv_to_eof(s, in);
+                co_await send_all_and_shutdown(s, reply);
+            }(t.server, at_server, response));
+
+        ioc.run();
+
+        BOOST_TEST(!relay_ec);
+        BOOST_TEST_EQ(up, request.size());
+        BOOST_TEST_EQ(down, response.size());
+        BOOST_TEST(at_server == request);
+        BOOST_TEST_EQ(at_client, response);
+    }
+
+    void testHalfClose()
+    {
+        io_context ioc(Backend);
+        topology t(ioc);
+        auto ex = ioc.get_executor();
+
+        // The client half-closes at once; the server must still be
+        // able to answer through the relay afterwards.
+        std::string at_server, at_client;
+        std::size_t up = 0, down = 0;
+
+        capy::run_async(ex)(
+            [](topology& t, std::size_t& up_out,
+               std::size_t& down_out) -> capy::task<> {
+                auto [ec, n1, n2] = co_await corosio::relay(t.a, t.b);
+                BOOST_TEST(!ec);
+                up_out   = n1;
+                down_out = n2;
+            }(t, up, down));
+
+        t.client.shutdown(shutdown_send);
+        capy::run_async(ex)(recv_to_eof(t.client, at_client));
+        capy::run_async(ex)(
+            [](local_stream_socket& s, std::string& in) -> capy::task<> {
+                co_await recv_to_eof(s, in);
+                co_await send_all_and_shutdown(s, "late reply");
+            }(t.server, at_server));
+
+        ioc.run();
+
+        BOOST_TEST_EQ(up, 0u);
+        BOOST_TEST_EQ(down, 10u);
+        BOOST_TEST(at_server.empty());
+        BOOST_TEST_EQ(at_client, std::string("late reply"));
+    }
+
+    void testCancel()
+    {
+        io_context ioc(Backend);
+        topology t(ioc);
+        auto ex = ioc.get_executor();
+
+        std::error_code relay_ec;
+        bool done = false;
+
+        capy::run_async(ex)(
+            [](topology& t, std::error_code& ec_out,
+               bool& done_out) -> capy::task<> {
+                auto [ec, n1, n2] = co_await corosio::relay(t.a, t.b);
+                (void)n1;
+                (void)n2;
+                ec_out   = ec;
+                done_out = true;
+            }(t, relay_ec, done));
+
+        ioc.poll();
+        BOOST_TEST(!done);
+
+        t.a.cancel();
+        t.b.cancel();
+        ioc.run();
+
+        BOOST_TEST(done);
+        BOOST_TEST(relay_ec == capy::cond::canceled);
+    }
+
+    // A sink with a small send buffer and a slow reader keeps the
+    // relay backed up. It must wait for the sink to drain and still
+    // deliver every byte in order.
+    void testSlowSink()
+    {
+        io_context ioc(Backend);
+        topology t(ioc);
+        auto ex = ioc.get_executor();
+
+        t.b.set_option(socket_option::send_buffer_size(4096));
+        t.server.set_option(socket_option::receive_buffer_size(4096));
+
+        std::string const request = make_payload(256 * 1024);
+        std::string at_server;
+        bool done = false;
+
+        capy::run_async(ex)([](topology& t, bool& done_out) -> capy::task<> {
+            auto [ec, n1, n2] = co_await corosio::relay(t.a, t.b);
+            BOOST_TEST(!ec);
+            BOOST_TEST_EQ(n1, 256u * 1024u);
+            BOOST_TEST_EQ(n2, 0u);
+            done_out = true;
+        }(t, done));
+
+        capy::run_async(ex)(send_all_and_shutdown(t.client, request));
+        capy::run_async(ex)(
+            [](local_stream_socket& s, std::string& out) -> capy::task<> {
+                timer tm(s.context());
+                char buf[4096];
+                for (;;)
+                {
+                    tm.expires_after(std::chrono::milliseconds(2));
+                    (void)co_await tm.wait();
+                    auto [ec, n] = co_await s.read_some(
+                        capy::mutable_buffer(buf, sizeof(buf)));
+                    if (ec)
+                        break;
+                    out.append(buf, n);
+                }
+                s.shutdown(shutdown_send);
+            }(t.server, at_server));
+
+        ioc.run();
+
+        BOOST_TEST(done);
+        BOOST_TEST_EQ(at_server.size(), request.size());
+        BOOST_TEST(at_server == request);
+    }
+
+    // The same exchange across TCP connections, the usual proxy case
+    void testTcp()
+    {
+        io_context ioc(Backend);
+        auto ex = ioc.get_executor();
+        auto [client, a] = test::make_socket_pair(ioc);
+        auto [b, server] = test::make_socket_pair(ioc);
+
+        std::string const request = make_payload(300000);
+        std::string const response("pong");
+        std::string at_server, at_client;
+        std::error_code relay_ec;
+        std::size_t up = 0, down = 0;
+
+        capy::run_async(ex)(
+            [](tcp_socket& a, tcp_socket& b, std::error_code& ec_out,
+               std::size_t& up_out, std::size_t& down_out) -> capy::task<> {
+                auto [ec, n1, n2] = co_await corosio::relay(a, b);
+                ec_out   = ec;
+                up_out   = n1;
+                down_out = n2;
+            }(a, b, relay_ec, up, down));
+
+        capy::run_async(ex)(send_all_and_shutdown(client, request));
+        capy::run_async(ex)(recv_to_eof(client, at_client));
+        capy::run_async(ex)(
+            [](tcp_socket& s, std::string& in,
+               std::string const& reply) -> capy::task<> {
+                co_await recv_to_eof(s, in);
+                co_await send_all_and_shutdown(s, reply);
+            }(server, at_server, response));
+
+        ioc.run();
+
+        BOOST_TEST(!relay_ec);
+        BOOST_TEST_EQ(up, request.size());
+        BOOST_TEST_EQ(down, response.size());
+        BOOST_TEST(at_server == request);
+        BOOST_TEST_EQ(at_client, response);
+    }
+
+    void run()
+    {
+        testBidirectional();
+        testHalfClose();
+        testCancel();
+        testSlowSink();
+        testTcp();
+    }
+};
+
+COROSIO_BACKEND_TESTS(relay_test, "boost.corosio.relay")
+
+} // namespace boost::corosio
@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/resolve_many.hpp>
+
+// GCC emits false-positive "may be used uninitialized" warnings
+// for structured bindings with co_await expressions
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/capy/cond.hpp>
+#include <boost/capy/error.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace boost::corosio {
+
+template<auto Backend>
+struct resolve_many_test
+{
+    static constexpr auto numeric =
+        resolve_flags::numeric_host | resolve_flags::numeric_service;
+
+    void testAllDelivered()
+    {
+        io_context_options opts;
+        opts.resolver_pool_size = 4;
+        io_context ioc(Backend, opts);
+
+        std::vector<host_service> names;
+        for (int i = 1; i <= 50; ++i)
+            names.push_back(
+                {"127.0.0." + std::to_string(i), std::to_string(1000 + i),
+                 numeric});
+
+        std::vector<int> seen(names.size(), 0);
+        bool ports_ok = true;
+        std::error_code batch_ec;
+        auto task = [&]() -> capy::task<> {
+            resolve_many_options o;
+            o.max_in_flight = 8;
+            auto [ec] = co_await resolve_many(
+                names,
+                [&](std::size_t i, std::error_code e, resolver_results r) {
+                    ++seen[i];
+                    if (e || r.size() != 1 ||
+                        r.begin()->get_endpoint().port() !=
+                            static_cast<std::uint16_t>(1001 + i))
+                        ports_ok = false;
+                },
+                o);
+            batch_ec = ec;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!batch_ec);
+        BOOST_TEST(ports_ok);
+        for (auto n : seen)
+            BOOST_TEST_EQ(n, 1);
+    }
+
+    void testPerNameErrors()
+    {
+        io_context ioc(Backend);
+
+        std::vector<host_service> names = {
+            {"127.0.0.1", "80", numeric},
+            {"not-numeric", "80", resolve_flags::numeric_host},
+            {"::1", "443", numeric},
+        };
+
+        std::vector<std::error_code> ecs(names.size());
+        std::error_code batch_ec;
+        auto task = [&]() -> capy::task<> {
+            auto [ec] = co_await resolve_many(
+                names, [&](std::size_t i, std::error_code e, resolver_results) {
+                    ecs[i] = e;
+                });
+            batch_ec = ec;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!batch_ec);
+        BOOST_TEST(!ecs[0]);
+        BOOST_TEST(ecs[1]);
+        BOOST_TEST(!ecs[2]);
+    }
+
+    void testEmpty()
+    {
+        io_context ioc(Backend);
+
+        int calls = 0;
+        std::error_code batch_ec = capy::error::canceled;
+        auto task = [&]() -> capy::task<> {
+            auto [ec] = co_await resolve_many(
+                {}, [&](std::size_t, std::error_code, resolver_results) {
+                    ++calls;
+                });
+            batch_ec = ec;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(!batch_ec);
+        BOOST_TEST_EQ(calls, 0);
+    }
+
+    void testStopped()
+    {
+        io_context ioc(Backend);
+
+        std::vector<host_service> names(10, {"127.0.0.1", "80", numeric});
+        std::stop_source stop;
+        stop.request_stop();
+
+        int calls = 0;
+        std::error_code batch_ec;
+        auto task = [&]() -> capy::task<> {
+            auto [ec] = co_await resolve_many(
+                names, [&](std::size_t, std::error_code, resolver_results) {
+                    ++calls;
+                });
+            batch_ec = ec;
+        };
+        capy::run_async(ioc.get_executor(), stop.get_token())(task());
+        ioc.run();
+
+        BOOST_TEST(batch_ec == capy::cond::canceled);
+        BOOST_TEST_EQ(calls, 0);
+    }
+
+    // A throwing callback stops the batch and the exception
+    // reaches the awaiting coroutine instead of hanging it
+    void testThrowingHandler()
+    {
+        io_context ioc(Backend);
+
+        std::vector<host_service> names(20, {"127.0.0.1", "80", numeric});
+
+        int calls   = 0;
+        bool caught = false;
+        bool done   = false;
+        auto task   = [&]() -> capy::task<> {
+            resolve_many_options o;
+            o.max_in_flight = 4;
+            try
+            {
+                (void)co_await resolve_many(
+                    names,
+                    [&](std::size_t, std::error_code, resolver_results) {
+                        if (++calls == 2)
+                            throw std::runtime_error("stop");
+                    },
+                    o);
+            }
+            catch (std::runtime_error const&)
+            {
+                caught = true;
+            }
+            done = true;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(done);
+        BOOST_TEST(caught);
+        BOOST_TEST(calls >= 2);
+        BOOST_TEST(calls < static_cast<int>(names.size()));
+    }
+
+    void testInvalidOptions()
+    {
+        resolve_many_options o;
+        o.max_in_flight = 0;
+        BOOST_TEST_THROWS(
+            (void)resolve_many(
+                {}, [](std::size_t, std::error_code, resolver_results) {}, o),
+            std::invalid_argument);
+    }
+
+    void run()
+    {
+        testAllDelivered();
+        testPerNameErrors();
+        testEmpty();
+        testStopped();
+        testThrowingHandler();
+        testInvalidOptions();
+    }
+};
+
+COROSIO_BACKEND_TESTS(resolve_many_test, "boost.corosio.resolve_many")
+
+} // namespace boost::corosio
@@ -18,11 +18,18 @@
 
 #include <boost/corosio/io_context.hpp>
 #include <boost/corosio/timer.hpp>
+#include <boost/corosio/detail/thread_pool.hpp>
 #include <boost/capy/cond.hpp>
 #include <boost/capy/ex/run_async.hpp>
 #include <boost/capy/task.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
 #include <stop_token>
+#include <thread>
+#include <vector>
 
 #include "test_suite.hpp"
 
@@ -603,6 +610,209 @@ struct resolver_test
         BOOST_TEST_EQ(resolve_count, 3);
     }
 
+#if BOOST_COROSIO_POSIX
+    // Resolution cache
+
+    static std::uint64_t lookups(io_context& ioc)
+    {
+        return ioc.pool_stats(thread_pool_lane::resolver).completed;
+    }
+
+    void testCacheHits()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms = 60000;
+        io_context ioc(opts);
+        resolver r(ioc);
+
+        int ok = 0;
+        auto task = [&]() -> capy::task<> {
+            for (int i = 0; i < 5; ++i)
+            {
+                auto [ec, res] = co_await r.resolve(
+                    "127.0.0.1", "8080",
+                    resolve_flags::numeric_host |
+                        resolve_flags::numeric_service);
+                if (!ec && res.size() == 1 &&
+                    res.begin()->get_endpoint().port() == 8080)
+                    ++ok;
+            }
+            // Different flags are a different key
+            auto [ec, res] = co_await r.resolve(
+                "127.0.0.1", "8080", resolve_flags::numeric_host);
+            if (!ec && !res.empty())
+                ++ok;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST_EQ(ok, 6);
+        BOOST_TEST_EQ(lookups(ioc), 2u);
+    }
+
+    void testCacheNegative()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms          = 60000;
+        opts.resolver_cache_negative_ttl_ms = 60000;
+        io_context ioc(opts);
+        resolver r(ioc);
+
+        std::error_code ec1, ec2;
+        auto task = [&]() -> capy::task<> {
+            auto [e1, r1] = co_await r.resolve(
+                "localhost", "80", resolve_flags::numeric_host);
+            ec1           = e1;
+            auto [e2, r2] = co_await r.resolve(
+                "localhost", "80", resolve_flags::numeric_host);
+            ec2           = e2;
+            (void)r1;
+            (void)r2;
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(ec1);
+        BOOST_TEST(ec2 == ec1);
+        BOOST_TEST_EQ(lookups(ioc), 1u);
+    }
+
+    void testCacheExpiry()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms = 1;
+        io_context ioc(opts);
+        resolver r(ioc);
+
+        auto task = [&]() -> capy::task<> {
+            auto [e1, r1] = co_await r.resolve(
+                "127.0.0.1", "80",
+                resolve_flags::numeric_host | resolve_flags::numeric_service);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            auto [e2, r2] = co_await r.resolve(
+                "127.0.0.1", "80",
+                resolve_flags::numeric_host | resolve_flags::numeric_service);
+            BOOST_TEST(!e1);
+            BOOST_TEST(!e2);
+            BOOST_TEST(r1.size() == r2.size());
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST_EQ(lookups(ioc), 2u);
+    }
+
+    void testCacheCoalescing()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms = 60000;
+        io_context ioc(opts);
+
+        constexpr int n = 16;
+        std::vector<resolver> resolvers;
+        for (int i = 0; i < n; ++i)
+            resolvers.emplace_back(ioc);
+
+        int ok    = 0;
+        auto task = [&](resolver& r) -> capy::task<> {
+            auto [ec, res] = co_await r.resolve(
+                "::1", "443",
+                resolve_flags::numeric_host | resolve_flags::numeric_service);
+            if (!ec && res.size() == 1 &&
+                res.begin()->get_endpoint().port() == 443)
+                ++ok;
+        };
+        for (auto& r : resolvers)
+            capy::run_async(ioc.get_executor())(task(r));
+        ioc.run();
+
+        // Every request is answered, by one lookup when the
+        // requests all arrive before it completes
+        BOOST_TEST_EQ(ok, n);
+        BOOST_TEST(lookups(ioc) >= 1u);
+        BOOST_TEST(lookups(ioc) <= static_cast<std::uint64_t>(n));
+    }
+
+    // Occupies the resolver lane until released
+    struct lane_blocker : detail::pool_work_item
+    {
+        std::atomic<bool> release{false};
+
+        static void execute(detail::pool_work_item* w) noexcept
+        {
+            auto* self = static_cast<lane_blocker*>(w);
+            while (!self->release.load(std::memory_order_acquire))
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    void testCachePoolShutDown()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms = 60000;
+        io_context ioc(opts);
+        auto& pool = ioc.use_service<detail::thread_pool>();
+
+        lane_blocker blocker;
+        blocker.func_ = &lane_blocker::execute;
+        BOOST_TEST(pool.post(&blocker, thread_pool_lane::resolver));
+
+        std::error_code ec1, ec2, ec3, ec4;
+        bool done1 = false, done2 = false, done3 = false, done4 = false;
+        auto task = [](resolver& r, char const* host, std::error_code& ec_out,
+                       bool& done) -> capy::task<> {
+            auto [ec, res] = co_await r.resolve(
+                host, "443",
+                resolve_flags::numeric_host | resolve_flags::numeric_service);
+            ec_out = ec;
+            done   = true;
+        };
+
+        // The leader queues behind the blocker and the second request
+        // parks on its pending entry
+        resolver r1(ioc), r2(ioc);
+        capy::run_async(ioc.get_executor())(task(r1, "::1", ec1, done1));
+        capy::run_async(ioc.get_executor())(task(r2, "::1", ec2, done2));
+        ioc.poll();
+        BOOST_TEST(!done1);
+        BOOST_TEST(!done2);
+
+        // Shutting down drains the lane, so the leader's lookup still
+        // runs and answers the parked request
+        std::thread stopper([&] { pool.shutdown(); });
+        blocker.release.store(true, std::memory_order_release);
+        ioc.run();
+        stopper.join();
+        ioc.restart();
+
+        BOOST_TEST(done1);
+        BOOST_TEST(done2);
+        BOOST_TEST(!ec1);
+        BOOST_TEST(!ec2);
+        BOOST_TEST_EQ(lookups(ioc), 2u);
+
+        // A leader that cannot post its lookup must not leave a
+        // pending entry stranding later requests on the key
+        resolver r3(ioc), r4(ioc);
+        capy::run_async(ioc.get_executor())(task(r3, "::2", ec3, done3));
+        capy::run_async(ioc.get_executor())(task(r4, "::2", ec4, done4));
+        ioc.run();
+
+        BOOST_TEST(done3);
+        BOOST_TEST(done4);
+        BOOST_TEST(ec3 == capy::cond::canceled);
+        BOOST_TEST(ec4 == capy::cond::canceled);
+    }
+
+    void testCacheInvalidOptions()
+    {
+        io_context_options opts;
+        opts.resolver_cache_ttl_ms      = 1000;
+        opts.resolver_cache_max_entries = 0;
+        BOOST_TEST_THROWS(io_context{opts}, std::invalid_argument);
+    }
+#endif
+
     // io_result tests
 
     void testIoResultSuccess()
@@ -1092,6 +1302,16 @@ struct resolver_test
         // Sequential resolves
         testSequentialResolves();
 
+#if BOOST_COROSIO_POSIX
+        // Resolution cache
+        testCacheHits();
+        testCacheNegative();
+        testCacheExpiry();
+        testCacheCoalescing();
+        testCachePoolShutDown();
+        testCacheInvalidOptions();
+#endif
+
         // io_result
         testIoResultSuccess();
         testIoResultError();
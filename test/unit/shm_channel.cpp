@@ -0,0 +1,352 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/shm_channel.hpp>
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/local_connect_pair.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+namespace boost::corosio {
+namespace {
+
+template<auto Backend>
+struct shm_channel_test
+{
+    void testClosedThrows()
+    {
+        io_context ioc(Backend);
+        shm_channel ch(ioc);
+        BOOST_TEST(!ch.is_open());
+        BOOST_TEST_EQ(ch.capacity(), 0u);
+
+        bool caught = false;
+        auto task = [](shm_channel& ch, bool& caught) -> capy::task<> {
+            char buf[4];
+            try
+            {
+                (void)co_await ch.send(capy::const_buffer(buf, 4));
+            }
+            catch (std::logic_error const&)
+            {
+                caught = true;
+            }
+        };
+        capy::run_async(ioc.get_executor())(task(ch, caught));
+        ioc.run();
+        BOOST_TEST(caught);
+    }
+
+#if defined(__linux__)
+    // Sets up both ends, then streams `total` bytes through rings of
+    // `capacity` bytes so both sides repeatedly park and wake.
+    void runTransfer(std::size_t capacity, std::size_t total)
+    {
+        io_context ioc(Backend);
+        local_stream_socket a(ioc), b(ioc);
+        if (auto ec = connect_pair(a, b))
+            throw std::system_error(ec, "connect_pair");
+
+        shm_channel tx(ioc), rx(ioc);
+        std::error_code create_ec, accept_ec;
+
+        auto create = [](shm_channel& ch, local_stream_socket s,
+                         std::size_t cap,
+                         std::error_code& out) -> capy::task<> {
+            auto [ec] = co_await ch.create(std::move(s), cap);
+            out       = ec;
+        };
+        auto accept = [](shm_channel& ch, local_stream_socket s,
+                         std::error_code& out) -> capy::task<> {
+            auto [ec] = co_await ch.accept(std::move(s));
+            out       = ec;
+        };
+        capy::run_async(ioc.get_executor())(
+            create(tx, std::move(a), capacity, create_ec));
+        capy::run_async(ioc.get_executor())(
+            accept(rx, std::move(b), accept_ec));
+        ioc.run();
+        ioc.restart();
+
+        BOOST_TEST_EQ(create_ec, std::error_code{});
+        BOOST_TEST_EQ(accept_ec, std::error_code{});
+        if (create_ec || accept_ec)
+            return;
+        BOOST_TEST(tx.is_open());
+        BOOST_TEST(rx.is_open());
+        BOOST_TEST_EQ(tx.capacity(), rx.capacity());
+        BOOST_TEST(tx.capacity() >= capacity);
+
+        std::vector<char> out(total);
+        for (std::size_t i = 0; i < total; ++i)
+            out[i] = static_cast<char>('a' + i % 26);
+        std::vector<char> in;
+
+        auto producer = [](shm_channel& ch,
+                           std::vector<char> const& data) -> capy::task<> {
+            std::size_t sent = 0;
+            while (sent < data.size())
+            {
+                auto [ec, n] = co_await ch.send(
+                    capy::const_buffer(data.data() + sent, data.size() - sent));
+                BOOST_TEST_EQ(ec, std::error_code{});
+                if (ec)
+                    co_return;
+                sent += n;
+            }
+            ch.close();
+        };
+        auto consumer = [](shm_channel& ch,
+                           std::vector<char>& data) -> capy::task<> {
+            char buf[37];
+            for (;;)
+            {
+                auto [ec, n] = co_await ch.recv(
+                    capy::mutable_buffer(buf, sizeof(buf)));
+                if (ec)
+                    co_return;
+                data.insert(data.end(), buf, buf + n);
+            }
+        };
+        capy::run_async(ioc.get_executor())(consumer(rx, in));
+        capy::run_async(ioc.get_executor())(producer(tx, out));
+        ioc.run();
+
+        BOOST_TEST_EQ(in.size(), total);
+        BOOST_TEST(in == out);
+    }
+
+    void testTransfer()
+    {
+        runTransfer(4096, 1000);
+    }
+
+    void testTransferWraps()
+    {
+        // A 64-byte ring forces wraparound and parking on both sides
+        runTransfer(64, 10000);
+    }
+
+    void testAcceptRejectsPlainData()
+    {
+        io_context ioc(Backend);
+        local_stream_socket a(ioc), b(ioc);
+        if (auto ec = connect_pair(a, b))
+            throw std::system_error(ec, "connect_pair");
+
+        shm_channel rx(ioc);
+        std::error_code accept_ec;
+
+        auto send = [](local_stream_socket& s) -> capy::task<> {
+            (void)co_await s.write_some(capy::const_buffer("S", 1));
+        };
+        auto accept = [](shm_channel& ch, local_stream_socket s,
+                         std::error_code& out) -> capy::task<> {
+            auto [ec] = co_await ch.accept(std::move(s));
+            out       = ec;
+        };
+        capy::run_async(ioc.get_executor())(send(a));
+        capy::run_async(ioc.get_executor())(
+            accept(rx, std::move(b), accept_ec));
+        ioc.run();
+
+        BOOST_TEST(accept_ec == std::errc::protocol_error);
+        BOOST_TEST(!rx.is_open());
+    }
+
+    // A peer that writes out-of-range ring indices must not make
+    // send or recv touch memory outside the ring
+    void testRejectsCorruptIndices()
+    {
+        // Mirror of the shared layout, filled in by a hostile creator
+        struct alignas(64) fake_layout
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t capacity;
+        };
+        struct fake_ring
+        {
+            alignas(64) std::uint64_t head;
+            alignas(64) std::uint32_t reader_waiting;
+            alignas(64) std::uint64_t tail;
+            alignas(64) std::uint32_t writer_waiting;
+        };
+        constexpr std::size_t cap  = 64;
+        constexpr std::size_t size =
+            sizeof(fake_layout) + 2 * sizeof(fake_ring) + 2 * cap;
+
+        io_context ioc(Backend);
+        local_stream_socket a(ioc), b(ioc);
+        if (auto ec = connect_pair(a, b))
+            throw std::system_error(ec, "connect_pair");
+
+        int mfd = ::memfd_create(
+            "corosio-shm-test", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        BOOST_TEST(mfd >= 0);
+        BOOST_TEST_EQ(::ftruncate(mfd, size), 0);
+        BOOST_TEST_EQ(
+            ::fcntl(
+                mfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL),
+            0);
+        void* map =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mfd, 0);
+        BOOST_TEST(map != MAP_FAILED);
+        if (mfd < 0 || map == MAP_FAILED)
+            return;
+        auto* base = static_cast<unsigned char*>(map);
+        new (base) fake_layout{0x434f5348, 1, cap};
+        auto* rings = new (base + sizeof(fake_layout)) fake_ring[2]{};
+        // Ring 0 is the acceptor's inbound ring, ring 1 its outbound
+        rings[0].head = 1 << 20;
+        rings[1].tail = 1 << 20;
+
+        int pair[2];
+        BOOST_TEST_EQ(
+            ::socketpair(
+                AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, pair),
+            0);
+
+        shm_channel rx(ioc);
+        std::error_code accept_ec, recv_ec, send_ec;
+        auto peer = [](local_stream_socket& s, int mfd,
+                       int bell) -> capy::task<> {
+            native_handle_type fds[] = {mfd, bell};
+            (void)co_await s.send_with_fds(capy::const_buffer("S", 1), fds);
+        };
+        auto use = [](shm_channel& ch, local_stream_socket s,
+                      std::error_code& a_ec, std::error_code& r_ec,
+                      std::error_code& s_ec) -> capy::task<> {
+            auto [ec] = co_await ch.accept(std::move(s));
+            a_ec      = ec;
+            if (ec)
+                co_return;
+            char buf[256];
+            auto [rec, rn] =
+                co_await ch.recv(capy::mutable_buffer(buf, sizeof(buf)));
+            r_ec = rec;
+            BOOST_TEST_EQ(rn, 0u);
+            auto [sec, sn] =
+                co_await ch.send(capy::const_buffer(buf, sizeof(buf)));
+            s_ec = sec;
+            BOOST_TEST_EQ(sn, 0u);
+        };
+        capy::run_async(ioc.get_executor())(peer(a, mfd, pair[1]));
+        capy::run_async(ioc.get_executor())(
+            use(rx, std::move(b), accept_ec, recv_ec, send_ec));
+        ioc.run();
+
+        BOOST_TEST_EQ(accept_ec, std::error_code{});
+        BOOST_TEST(recv_ec == std::errc::protocol_error);
+        BOOST_TEST(send_ec == std::errc::protocol_error);
+
+        rx.close();
+        ::munmap(map, size);
+        ::close(mfd);
+        ::close(pair[0]);
+        ::close(pair[1]);
+    }
+
+    // Without seals the peer could shrink the mapping and fault us
+    void testAcceptRejectsUnsealed()
+    {
+        struct alignas(64) fake_layout
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t capacity;
+        };
+        constexpr std::size_t cap  = 64;
+        // Each ring is four cache lines; only the seals are wrong
+        constexpr std::size_t size = sizeof(fake_layout) + 2 * 256 + 2 * cap;
+
+        io_context ioc(Backend);
+        local_stream_socket a(ioc), b(ioc);
+        if (auto ec = connect_pair(a, b))
+            throw std::system_error(ec, "connect_pair");
+
+        int mfd = ::memfd_create("corosio-shm-test", MFD_CLOEXEC);
+        BOOST_TEST(mfd >= 0);
+        BOOST_TEST_EQ(::ftruncate(mfd, size), 0);
+        fake_layout hdr{0x434f5348, 1, cap};
+        BOOST_TEST_EQ(
+            ::pwrite(mfd, &hdr, sizeof(hdr), 0),
+            static_cast<ssize_t>(sizeof(hdr)));
+
+        int pair[2];
+        BOOST_TEST_EQ(
+            ::socketpair(
+                AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, pair),
+            0);
+
+        shm_channel rx(ioc);
+        std::error_code accept_ec;
+        auto peer = [](local_stream_socket& s, int mfd,
+                       int bell) -> capy::task<> {
+            native_handle_type fds[] = {mfd, bell};
+            (void)co_await s.send_with_fds(capy::const_buffer("S", 1), fds);
+        };
+        auto accept = [](shm_channel& ch, local_stream_socket s,
+                         std::error_code& out) -> capy::task<> {
+            auto [ec] = co_await ch.accept(std::move(s));
+            out       = ec;
+        };
+        capy::run_async(ioc.get_executor())(peer(a, mfd, pair[1]));
+        capy::run_async(ioc.get_executor())(
+            accept(rx, std::move(b), accept_ec));
+        ioc.run();
+
+        BOOST_TEST(accept_ec == std::errc::protocol_error);
+        BOOST_TEST(!rx.is_open());
+
+        ::close(mfd);
+        ::close(pair[0]);
+        ::close(pair[1]);
+    }
+#endif
+
+    void run()
+    {
+        testClosedThrows();
+#if defined(__linux__)
+        testTransfer();
+        testTransferWraps();
+        testAcceptRejectsPlainData();
+        testRejectsCorruptIndices();
+        testAcceptRejectsUnsealed();
+#endif
+    }
+};
+
+COROSIO_BACKEND_TESTS(shm_channel_test, "boost.corosio.shm_channel")
+
+} // namespace
+} // namespace boost::corosio
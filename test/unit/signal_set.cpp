@@ -19,6 +19,12 @@
 
 #include <csignal>
 #include <chrono>
+#include <initializer_list>
+#include <type_traits>
+
+#if BOOST_COROSIO_HAS_EPOLL
+#include <signal.h>
+#endif
 
 #include "context.hpp"
 #include "test_suite.hpp"
@@ -788,7 +794,173 @@ struct signal_set_test
         BOOST_TEST_EQ(received_signal, SIGINT);
     }
 
-#else // !BOOST_COROSIO_POSIX
+#endif // BOOST_COROSIO_POSIX
+
+#if BOOST_COROSIO_HAS_EPOLL
+    // signalfd delivery tests (Linux only)
+
+    // io_context_options::signal_fd applies to epoll and io_uring
+    static constexpr bool uses_signal_fd =
+#if BOOST_COROSIO_HAS_IO_URING
+        std::is_same_v<std::remove_const_t<decltype(Backend)>, io_uring_t> ||
+#endif
+        std::is_same_v<std::remove_const_t<decltype(Backend)>, epoll_t>;
+
+    // Blocks signals in this thread so they queue on the signalfd,
+    // consuming any still pending before restoring the mask.
+    struct blocked_signals
+    {
+        sigset_t set;
+        sigset_t old;
+
+        blocked_signals(std::initializer_list<int> signals)
+        {
+            sigemptyset(&set);
+            for (int sig : signals)
+                sigaddset(&set, sig);
+            ::pthread_sigmask(SIG_BLOCK, &set, &old);
+        }
+
+        ~blocked_signals()
+        {
+            timespec zero{};
+            while (::sigtimedwait(&set, nullptr, &zero) > 0)
+            {
+            }
+            ::pthread_sigmask(SIG_SETMASK, &old, nullptr);
+        }
+    };
+
+    void testSignalFdWait()
+    {
+        if constexpr (!uses_signal_fd)
+            return;
+
+        io_context_options opts;
+        opts.signal_fd = true;
+        io_context ioc(Backend, opts);
+        signal_set s(ioc, SIGUSR1);
+        blocked_signals blocked{SIGUSR1};
+        timer t(ioc);
+
+        bool completed      = false;
+        int received_signal = 0;
+        std::error_code result_ec;
+
+        auto wait_task = [](signal_set& s_ref, std::error_code& ec_out,
+                            int& sig_out, bool& done_out) -> capy::task<> {
+            auto [ec, signum] = co_await s_ref.wait();
+            ec_out            = ec;
+            sig_out           = signum;
+            done_out          = true;
+        };
+        capy::run_async(ioc.get_executor())(
+            wait_task(s, result_ec, received_signal, completed));
+
+        // The signal is blocked, so only the signalfd can report it
+        t.expires_after(std::chrono::milliseconds(10));
+        auto raise_task = [](timer& t_ref) -> capy::task<> {
+            (void)co_await t_ref.wait();
+            std::raise(SIGUSR1);
+        };
+        capy::run_async(ioc.get_executor())(raise_task(t));
+
+        ioc.run();
+        BOOST_TEST(completed);
+        BOOST_TEST(!result_ec);
+        BOOST_TEST_EQ(received_signal, SIGUSR1);
+    }
+
+    void testSignalFdBatch()
+    {
+        if constexpr (!uses_signal_fd)
+            return;
+
+        io_context_options opts;
+        opts.signal_fd = true;
+        io_context ioc(Backend, opts);
+        signal_set s(ioc, SIGUSR1, SIGUSR2);
+        blocked_signals blocked{SIGUSR1, SIGUSR2};
+        timer t(ioc);
+
+        // Pending standard signals coalesce: one read returns one
+        // SIGUSR1 and one SIGUSR2.
+        std::raise(SIGUSR1);
+        std::raise(SIGUSR1);
+        std::raise(SIGUSR2);
+
+        int usr1 = 0;
+        int usr2 = 0;
+        std::error_code last_ec;
+
+        auto wait_task = [](signal_set& s_ref, int& usr1_out, int& usr2_out,
+                            std::error_code& ec_out) -> capy::task<> {
+            for (;;)
+            {
+                auto [ec, signum] = co_await s_ref.wait();
+                if (ec)
+                {
+                    ec_out = ec;
+                    co_return;
+                }
+                if (signum == SIGUSR1)
+                    ++usr1_out;
+                if (signum == SIGUSR2)
+                    ++usr2_out;
+            }
+        };
+        capy::run_async(ioc.get_executor())(
+            wait_task(s, usr1, usr2, last_ec));
+
+        // Nothing else is queued; end the waits after a while
+        t.expires_after(std::chrono::milliseconds(50));
+        auto cancel_task = [](timer& t_ref, signal_set& s_ref) -> capy::task<> {
+            (void)co_await t_ref.wait();
+            s_ref.cancel();
+        };
+        capy::run_async(ioc.get_executor())(cancel_task(t, s));
+
+        ioc.run();
+        BOOST_TEST_EQ(usr1, 1);
+        BOOST_TEST_EQ(usr2, 1);
+        BOOST_TEST(last_ec == capy::cond::canceled);
+    }
+
+    void testSignalFdOtherContext()
+    {
+        if constexpr (!uses_signal_fd)
+            return;
+
+        // A signal read from one context's signalfd still reaches
+        // signal_sets on a context without one.
+        io_context_options opts;
+        opts.signal_fd = true;
+        io_context reader(Backend, opts);
+        io_context other(Backend);
+        signal_set rs(reader, SIGUSR1);
+        signal_set os(other, SIGUSR1);
+        blocked_signals blocked{SIGUSR1};
+
+        std::raise(SIGUSR1);
+
+        int reader_signal = 0;
+        int other_signal  = 0;
+        auto wait_task = [](signal_set& s_ref, int& sig_out) -> capy::task<> {
+            auto [ec, signum] = co_await s_ref.wait();
+            (void)ec;
+            sig_out = signum;
+        };
+        capy::run_async(reader.get_executor())(wait_task(rs, reader_signal));
+        capy::run_async(other.get_executor())(wait_task(os, other_signal));
+
+        reader.run();
+        other.run();
+        BOOST_TEST_EQ(reader_signal, SIGUSR1);
+        BOOST_TEST_EQ(other_signal, SIGUSR1);
+    }
+#endif // BOOST_COROSIO_HAS_EPOLL
+
+#if !BOOST_COROSIO_POSIX
     // Signal flags tests (Windows only)
 
     void testFlagsNotSupportedOnWindows()
@@ -802,7 +974,7 @@ struct signal_set_test
         BOOST_TEST(result == std::errc::operation_not_supported);
     }
 
-#endif // BOOST_COROSIO_POSIX
+#endif // !BOOST_COROSIO_POSIX
 
     void run()
     {
@@ -876,6 +1048,13 @@ struct signal_set_test
         // Signal flags tests (Windows only)
         testFlagsNotSupportedOnWindows();
 #endif
+
+#if BOOST_COROSIO_HAS_EPOLL
+        // signalfd delivery tests (Linux only)
+        testSignalFdWait();
+        testSignalFdBatch();
+        testSignalFdOtherContext();
+#endif
     }
 };
 
@@ -351,6 +351,41 @@ struct stream_file_test
         BOOST_TEST(got_eof);
     }
 
+    void testHotFileReads()
+    {
+        // A freshly written file sits in the page cache. Enough reads
+        // to outrun the inline budget cover both completion paths.
+        std::string data;
+        for (int i = 0; i < 1024; ++i)
+            data += static_cast<char>('a' + i % 26);
+        temp_file tmp("sf_hot_", data);
+        io_context ioc(Backend);
+        stream_file f(ioc);
+        f.open(tmp.path, file_base::read_only);
+
+        std::string got;
+        std::error_code last;
+        auto task = [&]() -> capy::task<> {
+            char buf[8];
+            for (;;)
+            {
+                auto [ec, n] = co_await f.read_some(
+                    capy::mutable_buffer(buf, sizeof(buf)));
+                got.append(buf, n);
+                if (ec)
+                {
+                    last = ec;
+                    co_return;
+                }
+            }
+        };
+        capy::run_async(ioc.get_executor())(task());
+        ioc.run();
+
+        BOOST_TEST(last == capy::cond::eof);
+        BOOST_TEST(got == data);
+    }
+
     // Async write
 
     void testWriteSome()
@@ -826,6 +861,7 @@ struct stream_file_test
 
         testReadSome();
         testReadEOF();
+        testHotFileReads();
         testWriteSome();
         testSequentialReadWrite();
 
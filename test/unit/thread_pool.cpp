@@ -13,6 +13,7 @@
 #include <boost/corosio/io_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 
 #include "test_suite.hpp"
@@ -153,6 +154,184 @@ struct thread_pool_test
         BOOST_TEST(done.load() == static_cast<int>(num_threads));
     }
 
+    // Work that sleeps, to hold a lane's thread busy
+    struct sleep_work : detail::pool_work_item
+    {
+        std::atomic<int>* counter = nullptr;
+        std::chrono::milliseconds duration{0};
+
+        static void execute(detail::pool_work_item* p) noexcept
+        {
+            auto* self = static_cast<sleep_work*>(p);
+            std::this_thread::sleep_for(self->duration);
+            self->counter->fetch_add(1);
+        }
+    };
+
+    void testInvalidLaneConfig()
+    {
+        io_context ioc;
+        detail::thread_pool_lane_config bad;
+        bad.min_threads = 2;
+        bad.max_threads = 1;
+        BOOST_TEST_THROWS(
+            detail::thread_pool(ioc, bad, detail::thread_pool_lane_config{}),
+            std::logic_error);
+    }
+
+    void testLanesIndependent()
+    {
+        io_context ioc;
+        detail::thread_pool pool(ioc, 1);
+
+        // Block the resolver lane's only thread
+        std::atomic<int> dns_done{0};
+        sleep_work slow;
+        slow.counter  = &dns_done;
+        slow.duration = std::chrono::milliseconds(500);
+        slow.func_    = &sleep_work::execute;
+        BOOST_TEST(pool.post(&slow, thread_pool_lane::resolver));
+
+        // File work still runs while the lookup is stuck
+        std::atomic<int> counter{0};
+        test_work tw;
+        tw.counter = &counter;
+        tw.func_   = &test_work::execute;
+        BOOST_TEST(pool.post(&tw));
+
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(400);
+        while (counter.load() == 0 &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        BOOST_TEST(counter.load() == 1);
+        BOOST_TEST(dns_done.load() == 0);
+
+        pool.shutdown();
+        BOOST_TEST(dns_done.load() == 1);
+    }
+
+    void testElasticGrowthAndRetire()
+    {
+        io_context ioc;
+        detail::thread_pool_lane_config file;
+        file.min_threads  = 1;
+        file.max_threads  = 4;
+        file.grow_after   = std::chrono::microseconds(0);
+        file.idle_timeout = std::chrono::milliseconds(20);
+        detail::thread_pool pool(ioc, file, detail::thread_pool_lane_config{});
+
+        constexpr int n = 8;
+        std::atomic<int> counter{0};
+        sleep_work items[n];
+        for (auto& w : items)
+        {
+            w.counter  = &counter;
+            w.duration = std::chrono::milliseconds(20);
+            w.func_    = &sleep_work::execute;
+            BOOST_TEST(pool.post(&w));
+        }
+
+        while (counter.load() < n)
+            std::this_thread::yield();
+
+        auto s = pool.stats(thread_pool_lane::file);
+        BOOST_TEST(s.threads_started > 1);
+        BOOST_TEST(s.threads_started <= 4);
+        BOOST_TEST(s.peak_queue_depth >= 1);
+        BOOST_TEST(s.max_wait.count() > 0);
+
+        // Grown threads retire back to the minimum
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (pool.stats(thread_pool_lane::file).threads > 1 &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        s = pool.stats(thread_pool_lane::file);
+        BOOST_TEST(s.threads == 1);
+        BOOST_TEST(s.threads_retired == s.threads_started - 1);
+        BOOST_TEST(s.completed == static_cast<std::uint64_t>(n));
+
+        pool.shutdown();
+    }
+
+    // A burst queued behind a blocked thread grows the lane once
+    // grow_after passes, with no later post or dequeue to notice it
+    void testGrowthWithoutPosts()
+    {
+        io_context ioc;
+        detail::thread_pool_lane_config dns;
+        dns.min_threads = 1;
+        dns.max_threads = 2;
+        dns.grow_after  = std::chrono::milliseconds(100);
+        detail::thread_pool pool(ioc, detail::thread_pool_lane_config{}, dns);
+
+        std::atomic<int> slow_done{0};
+        sleep_work slow;
+        slow.counter  = &slow_done;
+        slow.duration = std::chrono::milliseconds(2000);
+        slow.func_    = &sleep_work::execute;
+        BOOST_TEST(pool.post(&slow, thread_pool_lane::resolver));
+
+        // Wait for the only thread to block in the slow item
+        for (;;)
+        {
+            auto s = pool.stats(thread_pool_lane::resolver);
+            if (s.threads == 1 && s.idle == 0 && s.queue_depth == 0)
+                break;
+            std::this_thread::yield();
+        }
+
+        constexpr int n = 4;
+        std::atomic<int> counter{0};
+        test_work burst[n];
+        for (auto& w : burst)
+        {
+            w.counter = &counter;
+            w.func_   = &test_work::execute;
+            BOOST_TEST(pool.post(&w, thread_pool_lane::resolver));
+        }
+
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(1500);
+        while (counter.load() < n &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        BOOST_TEST(counter.load() == n);
+        BOOST_TEST(slow_done.load() == 0);
+        BOOST_TEST(
+            pool.stats(thread_pool_lane::resolver).threads_started == 2);
+
+        pool.shutdown();
+        BOOST_TEST(slow_done.load() == 1);
+    }
+
+    void testContextStats()
+    {
+        io_context_options opts;
+        opts.thread_pool_size     = 2;
+        opts.thread_pool_max_size = 3;
+        io_context ioc(opts);
+
+        auto& pool = ioc.use_service<detail::thread_pool>();
+        std::atomic<int> counter{0};
+        test_work tw;
+        tw.counter = &counter;
+        tw.func_   = &test_work::execute;
+        BOOST_TEST(pool.post(&tw));
+        while (counter.load() == 0)
+            std::this_thread::yield();
+
+        auto s = ioc.pool_stats(thread_pool_lane::file);
+        BOOST_TEST(s.threads_started == 2);
+        BOOST_TEST(s.queue_depth == 0);
+
+        auto r = ioc.pool_stats(thread_pool_lane::resolver);
+        BOOST_TEST(r.threads_started == 0);
+    }
+
     void run()
     {
         testDrainOnShutdown();
@@ -160,6 +339,11 @@ struct thread_pool_test
         testPostAfterShutdown();
         testZeroThreads();
         testMultipleThreads();
+        testInvalidLaneConfig();
+        testLanesIndependent();
+        testElasticGrowthAndRetire();
+        testGrowthWithoutPosts();
+        testContextStats();
     }
 };
 
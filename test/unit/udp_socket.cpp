@@ -11,6 +11,8 @@
 #include <boost/corosio/udp_socket.hpp>
 
 #include <boost/corosio/udp.hpp>
+#include <boost/corosio/datagram_info.hpp>
+#include <boost/corosio/detail/platform.hpp>
 #include <boost/corosio/socket_option.hpp>
 #include <boost/corosio/timer.hpp>
 
@@ -22,7 +24,9 @@
 
 #include <chrono>
 #include <cstring>
+#include <span>
 #include <stop_token>
+#include <system_error>
 
 #include "context.hpp"
 #include "test_suite.hpp"
@@ -1199,6 +1203,507 @@ struct udp_socket_test
         sock.close();
     }
 
+    void testBatchClosedThrows()
+    {
+        io_context ioc(Backend);
+        udp_socket sock(ioc);
+
+        datagram_slot rslots[2];
+        bool caught = false;
+        try
+        {
+            (void)sock.recv_batch(rslots);
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+
+        const_datagram_slot sslots[2];
+        caught = false;
+        try
+        {
+            (void)sock.send_batch(sslots);
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+    }
+
+    void testSendRecvBatch()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+
+        auto ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto ec2 = sender.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec2, std::error_code{});
+        auto send_ep = sender.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r, endpoint dest,
+                       endpoint src) -> capy::task<> {
+            constexpr std::size_t count = 4;
+
+            char out[count][8];
+            const_datagram_slot sslots[count];
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::memset(out[i], static_cast<char>('a' + i), i + 1);
+                sslots[i].buffer = capy::const_buffer(out[i], i + 1);
+                sslots[i].peer   = dest;
+            }
+
+            // A short send is allowed; resubmit the tail.
+            std::size_t sent = 0;
+            while (sent < count)
+            {
+                auto [ec, n] = co_await s.send_batch(
+                    std::span(sslots).subspan(sent));
+                BOOST_TEST_EQ(ec, std::error_code{});
+                if (ec || n == 0)
+                    co_return;
+                for (std::size_t i = sent; i < sent + n; ++i)
+                    BOOST_TEST_EQ(sslots[i].size, i + 1);
+                sent += n;
+            }
+
+            char in[count][64];
+            datagram_slot rslots[count];
+            for (std::size_t i = 0; i < count; ++i)
+                rslots[i].buffer = capy::mutable_buffer(in[i], sizeof(in[i]));
+
+            std::size_t got = 0;
+            while (got < count)
+            {
+                auto [ec, n] = co_await r.recv_batch(
+                    std::span(rslots).subspan(got));
+                BOOST_TEST_EQ(ec, std::error_code{});
+                if (ec || n == 0)
+                    co_return;
+                got += n;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                BOOST_TEST_EQ(rslots[i].size, i + 1);
+                BOOST_TEST(rslots[i].peer == src);
+                BOOST_TEST_EQ(in[i][0], static_cast<char>('a' + i));
+            }
+        };
+
+        capy::run_async(ioc.get_executor())(
+            task(sender, receiver, recv_ep, send_ep));
+        ioc.run();
+    }
+
+#if defined(__linux__)
+    // Kernels without UDP_SEGMENT / UDP_GRO reject them; skip there.
+    static bool offload_unsupported(std::error_code ec) noexcept
+    {
+        return ec == std::errc::invalid_argument ||
+            ec == std::errc::operation_not_supported ||
+            ec == std::errc::no_protocol_option;
+    }
+
+    void testSegmentedSendBatch()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+
+        auto ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            constexpr std::size_t segment = 100;
+            constexpr std::size_t total   = 250;
+
+            char out[total];
+            for (std::size_t i = 0; i < total; ++i)
+                out[i] = static_cast<char>(i / segment);
+
+            const_datagram_slot sslot;
+            sslot.buffer       = capy::const_buffer(out, total);
+            sslot.peer         = dest;
+            sslot.segment_size = segment;
+
+            auto [sec, sn] = co_await s.send_batch(std::span(&sslot, 1));
+            if (offload_unsupported(sec))
+                co_return;
+            BOOST_TEST_EQ(sec, std::error_code{});
+            BOOST_TEST_EQ(sn, 1u);
+            BOOST_TEST_EQ(sslot.size, total);
+
+            // Without GRO the receiver sees three separate datagrams.
+            char in[3][256];
+            datagram_slot rslots[3];
+            for (std::size_t i = 0; i < 3; ++i)
+                rslots[i].buffer = capy::mutable_buffer(in[i], sizeof(in[i]));
+
+            std::size_t got = 0;
+            while (got < 3)
+            {
+                auto [ec, n] = co_await r.recv_batch(
+                    std::span(rslots).subspan(got));
+                BOOST_TEST_EQ(ec, std::error_code{});
+                if (ec || n == 0)
+                    co_return;
+                got += n;
+            }
+
+            BOOST_TEST_EQ(rslots[0].size, 100u);
+            BOOST_TEST_EQ(rslots[1].size, 100u);
+            BOOST_TEST_EQ(rslots[2].size, 50u);
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                BOOST_TEST_EQ(rslots[i].segment_size, 0u);
+                BOOST_TEST_EQ(in[i][0], static_cast<char>(i));
+            }
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, recv_ep));
+        ioc.run();
+    }
+
+    void testGroRecvBatch()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+
+        try
+        {
+            receiver.set_option(socket_option::udp_gro(true));
+        }
+        catch (std::system_error const& e)
+        {
+            if (offload_unsupported(e.code()))
+                return;
+            throw;
+        }
+
+        auto ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            constexpr std::size_t segment = 100;
+            constexpr std::size_t total   = 400;
+
+            char out[total] = {};
+            const_datagram_slot sslot;
+            sslot.buffer       = capy::const_buffer(out, total);
+            sslot.peer         = dest;
+            sslot.segment_size = segment;
+
+            auto [sec, sn] = co_await s.send_batch(std::span(&sslot, 1));
+            if (offload_unsupported(sec))
+                co_return;
+            BOOST_TEST_EQ(sec, std::error_code{});
+
+            // The kernel may or may not coalesce; either way every
+            // byte arrives and any reported segment size is ours.
+            static char in[4][65536];
+            datagram_slot rslots[4];
+            for (std::size_t i = 0; i < 4; ++i)
+                rslots[i].buffer = capy::mutable_buffer(in[i], sizeof(in[i]));
+
+            std::size_t bytes = 0;
+            while (bytes < total)
+            {
+                auto [ec, n] = co_await r.recv_batch(rslots);
+                BOOST_TEST_EQ(ec, std::error_code{});
+                if (ec || n == 0)
+                    co_return;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    bytes += rslots[i].size;
+                    if (rslots[i].segment_size != 0)
+                        BOOST_TEST_EQ(rslots[i].segment_size, segment);
+                    else
+                        BOOST_TEST_EQ(rslots[i].size, segment);
+                }
+            }
+            BOOST_TEST_EQ(bytes, total);
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, recv_ep));
+        ioc.run();
+    }
+#endif
+
+    void testCancelRecvBatch()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sock(ioc);
+        sock.open();
+        auto ec = sock.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+
+        auto task = [&]() -> capy::task<> {
+            timer t(ioc);
+            t.expires_after(std::chrono::milliseconds(50));
+
+            bool recv_done = false;
+            std::error_code recv_ec;
+            std::size_t recv_n = 99;
+
+            auto nested = [&]() -> capy::task<> {
+                char buf[2][64];
+                datagram_slot slots[2];
+                slots[0].buffer = capy::mutable_buffer(buf[0], sizeof(buf[0]));
+                slots[1].buffer = capy::mutable_buffer(buf[1], sizeof(buf[1]));
+                auto [ec, n] = co_await sock.recv_batch(slots);
+                recv_ec   = ec;
+                recv_n    = n;
+                recv_done = true;
+            };
+            capy::run_async(ioc.get_executor())(nested());
+
+            (void)co_await t.wait();
+            sock.cancel();
+
+            timer t2(ioc);
+            t2.expires_after(std::chrono::milliseconds(50));
+            (void)co_await t2.wait();
+
+            BOOST_TEST(recv_done);
+            BOOST_TEST(recv_ec == capy::cond::canceled);
+            BOOST_TEST_EQ(recv_n, 0u);
+        };
+        capy::run_async(ioc.get_executor())(task());
+
+        ioc.run();
+        sock.close();
+    }
+
+    void testMsgClosedThrows()
+    {
+        io_context ioc(Backend);
+        udp_socket sock(ioc);
+
+        char buf[16];
+        endpoint source;
+        datagram_info info;
+        bool caught = false;
+        try
+        {
+            (void)sock.recv_msg(
+                capy::mutable_buffer(buf, sizeof(buf)), source, info);
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+
+        caught = false;
+        try
+        {
+            (void)sock.send_msg(
+                capy::const_buffer(buf, sizeof(buf)),
+                endpoint(ipv4_address::loopback(), 9), info);
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+    }
+
+    void testRecvMsgNoOptions()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+
+        auto ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            auto [sec, sn] =
+                co_await s.send_to(capy::const_buffer("ping", 4), dest);
+            BOOST_TEST_EQ(sec, std::error_code{});
+
+            // Stale fields must be cleared when nothing is reported.
+            char buf[16];
+            endpoint source;
+            datagram_info info;
+            info.has_local_address = true;
+            info.has_timestamp     = true;
+            auto [rec, rn] = co_await r.recv_msg(
+                capy::mutable_buffer(buf, sizeof(buf)), source, info);
+            BOOST_TEST_EQ(rec, std::error_code{});
+            BOOST_TEST_EQ(rn, 4u);
+            BOOST_TEST_EQ(source.port(), s.local_endpoint().port());
+            BOOST_TEST(!info.has_local_address);
+            BOOST_TEST(!info.has_timestamp);
+            BOOST_TEST(!info.has_tos);
+            BOOST_TEST(!info.has_drops);
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, recv_ep));
+        ioc.run();
+    }
+
+#if BOOST_COROSIO_POSIX
+    void testRecvMsgPacketInfo()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+        receiver.set_option(socket_option::receive_packet_info_v4(true));
+        receiver.set_option(socket_option::receive_timestamp(true));
+
+        // Bind to the wildcard so only the control data names 127.0.0.1.
+        auto ec = receiver.bind(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        endpoint dest(ipv4_address::loopback(), receiver.local_endpoint().port());
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            auto [sec, sn] =
+                co_await s.send_to(capy::const_buffer("ping", 4), dest);
+            BOOST_TEST_EQ(sec, std::error_code{});
+
+            char buf[16];
+            endpoint source;
+            datagram_info info;
+            auto [rec, rn] = co_await r.recv_msg(
+                capy::mutable_buffer(buf, sizeof(buf)), source, info);
+            BOOST_TEST_EQ(rec, std::error_code{});
+            BOOST_TEST_EQ(rn, 4u);
+            BOOST_TEST(info.has_local_address);
+            BOOST_TEST(info.local_address.is_v4());
+            BOOST_TEST(
+                info.local_address.v4_address() == ipv4_address::loopback());
+            BOOST_TEST(info.has_timestamp);
+            BOOST_TEST(info.timestamp.count() > 0);
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, dest));
+        ioc.run();
+    }
+
+    void testSendMsgSourceAddress()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+        receiver.set_option(socket_option::receive_packet_info_v4(true));
+
+        auto ec = sender.bind(endpoint(ipv4_address::any(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            datagram_info out;
+            out.local_address     = endpoint(ipv4_address::loopback(), 0);
+            out.has_local_address = true;
+            auto [sec, sn] = co_await s.send_msg(
+                capy::const_buffer("pong", 4), dest, out);
+            BOOST_TEST_EQ(sec, std::error_code{});
+            BOOST_TEST_EQ(sn, 4u);
+
+            char buf[16];
+            endpoint source;
+            datagram_info in;
+            auto [rec, rn] = co_await r.recv_msg(
+                capy::mutable_buffer(buf, sizeof(buf)), source, in);
+            BOOST_TEST_EQ(rec, std::error_code{});
+            BOOST_TEST_EQ(rn, 4u);
+            BOOST_TEST(std::memcmp(buf, "pong", 4) == 0);
+            BOOST_TEST(source.v4_address() == ipv4_address::loopback());
+            BOOST_TEST(in.has_local_address);
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, recv_ep));
+        ioc.run();
+    }
+#endif
+
+#if defined(__linux__)
+    void testRecvMsgTos()
+    {
+        io_context ioc(Backend);
+
+        udp_socket sender(ioc);
+        udp_socket receiver(ioc);
+
+        sender.open();
+        receiver.open();
+        receiver.set_option(socket_option::receive_tos_v4(true));
+
+        auto ec = receiver.bind(endpoint(ipv4_address::loopback(), 0));
+        BOOST_TEST_EQ(ec, std::error_code{});
+        auto recv_ep = receiver.local_endpoint();
+
+        auto task = [](udp_socket& s, udp_socket& r,
+                       endpoint dest) -> capy::task<> {
+            // DSCP AF11 with ECT(0)
+            datagram_info out;
+            out.tos     = 0x2a;
+            out.has_tos = true;
+            auto [sec, sn] = co_await s.send_msg(
+                capy::const_buffer("ecn", 3), dest, out);
+            BOOST_TEST_EQ(sec, std::error_code{});
+
+            char buf[16];
+            endpoint source;
+            datagram_info in;
+            auto [rec, rn] = co_await r.recv_msg(
+                capy::mutable_buffer(buf, sizeof(buf)), source, in);
+            BOOST_TEST_EQ(rec, std::error_code{});
+            BOOST_TEST(in.has_tos);
+            BOOST_TEST_EQ(in.tos, 0x2a);
+            BOOST_TEST_EQ(in.ecn(), 0x02);
+        };
+
+        capy::run_async(ioc.get_executor())(task(sender, receiver, recv_ep));
+        ioc.run();
+    }
+#endif
+
     void testWrongProtocolNoDelayOnUdp()
     {
         // TCP_NODELAY is meaningful only on TCP; setting on UDP must error.
@@ -1265,6 +1770,22 @@ struct udp_socket_test
         testMulticastInterfaceV6();
         testBufferSizeBoundary();
         testWrongProtocolNoDelayOnUdp();
+        testBatchClosedThrows();
+        testSendRecvBatch();
+        testCancelRecvBatch();
+#if defined(__linux__)
+        testSegmentedSendBatch();
+        testGroRecvBatch();
+#endif
+        testMsgClosedThrows();
+        testRecvMsgNoOptions();
+#if BOOST_COROSIO_POSIX
+        testRecvMsgPacketInfo();
+        testSendMsgSourceAddress();
+#endif
+#if defined(__linux__)
+        testRecvMsgTos();
+#endif
     }
 };
 
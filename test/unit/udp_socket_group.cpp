@@ -0,0 +1,276 @@
+//
+// Copyright (c) 2026 Steve Gerbino
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/corosio
+//
+
+// Test that header file is self-contained.
+#include <boost/corosio/udp_socket_group.hpp>
+
+#include <boost/corosio/io_context.hpp>
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/capy/buffers.hpp>
+#include <boost/capy/ex/run_async.hpp>
+#include <boost/capy/task.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "context.hpp"
+#include "test_suite.hpp"
+
+namespace boost::corosio {
+namespace {
+
+template<auto Backend>
+struct udp_socket_group_test
+{
+    void testEmpty()
+    {
+        io_context ioc(Backend);
+        udp_socket_group group(ioc);
+
+        BOOST_TEST(group.empty());
+        BOOST_TEST_EQ(group.size(), 0u);
+        BOOST_TEST_EQ(group.local_endpoint().port(), 0);
+
+        bool caught = false;
+        try
+        {
+            (void)group.steer_by_cpu();
+        }
+        catch (std::logic_error const&)
+        {
+            caught = true;
+        }
+        BOOST_TEST(caught);
+
+        // No-ops on an empty group
+        group.cancel();
+        group.close();
+    }
+
+#if BOOST_COROSIO_POSIX
+    void testOpenSharesPort()
+    {
+        io_context ioc(Backend);
+        udp_socket_group group(ioc);
+
+        auto ec = group.open(endpoint(ipv4_address::loopback(), 0), 4);
+        BOOST_TEST_EQ(ec, std::error_code{});
+        BOOST_TEST_EQ(group.size(), 4u);
+
+        auto port = group.local_endpoint().port();
+        BOOST_TEST(port != 0);
+        for (auto& s : group.sockets())
+        {
+            BOOST_TEST(s.is_open());
+            BOOST_TEST_EQ(s.local_endpoint().port(), port);
+        }
+
+        // Reopening replaces the previous members
+        ec = group.open(endpoint(ipv4_address::loopback(), 0), 2);
+        BOOST_TEST_EQ(ec, std::error_code{});
+        BOOST_TEST_EQ(group.size(), 2u);
+
+        group.close();
+        BOOST_TEST(group.empty());
+    }
+
+    void testReceiveAcrossGroup()
+    {
+        constexpr std::size_t members = 4;
+        constexpr std::size_t senders = 32;
+
+        io_context ioc(Backend);
+        udp_socket_group group(ioc);
+
+        auto ec = group.open(endpoint(ipv4_address::loopback(), 0), members);
+        BOOST_TEST_EQ(ec, std::error_code{});
+        if (ec)
+            return;
+        auto dest = group.local_endpoint();
+
+        // Distinct source ports give the kernel distinct flows to hash
+        std::vector<udp_socket> out;
+        for (std::size_t i = 0; i < senders; ++i)
+        {
+            out.emplace_back(ioc);
+            out.back().open();
+        }
+
+        std::size_t received = 0;
+        std::size_t loops    = 0;
+        auto loop = [](udp_socket& sock, udp_socket_group* g,
+                       std::size_t* received,
+                       std::size_t* loops) -> capy::task<> {
+            char buf[64];
+            endpoint peer;
+            for (;;)
+            {
+                auto [rec, n] = co_await sock.recv_from(
+                    capy::mutable_buffer(buf, sizeof(buf)), peer);
+                if (rec)
+                    break;
+                BOOST_TEST_EQ(n, 4u);
+                if (++*received == senders)
+                    g->cancel();
+            }
+            ++*loops;
+        };
+        group.start(ioc.get_executor(), [&](udp_socket& sock, std::size_t) {
+            return loop(sock, &group, &received, &loops);
+        });
+
+        auto send = [](std::vector<udp_socket>& out,
+                       endpoint dest) -> capy::task<> {
+            for (auto& s : out)
+            {
+                auto [sec, n] =
+                    co_await s.send_to(capy::const_buffer("ping", 4), dest);
+                BOOST_TEST_EQ(sec, std::error_code{});
+            }
+        };
+        capy::run_async(ioc.get_executor())(send(out, dest));
+
+        ioc.run();
+        BOOST_TEST_EQ(received, senders);
+        BOOST_TEST_EQ(loops, members);
+    }
+
+    // The loops read their lambda's captures after start() returns
+    void testCapturingLambda()
+    {
+        constexpr std::size_t members = 2;
+        constexpr std::size_t senders = 8;
+
+        io_context ioc(Backend);
+        udp_socket_group group(ioc);
+
+        auto ec = group.open(endpoint(ipv4_address::loopback(), 0), members);
+        BOOST_TEST_EQ(ec, std::error_code{});
+        if (ec)
+            return;
+        auto dest = group.local_endpoint();
+
+        std::vector<udp_socket> out;
+        for (std::size_t i = 0; i < senders; ++i)
+        {
+            out.emplace_back(ioc);
+            out.back().open();
+        }
+
+        std::size_t received = 0;
+        std::size_t matched  = 0;
+        std::string expected = "ping";
+        group.start(
+            ioc.get_executor(),
+            [expected, received = &received, matched = &matched,
+             g = &group](udp_socket& sock, std::size_t) -> capy::task<> {
+                char buf[64];
+                endpoint peer;
+                for (;;)
+                {
+                    auto [rec, n] = co_await sock.recv_from(
+                        capy::mutable_buffer(buf, sizeof(buf)), peer);
+                    if (rec)
+                        co_return;
+                    if (std::string(buf, n) == expected)
+                        ++*matched;
+                    if (++*received == senders)
+                        g->cancel();
+                }
+            });
+
+        auto send = [](std::vector<udp_socket>& out,
+                       endpoint dest) -> capy::task<> {
+            for (auto& s : out)
+                (void)co_await s.send_to(capy::const_buffer("ping", 4), dest);
+        };
+        capy::run_async(ioc.get_executor())(send(out, dest));
+
+        ioc.run();
+        BOOST_TEST_EQ(received, senders);
+        BOOST_TEST_EQ(matched, senders);
+    }
+
+    // Loops may still use their socket after the group is gone
+    void testLoopsOutliveGroup()
+    {
+        io_context ioc(Backend);
+        std::size_t ended  = 0;
+        std::size_t closed = 0;
+        {
+            udp_socket_group group(ioc);
+            auto ec =
+                group.open(endpoint(ipv4_address::loopback(), 0), 2);
+            BOOST_TEST_EQ(ec, std::error_code{});
+            if (ec)
+                return;
+            group.start(
+                ioc.get_executor(),
+                [&](udp_socket& sock, std::size_t) -> capy::task<> {
+                    char buf[16];
+                    endpoint peer;
+                    auto [rec, n] = co_await sock.recv_from(
+                        capy::mutable_buffer(buf, sizeof(buf)), peer);
+                    (void)n;
+                    BOOST_TEST(rec);
+                    if (!sock.is_open())
+                        ++closed;
+                    ++ended;
+                });
+            ioc.poll();
+            BOOST_TEST_EQ(ended, 0u);
+        }
+
+        ioc.run();
+        BOOST_TEST_EQ(ended, 2u);
+        BOOST_TEST_EQ(closed, 2u);
+    }
+#endif
+
+#if defined(__linux__)
+    void testSteerByCpu()
+    {
+        io_context ioc(Backend);
+        udp_socket_group group(ioc);
+
+        auto ec = group.open(endpoint(ipv4_address::loopback(), 0), 2);
+        BOOST_TEST_EQ(ec, std::error_code{});
+        if (ec)
+            return;
+
+        // Older kernels lack SO_ATTACH_REUSEPORT_CBPF
+        ec = group.steer_by_cpu();
+        BOOST_TEST(
+            !ec || ec == std::errc::protocol_not_available ||
+            ec == std::errc::operation_not_supported);
+    }
+#endif
+
+    void run()
+    {
+        testEmpty();
+#if BOOST_COROSIO_POSIX
+        testOpenSharesPort();
+        testReceiveAcrossGroup();
+        testCapturingLambda();
+        testLoopsOutliveGroup();
+#endif
+#if defined(__linux__)
+        testSteerByCpu();
+#endif
+    }
+};
+
+COROSIO_BACKEND_TESTS(udp_socket_group_test, "boost.corosio.udp_socket_group")
+
+} // namespace
+} // namespace boost::corosio
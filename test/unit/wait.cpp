@@ -10,6 +10,8 @@
 // Test that header is self-contained.
 #include <boost/corosio/wait_type.hpp>
 
+#include <boost/corosio/detail/platform.hpp>
+#include <boost/corosio/local_connect_pair.hpp>
 #include <boost/corosio/local_endpoint.hpp>
 #include <boost/corosio/local_stream_acceptor.hpp>
 #include <boost/corosio/local_stream_socket.hpp>
@@ -29,6 +31,10 @@
 #include <boost/capy/ex/run_async.hpp>
 #include <boost/capy/task.hpp>
 
+#if BOOST_COROSIO_POSIX
+#include <sys/socket.h>
+#endif
+
 #include <array>
 #include <chrono>
 #include <string_view>
@@ -85,9 +91,8 @@ struct wait_test
         BOOST_TEST_EQ(bytes_read, payload.size());
     }
 
-    // wait_type::write completes immediately on a connected socket.
-    // Corosio matches asio's IOCP behavior: writability is always
-    // treated as ready, the wait does not park on a edge transition.
+    // wait_type::write completes immediately on a writable socket,
+    // matching asio's IOCP behavior.
     void testWaitWriteImmediate()
     {
         io_context ioc(Backend);
@@ -110,6 +115,54 @@ struct wait_test
         BOOST_TEST(!wait_ec);
     }
 
+#if BOOST_COROSIO_POSIX
+    // wait_type::write on a full socket parks until the peer reads.
+    void testWaitWriteParksWhenFull()
+    {
+        io_context ioc(Backend);
+        auto ex = ioc.get_executor();
+        local_stream_socket s1(ioc), s2(ioc);
+        if (auto ec = connect_pair(s1, s2))
+            throw std::system_error(ec, "connect_pair");
+        s1.set_option(socket_option::send_buffer_size(4096));
+
+        char fill[4096] = {};
+        while (::send(s1.native_handle(), fill, sizeof(fill),
+                      MSG_DONTWAIT | MSG_NOSIGNAL) > 0)
+        {
+        }
+
+        std::error_code wait_ec;
+        bool wait_done = false;
+        auto writer = [&]() -> capy::task<> {
+            auto [ec] = co_await s1.wait(wait_type::write);
+            wait_ec   = ec;
+            wait_done = true;
+            // Ends the reader
+            s1.shutdown(shutdown_send);
+        };
+        capy::run_async(ex)(writer());
+        ioc.poll();
+        BOOST_TEST(!wait_done);
+
+        auto reader = [&]() -> capy::task<> {
+            char buf[4096];
+            for (;;)
+            {
+                auto [ec, n] = co_await s2.read_some(
+                    capy::mutable_buffer(buf, sizeof(buf)));
+                if (ec)
+                    break;
+            }
+        };
+        capy::run_async(ex)(reader());
+        ioc.run();
+
+        BOOST_TEST(wait_done);
+        BOOST_TEST(!wait_ec);
+    }
+#endif
+
     // local_stream_socket wait_read fires when the peer writes.
     void testWaitOnLocalStream()
     {
@@ -323,6 +376,9 @@ struct wait_test
     {
         testWaitReadAndNoConsume();
         testWaitWriteImmediate();
+#if BOOST_COROSIO_POSIX
+        testWaitWriteParksWhenFull();
+#endif
         testWaitOnLocalStream();
         testCancellation();
         testAcceptorWait();